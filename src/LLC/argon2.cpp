@@ -13,11 +13,98 @@ ________________________________________________________________________________
 
 #include <LLC/include/argon2.h>
 
+#include <Util/include/args.h>
 #include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+
+#include <condition_variable>
+#include <thread>
 
 namespace LLC
 {
 
+    /* Mutex to protect the active derivation counter. */
+    std::mutex ARGON2_MUTEX;
+
+
+    /* Condition to wake threads waiting for a free derivation slot. */
+    std::condition_variable ARGON2_CONDITION;
+
+
+    /* The current number of argon2 computations in progress, not counting consensus signing. */
+    uint32_t nArgon2Active = 0;
+
+
+    /* The current number of consensus signing argon2 computations in progress. */
+    uint32_t nArgon2Priority = 0;
+
+
+    /* Flag for if the current thread is signing for consensus. */
+    thread_local bool fArgon2Priority = false;
+
+
+    /* Acquire a derivation slot, blocking while the limit is reached. */
+    Argon2Slot::Argon2Slot()
+    : fPriority (fArgon2Priority)
+    {
+        /* Default to half our cores so logins don't starve block processing. */
+        const uint32_t nLimit =
+            std::max(1u, uint32_t(config::GetArg("-argon2_threads", std::max(1u, std::thread::hardware_concurrency() / 2))));
+
+        /* Wait for a free slot, consensus signing only waits on its own. */
+        std::unique_lock<std::mutex> lk(ARGON2_MUTEX);
+        if(fPriority)
+        {
+            ARGON2_CONDITION.wait(lk, []{ return nArgon2Priority == 0; });
+            ++nArgon2Priority;
+        }
+        else
+        {
+            ARGON2_CONDITION.wait(lk, [nLimit]{ return nArgon2Active < nLimit; });
+            ++nArgon2Active;
+        }
+    }
+
+
+    /* Release our derivation slot and wake the waiting threads. */
+    Argon2Slot::~Argon2Slot()
+    {
+        {
+            LOCK(ARGON2_MUTEX);
+            if(fPriority)
+                --nArgon2Priority;
+            else
+                --nArgon2Active;
+        }
+
+        /* Wake every thread, as the next one waiting may be waiting on the other kind of slot. */
+        ARGON2_CONDITION.notify_all();
+    }
+
+
+    /* Mark the argon2 computations of the current thread as consensus signing. */
+    Argon2Priority::Argon2Priority()
+    : fPrevious (fArgon2Priority)
+    {
+        fArgon2Priority = true;
+    }
+
+
+    /* Restore the current thread. */
+    Argon2Priority::~Argon2Priority()
+    {
+        fArgon2Priority = fPrevious;
+    }
+
+
+    /* Get the number of argon2 computations currently in progress. */
+    uint32_t Argon2Active()
+    {
+        LOCK(ARGON2_MUTEX);
+        return nArgon2Active + nArgon2Priority;
+    }
+
+
 
     /* 256-bit hashing function */
     uint256_t Argon2_256(const std::vector<uint8_t>& vchData,
@@ -70,6 +157,7 @@ namespace LLC
         };
 
         /* Run the argon2 computation. */
+        const Argon2Slot tSlot;
         int32_t nRet = argon2id_ctx(&context);
         if(nRet != ARGON2_OK)
             throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
@@ -141,6 +229,7 @@ namespace LLC
         };
 
         /* Run the argon2 computation. */
+        const Argon2Slot tSlot;
         int32_t nRet = argon2id_ctx(&context);
         if(nRet != ARGON2_OK)
             throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
@@ -368,6 +368,32 @@ namespace LLC
 	}
 
 
+	/** SK512
+     *
+     *  512-bit hashing for a batch of messages of equal length stored back to back, such as the pairs of one
+     *  merkle tree level. Messages are hashed eight at a time in vector lanes.
+     *
+     *  @param[in] pData The first byte of the first message.
+     *  @param[in] nLength The length of each message in bytes.
+     *  @param[in] nCount The number of messages.
+     *  @param[out] pHashes The hashes, nCount of them in the same order as the messages.
+     *
+     **/
+	void SK512(const uint8_t* pData, const uint32_t nLength, const uint32_t nCount, uint512_t* pHashes);
+
+
+	/** SK512
+     *
+     *  512-bit hashing for a batch of independent messages, such as serialized transactions. Messages that take
+     *  the same number of skein blocks are hashed eight at a time in vector lanes. Bypasses the hash cache.
+     *
+     *  @param[in] vData The messages to hash.
+     *  @param[out] vHashes The hashes, in the same order as vData.
+     *
+     **/
+	void SK512(const std::vector<std::vector<uint8_t>>& vData, std::vector<uint512_t> &vHashes);
+
+
 	/** SK576
      *
      * 576-bit hashing template used for Private Keys.
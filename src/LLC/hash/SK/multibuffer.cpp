@@ -0,0 +1,419 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+
+#include <algorithm>
+#include <cstring>
+
+/* The kernels are written once over a generic eight lane vector type, and inlined into copies built for each ISA. */
+#if defined(__x86_64__) && defined(__GNUC__)
+#define SK_DISPATCH 1
+#endif
+
+namespace LLC
+{
+    namespace
+    {
+        /* Number of messages hashed side by side. */
+        const uint32_t SK_LANES = 8;
+
+
+        /* One 64-bit word from each message. This lowers to one zmm, two ymm or four xmm registers. */
+        typedef uint64_t lane_t __attribute__((vector_size(64)));
+
+
+        /* Function signature shared by every kernel build. */
+        typedef void (*sk512_kernel_t)(const uint8_t* const pData[SK_LANES], const uint32_t nLength[SK_LANES],
+                                       const uint32_t nBlocks, uint8_t* const pHash[SK_LANES]);
+
+
+        /* The Keccak-f[1600] round constants. */
+        const uint64_t KECCAK_ROUND[24] =
+        {
+            0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808aULL, 0x8000000080008000ULL,
+            0x000000000000808bULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+            0x000000000000008aULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000aULL,
+            0x000000008000808bULL, 0x800000000000008bULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+            0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800aULL, 0x800000008000000aULL,
+            0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+        };
+
+
+        /* The rho rotation for lane x + 5y. */
+        const uint32_t KECCAK_RHO[25] =
+        {
+             0,  1, 62, 28, 27,
+            36, 44,  6, 55, 20,
+             3, 10, 43, 25, 39,
+            41, 45, 15, 21,  8,
+            18,  2, 61, 56, 14
+        };
+
+
+        /* The pi destination y + 5((2x + 3y) mod 5) for lane x + 5y. */
+        const uint32_t KECCAK_PI[25] =
+        {
+             0, 10, 20,  5, 15,
+            16,  1, 11, 21,  6,
+             7, 17,  2, 12, 22,
+            23,  8, 18,  3, 13,
+            14, 24,  9, 19,  4
+        };
+
+
+        /* Rotate every lane left, a rotation of zero is handled by the mask. Macros rather than functions, as a
+         * vector return changes the ABI between the kernel builds. */
+        #define SK_ROTL(x, n)     (((x) << (n)) | ((x) >> ((64 - (n)) & 63)))
+
+
+        /* Broadcast a word to every lane. */
+        #define SK_BROADCAST(n)   (lane_t{ (n), (n), (n), (n), (n), (n), (n), (n) })
+
+
+        /* One threefish mix. */
+        #define SK_MIX(a, b, r)  X[a] += X[b]; X[b] = SK_ROTL(X[b], uint32_t(r)) ^ X[a];
+
+
+        /* Four threefish rounds with the word permutation of the reference implementation. */
+        #define SK_ROUNDS(R0, R1, R2, R3)                                                       \
+            SK_MIX(0, 1, R0##_0) SK_MIX(2, 3, R0##_1) SK_MIX(4, 5, R0##_2) SK_MIX(6, 7, R0##_3) \
+            SK_MIX(2, 1, R1##_0) SK_MIX(4, 7, R1##_1) SK_MIX(6, 5, R1##_2) SK_MIX(0, 3, R1##_3) \
+            SK_MIX(4, 1, R2##_0) SK_MIX(6, 3, R2##_1) SK_MIX(0, 5, R2##_2) SK_MIX(2, 7, R2##_3) \
+            SK_MIX(6, 1, R3##_0) SK_MIX(0, 7, R3##_1) SK_MIX(2, 5, R3##_2) SK_MIX(4, 3, R3##_3)
+
+
+        /* Inject subkey s into the state. */
+        __attribute__((always_inline)) inline void skein_inject(lane_t X[8], const lane_t ks[9], const lane_t ts[3], const uint32_t s)
+        {
+            X[0] += ks[(s + 0) % 9];
+            X[1] += ks[(s + 1) % 9];
+            X[2] += ks[(s + 2) % 9];
+            X[3] += ks[(s + 3) % 9];
+            X[4] += ks[(s + 4) % 9];
+            X[5] += ks[(s + 5) % 9] + ts[(s + 0) % 3];
+            X[6] += ks[(s + 6) % 9] + ts[(s + 1) % 3];
+            X[7] += ks[(s + 7) % 9] + SK_BROADCAST(s);
+        }
+
+
+        /* Process one Skein-512 block per lane, matching Skein_512_Process_Block. */
+        __attribute__((always_inline)) inline void skein_block(lane_t H[8], const lane_t w[8], const lane_t& t0, const uint64_t t1)
+        {
+            /* Build the key schedule from the chaining value. */
+            lane_t ks[9];
+            ks[8] = SK_BROADCAST(SKEIN_KS_PARITY);
+            for(uint32_t i = 0; i < 8; ++i)
+            {
+                ks[i]  = H[i];
+                ks[8] ^= H[i];
+            }
+
+            /* Build the tweak schedule. */
+            const lane_t ts[3] = { t0, SK_BROADCAST(t1), t0 ^ SK_BROADCAST(t1) };
+
+            /* The first key injection. */
+            lane_t X[8];
+            for(uint32_t i = 0; i < 8; ++i)
+                X[i] = w[i] + ks[i];
+
+            X[5] += ts[0];
+            X[6] += ts[1];
+
+            /* Run the 72 rounds, with a key injection after every fourth. */
+            for(uint32_t s = 1; s < SKEIN_512_ROUNDS_TOTAL / 4; s += 2)
+            {
+                SK_ROUNDS(R_512_0, R_512_1, R_512_2, R_512_3)
+                skein_inject(X, ks, ts, s);
+
+                SK_ROUNDS(R_512_4, R_512_5, R_512_6, R_512_7)
+                skein_inject(X, ks, ts, s + 1);
+            }
+
+            /* Feed forward the input block. */
+            for(uint32_t i = 0; i < 8; ++i)
+                H[i] = X[i] ^ w[i];
+        }
+
+
+        /* The Keccak-f[1600] permutation over every lane. */
+        __attribute__((always_inline)) inline void keccak_permute(lane_t A[25])
+        {
+            for(uint32_t nRound = 0; nRound < 24; ++nRound)
+            {
+                /* Theta. */
+                lane_t C[5];
+                for(uint32_t x = 0; x < 5; ++x)
+                    C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+
+                for(uint32_t x = 0; x < 5; ++x)
+                {
+                    const lane_t D = C[(x + 4) % 5] ^ SK_ROTL(C[(x + 1) % 5], 1);
+                    for(uint32_t y = 0; y < 25; y += 5)
+                        A[x + y] ^= D;
+                }
+
+                /* Rho and pi. */
+                lane_t B[25];
+                for(uint32_t i = 0; i < 25; ++i)
+                    B[KECCAK_PI[i]] = SK_ROTL(A[i], KECCAK_RHO[i]);
+
+                /* Chi. */
+                for(uint32_t y = 0; y < 25; y += 5)
+                    for(uint32_t x = 0; x < 5; ++x)
+                        A[x + y] = B[x + y] ^ (~B[(x + 1) % 5 + y] & B[(x + 2) % 5 + y]);
+
+                /* Iota. */
+                A[0] ^= SK_BROADCAST(KECCAK_ROUND[nRound]);
+            }
+        }
+
+
+        /* Hash one message per lane, every message spanning nBlocks skein blocks. */
+        __attribute__((always_inline)) inline void sk512_lanes(const uint8_t* const pData[SK_LANES], const uint32_t nLength[SK_LANES],
+                                                               const uint32_t nBlocks, uint8_t* const pHash[SK_LANES])
+        {
+            /* Get the chaining value Skein_512_Init starts from. */
+            Skein_512_Ctxt_t ctxSkein;
+            Skein_512_Init(&ctxSkein, 512);
+
+            lane_t H[8];
+            for(uint32_t i = 0; i < 8; ++i)
+                H[i] = SK_BROADCAST(ctxSkein.X[i]);
+
+            /* Process the message blocks, the last one is zero padded and flagged final. */
+            lane_t t0 = SK_BROADCAST(0);
+            for(uint32_t nBlock = 0; nBlock < nBlocks; ++nBlock)
+            {
+                const bool fFinal = (nBlock + 1 == nBlocks);
+
+                /* Gather the block of each lane. */
+                uint64_t nWords[8][SK_LANES];
+                uint64_t nAdd[SK_LANES];
+                for(uint32_t nLane = 0; nLane < SK_LANES; ++nLane)
+                {
+                    const uint32_t nOffset = nBlock * SKEIN_512_BLOCK_BYTES;
+                    const uint32_t nBytes  = fFinal ? (nLength[nLane] - nOffset) : SKEIN_512_BLOCK_BYTES;
+
+                    uint64_t nBlockWords[8] = { 0 };
+                    if(nBytes > 0)
+                        std::memcpy(nBlockWords, pData[nLane] + nOffset, nBytes);
+
+                    for(uint32_t i = 0; i < 8; ++i)
+                        nWords[i][nLane] = nBlockWords[i];
+
+                    nAdd[nLane] = nBytes;
+                }
+
+                lane_t w[8];
+                for(uint32_t i = 0; i < 8; ++i)
+                    std::memcpy(&w[i], nWords[i], sizeof(lane_t));
+
+                lane_t add;
+                std::memcpy(&add, nAdd, sizeof(lane_t));
+                t0 += add;
+
+                /* The tweak flags only depend on the block position, which every lane shares. */
+                const uint64_t t1 = SKEIN_T1_BLK_TYPE_MSG | (nBlock == 0 ? SKEIN_T1_FLAG_FIRST : 0) | (fFinal ? SKEIN_T1_FLAG_FINAL : 0);
+                skein_block(H, w, t0, t1);
+            }
+
+            /* Run the output stage with a zero counter block. */
+            const lane_t wZero[8] = { };
+            skein_block(H, wZero, SK_BROADCAST(8), SKEIN_T1_FLAG_FIRST | SKEIN_T1_BLK_TYPE_OUT_FINAL);
+
+            /* Absorb the 64-byte skein hash into SHA3-512, padding lands inside the 72-byte rate. */
+            lane_t A[25] = { };
+            for(uint32_t i = 0; i < 8; ++i)
+                A[i] = H[i];
+
+            A[8] = SK_BROADCAST(0x06 | (0x80ULL << 56));
+            keccak_permute(A);
+
+            /* Scatter the digests. */
+            uint64_t nOut[8][SK_LANES];
+            for(uint32_t i = 0; i < 8; ++i)
+                std::memcpy(nOut[i], &A[i], sizeof(lane_t));
+
+            for(uint32_t nLane = 0; nLane < SK_LANES; ++nLane)
+                for(uint32_t i = 0; i < 8; ++i)
+                    std::memcpy(pHash[nLane] + (i * 8), &nOut[i][nLane], 8);
+        }
+
+
+        /* Baseline build of the kernel. */
+        void sk512_generic(const uint8_t* const pData[SK_LANES], const uint32_t nLength[SK_LANES],
+                           const uint32_t nBlocks, uint8_t* const pHash[SK_LANES])
+        {
+            sk512_lanes(pData, nLength, nBlocks, pHash);
+        }
+
+
+    #ifdef SK_DISPATCH
+
+        /* AVX2 build of the kernel. */
+        __attribute__((target("avx2")))
+        void sk512_avx2(const uint8_t* const pData[SK_LANES], const uint32_t nLength[SK_LANES],
+                        const uint32_t nBlocks, uint8_t* const pHash[SK_LANES])
+        {
+            sk512_lanes(pData, nLength, nBlocks, pHash);
+        }
+
+
+        /* AVX-512 build of the kernel. */
+        __attribute__((target("avx512f")))
+        void sk512_avx512(const uint8_t* const pData[SK_LANES], const uint32_t nLength[SK_LANES],
+                          const uint32_t nBlocks, uint8_t* const pHash[SK_LANES])
+        {
+            sk512_lanes(pData, nLength, nBlocks, pHash);
+        }
+
+    #endif
+
+
+        /* Select the widest kernel this CPU supports. */
+        sk512_kernel_t sk512_select()
+        {
+        #ifdef SK_DISPATCH
+            __builtin_cpu_init();
+            if(__builtin_cpu_supports("avx512f"))
+                return &sk512_avx512;
+
+            if(__builtin_cpu_supports("avx2"))
+                return &sk512_avx2;
+        #endif
+
+            return &sk512_generic;
+        }
+
+
+        /* Number of skein blocks a message of given length is processed in. */
+        uint32_t sk512_blocks(const uint32_t nLength)
+        {
+            return std::max(1u, (nLength + SKEIN_512_BLOCK_BYTES - 1) / SKEIN_512_BLOCK_BYTES);
+        }
+
+
+        /* Hash a single message with the reference implementation. */
+        void sk512_single(const uint8_t* pData, const uint32_t nLength, uint8_t* pHash)
+        {
+            uint512_t hashSkein;
+            Skein_512_Ctxt_t ctxSkein;
+            Skein_512_Init  (&ctxSkein, 512);
+            Skein_512_Update(&ctxSkein, (nLength == 0 ? pblank : pData), nLength);
+            Skein_512_Final (&ctxSkein, (uint8_t *)&hashSkein);
+
+            Keccak_HashInstance ctxKeccak;
+            Keccak_HashInitialize_SHA3_512(&ctxKeccak);
+            Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 512);
+            Keccak_HashFinal(&ctxKeccak, pHash);
+        }
+
+
+        /* Hash a group of messages with equal block counts, short groups fill the spare lanes with the first message. */
+        void sk512_group(const uint8_t* const pData[], const uint32_t nLength[], uint8_t* const pHash[], const uint32_t nCount)
+        {
+            static const sk512_kernel_t pKernel = sk512_select();
+
+            /* A pass costs a few single hashes, so one or two messages are cheaper on the reference code. */
+            if(nCount < 3)
+            {
+                for(uint32_t n = 0; n < nCount; ++n)
+                    sk512_single(pData[n], nLength[n], pHash[n]);
+
+                return;
+            }
+
+            /* Pad out the lanes. */
+            uint8_t vSpare[SK_LANES][64];
+
+            const uint8_t* pLaneData[SK_LANES];
+            uint32_t       nLaneLength[SK_LANES];
+            uint8_t*       pLaneHash[SK_LANES];
+            for(uint32_t nLane = 0; nLane < SK_LANES; ++nLane)
+            {
+                const bool fUsed = (nLane < nCount);
+
+                pLaneData[nLane]   = fUsed ? pData[nLane]   : pData[0];
+                nLaneLength[nLane] = fUsed ? nLength[nLane] : nLength[0];
+                pLaneHash[nLane]   = fUsed ? pHash[nLane]   : vSpare[nLane];
+            }
+
+            pKernel(pLaneData, nLaneLength, sk512_blocks(nLength[0]), pLaneHash);
+        }
+    }
+
+
+    /* 512-bit hashing for a batch of messages stored back to back. */
+    void SK512(const uint8_t* pData, const uint32_t nLength, const uint32_t nCount, uint512_t* pHashes)
+    {
+        for(uint32_t nIndex = 0; nIndex < nCount; nIndex += SK_LANES)
+        {
+            const uint32_t nTotal = std::min(SK_LANES, nCount - nIndex);
+
+            const uint8_t* pGroupData[SK_LANES];
+            uint32_t       nGroupLength[SK_LANES];
+            uint8_t*       pGroupHash[SK_LANES];
+            for(uint32_t n = 0; n < nTotal; ++n)
+            {
+                pGroupData[n]   = pData + uint64_t(nIndex + n) * nLength;
+                nGroupLength[n] = nLength;
+                pGroupHash[n]   = (uint8_t *)&pHashes[nIndex + n];
+            }
+
+            sk512_group(pGroupData, nGroupLength, pGroupHash, nTotal);
+        }
+    }
+
+
+    /* 512-bit hashing for a batch of independent messages. */
+    void SK512(const std::vector<std::vector<uint8_t>>& vData, std::vector<uint512_t> &vHashes)
+    {
+        vHashes.resize(vData.size());
+
+        /* Order the messages by block count so that lanes are filled with messages of equal work. */
+        std::vector<uint32_t> vOrder(vData.size());
+        for(uint32_t n = 0; n < vOrder.size(); ++n)
+            vOrder[n] = n;
+
+        std::stable_sort(vOrder.begin(), vOrder.end(), [&vData](const uint32_t a, const uint32_t b)
+        {
+            return sk512_blocks(vData[a].size()) < sk512_blocks(vData[b].size());
+        });
+
+        /* Hash each run of equal block counts in groups of lanes. */
+        uint32_t nIndex = 0;
+        while(nIndex < vOrder.size())
+        {
+            const uint32_t nBlocks = sk512_blocks(vData[vOrder[nIndex]].size());
+
+            const uint8_t* pGroupData[SK_LANES];
+            uint32_t       nGroupLength[SK_LANES];
+            uint8_t*       pGroupHash[SK_LANES];
+
+            uint32_t nTotal = 0;
+            while(nTotal < SK_LANES && nIndex < vOrder.size() && sk512_blocks(vData[vOrder[nIndex]].size()) == nBlocks)
+            {
+                const uint32_t nMessage = vOrder[nIndex++];
+
+                pGroupData[nTotal]   = vData[nMessage].data();
+                nGroupLength[nTotal] = static_cast<uint32_t>(vData[nMessage].size());
+                pGroupHash[nTotal]   = (uint8_t *)&vHashes[nMessage];
+
+                ++nTotal;
+            }
+
+            sk512_group(pGroupData, nGroupLength, pGroupHash, nTotal);
+        }
+    }
+}
@@ -20,6 +20,70 @@ ________________________________________________________________________________
 namespace LLC
 {
 
+	/** Argon2Slot
+	 *
+	 * Scoped guard that bounds the number of concurrent argon2 computations to -argon2_threads.
+	 * Each computation is single-laned, so this caps the cores and memory that logins can consume.
+	 *
+	 **/
+	class Argon2Slot
+	{
+		/** Flag for if this is the reserved slot of a consensus signing computation. **/
+		const bool fPriority;
+
+	public:
+
+		/** Default Constructor. Blocks until a slot is available. **/
+		Argon2Slot();
+
+
+		/** Destructor. Releases the slot. **/
+		~Argon2Slot();
+
+
+		/** Deleted copy and assignment. **/
+		Argon2Slot(const Argon2Slot&) = delete;
+		Argon2Slot& operator=(const Argon2Slot&) = delete;
+	};
+
+
+	/** Argon2Priority
+	 *
+	 * Scoped guard that marks the argon2 computations of the current thread as consensus signing.
+	 * These use a slot reserved for them, so producing blocks never waits behind queued logins.
+	 *
+	 **/
+	class Argon2Priority
+	{
+		/** The previous state of the current thread, for nested guards. **/
+		const bool fPrevious;
+
+	public:
+
+		/** Default Constructor. Marks the current thread. **/
+		Argon2Priority();
+
+
+		/** Destructor. Restores the current thread. **/
+		~Argon2Priority();
+
+
+		/** Deleted copy and assignment. **/
+		Argon2Priority(const Argon2Priority&) = delete;
+		Argon2Priority& operator=(const Argon2Priority&) = delete;
+	};
+
+
+	/** Argon2Active
+	 *
+	 * Get the number of argon2 computations currently in progress.
+	 *
+	 * @return The active computation count.
+	 *
+	 **/
+	uint32_t Argon2Active();
+
+
 	/** Argon2_256
 	 *
 	 * 256-bit version of argon2 hashing function.
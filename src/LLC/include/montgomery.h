@@ -0,0 +1,53 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_INCLUDE_MONTGOMERY_H
+#define NEXUS_LLC_INCLUDE_MONTGOMERY_H
+
+#include <LLC/types/uint1024.h>
+
+#include <vector>
+
+/** Namespace LLC (Lower Level Crypto) **/
+namespace LLC
+{
+
+    /** FermatTest
+     *
+     *  Calculates the base 2 fermat remainder 2^(p-1) mod p. A single number can't fill the vector lanes of the
+     *  batched kernel, so this goes through OpenSSL's montgomery exponentiation.
+     *
+     *  @param[in] hashTest The number to test.
+     *
+     *  @return The remainder of the fermat test.
+     *
+     **/
+    uint1024_t FermatTest(const uint1024_t& hashTest);
+
+
+    /** FermatTest
+     *
+     *  Calculates the base 2 fermat remainders for a batch of numbers in one call, such as every offset in a
+     *  prime cluster. Odd numbers are tested eight at a time with an AVX-512 IFMA montgomery kernel over 52-bit
+     *  digits when the CPU supports it, anything else falls back to OpenSSL.
+     *
+     *  @param[in] vTest The numbers to test.
+     *  @param[out] vResults The remainders, in the same order as vTest.
+     *
+     **/
+    void FermatTest(const std::vector<uint1024_t>& vTest, std::vector<uint1024_t> &vResults);
+
+}
+
+#endif
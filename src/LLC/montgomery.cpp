@@ -0,0 +1,388 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/montgomery.h>
+#include <LLC/types/bignum.h>
+
+#include <openssl/bn.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define MONTGOMERY_IFMA
+#include <immintrin.h>
+#endif
+
+namespace LLC
+{
+
+    /* The number of 64-bit limbs in a 1024-bit number. */
+    const uint32_t LIMBS  = 16;
+
+
+    /* The number of 52-bit digits used by the IFMA kernel, giving R = 2^1040 > 4N. */
+    const uint32_t DIGITS = 20;
+
+
+    /* The number of numbers tested side by side, one per 64-bit vector lane. */
+    const uint32_t LANES  = 8;
+
+
+    /* Mask for a single 52-bit digit. */
+    const uint64_t MASK52 = (uint64_t(1) << 52) - 1;
+
+
+    /* Calculate 2^(p-1) mod p through OpenSSL. */
+    uint1024_t fermat_bignum(const uint1024_t& hashTest)
+    {
+        CAutoBN_CTX pctx;
+
+        CBigNum bnPrime(hashTest);
+        CBigNum bnBase(2);
+        CBigNum bnExp = bnPrime - 1;
+
+        CBigNum bnResult;
+        BN_mod_exp(bnResult.getBN(), bnBase.getBN(), bnExp.getBN(), bnPrime.getBN(), pctx);
+
+        return bnResult.getuint1024();
+    }
+
+
+#if defined(MONTGOMERY_IFMA)
+
+    /* Calculate -n^-1 mod 2^64 by newton iteration, n must be odd. */
+    inline uint64_t inverse_limb(const uint64_t n)
+    {
+        uint64_t x = n; //correct to 3 bits for odd n
+        for(uint32_t i = 0; i < 5; ++i)
+            x *= 2 - n * x;
+
+        return (~x) + 1;
+    }
+
+
+    /* Check if x >= n, treating both as little endian limb arrays. */
+    inline bool greater_equal(const uint64_t* x, const uint64_t* n)
+    {
+        for(int32_t i = LIMBS - 1; i >= 0; --i)
+        {
+            if(x[i] != n[i])
+                return x[i] > n[i];
+        }
+
+        return true;
+    }
+
+
+    /* Set x = x - n, ignoring the final borrow. */
+    inline void subtract(uint64_t* x, const uint64_t* n)
+    {
+        uint64_t nBorrow = 0;
+        for(uint32_t i = 0; i < LIMBS; ++i)
+        {
+            const uint64_t nDiff = x[i] - n[i] - nBorrow;
+
+            nBorrow = (x[i] < n[i] || (x[i] == n[i] && nBorrow)) ? 1 : 0;
+            x[i]    = nDiff;
+        }
+    }
+
+
+    /* Set x = 2x mod n, where x < n. */
+    inline void double_mod(uint64_t* x, const uint64_t* n)
+    {
+        /* Shift left by one, keeping our carry bit. */
+        const uint64_t nCarry = x[LIMBS - 1] >> 63;
+        for(uint32_t i = LIMBS - 1; i > 0; --i)
+            x[i] = (x[i] << 1) | (x[i - 1] >> 63);
+
+        x[0] <<= 1;
+
+        /* Reduce if we overflowed 1024 bits or are above our modulus. */
+        if(nCarry || greater_equal(x, n))
+            subtract(x, n);
+    }
+
+
+    /* Split 64-bit limbs into 52-bit digits. */
+    inline void to_digits(uint64_t* d, const uint64_t* x)
+    {
+        for(uint32_t k = 0; k < DIGITS; ++k)
+        {
+            const uint32_t nBit  = k * 52;
+            const uint32_t nWord = nBit >> 6;
+            const uint32_t nOff  = nBit & 63;
+
+            uint64_t nDigit = x[nWord] >> nOff;
+            if(nOff > 12 && nWord + 1 < LIMBS)
+                nDigit |= x[nWord + 1] << (64 - nOff);
+
+            d[k] = nDigit & MASK52;
+        }
+    }
+
+
+    /* Join 52-bit digits back into 64-bit limbs, dropping anything above 1024 bits. */
+    inline void from_digits(uint64_t* x, const uint64_t* d)
+    {
+        std::fill(x, x + LIMBS, 0);
+        for(uint32_t k = 0; k < DIGITS; ++k)
+        {
+            const uint32_t nBit  = k * 52;
+            const uint32_t nWord = nBit >> 6;
+            const uint32_t nOff  = nBit & 63;
+
+            x[nWord] |= d[k] << nOff;
+            if(nOff > 12 && nWord + 1 < LIMBS)
+                x[nWord + 1] |= d[k] >> (64 - nOff);
+        }
+    }
+
+
+    /* Get what each digit carries above 52 bits. The zeroing form is the same shift over every lane, without reading
+     * the undefined vector the plain form passes through, which GCC warns is uninitialized. */
+    __attribute__((target("avx512f")))
+    inline __m512i carry(const __m512i x)
+    {
+        return _mm512_maskz_srli_epi64(0xFF, x, 52);
+    }
+
+
+    /* Propagate carries so every digit is below 2^52 again. */
+    __attribute__((target("avx512f,avx512ifma")))
+    inline void normalize(__m512i* x)
+    {
+        const __m512i vMask = _mm512_set1_epi64(MASK52);
+        for(uint32_t j = 0; j < DIGITS - 1; ++j)
+        {
+            x[j + 1] = _mm512_add_epi64(x[j + 1], carry(x[j]));
+            x[j]     = _mm512_and_si512(x[j], vMask);
+        }
+    }
+
+
+    /* Almost montgomery product z = x * y * R^-1 mod n for eight numbers at once. Inputs below 4n give outputs below 2n. */
+    __attribute__((target("avx512f,avx512ifma")))
+    inline void mulredc(__m512i* z, const __m512i* x, const __m512i* y, const __m512i* n, const __m512i k)
+    {
+        const __m512i vZero = _mm512_setzero_si512();
+
+        /* Digits are accumulated unnormalized, 64-bit lanes leave headroom for every partial product. */
+        __m512i t[DIGITS + 1];
+        for(uint32_t j = 0; j <= DIGITS; ++j)
+            t[j] = vZero;
+
+        for(uint32_t i = 0; i < DIGITS; ++i)
+        {
+            /* Multiply step: t += x * y[i] */
+            for(uint32_t j = 0; j < DIGITS; ++j)
+            {
+                t[j]     = _mm512_madd52lo_epu64(t[j],     x[j], y[i]);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], x[j], y[i]);
+            }
+
+            /* Reduce step: t += m * n, clearing our lowest digit. */
+            const __m512i m = _mm512_madd52lo_epu64(vZero, t[0], k);
+            for(uint32_t j = 0; j < DIGITS; ++j)
+            {
+                t[j]     = _mm512_madd52lo_epu64(t[j],     n[j], m);
+                t[j + 1] = _mm512_madd52hi_epu64(t[j + 1], n[j], m);
+            }
+
+            /* Shift down a digit, carrying what is left of our lowest. */
+            t[1] = _mm512_add_epi64(t[1], carry(t[0]));
+            for(uint32_t j = 0; j < DIGITS; ++j)
+                t[j] = t[j + 1];
+
+            t[DIGITS] = vZero;
+        }
+
+        std::copy(t, t + DIGITS, z);
+        normalize(z);
+    }
+
+
+    /* Calculate 2^(n-1) mod n for eight odd moduli side by side using AVX-512 IFMA. */
+    __attribute__((target("avx512f,avx512ifma")))
+    void fermat_ifma(uint64_t r[LANES][LIMBS], const uint64_t n[LANES][LIMBS])
+    {
+        uint64_t vBuffer[DIGITS][LANES];
+        uint64_t vDigits[DIGITS];
+
+        /* Load our moduli and our starting values of R mod n, the montgomery form of one. */
+        uint64_t vInverse[LANES];
+        for(uint32_t l = 0; l < LANES; ++l)
+        {
+            to_digits(vDigits, n[l]);
+            for(uint32_t k = 0; k < DIGITS; ++k)
+                vBuffer[k][l] = vDigits[k];
+
+            vInverse[l] = inverse_limb(n[l][0]) & MASK52;
+        }
+
+        __m512i vN[DIGITS];
+        for(uint32_t k = 0; k < DIGITS; ++k)
+            vN[k] = _mm512_loadu_si512(vBuffer[k]);
+
+        for(uint32_t l = 0; l < LANES; ++l)
+        {
+            uint64_t x[LIMBS] = { 0 };
+            x[0] = 1;
+            if(greater_equal(x, n[l]))
+                x[0] = 0;
+
+            for(uint32_t i = 0; i < DIGITS * 52; ++i)
+                double_mod(x, n[l]);
+
+            to_digits(vDigits, x);
+            for(uint32_t k = 0; k < DIGITS; ++k)
+                vBuffer[k][l] = vDigits[k];
+        }
+
+        __m512i vX[DIGITS];
+        for(uint32_t k = 0; k < DIGITS; ++k)
+            vX[k] = _mm512_loadu_si512(vBuffer[k]);
+
+        const __m512i vK = _mm512_loadu_si512(vInverse);
+
+        /* Skip the leading zero bits shared by every lane. */
+        int32_t nTop = LIMBS * 64 - 1;
+        while(nTop > 0)
+        {
+            bool fSet = false;
+            for(uint32_t l = 0; l < LANES; ++l)
+                fSet |= ((n[l][nTop >> 6] >> (nTop & 63)) & 1);
+
+            if(fSet)
+                break;
+
+            --nTop;
+        }
+
+        /* Left to right square and multiply, where multiplying by our base of 2 is a per lane doubling. */
+        for(int32_t i = nTop; i >= 0; --i)
+        {
+            mulredc(vX, vX, vX, vN, vK);
+
+            /* Exponent is n - 1, which for odd n only clears the lowest bit. */
+            __mmask8 nDouble = 0;
+            if(i > 0)
+            {
+                for(uint32_t l = 0; l < LANES; ++l)
+                    nDouble |= ((n[l][i >> 6] >> (i & 63)) & 1) << l;
+            }
+
+            if(nDouble)
+            {
+                for(uint32_t k = 0; k < DIGITS; ++k)
+                    vX[k] = _mm512_mask_add_epi64(vX[k], nDouble, vX[k], vX[k]);
+
+                normalize(vX);
+            }
+        }
+
+        /* Convert out of montgomery form. */
+        __m512i vOne[DIGITS];
+        for(uint32_t k = 0; k < DIGITS; ++k)
+            vOne[k] = _mm512_setzero_si512();
+
+        vOne[0] = _mm512_set1_epi64(1);
+        mulredc(vX, vX, vOne, vN, vK);
+
+        /* Unpack each lane and fully reduce below n. */
+        for(uint32_t k = 0; k < DIGITS; ++k)
+            _mm512_storeu_si512(vBuffer[k], vX[k]);
+
+        for(uint32_t l = 0; l < LANES; ++l)
+        {
+            for(uint32_t k = 0; k < DIGITS; ++k)
+                vDigits[k] = vBuffer[k][l];
+
+            from_digits(r[l], vDigits);
+            if(greater_equal(r[l], n[l]))
+                subtract(r[l], n[l]);
+        }
+    }
+
+
+    /* Check that both our CPU and OS support the IFMA kernel. */
+    bool supports_ifma()
+    {
+        static const bool fSupported =
+            __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+
+        return fSupported;
+    }
+
+#endif
+
+
+    /* Calculates the base 2 fermat remainder 2^(p-1) mod p. */
+    uint1024_t FermatTest(const uint1024_t& hashTest)
+    {
+        return fermat_bignum(hashTest);
+    }
+
+
+    /* Calculates the base 2 fermat remainders for a batch of numbers in one call. */
+    void FermatTest(const std::vector<uint1024_t>& vTest, std::vector<uint1024_t> &vResults)
+    {
+        vResults.resize(vTest.size());
+
+#if defined(MONTGOMERY_IFMA)
+
+        /* Montgomery reduction requires an odd modulus, the rest go through OpenSSL. */
+        std::vector<uint32_t> vOdd;
+        for(uint32_t n = 0; n < vTest.size(); ++n)
+        {
+            if(vTest[n].Get64(0) & 1)
+                vOdd.push_back(n);
+            else
+                vResults[n] = fermat_bignum(vTest[n]);
+        }
+
+        /* A single number doesn't fill enough lanes to beat OpenSSL. */
+        if(vOdd.size() < 2 || !supports_ifma())
+        {
+            for(const auto& n : vOdd)
+                vResults[n] = fermat_bignum(vTest[n]);
+
+            return;
+        }
+
+        /* Run our kernel over groups of eight, padding the last group with its first number. */
+        uint64_t n[LANES][LIMBS];
+        uint64_t r[LANES][LIMBS];
+        for(uint32_t nGroup = 0; nGroup < vOdd.size(); nGroup += LANES)
+        {
+            for(uint32_t l = 0; l < LANES; ++l)
+            {
+                const uint32_t nIndex = vOdd[(nGroup + l < vOdd.size()) ? nGroup + l : nGroup];
+                std::memcpy(n[l], vTest[nIndex].begin(), sizeof(n[l]));
+            }
+
+            fermat_ifma(r, n);
+
+            for(uint32_t l = 0; l < LANES && nGroup + l < vOdd.size(); ++l)
+                std::memcpy(vResults[vOdd[nGroup + l]].begin(), r[l], sizeof(r[l]));
+        }
+
+#else
+
+        for(uint32_t n = 0; n < vTest.size(); ++n)
+            vResults[n] = fermat_bignum(vTest[n]);
+
+#endif
+    }
+}
@@ -143,7 +143,7 @@ inline void sqrredc(uint32_t *z, uint32_t *x, uint32_t *n, const uint32_t d, uin
 {
     uint64_t prod;
     uint32_t m;
-    uint32_t c;
+    uint32_t c = 0;
 
     uint8_t i;
     uint8_t j;
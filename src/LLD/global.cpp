@@ -467,5 +467,102 @@ namespace LLD
         /* Abort the legacy DB transaction. */
         if(Legacy && (nInstances & INSTANCES::LEGACY))
             Legacy->TxnRelease();
+
+        /* Discard any undo journals captured under the aborted transaction. */
+        UndoRelease(nInstances);
+    }
+
+
+    /* Get the consensus instances that are open, by instance. */
+    std::map<uint16_t, SectorDatabase<BinaryHashMap, BinaryLRU>*> Instances(const uint16_t nInstances)
+    {
+        std::map<uint16_t, SectorDatabase<BinaryHashMap, BinaryLRU>*> mapInstances;
+
+        /* Add the contract DB. */
+        if(Contract && (nInstances & INSTANCES::CONTRACT))
+            mapInstances[INSTANCES::CONTRACT] = Contract;
+
+        /* Add the register DB. */
+        if(Register && (nInstances & INSTANCES::REGISTER))
+            mapInstances[INSTANCES::REGISTER] = Register;
+
+        /* Add the ledger DB. */
+        if(Ledger && (nInstances & INSTANCES::LEDGER))
+            mapInstances[INSTANCES::LEDGER] = Ledger;
+
+        /* Add the trust DB. */
+        if(Trust && (nInstances & INSTANCES::TRUST))
+            mapInstances[INSTANCES::TRUST] = Trust;
+
+        /* Add the legacy DB. */
+        if(Legacy && (nInstances & INSTANCES::LEGACY))
+            mapInstances[INSTANCES::LEGACY] = Legacy;
+
+        return mapInstances;
+    }
+
+
+    /* Start capturing the pre-images of keys the calling thread modifies. */
+    void UndoBegin(const uint16_t nInstances)
+    {
+        for(const auto& pair : Instances(nInstances))
+            pair.second->UndoBegin();
+    }
+
+
+    /* Stop capturing pre-images in the given instances. */
+    bool UndoEnd(std::map<uint16_t, SectorUndo> &mapUndo, const uint16_t nInstances)
+    {
+        /* Collect every journal, even once one is incomplete, so none are left capturing. */
+        bool fComplete = true;
+        for(const auto& pair : Instances(nInstances))
+        {
+            SectorUndo undo;
+            if(!pair.second->UndoEnd(undo))
+                fComplete = false;
+
+            /* Only keep journals with something to put back. */
+            if(!undo.vPreimages.empty())
+                mapUndo[pair.first] = std::move(undo);
+        }
+
+        return fComplete;
+    }
+
+
+    /* Stop capturing pre-images, discarding what was captured. */
+    void UndoRelease(const uint16_t nInstances)
+    {
+        for(const auto& pair : Instances(nInstances))
+            pair.second->UndoRelease();
+    }
+
+
+    /* Put back the pre-images of undo journals into their instances. */
+    bool UndoApply(const std::map<uint16_t, SectorUndo>& mapUndo)
+    {
+        /* Check that every instance journaled is available first. */
+        const std::map<uint16_t, SectorDatabase<BinaryHashMap, BinaryLRU>*> mapInstances = Instances(INSTANCES::CONSENSUS);
+        for(const auto& pair : mapUndo)
+            if(!mapInstances.count(pair.first))
+                return debug::error(FUNCTION, "no instance for undo journal ", pair.first);
+
+        /* Apply the journals. */
+        for(const auto& pair : mapUndo)
+        {
+            /* Registers go through their database to clear their memory states. */
+            if(pair.first == INSTANCES::REGISTER)
+            {
+                if(!Register->UndoApply(pair.second))
+                    return false;
+
+                continue;
+            }
+
+            if(!mapInstances.at(pair.first)->UndoApply(pair.second))
+                return false;
+        }
+
+        return true;
     }
 }
@@ -21,6 +21,7 @@ ________________________________________________________________________________
 #include <Util/include/debug.h>
 #include <Util/include/hex.h>
 
+#include <algorithm>
 #include <iomanip>
 
 namespace LLD
@@ -155,6 +156,13 @@ namespace LLD
     }
 
 
+    /* Get the total buckets allocated in the hashmap. */
+    uint32_t BinaryHashMap::Buckets() const
+    {
+        return HASHMAP_TOTAL_BUCKETS;
+    }
+
+
     /* Read a key index from the disk hashmaps. */
     void BinaryHashMap::Initialize()
     {
@@ -523,6 +531,192 @@ namespace LLD
     }
 
 
+    /* Read every key in a range of buckets from the disk hashmaps. */
+    bool BinaryHashMap::Scan(const uint32_t nBegin, const uint32_t nEnd, std::vector< std::pair<uint32_t, SectorKey> > &vKeys)
+    {
+        LOCK(KEY_MUTEX);
+
+        /* Check that the range is within our buckets. */
+        if(nBegin > nEnd || nEnd > HASHMAP_TOTAL_BUCKETS)
+            return debug::error(FUNCTION, "bucket range ", nBegin, "-", nEnd, " out of bounds");
+
+        /* Find the most files any bucket in the range links through. */
+        uint16_t nFiles = 0;
+        for(uint32_t nBucket = nBegin; nBucket < nEnd; ++nBucket)
+            nFiles = std::max(nFiles, hashmap[nBucket]);
+
+        /* Read the range from the most recent file first, so a key found twice keeps its newest entry. */
+        std::vector< std::pair<uint32_t, SectorKey> > vRange;
+        std::vector<uint8_t> vRead((nEnd - nBegin) * HASHMAP_KEY_ALLOCATION, 0);
+        for(int16_t i = nFiles - 1; i >= 0; --i)
+        {
+            /* Find the file stream for LRU cache. */
+            std::fstream* pstream;
+            if(!fileCache->Get(i, pstream))
+            {
+                std::string filename = debug::safe_printstr(strBaseLocation, "_hashmap.", std::setfill('0'), std::setw(5), i);
+
+                /* Set the new stream pointer. */
+                pstream = new std::fstream(filename, std::ios::in | std::ios::out | std::ios::binary);
+                if(!pstream->is_open())
+                {
+                    delete pstream;
+                    return debug::error(FUNCTION, "couldn't open hashmap object at: ",
+                        filename, " (", strerror(errno), ")");
+                }
+
+                /* If file not found add to LRU cache. */
+                fileCache->Put(i, pstream);
+            }
+
+            /* Check that file is open. */
+            if(!pstream->is_open())
+                pstream->open(debug::safe_printstr(strBaseLocation, "_hashmap.", std::setfill('0'), std::setw(5), i), std::ios::in | std::ios::out | std::ios::binary);
+
+            /* Read the whole range of buckets in one sequential read. */
+            pstream->seekg(nBegin * HASHMAP_KEY_ALLOCATION, std::ios::beg);
+            if(!pstream->read((char*) &vRead[0], vRead.size()))
+                return debug::error(FUNCTION, "only ", pstream->gcount(), "/", vRead.size(), " bytes read");
+
+            /* Deserialize the keys of buckets that link through this file. */
+            for(uint32_t nBucket = nBegin; nBucket < nEnd; ++nBucket)
+            {
+                if(i >= hashmap[nBucket])
+                    continue;
+
+                /* Get the bucket binary data. */
+                const auto itBucket = vRead.begin() + (nBucket - nBegin) * HASHMAP_KEY_ALLOCATION;
+                const std::vector<uint8_t> vBucket(itBucket, itBucket + HASHMAP_KEY_ALLOCATION);
+
+                /* Deserialize the key and skip any that aren't ready. */
+                DataStream ssKey(vBucket, SER_LLD, DATABASE_VERSION);
+                SectorKey cKey;
+                ssKey >> cKey;
+
+                if(!cKey.Ready())
+                    continue;
+
+                /* Set the key as it is stored, keeping the length it had before compression. */
+                const uint16_t nSize = std::min(cKey.nLength, HASHMAP_MAX_KEY_SIZE);
+                cKey.vKey.assign(vBucket.begin() + 13, vBucket.begin() + 13 + nSize);
+
+                vRange.emplace_back(nBucket, std::move(cKey));
+            }
+        }
+
+        /* Order by bucket and key, keeping the newest entry of keys found twice. */
+        std::stable_sort(vRange.begin(), vRange.end(),
+            [](const std::pair<uint32_t, SectorKey>& a, const std::pair<uint32_t, SectorKey>& b)
+            {
+                if(a.first != b.first)
+                    return a.first < b.first;
+
+                return a.second.vKey < b.second.vKey;
+            });
+
+        for(auto& tKey : vRange)
+        {
+            /* Skip older entries of the same key. */
+            if(vKeys.size() > 0 && vKeys.back().first == tKey.first && vKeys.back().second.vKey == tKey.second.vKey)
+                continue;
+
+            vKeys.push_back(std::move(tKey));
+        }
+
+        return true;
+    }
+
+
+    /* Append keys as they are stored to their buckets without checking for existing keys. */
+    bool BinaryHashMap::Insert(const std::vector< std::pair<uint32_t, SectorKey> >& vKeys)
+    {
+        LOCK(KEY_MUTEX);
+
+        for(const auto& tKey : vKeys)
+        {
+            const uint32_t nBucket  = tKey.first;
+            const SectorKey& cKey   = tKey.second;
+
+            /* Check that the key fits in our buckets as it is stored. */
+            if(nBucket >= HASHMAP_TOTAL_BUCKETS || cKey.vKey.size() > HASHMAP_MAX_KEY_SIZE)
+                return debug::error(FUNCTION, "key out of bounds for bucket ", nBucket);
+
+            /* Create a new disk hashmap object in linked list if it doesn't exist. */
+            std::string file = debug::safe_printstr(strBaseLocation, "_hashmap.", std::setfill('0'), std::setw(5), hashmap[nBucket]);
+            if(!filesystem::exists(file))
+            {
+                /* Blank vector to write empty space in new disk file. */
+                std::vector<uint8_t> vSpace(HASHMAP_KEY_ALLOCATION, 0);
+
+                /* Write the blank data to the new file handle. */
+                std::ofstream stream(file, std::ios::out | std::ios::binary | std::ios::app);
+                if(!stream)
+                    return debug::error(FUNCTION, strerror(errno));
+
+                for(uint32_t i = 0; i < HASHMAP_TOTAL_BUCKETS; ++i)
+                    stream.write((char*)&vSpace[0], vSpace.size());
+
+                stream.close();
+            }
+
+            /* Serialize the key header followed by the key as it is stored. */
+            DataStream ssKey(SER_LLD, DATABASE_VERSION);
+            ssKey << cKey;
+            ssKey.write((char*)&cKey.vKey[0], cKey.vKey.size());
+
+            /* Find the file stream for LRU cache. */
+            std::fstream* pstream;
+            if(!fileCache->Get(hashmap[nBucket], pstream))
+            {
+                /* Set the new stream pointer. */
+                pstream = new std::fstream(file, std::ios::in | std::ios::out | std::ios::binary);
+                if(!pstream->is_open())
+                {
+                    delete pstream;
+                    return debug::error(FUNCTION, "Failed to generate file object");
+                }
+
+                /* If not in cache, add to the LRU. */
+                fileCache->Put(hashmap[nBucket], pstream);
+            }
+
+            /* Check that file is open. */
+            if(!pstream->is_open())
+                pstream->open(file, std::ios::in | std::ios::out | std::ios::binary);
+
+            /* Write the key, leaving the flush for the end of the batch. */
+            pstream->seekp(nBucket * HASHMAP_KEY_ALLOCATION, std::ios::beg);
+            pstream->write((char*)&ssKey.Bytes()[0], ssKey.size());
+
+            /* Link the bucket through the file. */
+            ++hashmap[nBucket];
+        }
+
+        /* Flush the hashmap files still open. */
+        TemplateNode<uint16_t, std::fstream*>* pnode = fileCache->pfirst;
+        while(pnode)
+        {
+            pnode->Data->flush();
+            pnode = pnode->pnext;
+        }
+
+        /* Check index file handle is open. */
+        if(!pindex->is_open())
+            pindex->open(debug::safe_printstr(strBaseLocation, "_hashmap.index"), std::ios::in | std::ios::out | std::ios::binary);
+
+        /* Write the disk index once for the whole batch. */
+        std::vector<uint8_t> vIndex(HASHMAP_TOTAL_BUCKETS * 2, 0);
+        for(uint32_t nBucket = 0; nBucket < HASHMAP_TOTAL_BUCKETS; ++nBucket)
+            std::copy((uint8_t *)&hashmap[nBucket], (uint8_t *)&hashmap[nBucket] + 2, (uint8_t *)&vIndex[nBucket * 2]);
+
+        pindex->seekp(0, std::ios::beg);
+        pindex->write((char*)&vIndex[0], vIndex.size());
+        pindex->flush();
+
+        return true;
+    }
+
+
     /*  Erase a key from the disk hashmaps.
      *  TODO: This should be optimized further. */
     bool BinaryHashMap::Erase(const std::vector<uint8_t> &vKey)
@@ -113,6 +113,63 @@ namespace LLD
      *
      */
     void TxnCommit(const uint8_t nFlags = 0, const uint16_t nInstances = INSTANCES::CONSENSUS);
+
+
+    /** Instances
+     *
+     *  Get the consensus instances that are open, by instance.
+     *
+     *  @param[in] nInstances The instances to get.
+     *
+     *  @return The open instances, ordered by instance.
+     *
+     */
+    std::map<uint16_t, SectorDatabase<BinaryHashMap, BinaryLRU>*> Instances(const uint16_t nInstances = INSTANCES::CONSENSUS);
+
+
+    /** Undo Begin
+     *
+     *  Start capturing the pre-images of keys the calling thread modifies in the given instances.
+     *
+     *  @param[in] nInstances The instances to capture.
+     *
+     */
+    void UndoBegin(const uint16_t nInstances = INSTANCES::CONSENSUS);
+
+
+    /** Undo End
+     *
+     *  Stop capturing pre-images in the given instances.
+     *
+     *  @param[out] mapUndo The undo journals captured, by instance.
+     *  @param[in] nInstances The instances to stop capturing.
+     *
+     *  @return true if every modification captured can be put back.
+     *
+     */
+    bool UndoEnd(std::map<uint16_t, SectorUndo> &mapUndo, const uint16_t nInstances = INSTANCES::CONSENSUS);
+
+
+    /** Undo Release
+     *
+     *  Stop capturing pre-images in the given instances, discarding what was captured.
+     *
+     *  @param[in] nInstances The instances to stop capturing.
+     *
+     */
+    void UndoRelease(const uint16_t nInstances = INSTANCES::CONSENSUS);
+
+
+    /** Undo Apply
+     *
+     *  Put back the pre-images of undo journals into their instances.
+     *
+     *  @param[in] mapUndo The undo journals to apply, by instance.
+     *
+     *  @return true if every journal was applied.
+     *
+     */
+    bool UndoApply(const std::map<uint16_t, SectorUndo>& mapUndo);
 }
 
 #endif
@@ -136,6 +136,16 @@ namespace LLD
         uint32_t GetBucket(const std::vector<uint8_t>& vKey);
 
 
+        /** Buckets
+         *
+         *  Get the total buckets allocated in the hashmap.
+         *
+         *  @return The total buckets.
+         *
+         **/
+        uint32_t Buckets() const;
+
+
         /** Initialize
          *
          *  Initialize the binary hash map keychain.
@@ -189,6 +199,34 @@ namespace LLD
         bool Restore(const std::vector<uint8_t> &vKey);
 
 
+        /** Scan
+         *
+         *  Read every key in a range of buckets from the disk hashmaps, ordered by bucket and then by key.
+         *  Keys are returned as they are stored, compressed if they were larger than max size.
+         *
+         *  @param[in] nBegin The first bucket to read.
+         *  @param[in] nEnd The bucket to stop reading before.
+         *  @param[out] vKeys The buckets and keys that were read.
+         *
+         *  @return True if the range was read, false otherwise.
+         *
+         **/
+        bool Scan(const uint32_t nBegin, const uint32_t nEnd, std::vector< std::pair<uint32_t, SectorKey> > &vKeys);
+
+
+        /** Insert
+         *
+         *  Append keys as they are stored to their buckets without checking for existing keys,
+         *  writing the disk index once for the whole batch.
+         *
+         *  @param[in] vKeys The buckets and keys to insert.
+         *
+         *  @return True if the keys were inserted, false otherwise.
+         *
+         **/
+        bool Insert(const std::vector< std::pair<uint32_t, SectorKey> >& vKeys);
+
+
         /** Erase
          *
          *  Erase a key from the disk hashmaps.
@@ -27,6 +27,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/constants.h>
 #include <TAO/Ledger/types/state.h>
 #include <TAO/Ledger/types/merkle.h>
+#include <TAO/Ledger/types/metrics.h>
 #include <TAO/Ledger/types/mempool.h>
 #include <TAO/Ledger/types/client.h>
 
@@ -1282,6 +1283,95 @@ namespace LLD
     }
 
 
+    /* Writes the running metrics of the chain, as of the best block they hold. */
+    bool LedgerDB::WriteMetrics(const TAO::Ledger::Metrics& tMetrics)
+    {
+        return Write(std::string("metrics"), tMetrics);
+    }
+
+
+    /* Reads the running metrics of the chain. */
+    bool LedgerDB::ReadMetrics(TAO::Ledger::Metrics &tMetrics)
+    {
+        return Read(std::string("metrics"), tMetrics);
+    }
+
+
+    /* Writes the volume totals of the chain up to a block height. */
+    bool LedgerDB::WriteVolume(const uint32_t nHeight, const TAO::Ledger::Volume& tVolume)
+    {
+        return Write(std::make_pair(std::string("volume"), nHeight), tVolume);
+    }
+
+
+    /* Reads the volume totals of the chain up to a block height. */
+    bool LedgerDB::ReadVolume(const uint32_t nHeight, TAO::Ledger::Volume &tVolume)
+    {
+        return Read(std::make_pair(std::string("volume"), nHeight), tVolume);
+    }
+
+
+    /* Erases the volume totals of the chain up to a block height. */
+    bool LedgerDB::EraseVolume(const uint32_t nHeight)
+    {
+        return Erase(std::make_pair(std::string("volume"), nHeight));
+    }
+
+
+    /* Writes the undo journals of the block connected at a height. */
+    bool LedgerDB::WriteUndo(const uint32_t nHeight, const uint1024_t& hashBlock, const std::map<uint16_t, SectorUndo>& mapUndo)
+    {
+        return Write(std::make_pair(std::string("undo"), nHeight), std::make_pair(hashBlock, mapUndo));
+    }
+
+
+    /* Reads the undo journals of the block connected at a height. */
+    bool LedgerDB::ReadUndo(const uint32_t nHeight, uint1024_t &hashBlock, std::map<uint16_t, SectorUndo> &mapUndo)
+    {
+        std::pair<uint1024_t, std::map<uint16_t, SectorUndo>> pairUndo;
+        if(!Read(std::make_pair(std::string("undo"), nHeight), pairUndo))
+            return false;
+
+        hashBlock = pairUndo.first;
+        mapUndo   = std::move(pairUndo.second);
+
+        return true;
+    }
+
+
+    /* Erases the undo journals of the block connected at a height. */
+    bool LedgerDB::EraseUndo(const uint32_t nHeight)
+    {
+        /* Heights connected without a journal have nothing to erase. */
+        const std::pair<std::string, uint32_t> pairKey = std::make_pair(std::string("undo"), nHeight);
+        if(!Exists(pairKey))
+            return true;
+
+        return Erase(pairKey);
+    }
+
+
+    /* Writes the block of a snapshot being imported, marking the import in progress. */
+    bool LedgerDB::WriteImport(const uint1024_t& hashBlock)
+    {
+        return Write(std::string("snapshotimport"), hashBlock);
+    }
+
+
+    /* Reads the block of a snapshot import that is in progress, or didn't finish. */
+    bool LedgerDB::ReadImport(uint1024_t &hashBlock)
+    {
+        return Read(std::string("snapshotimport"), hashBlock);
+    }
+
+
+    /* Erases the marker of a snapshot import once it has finished. */
+    bool LedgerDB::EraseImport()
+    {
+        return Erase(std::string("snapshotimport"));
+    }
+
+
     /* Begin a memory transaction following ACID properties. */
     void LedgerDB::MemoryBegin(const uint8_t nFlags)
     {
@@ -39,6 +39,13 @@ namespace LLD
     /* Writes a transaction to the legacy DB. */
     bool LegacyDB::WriteTx(const uint512_t& hashTx, const Legacy::Transaction& tx)
     {
+        /* Index the outputs first, so an indexed output always has its transaction to fall back on. */
+        for(uint32_t n = 0; n < tx.vout.size(); ++n)
+        {
+            if(!Write(std::make_pair(std::string("output"), std::make_pair(hashTx, n)), Legacy::Coin(tx, n), "output"))
+                return false;
+        }
+
         return Write(std::make_pair(std::string("tx"), hashTx), tx, "tx");
     }
 
@@ -93,10 +100,28 @@ namespace LLD
     }
 
 
+    /* Reads an output from the outpoint index. */
+    bool LegacyDB::ReadOutput(const uint512_t& hashTx, const uint32_t nOutput, Legacy::Coin &coin)
+    {
+        /* Outputs are only indexed with full transactions. */
+        if(config::fClient.load())
+            return false;
+
+        return Read(std::make_pair(std::string("output"), std::make_pair(hashTx, nOutput)), coin);
+    }
+
+
     /* Erases a transaction from the ledger DB. */
     bool LegacyDB::EraseTx(const uint512_t& hashTx)
     {
         //TODO: this is never used. Might consdier removing since transactions are never erased
+        Legacy::Transaction tx;
+        if(Read(std::make_pair(std::string("tx"), hashTx), tx))
+        {
+            for(uint32_t n = 0; n < tx.vout.size(); ++n)
+                Erase(std::make_pair(std::string("output"), std::make_pair(hashTx, n)));
+        }
+
         return Erase(std::make_pair(std::string("tx"), hashTx));
     }
 
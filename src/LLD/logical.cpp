@@ -15,6 +15,7 @@ ________________________________________________________________________________
 
 #include <LLD/include/global.h>
 
+#include <TAO/API/types/history.h>
 #include <TAO/API/types/transaction.h>
 
 #include <TAO/Operation/types/contract.h>
@@ -187,7 +188,7 @@ namespace LLD
 
 
     /* Push an register transaction to process for given genesis-id. */
-    bool LogicalDB::PushTransaction(const uint256_t& hashRegister, const uint512_t& hashTx)
+    bool LogicalDB::PushTransaction(const uint256_t& hashRegister, const TAO::API::HistoryEntry& tEntry)
     {
         /* Get our current sequence number. */
         uint32_t nOwnerSequence = 0;
@@ -196,7 +197,20 @@ namespace LLD
         Read(std::make_pair(std::string("transactions.sequence"), hashRegister), nOwnerSequence);
 
         /* Add our indexing entry by owner sequence number. */
-        if(!Write(std::make_tuple(std::string("transactions.index"), nOwnerSequence, hashRegister), hashTx))
+        if(!Write(std::make_tuple(std::string("transactions.index"), nOwnerSequence, hashRegister), tEntry.hashTx))
+            return false;
+
+        /* Count our contracts on top of the previous entry for seeking by offset. */
+        TAO::API::HistoryEntry tHistory = tEntry;
+        tHistory.nRows = tEntry.vContracts.size();
+
+        /* Previous entries are missing for registers indexed before the history, which HasHistory() catches. */
+        TAO::API::HistoryEntry tPrev;
+        if(nOwnerSequence > 0 && ReadHistory(hashRegister, nOwnerSequence - 1, tPrev))
+            tHistory.nRows += tPrev.nRows;
+
+        /* Add our history entry under the same sequence number. */
+        if(!Write(std::make_tuple(std::string("history.index"), nOwnerSequence, hashRegister), tHistory))
             return false;
 
         /* Write our new events sequence to disk. */
@@ -221,6 +235,9 @@ namespace LLD
         if(!Erase(std::make_tuple(std::string("transactions.index"), --nOwnerSequence, hashRegister)))
             return false;
 
+        /* Erase our history entry, which won't exist for registers indexed before the history. */
+        Erase(std::make_tuple(std::string("history.index"), nOwnerSequence, hashRegister));
+
         /* Write our new events sequence to disk. */
         if(!Write(std::make_pair(std::string("transactions.sequence"), hashRegister), nOwnerSequence))
             return false;
@@ -254,6 +271,66 @@ namespace LLD
     }
 
 
+    /* Get the number of transactions that modified a register state. */
+    bool LogicalDB::CountTransactions(const uint256_t& hashRegister, uint32_t &nCount)
+    {
+        /* Our sequence is the number of transactions. */
+        if(!Read(std::make_pair(std::string("transactions.sequence"), hashRegister), nCount))
+            return false;
+
+        return (nCount > 0);
+    }
+
+
+    /* Check if a register's transactions all have history entries. */
+    bool LogicalDB::HasHistory(const uint256_t& hashRegister)
+    {
+        /* Entries are only ever pushed and popped at the end, so a first entry means they are all there. */
+        return Exists(std::make_tuple(std::string("history.index"), uint32_t(0), hashRegister));
+    }
+
+
+    /* Read the history entry of a register by its sequence. */
+    bool LogicalDB::ReadHistory(const uint256_t& hashRegister, const uint32_t nSequence, TAO::API::HistoryEntry &tEntry)
+    {
+        return Read(std::make_tuple(std::string("history.index"), nSequence, hashRegister), tEntry);
+    }
+
+
+    /* Find the history entry holding a given contract of a register. */
+    bool LogicalDB::SeekHistory(const uint256_t& hashRegister, const uint32_t nRow, uint32_t &nSequence, TAO::API::HistoryEntry &tEntry)
+    {
+        /* Get our total number of entries. */
+        uint32_t nCount = 0;
+        if(!CountTransactions(hashRegister, nCount))
+            return false;
+
+        /* Search for the first entry that counts past our contract. */
+        uint32_t nBegin = 0, nEnd = nCount;
+        while(nBegin < nEnd)
+        {
+            /* Read the entry in the middle of our range. */
+            const uint32_t nMiddle = nBegin + (nEnd - nBegin) / 2;
+            if(!ReadHistory(hashRegister, nMiddle, tEntry))
+                return false;
+
+            /* Narrow our range to the side holding the contract. */
+            if(tEntry.nRows > nRow)
+                nEnd = nMiddle;
+            else
+                nBegin = nMiddle + 1;
+        }
+
+        /* Check that we didn't seek past the last contract. */
+        if(nBegin == nCount)
+            return false;
+
+        /* Read our final entry. */
+        nSequence = nBegin;
+        return ReadHistory(hashRegister, nSequence, tEntry);
+    }
+
+
     /* Push an register transaction to process for given register address. */
     bool LogicalDB::PushRegisterTx(const uint256_t& hashRegister, const uint512_t& hashTx)
     {
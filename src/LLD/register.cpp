@@ -25,6 +25,10 @@ ________________________________________________________________________________
 namespace LLD
 {
 
+    /* Set of register addresses read on this thread. */
+    thread_local std::set<uint256_t>* RegisterDB::pReads = nullptr;
+
+
     /** The Database Constructor. To determine file location and the Bytes per Record. **/
     RegisterDB::RegisterDB(const uint8_t nFlagsIn, const uint32_t nBucketsIn, const uint32_t nCacheIn)
     : SectorDatabase(std::string("_REGISTER")
@@ -188,6 +192,10 @@ namespace LLD
     /* Read a state register from the register database. */
     bool RegisterDB::ReadState(const uint256_t& hashRegister, TAO::Register::State& state, const uint8_t nFlags)
     {
+        /* Track our read for callers depending on it. */
+        if(pReads)
+            pReads->insert(hashRegister);
+
         /* Memory mode for pre-database commits. */
         if(nFlags == TAO::Ledger::FLAGS::MEMPOOL ||
            nFlags == TAO::Ledger::FLAGS::LOOKUP  ||
@@ -320,6 +328,34 @@ namespace LLD
     }
 
 
+    /* Put back the pre-images of an undo journal, removing memory states for the registers it puts back. */
+    bool RegisterDB::UndoApply(const SectorUndo& undo)
+    {
+        /* Put back the records on disk first. */
+        if(!SectorDatabase::UndoApply(undo))
+            return false;
+
+        /* Memory states written over the records put back are now stale. */
+        for(const auto& tPreimage : undo.vPreimages)
+        {
+            /* Get the register address from the key. */
+            DataStream ssKey(tPreimage.vKey, SER_LLD, DATABASE_VERSION);
+
+            std::pair<std::string, uint256_t> pairKey;
+            ssKey >> pairKey;
+
+            /* Only states have memory states. */
+            if(pairKey.first != "state")
+                continue;
+
+            /* Erase the memory states like a block would. */
+            WriteState(pairKey.second, TAO::Register::State(), TAO::Ledger::FLAGS::ERASE);
+        }
+
+        return true;
+    }
+
+
     /* Read an object register from the register database. */
     bool RegisterDB::ReadObject(const uint256_t& hashRegister, TAO::Register::Object& object, const uint8_t nFlags)
     {
@@ -380,6 +416,10 @@ namespace LLD
         const uint256_t hashRegister =
             TAO::Register::Address(std::string("trust"), hashGenesis, TAO::Register::Address::TRUST);
 
+        /* Track our read for callers depending on it. */
+        if(pReads)
+            pReads->insert(hashRegister);
+
         /* Memory mode for pre-database commits. */
         if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
         {
@@ -449,6 +489,10 @@ namespace LLD
     /* Determines if a state exists in the register database. */
     bool RegisterDB::HasState(const uint256_t& hashRegister, const uint8_t nFlags)
     {
+        /* Track our read for callers depending on it. */
+        if(pReads)
+            pReads->insert(hashRegister);
+
         /* Memory mode for pre-database commits. */
         if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
         {
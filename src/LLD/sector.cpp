@@ -41,6 +41,7 @@ namespace LLD
     , strName(strNameIn)
     , runtime()
     , pTransaction(nullptr)
+    , pUndo(nullptr)
     , pSectorKeys(new KeychainType((config::GetDataDir() + strName + "/keychain/"), nFlagsIn, nBucketsIn))
     , cachePool(new CacheType(nCacheIn))
     , fileCache(new TemplateLRU<uint32_t, std::fstream*>(8))
@@ -91,6 +92,9 @@ namespace LLD
         if(pTransaction)
             delete pTransaction;
 
+        if(pUndo)
+            delete pUndo;
+
         if(cachePool)
             delete cachePool;
 
@@ -812,7 +816,7 @@ namespace LLD
                 ssJournal >> vKey;
 
                 /* Erase the key. */
-                pTransaction->EraseTransaction(vKey);
+                TxnErase(vKey);
 
                 /* Debug output. */
                 debug::log(0, FUNCTION, "erasing key ", HexStr(vKey.begin(), vKey.end()).substr(0, 20));
@@ -873,6 +877,376 @@ namespace LLD
     }
 
 
+    /*  Start capturing the pre-images of the keys modified by the calling thread. */
+    template<class KeychainType, class CacheType>
+    void SectorDatabase<KeychainType, CacheType>::UndoBegin()
+    {
+        LOCK(TRANSACTION_MUTEX);
+
+        /* Delete a previous undo journal if applicable. */
+        if(pUndo)
+            delete pUndo;
+
+        /* Create the new undo journal for this thread. */
+        pUndo = new SectorUndo();
+    }
+
+
+    /*  Stop capturing pre-images. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::UndoEnd(SectorUndo &undo)
+    {
+        LOCK(TRANSACTION_MUTEX);
+
+        /* Check for an undo journal being captured. */
+        if(!pUndo)
+            return false;
+
+        /* Hand over the journal. */
+        undo = std::move(*pUndo);
+
+        /* Cleanup the undo journal. */
+        delete pUndo;
+        pUndo = nullptr;
+
+        return undo.fComplete;
+    }
+
+
+    /*  Stop capturing pre-images, discarding what was captured. */
+    template<class KeychainType, class CacheType>
+    void SectorDatabase<KeychainType, CacheType>::UndoRelease()
+    {
+        LOCK(TRANSACTION_MUTEX);
+
+        /* Cleanup the undo journal. */
+        if(pUndo)
+            delete pUndo;
+
+        pUndo = nullptr;
+    }
+
+
+    /*  Put back the pre-images of an undo journal. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::UndoApply(const SectorUndo& undo)
+    {
+        if(nFlags & FLAGS::READONLY)
+            return debug::error(FUNCTION, "UndoApply called on database in read-only mode");
+
+        /* Put back the pre-images in the reverse of the order they were captured. */
+        for(auto it = undo.vPreimages.rbegin(); it != undo.vPreimages.rend(); ++it)
+        {
+            const SectorPreimage& tPreimage = *it;
+
+            /* Remove the item from the cache pool. */
+            cachePool->Remove(tPreimage.vKey);
+
+            /* Put back into the transaction if one is open. */
+            {
+                LOCK(TRANSACTION_MUTEX);
+                if(pTransaction)
+                {
+                    /* Clear what was pending for this key. */
+                    TxnErase(tPreimage.vKey);
+
+                    /* Keys that didn't exist stay erased. */
+                    if(tPreimage.nState == PREIMAGE::MISSING)
+                    {
+                        pTransaction->ssJournal << std::string("erase") << tPreimage.vKey;
+                        continue;
+                    }
+
+                    /* Keys that existed are written back. */
+                    pTransaction->setErasedData.erase(tPreimage.vKey);
+                    if(tPreimage.nState == PREIMAGE::KEY)
+                    {
+                        pTransaction->ssJournal << std::string("key") << tPreimage.vKey;
+                        pTransaction->setKeychain.insert(tPreimage.vKey);
+                    }
+                    else
+                    {
+                        pTransaction->ssJournal << std::string("write") << tPreimage.vKey << tPreimage.vData;
+                        pTransaction->mapTransactions[tPreimage.vKey] = tPreimage.vData;
+                    }
+
+                    continue;
+                }
+            }
+
+            /* Otherwise put back directly, leaving the record of a key that didn't exist for the keychain only. */
+            switch(tPreimage.nState)
+            {
+                case PREIMAGE::MISSING:
+                {
+                    pSectorKeys->Erase(tPreimage.vKey);
+                    break;
+                }
+
+                case PREIMAGE::KEY:
+                {
+                    SectorKey cKey(STATE::READY, tPreimage.vKey, 0, 0, 0);
+                    if(!pSectorKeys->Put(cKey))
+                        return debug::error(FUNCTION, "failed to put back keychain entry");
+
+                    break;
+                }
+
+                default:
+                {
+                    if(!Put(tPreimage.vKey, tPreimage.vData))
+                        return debug::error(FUNCTION, "failed to put back sector data");
+
+                    break;
+                }
+            }
+        }
+
+        return true;
+    }
+
+
+    /*  Capture the pre-image of a key about to be modified. */
+    template<class KeychainType, class CacheType>
+    void SectorDatabase<KeychainType, CacheType>::Capture(const std::vector<uint8_t>& vKey, const bool fIndex)
+    {
+        /* The state of the key before this modification. */
+        uint8_t nState = PREIMAGE::MISSING;
+        std::vector<uint8_t> vData;
+
+        /* Check the transaction first, as it holds the newest state of the key. */
+        {
+            LOCK(TRANSACTION_MUTEX);
+
+            /* Only capture the first modification of a key made by the capturing thread. */
+            if(!pUndo || pUndo->idThread != std::this_thread::get_id() || pUndo->Has(vKey))
+                return;
+
+            if(pTransaction)
+            {
+                /* Keys indexed to another key's record can't be put back on their own. */
+                if(pTransaction->mapIndex.count(vKey))
+                {
+                    pUndo->fComplete = false;
+                    return;
+                }
+
+                /* Check for data pending to be erased, written, or added to keychain. */
+                bool fPending = true;
+                if(pTransaction->setErasedData.count(vKey))
+                    nState = PREIMAGE::MISSING;
+                else if(pTransaction->mapTransactions.count(vKey))
+                {
+                    nState = PREIMAGE::DATA;
+                    vData  = pTransaction->mapTransactions[vKey];
+                }
+                else if(pTransaction->setKeychain.count(vKey))
+                    nState = PREIMAGE::KEY;
+                else
+                    fPending = false;
+
+                /* Add the pending state now, as it's newer than what is on disk. */
+                if(fPending)
+                {
+                    /* Indexing a key that existed points it at another record, which can't be put back on its own. */
+                    if(fIndex && nState != PREIMAGE::MISSING)
+                        pUndo->fComplete = false;
+
+                    pUndo->Add(nState, vKey, vData);
+                    return;
+                }
+            }
+        }
+
+        /* Check the cache pool and keychain for what is on disk. */
+        bool fReadable = true;
+        if(cachePool->Get(vKey, vData))
+            nState = PREIMAGE::DATA;
+        else
+        {
+            SectorKey cKey;
+            if(pSectorKeys->Get(vKey, cKey))
+            {
+                /* Check for a keychain only entry. */
+                if(cKey.nSectorFile == 0 && cKey.nSectorSize == 0 && cKey.nSectorStart == 0)
+                    nState = PREIMAGE::KEY;
+                else if(Get(cKey, vData))
+                    nState = PREIMAGE::DATA;
+                else
+                    fReadable = false;
+            }
+        }
+
+        /* Add the pre-image if still capturing. */
+        LOCK(TRANSACTION_MUTEX);
+        if(!pUndo)
+            return;
+
+        /* Indexing a key that existed points it at another record, which can't be put back on its own. */
+        if(!fReadable || (fIndex && nState != PREIMAGE::MISSING))
+            pUndo->fComplete = false;
+
+        pUndo->Add(nState, vKey, vData);
+    }
+
+
+    /*  Get the total buckets allocated in the keychain. */
+    template<class KeychainType, class CacheType>
+    uint32_t SectorDatabase<KeychainType, CacheType>::Buckets() const
+    {
+        return pSectorKeys->Buckets();
+    }
+
+
+    /*  Read every key in a range of keychain buckets. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::Keys(const uint32_t nBegin, const uint32_t nEnd, std::vector< std::pair<uint32_t, SectorKey> > &vKeys)
+    {
+        return pSectorKeys->Scan(nBegin, nEnd, vKeys);
+    }
+
+
+    /*  Write snapshot records in bulk. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::Import(const std::vector<SectorRecord>& vRecords,
+                                                          std::vector< std::tuple<uint16_t, uint32_t, uint32_t> > &vLocations)
+    {
+        if(nFlags & FLAGS::READONLY)
+            return debug::error(FUNCTION, "Import called on database in read-only mode");
+
+        /* Build the keys for every record, buffering the data into one write. */
+        std::vector< std::pair<uint32_t, SectorKey> > vKeys;
+        {
+            LOCK(SECTOR_MUTEX);
+
+            DataStream ssData(SER_LLD, DATABASE_VERSION);
+            for(const auto& tRecord : vRecords)
+            {
+                /* Keychain only entries have no location. */
+                SectorKey cKey(STATE::READY, tRecord.vKey, 0, 0, 0);
+                cKey.nLength = tRecord.nLength;
+
+                /* Indexes take the location of a record already written. */
+                if(tRecord.nState == SNAPSHOT::INDEX)
+                {
+                    if(tRecord.nIndex >= vLocations.size())
+                        return debug::error(FUNCTION, "index to record ", tRecord.nIndex, " not yet written");
+
+                    std::tie(cKey.nSectorFile, cKey.nSectorStart, cKey.nSectorSize) = vLocations[tRecord.nIndex];
+                }
+                else if(tRecord.nState == SNAPSHOT::DATA)
+                {
+                    /* Create new file if above current file size. */
+                    if(nCurrentFileSize + ssData.size() > MAX_SECTOR_FILE_SIZE)
+                    {
+                        if(!Append(ssData))
+                            return false;
+
+                        debug::log(4, FUNCTION, "allocating new sector file ", nCurrentFile + 1);
+
+                        ++nCurrentFile;
+                        nCurrentFileSize = 0;
+
+                        std::ofstream stream
+                        (
+                            debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile),
+                            std::ios::out | std::ios::binary | std::ios::trunc
+                        );
+                        stream.close();
+                    }
+
+                    /* Set the location the record will have once the buffer is appended. */
+                    cKey.nSectorFile  = static_cast<uint16_t>(nCurrentFile);
+                    cKey.nSectorStart = static_cast<uint32_t>(nCurrentFileSize + ssData.size());
+                    cKey.nSectorSize  = static_cast<uint32_t>(tRecord.vData.size() + GetSizeOfCompactSize(tRecord.vData.size()));
+
+                    vLocations.emplace_back(cKey.nSectorFile, cKey.nSectorStart, cKey.nSectorSize);
+
+                    /* Buffer the size of record and the data record. */
+                    WriteCompactSize(ssData, tRecord.vData.size());
+                    ssData.write((char*)tRecord.vData.data(), tRecord.vData.size());
+
+                    ++nRecordsFlushed;
+                }
+
+                vKeys.emplace_back(tRecord.nBucket, std::move(cKey));
+            }
+
+            /* Write the rest of the records. */
+            if(!Append(ssData))
+                return false;
+        }
+
+        /* Add every key to the keychain in one batch. */
+        if(!pSectorKeys->Insert(vKeys))
+            return debug::error(FUNCTION, "failed to insert keys to keychain");
+
+        return true;
+    }
+
+
+    /*  Append buffered records to the end of the current sector file. */
+    template<class KeychainType, class CacheType>
+    bool SectorDatabase<KeychainType, CacheType>::Append(DataStream& ssData)
+    {
+        /* Skip if there is nothing buffered. */
+        if(ssData.size() == 0)
+            return true;
+
+        /* Find the file stream for LRU cache. */
+        std::fstream* pstream;
+        if(!fileCache->Get(nCurrentFile, pstream))
+        {
+            /* Set the new stream pointer. */
+            pstream = new std::fstream(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile), std::ios::in | std::ios::out | std::ios::binary);
+            if(!pstream->is_open())
+            {
+                delete pstream;
+                return debug::error(FUNCTION, "couldn't open sector file ", nCurrentFile);
+            }
+
+            /* If file not found add to LRU cache. */
+            fileCache->Put(nCurrentFile, pstream);
+        }
+
+        /* Check stream file is still open. */
+        if(!pstream->is_open())
+            pstream->open(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile), std::ios::in | std::ios::out | std::ios::binary);
+
+        /* Append the whole buffer in one write. */
+        pstream->seekp(nCurrentFileSize, std::ios::beg);
+        if(!pstream->write((char*) &ssData.Bytes()[0], ssData.size()))
+            return debug::error(FUNCTION, "failed to append ", ssData.size(), " bytes");
+
+        pstream->flush();
+
+        /* Increment the current filesize */
+        nCurrentFileSize += static_cast<uint32_t>(ssData.size());
+        nBytesWrote      += static_cast<uint32_t>(ssData.size());
+
+        ssData.clear();
+
+        return true;
+    }
+
+
+    /*  Erase a key in the open transaction, only queueing it to be erased from the keychain if it was there before. */
+    template<class KeychainType, class CacheType>
+    void SectorDatabase<KeychainType, CacheType>::TxnErase(const std::vector<uint8_t>& vKey)
+    {
+        /* Check if the key was written within this transaction. */
+        const bool fWritten = (pTransaction->mapTransactions.count(vKey) || pTransaction->setKeychain.count(vKey));
+
+        /* Erase the transaction data. */
+        pTransaction->EraseTransaction(vKey);
+
+        /* Keys that weren't on disk before this transaction have nothing to erase. */
+        SectorKey cKey;
+        if(fWritten && !pSectorKeys->Get(vKey, cKey))
+            pTransaction->setErasedData.erase(vKey);
+    }
+
+
     /* Explicity instantiate all template instances needed for compiler. */
     template class SectorDatabase<BinaryHashMap,  BinaryLRU>;
 
@@ -0,0 +1,41 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/templates/snapshot.h>
+
+namespace LLD
+{
+
+    /* Default Constructor. */
+    SectorRecord::SectorRecord()
+    : nState       (SNAPSHOT::KEY)
+    , nBucket      (0)
+    , nLength      (0)
+    , vKey         ( )
+    , vData        ( )
+    , nIndex       (0)
+    {
+    }
+
+
+    /* Constructor. */
+    SectorRecord::SectorRecord(const uint32_t nBucketIn, const SectorKey& cKey)
+    : nState       (SNAPSHOT::KEY)
+    , nBucket      (nBucketIn)
+    , nLength      (cKey.nLength)
+    , vKey         (cKey.vKey)
+    , vData        ( )
+    , nIndex       (0)
+    {
+    }
+}
@@ -20,6 +20,8 @@ ________________________________________________________________________________
 #include <LLD/include/version.h>
 #include <LLD/templates/key.h>
 #include <LLD/templates/transaction.h>
+#include <LLD/templates/undo.h>
+#include <LLD/templates/snapshot.h>
 
 #include <LLD/cache/template_lru.h>
 
@@ -32,6 +34,7 @@ ________________________________________________________________________________
 #include <cstdint>
 #include <atomic>
 #include <thread>
+#include <tuple>
 #include <mutex>
 #include <condition_variable>
 
@@ -109,6 +112,10 @@ namespace LLD
         SectorTransaction* pTransaction;
 
 
+        /* Undo journal being captured. */
+        SectorUndo* pUndo;
+
+
         /* Sector Keys Database. */
         KeychainType* pSectorKeys;
 
@@ -250,6 +257,9 @@ namespace LLD
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
             ssKey << key;
 
+            /* Capture the pre-image if journaling for undo. */
+            Capture(ssKey.Bytes());
+
             /* Remove the item from the cache pool. */
             cachePool->Remove(ssKey.Bytes());
 
@@ -262,7 +272,7 @@ namespace LLD
                     pTransaction->ssJournal << std::string("erase") << ssKey.Bytes();
 
                     /* Erase the transaction data. */
-                    pTransaction->EraseTransaction(ssKey.Bytes());
+                    TxnErase(ssKey.Bytes());
 
                     return true;
                 }
@@ -548,6 +558,9 @@ namespace LLD
             const std::vector<uint8_t>& vKey   = ssKey.Bytes();
             const std::vector<uint8_t>& vIndex = ssIndex.Bytes();
 
+            /* Capture the pre-image if journaling for undo. */
+            Capture(vKey, true);
+
             /* Check that the key is not pending in a transaction for Erase. */
             {
                 LOCK(TRANSACTION_MUTEX);
@@ -603,6 +616,9 @@ namespace LLD
             /* Get reference of key. */
             const std::vector<uint8_t>& vKey = ssKey.Bytes();
 
+            /* Capture the pre-image if journaling for undo. */
+            Capture(vKey);
+
             /* Check for transaction. */
             {
                 LOCK(TRANSACTION_MUTEX);
@@ -657,6 +673,9 @@ namespace LLD
             const std::vector<uint8_t>& vKey  = ssKey.Bytes();
             const std::vector<uint8_t>& vData = ssData.Bytes();
 
+            /* Capture the pre-image if journaling for undo. */
+            Capture(vKey);
+
             /* Check for transaction. */
             {
                 LOCK(TRANSACTION_MUTEX);
@@ -816,6 +835,122 @@ namespace LLD
          **/
         bool TxnRecovery();
 
+
+        /** UndoBegin
+         *
+         *  Start capturing the pre-images of the keys modified by the calling thread.
+         *
+         **/
+        void UndoBegin();
+
+
+        /** UndoEnd
+         *
+         *  Stop capturing pre-images.
+         *
+         *  @param[out] undo The undo journal that was captured.
+         *
+         *  @return True if every modification captured can be put back, false otherwise.
+         *
+         **/
+        bool UndoEnd(SectorUndo &undo);
+
+
+        /** UndoRelease
+         *
+         *  Stop capturing pre-images, discarding what was captured.
+         *
+         **/
+        void UndoRelease();
+
+
+        /** UndoApply
+         *
+         *  Put back the pre-images of an undo journal, into the database transaction if one is open.
+         *
+         *  @param[in] undo The undo journal to apply.
+         *
+         *  @return True if the pre-images were put back, false otherwise.
+         *
+         **/
+        bool UndoApply(const SectorUndo& undo);
+
+
+        /** Buckets
+         *
+         *  Get the total buckets allocated in the keychain.
+         *
+         *  @return The total buckets.
+         *
+         **/
+        uint32_t Buckets() const;
+
+
+        /** Keys
+         *
+         *  Read every key in a range of keychain buckets, ordered by bucket and then by key as the keychain stores it.
+         *
+         *  @param[in] nBegin The first bucket to read.
+         *  @param[in] nEnd The bucket to stop reading before.
+         *  @param[out] vKeys The buckets and keys that were read.
+         *
+         *  @return True if the range was read, false otherwise.
+         *
+         **/
+        bool Keys(const uint32_t nBegin, const uint32_t nEnd, std::vector< std::pair<uint32_t, SectorKey> > &vKeys);
+
+
+        /** Import
+         *
+         *  Write snapshot records in bulk, appending their data to the sector file in one write and their keys
+         *  to the keychain without checking for existing keys. Only for databases that don't hold these keys yet.
+         *
+         *  @param[in] vRecords The records to write.
+         *  @param[out] vLocations The file, start and size of every record written so far, for resolving indexes.
+         *
+         *  @return True if the records were written, false otherwise.
+         *
+         **/
+        bool Import(const std::vector<SectorRecord>& vRecords,
+                    std::vector< std::tuple<uint16_t, uint32_t, uint32_t> > &vLocations);
+
+
+    private:
+
+        /** Append
+         *
+         *  Append buffered records to the end of the current sector file. Requires SECTOR_MUTEX.
+         *
+         *  @param[out] ssData The buffered records, cleared once written.
+         *
+         *  @return True if the records were written, false otherwise.
+         *
+         **/
+        bool Append(DataStream& ssData);
+
+
+        /** Capture
+         *
+         *  Capture the pre-image of a key about to be modified, if journaling for undo on this thread.
+         *
+         *  @param[in] vKey The binary data of the key.
+         *  @param[in] fIndex Flag for if the key is about to be indexed to another key's record.
+         *
+         **/
+        void Capture(const std::vector<uint8_t>& vKey, const bool fIndex = false);
+
+
+        /** TxnErase
+         *
+         *  Erase a key in the open transaction, only queueing it to be erased from the keychain if it was there before
+         *  the transaction, since keys written and erased within one transaction have nothing on disk.
+         *  The transaction mutex must be held.
+         *
+         *  @param[in] vKey The binary data of the key.
+         *
+         **/
+        void TxnErase(const std::vector<uint8_t>& vKey);
+
     };
 }
 
@@ -0,0 +1,98 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_TEMPLATES_SNAPSHOT_H
+#define NEXUS_LLD_TEMPLATES_SNAPSHOT_H
+
+#include <LLD/templates/key.h>
+
+#include <Util/templates/serialize.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace LLD
+{
+
+    /** SNAPSHOT
+     *
+     *  The kinds of keys a snapshot record can hold.
+     *
+     **/
+    struct SNAPSHOT
+    {
+        enum : uint8_t
+        {
+            KEY     = 0x01, //the key is in the keychain only
+            DATA    = 0x02, //the key has its own record
+            INDEX   = 0x03, //the key is indexed to the record of another key
+        };
+    };
+
+
+    /** SectorRecord
+     *
+     *  A keychain entry and its record, as a sector database stores them, for bulk export and import.
+     *  Keys are held as the keychain stores them, since keys larger than its max size can't be recovered.
+     *
+     **/
+    class SectorRecord
+    {
+    public:
+
+        /** The kind of key. **/
+        uint8_t nState;
+
+
+        /** The keychain bucket of the key. **/
+        uint32_t nBucket;
+
+
+        /** The length of the key before it was compressed for the keychain. **/
+        uint16_t nLength;
+
+
+        /** The key as the keychain stores it. **/
+        std::vector<uint8_t> vKey;
+
+
+        /** The record in binary including its type, if the key has its own record. **/
+        std::vector<uint8_t> vData;
+
+
+        /** The position of the record an index points to, among the records of its database in export order. **/
+        uint64_t nIndex;
+
+
+        /** Default Constructor. **/
+        SectorRecord();
+
+
+        /** Constructor. **/
+        SectorRecord(const uint32_t nBucketIn, const SectorKey& cKey);
+
+
+        IMPLEMENT_SERIALIZE
+        (
+            READWRITE(nState);
+            READWRITE(nBucket);
+            READWRITE(nLength);
+            READWRITE(vKey);
+            READWRITE(vData);
+            READWRITE(nIndex);
+        )
+    };
+}
+
+#endif
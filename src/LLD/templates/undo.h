@@ -0,0 +1,144 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLD_TEMPLATES_UNDO_H
+#define NEXUS_LLD_TEMPLATES_UNDO_H
+
+#include <Util/templates/serialize.h>
+
+#include <cstdint>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace LLD
+{
+
+    /** PREIMAGE
+     *
+     *  The states a key can be in before it was first modified.
+     *
+     **/
+    struct PREIMAGE
+    {
+        enum : uint8_t
+        {
+            MISSING = 0x00, //the key didn't exist
+            KEY     = 0x01, //the key existed in the keychain only
+            DATA    = 0x02, //the key existed with a record
+        };
+    };
+
+
+    /** SectorPreimage
+     *
+     *  The state of a key and the bytes of its record before it was first modified.
+     *
+     **/
+    class SectorPreimage
+    {
+    public:
+
+        /** The state of the key. **/
+        uint8_t nState;
+
+
+        /** The key in binary. **/
+        std::vector<uint8_t> vKey;
+
+
+        /** The record in binary, including its type, if the key had one. **/
+        std::vector<uint8_t> vData;
+
+
+        /** Default Constructor. **/
+        SectorPreimage();
+
+
+        /** Constructor. **/
+        SectorPreimage(const uint8_t nStateIn, const std::vector<uint8_t>& vKeyIn, const std::vector<uint8_t>& vDataIn);
+
+
+        IMPLEMENT_SERIALIZE
+        (
+            READWRITE(nState);
+            READWRITE(vKey);
+            READWRITE(vData);
+        )
+    };
+
+
+    /** SectorUndo
+     *
+     *  Undo journal of the pre-images of every key a sector database modified while capturing, in the order they
+     *  were first touched, so the modifications can be put back with one sequential apply.
+     *
+     **/
+    class SectorUndo
+    {
+    public:
+
+        /** The captured pre-images. **/
+        std::vector<SectorPreimage> vPreimages;
+
+
+        /** The keys already captured. **/
+        std::set< std::vector<uint8_t> > setKeys;
+
+
+        /** The thread whose modifications are being captured. **/
+        std::thread::id idThread;
+
+
+        /** Flag for if every modification captured can be put back. **/
+        bool fComplete;
+
+
+        /** Default Constructor. **/
+        SectorUndo();
+
+
+        IMPLEMENT_SERIALIZE
+        (
+            READWRITE(vPreimages);
+        )
+
+
+        /** Has
+         *
+         *  Determine if a key's pre-image was already captured.
+         *
+         *  @param[in] vKey The key in binary.
+         *
+         *  @return true if the key was captured.
+         *
+         **/
+        bool Has(const std::vector<uint8_t>& vKey) const;
+
+
+        /** Add
+         *
+         *  Add the pre-image of a key touched for the first time.
+         *
+         *  @param[in] nState The state of the key.
+         *  @param[in] vKey The key in binary.
+         *  @param[in] vData The record in binary if the key had one.
+         *
+         **/
+        void Add(const uint8_t nState, const std::vector<uint8_t>& vKey,
+                 const std::vector<uint8_t>& vData = std::vector<uint8_t>());
+    };
+}
+
+#endif
@@ -38,7 +38,9 @@ namespace TAO
     namespace Ledger
     {
         class BlockState;
+        class Metrics;
         class Transaction;
+        class Volume;
     }
 
     namespace API { class Transaction; }
@@ -848,6 +850,142 @@ namespace LLD
         bool EraseFirst(const uint256_t& hashGenesis);
 
 
+        /** WriteMetrics
+         *
+         *  Writes the running metrics of the chain, as of the best block they hold.
+         *
+         *  @param[in] tMetrics The metrics to write.
+         *
+         *  @return True if the metrics were written, false otherwise.
+         *
+         **/
+        bool WriteMetrics(const TAO::Ledger::Metrics& tMetrics);
+
+
+        /** ReadMetrics
+         *
+         *  Reads the running metrics of the chain.
+         *
+         *  @param[out] tMetrics The metrics to read.
+         *
+         *  @return True if the metrics were read, false otherwise.
+         *
+         **/
+        bool ReadMetrics(TAO::Ledger::Metrics &tMetrics);
+
+
+        /** WriteVolume
+         *
+         *  Writes the volume totals of the chain up to a block height.
+         *
+         *  @param[in] nHeight The height of the block.
+         *  @param[in] tVolume The volume totals to write.
+         *
+         *  @return True if the volume was written, false otherwise.
+         *
+         **/
+        bool WriteVolume(const uint32_t nHeight, const TAO::Ledger::Volume& tVolume);
+
+
+        /** ReadVolume
+         *
+         *  Reads the volume totals of the chain up to a block height.
+         *
+         *  @param[in] nHeight The height of the block.
+         *  @param[out] tVolume The volume totals to read.
+         *
+         *  @return True if the volume was read, false otherwise.
+         *
+         **/
+        bool ReadVolume(const uint32_t nHeight, TAO::Ledger::Volume &tVolume);
+
+
+        /** EraseVolume
+         *
+         *  Erases the volume totals of the chain up to a block height.
+         *
+         *  @param[in] nHeight The height of the block.
+         *
+         *  @return True if the volume was erased, false otherwise.
+         *
+         **/
+        bool EraseVolume(const uint32_t nHeight);
+
+
+        /** WriteUndo
+         *
+         *  Writes the undo journals of the block connected at a height.
+         *
+         *  @param[in] nHeight The height of the block.
+         *  @param[in] hashBlock The hash of the block.
+         *  @param[in] mapUndo The undo journals of the block, by database instance.
+         *
+         *  @return True if the journals were written, false otherwise.
+         *
+         **/
+        bool WriteUndo(const uint32_t nHeight, const uint1024_t& hashBlock, const std::map<uint16_t, SectorUndo>& mapUndo);
+
+
+        /** ReadUndo
+         *
+         *  Reads the undo journals of the block connected at a height.
+         *
+         *  @param[in] nHeight The height of the block.
+         *  @param[out] hashBlock The hash of the block.
+         *  @param[out] mapUndo The undo journals of the block, by database instance.
+         *
+         *  @return True if the journals were read, false otherwise.
+         *
+         **/
+        bool ReadUndo(const uint32_t nHeight, uint1024_t &hashBlock, std::map<uint16_t, SectorUndo> &mapUndo);
+
+
+        /** EraseUndo
+         *
+         *  Erases the undo journals of the block connected at a height, if it has any.
+         *
+         *  @param[in] nHeight The height of the block.
+         *
+         *  @return True if the journals were erased or there were none, false otherwise.
+         *
+         **/
+        bool EraseUndo(const uint32_t nHeight);
+
+
+        /** WriteImport
+         *
+         *  Writes the block of a snapshot being imported, marking the import in progress until it is erased.
+         *
+         *  @param[in] hashBlock The hash of the snapshot's block.
+         *
+         *  @return True if the write was successful, false otherwise.
+         *
+         **/
+        bool WriteImport(const uint1024_t& hashBlock);
+
+
+        /** ReadImport
+         *
+         *  Reads the block of a snapshot import that is in progress, or didn't finish.
+         *
+         *  @param[out] hashBlock The hash of the snapshot's block.
+         *
+         *  @return True if an import is in progress, false otherwise.
+         *
+         **/
+        bool ReadImport(uint1024_t &hashBlock);
+
+
+        /** EraseImport
+         *
+         *  Erases the marker of a snapshot import once it has finished.
+         *
+         *  @return True if the erase was successful, false otherwise.
+         *
+         **/
+        bool EraseImport();
+
+
         /** MemoryBegin
          *
          *  Begin a memory transaction following ACID properties.
@@ -21,6 +21,7 @@ ________________________________________________________________________________
 #include <LLD/cache/binary_lru.h>
 #include <LLD/keychain/hashmap.h>
 
+#include <Legacy/types/coin.h>
 #include <Legacy/types/transaction.h>
 
 #include <TAO/Ledger/include/enum.h>
@@ -49,7 +50,7 @@ namespace LLD
 
         /** WriteTx
          *
-         *  Writes a transaction to the legacy DB.
+         *  Writes a transaction to the legacy DB, indexing each of its outputs by outpoint.
          *
          *  @param[in] hashTx The txid of transaction to write.
          *  @param[in] tx The transaction object to write.
@@ -103,6 +104,20 @@ namespace LLD
         bool ReadTx(const uint512_t& hashTx, const uint32_t nOutput, Legacy::Transaction& tx);
 
 
+        /** ReadOutput
+         *
+         *  Reads an output from the outpoint index, without reading the whole transaction.
+         *
+         *  @param[in] hashTx The txid of the transaction the output belongs to.
+         *  @param[in] nOutput The output to read.
+         *  @param[out] coin The output along with what spending it needs from its transaction.
+         *
+         *  @return True if the output is indexed, false otherwise.
+         *
+         **/
+        bool ReadOutput(const uint512_t& hashTx, const uint32_t nOutput, Legacy::Coin &coin);
+
+
         /** EraseTx
          *
          *  Erases a transaction from the ledger DB.
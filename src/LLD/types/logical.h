@@ -19,7 +19,7 @@ ________________________________________________________________________________
 #include <LLD/cache/binary_lru.h>
 #include <LLD/keychain/hashmap.h>
 
-namespace TAO::API       { class Transaction; }
+namespace TAO::API       { class Transaction; class HistoryEntry; }
 namespace TAO::Operation { class Contract;    }
 
 namespace LLD
@@ -248,16 +248,15 @@ namespace LLD
 
         /** PushTransaction
          *
-         *  Push an register transaction to process for given genesis-id.
+         *  Push an register transaction to process for given genesis-id, along with its history entry.
          *
-         *  @param[in] hashGenesis The genesis-id to push register for.
          *  @param[in] hashRegister The address of register to push
-         *  @param[in] hashTx The txid of the transaction that modified register.
+         *  @param[in] tEntry The history entry of the transaction that modified register.
          *
          *  @return true if event was pushed successfully.
          *
          **/
-        bool PushTransaction(const uint256_t& hashRegister, const uint512_t& hashTx);
+        bool PushTransaction(const uint256_t& hashRegister, const TAO::API::HistoryEntry& tEntry);
 
 
         /** EraseTransaction
@@ -286,6 +285,62 @@ namespace LLD
         bool ListTransactions(const uint256_t& hashRegister, std::vector<uint512_t> &vTransactions);
 
 
+        /** CountTransactions
+         *
+         *  Get the number of transactions that modified a register state.
+         *
+         *  @param[in] hashRegister The address of register to count for
+         *  @param[out] nCount The number of transactions.
+         *
+         *  @return true if register has any transactions.
+         *
+         **/
+        bool CountTransactions(const uint256_t& hashRegister, uint32_t &nCount);
+
+
+        /** HasHistory
+         *
+         *  Check if a register's transactions all have history entries, which is not the case for registers indexed
+         *  before the history index existed.
+         *
+         *  @param[in] hashRegister The address of register to check for
+         *
+         *  @return true if the history index is complete.
+         *
+         **/
+        bool HasHistory(const uint256_t& hashRegister);
+
+
+        /** ReadHistory
+         *
+         *  Read the history entry of a register by its sequence.
+         *
+         *  @param[in] hashRegister The address of register to read for
+         *  @param[in] nSequence The sequence of the entry, starting from the oldest at zero.
+         *  @param[out] tEntry The history entry read.
+         *
+         *  @return true if read successfully
+         *
+         **/
+        bool ReadHistory(const uint256_t& hashRegister, const uint32_t nSequence, TAO::API::HistoryEntry &tEntry);
+
+
+        /** SeekHistory
+         *
+         *  Find the history entry holding a given contract of a register, counting contracts from the oldest. This
+         *  is a binary search over the entries, so seeking to a page costs a handful of reads regardless of history.
+         *
+         *  @param[in] hashRegister The address of register to seek for
+         *  @param[in] nRow The contract to find, starting from the oldest at zero.
+         *  @param[out] nSequence The sequence of the entry holding the contract.
+         *  @param[out] tEntry The history entry holding the contract.
+         *
+         *  @return true if the contract was found.
+         *
+         **/
+        bool SeekHistory(const uint256_t& hashRegister, const uint32_t nRow, uint32_t &nSequence, TAO::API::HistoryEntry &tEntry);
+
+
         /** PushRegisterTx
          *
          *   Push an register transaction to process for given register address.
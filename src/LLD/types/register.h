@@ -85,6 +85,10 @@ namespace LLD
     public:
 
 
+        /** Set of register addresses read on this thread, for callers tracking what their results depend on. **/
+        static thread_local std::set<uint256_t>* pReads;
+
+
         /** The Database Constructor. To determine file location and the Bytes per Record. **/
         RegisterDB(const uint8_t nFlagsIn = FLAGS::CREATE | FLAGS::WRITE,
             const uint32_t nBucketsIn = 77773, const uint32_t nCacheIn = 1024 * 1024);
@@ -139,6 +143,19 @@ namespace LLD
         bool EraseState(const uint256_t& hashRegister, const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
 
 
+        /** UndoApply
+         *
+         *  Put back the pre-images of an undo journal, erasing the memory states and lookups of every register it
+         *  puts back, since they were written over the records the journal restores.
+         *
+         *  @param[in] undo The journal to put back.
+         *
+         *  @return True if the journal was put back, false otherwise.
+         *
+         **/
+        bool UndoApply(const SectorUndo& undo);
+
+
         /** ReadObject
          *
          *  Read an object register from the register database.
@@ -0,0 +1,60 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/templates/undo.h>
+
+namespace LLD
+{
+
+    /* Default Constructor. */
+    SectorPreimage::SectorPreimage()
+    : nState (PREIMAGE::MISSING)
+    , vKey   ( )
+    , vData  ( )
+    {
+    }
+
+
+    /* Constructor. */
+    SectorPreimage::SectorPreimage(const uint8_t nStateIn, const std::vector<uint8_t>& vKeyIn, const std::vector<uint8_t>& vDataIn)
+    : nState (nStateIn)
+    , vKey   (vKeyIn)
+    , vData  (vDataIn)
+    {
+    }
+
+
+    /* Default Constructor. */
+    SectorUndo::SectorUndo()
+    : vPreimages ( )
+    , setKeys    ( )
+    , idThread   (std::this_thread::get_id())
+    , fComplete  (true)
+    {
+    }
+
+
+    /* Determine if a key's pre-image was already captured. */
+    bool SectorUndo::Has(const std::vector<uint8_t>& vKey) const
+    {
+        return setKeys.count(vKey);
+    }
+
+
+    /* Add the pre-image of a key touched for the first time. */
+    void SectorUndo::Add(const uint8_t nState, const std::vector<uint8_t>& vKey, const std::vector<uint8_t>& vData)
+    {
+        setKeys.insert(vKey);
+        vPreimages.emplace_back(nState, vKey, vData);
+    }
+}
@@ -16,6 +16,7 @@ ________________________________________________________________________________
 #include <LLP/types/apinode.h>
 #include <LLP/templates/events.h>
 
+#include <TAO/API/include/encoding.h>
 #include <TAO/API/include/json.h>
 #include <TAO/API/types/commands.h>
 #include <TAO/API/types/exception.h>
@@ -85,7 +86,7 @@ namespace LLP
 
                 /* Swap our new address back into DDOS map */
                 if(!API_SERVER->DDOS_MAP->count(this->addr))
-                    API_SERVER->DDOS_MAP->insert(std::make_pair(this->addr, new DDOS_Filter(API_SERVER->CONFIG.DDOS_TIMESPAN)));
+                    API_SERVER->DDOS_MAP->insert(std::make_pair(this->addr, new DDOS_Filter(API_SERVER->CONFIG.DDOS_TIMESPAN, API_SERVER->CONFIG.DDOS_RSCORE, API_SERVER->CONFIG.DDOS_COMMANDS)));
 
                 /* Add a connection to score. */
                 this->DDOS = API_SERVER->DDOS_MAP->at(this->addr);
@@ -127,6 +128,9 @@ namespace LLP
         /* The HTTP response status code, default to 200 unless an error is encountered */
         uint16_t nStatus = 200;
 
+        /* The encoding of our response, which follows the request unless the accept header asks otherwise. */
+        uint8_t nEncoding = TAO::API::ENCODING::JSON;
+
         /* Log the starting time for this command. */
         runtime::timer tLatency;
         tLatency.Start();
@@ -159,11 +163,11 @@ namespace LLP
                         jParams = TAO::API::ParamsToJSON(vParams);
                     }
 
-                    /* JSON encoding. */
-                    else if(INCOMING.mapHeaders["content-type"] == "application/json")
+                    /* JSON or binary encodings. */
+                    else if(TAO::API::ContentEncoding(INCOMING.mapHeaders["content-type"], nEncoding))
                     {
-                        /* Parse JSON like normal. */
-                        jParams = encoding::json::parse(INCOMING.strContent);
+                        /* Decode our parameters, parsing JSON like normal. */
+                        jParams = TAO::API::DecodeContent(INCOMING.strContent, nEncoding);
                     }
                     else
                         throw TAO::API::Exception(-5, "content-type [", INCOMING.mapHeaders["content-type"], "] not supported");
@@ -276,6 +280,13 @@ namespace LLP
         /* Build packet. */
         HTTPPacket RESPONSE(nStatus);
 
+        /* Check if the client asked for a specific encoding. */
+        if(INCOMING.mapHeaders.count("accept"))
+            nEncoding = TAO::API::AcceptEncoding(INCOMING.mapHeaders["accept"], nEncoding);
+
+        /* Set our content type so the packet doesn't have to detect it. */
+        RESPONSE.mapHeaders["Content-Type"] = TAO::API::ContentType(nEncoding);
+
         /* Add the origin header if supplied in the request */
         if(INCOMING.mapHeaders.count("origin"))
             RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = INCOMING.mapHeaders["origin"];
@@ -303,8 +314,8 @@ namespace LLP
         if(config::GetBoolArg("-httpresponse", false))
             debug::log(0, jRet.dump(4));
 
-        /* Add content. */
-        RESPONSE.strContent = jRet.dump();
+        /* Add content, encoding binary formats straight into the response. */
+        TAO::API::EncodeContent(jRet, nEncoding, RESPONSE.strContent);
 
         /* Write the response */
         this->WritePacket(RESPONSE);
@@ -229,14 +229,20 @@ namespace LLP
     /*  Write a single packet to the TCP stream. */
     template <class PacketType>
     void BaseConnection<PacketType>::WritePacket(const PacketType& PACKET)
+    {
+        /* Get the bytes of the packet. */
+        WritePacket(PACKET.GetBytes());
+    }
+
+
+    /*  Write a single packet that is already serialized to the TCP stream. */
+    template <class PacketType>
+    void BaseConnection<PacketType>::WritePacket(const std::vector<uint8_t>& vBytes)
     {
         /* Only get this value one time. */
         static const uint64_t nMaxSendBuffer =
             config::GetArg("-maxsendbuffer", MAX_SEND_BUFFER);
 
-        /* Get the bytes of the packet. */
-        const std::vector<uint8_t> vBytes = PACKET.GetBytes();
-
         /* Stop sending packets if send buffer is full. */
         if(Buffered() + vBytes.size() + 1024 < nMaxSendBuffer //reserve 1Kb of buffer for critical messages
         || (fBufferFull.load() && Buffered() + vBytes.size() < nMaxSendBuffer)) //catch for critical messages (< 1 Kb)
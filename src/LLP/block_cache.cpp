@@ -0,0 +1,162 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/block_cache.h>
+
+#include <Util/include/mutex.h>
+
+namespace LLP
+{
+
+    /* Constructor */
+    BlockCache::BlockCache(const uint64_t nMaxBytesIn)
+    : MUTEX        ( )
+    , nMaxBytes    (nMaxBytesIn)
+    , nBytes       (0)
+    , lEntries     ( )
+    , mapEntries   ( )
+    , nHits        (0)
+    , nMisses      (0)
+    , nBytesServed (0)
+    {
+    }
+
+
+    /* Destructor. */
+    BlockCache::~BlockCache()
+    {
+    }
+
+
+    /* Get the cached packets for a block, counting a hit or a miss. */
+    std::shared_ptr<const BlockCache::Packets> BlockCache::Get(const uint1024_t& hashBlock, const uint8_t nSpecifier, const uint1024_t& hashNext)
+    {
+        LOCK(MUTEX);
+
+        /* Check for the entry. */
+        auto it = mapEntries.find(std::make_pair(hashBlock, nSpecifier));
+        if(it == mapEntries.end())
+        {
+            ++nMisses;
+            return nullptr;
+        }
+
+        /* Drop entries built before the chain moved past this block, or reorganized away from it. */
+        if(it->second->hashNext != hashNext)
+        {
+            erase(it->second);
+
+            ++nMisses;
+            return nullptr;
+        }
+
+        /* Move to the front of the list. */
+        lEntries.splice(lEntries.begin(), lEntries, it->second);
+
+        ++nHits;
+        nBytesServed += it->second->nBytes;
+
+        return it->second->pPackets;
+    }
+
+
+    /* Add the packets for a block, evicting the least recently used entries if over size. */
+    void BlockCache::Put(const uint1024_t& hashBlock, const uint8_t nSpecifier, const uint1024_t& hashNext,
+                         const std::shared_ptr<const Packets>& pPackets)
+    {
+        /* Get the total size of the packets. */
+        uint64_t nSize = 0;
+        for(const auto& vPacket : *pPackets)
+            nSize += vPacket.size();
+
+        /* Don't let one block flush the whole cache. */
+        if(nSize > nMaxBytes / 4)
+            return;
+
+        LOCK(MUTEX);
+
+        /* Replace any existing entry. */
+        const std::pair<uint1024_t, uint8_t> tKey = std::make_pair(hashBlock, nSpecifier);
+
+        auto it = mapEntries.find(tKey);
+        if(it != mapEntries.end())
+            erase(it->second);
+
+        /* Add to the front of the list. */
+        lEntries.push_front({tKey, hashNext, pPackets, nSize});
+        mapEntries[tKey] = lEntries.begin();
+        nBytes += nSize;
+
+        /* Evict from the back until under size. */
+        while(nBytes > nMaxBytes && !lEntries.empty())
+            erase(std::prev(lEntries.end()));
+    }
+
+
+    /* Remove all cached entries. */
+    void BlockCache::Clear()
+    {
+        LOCK(MUTEX);
+
+        lEntries.clear();
+        mapEntries.clear();
+        nBytes = 0;
+    }
+
+
+    /* Get the number of cached responses. */
+    uint64_t BlockCache::Size() const
+    {
+        LOCK(MUTEX);
+        return mapEntries.size();
+    }
+
+
+    /* Get the total size of cached packets. */
+    uint64_t BlockCache::Bytes() const
+    {
+        LOCK(MUTEX);
+        return nBytes;
+    }
+
+
+    /* Get the number of responses served from the cache. */
+    uint64_t BlockCache::Hits() const
+    {
+        return nHits.load();
+    }
+
+
+    /* Get the number of responses that had to be built. */
+    uint64_t BlockCache::Misses() const
+    {
+        return nMisses.load();
+    }
+
+
+    /* Get the number of bytes served from the cache. */
+    uint64_t BlockCache::BytesServed() const
+    {
+        return nBytesServed.load();
+    }
+
+
+    /* Remove an entry, MUTEX must be held. */
+    void BlockCache::erase(const std::list<Entry>::iterator& it)
+    {
+        nBytes -= it->nBytes;
+
+        mapEntries.erase(it->tKey);
+        lEntries.erase(it);
+    }
+}
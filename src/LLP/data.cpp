@@ -29,6 +29,27 @@ ________________________________________________________________________________
 
 namespace LLP
 {
+    /* Get the command of a packet, used to hold each command to its own request rate. */
+    static uint16_t packet_command(const Packet& packet)
+    {
+        return packet.HEADER;
+    }
+
+
+    /* Get the command of a message packet. */
+    static uint16_t packet_command(const MessagePacket& packet)
+    {
+        return packet.MESSAGE;
+    }
+
+
+    /* HTTP requests all share one command. */
+    static uint16_t packet_command(const HTTPPacket& packet)
+    {
+        return 0;
+    }
+
+
     /** Default Constructor **/
     template <class ProtocolType>
     DataThread<ProtocolType>::DataThread(const uint32_t nID, const bool ffDDOSIn,
@@ -362,6 +383,11 @@ namespace LLP
                     /* If a Packet was received successfully, increment request count [and DDOS count if enabled]. */
                     if(CONNECTION->PacketComplete())
                     {
+                        /* Hold the request back while its address or command is over rate, leaving the rest unread. */
+                        if(fDDOS.load() && CONNECTION->DDOS && !CONNECTION->addr.IsLocal()
+                        && !CONNECTION->DDOS->Allow(packet_command(CONNECTION->INCOMING)))
+                            continue;
+
                         /* Debug dump of message type. */
                         if(config::nVerbose.load() >= 4)
                             debug::log(4, FUNCTION, "Received Message (", CONNECTION->INCOMING.GetBytes().size(), " bytes)");
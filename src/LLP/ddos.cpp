@@ -13,64 +13,60 @@ ________________________________________________________________________________
 
 #include <LLP/templates/ddos.h>
 
+#include <algorithm>
+#include <chrono>
+
 namespace LLP
 {
 
-    /*  Construct a DDOS Score of Moving Average Timespan. */
-    DDOS_Score::DDOS_Score(int nTimespan)
-    : SCORE()
-    , TIMER()
-    , nIterator()
-    , MUTEX()
+    /* Get the current second or microsecond on a clock that never goes backwards. */
+    static uint64_t steady(const bool fMicroseconds = false)
     {
-        LOCK(MUTEX);
+        const auto tNow = std::chrono::steady_clock::now().time_since_epoch();
+        return fMicroseconds ? std::chrono::duration_cast<std::chrono::microseconds>(tNow).count() :
+                               std::chrono::duration_cast<std::chrono::seconds>(tNow).count();
+    }
 
-        for(int i = 0; i < nTimespan; ++i)
-            SCORE.push_back(std::make_pair(true, 0));
 
-        TIMER.Start();
-        nIterator = 0;
+    /*  Construct a DDOS Score of Moving Average Timespan. */
+    DDOS_Score::DDOS_Score(int nTimespan)
+    : SCORE     (new std::atomic<uint64_t>[std::max(nTimespan, 1)])
+    , nTimespan (std::max(nTimespan, 1))
+    {
+        for(uint32_t i = 0; i < this->nTimespan; ++i)
+            SCORE[i].store(0);
     }
 
     /** Default Destructor. **/
     DDOS_Score::~DDOS_Score()
     {
-        SCORE.clear();
-    }
-
-
-    /*  Reset the Timer and the Score Flags to be Overwritten. */
-    void DDOS_Score::reset()
-    {
-        for(uint32_t i = 0; i < SCORE.size(); ++i)
-            SCORE[i].first = false;
-
-        TIMER.Reset();
-        nIterator = 0;
     }
 
 
      /* Flush the DDOS Score to 0. */
     void DDOS_Score::Flush()
     {
-        LOCK(MUTEX);
-
-        reset();
-        for(uint32_t i = 0; i < SCORE.size(); ++i)
-            SCORE[i].second = 0;
+        for(uint32_t i = 0; i < nTimespan; ++i)
+            SCORE[i].store(0);
     }
 
 
      /*  Access the DDOS Score from the Moving Average. */
     int32_t DDOS_Score::Score() const
     {
-        LOCK(MUTEX);
+        const uint64_t nNow = steady();
 
-        uint32_t nMovingAverage = 0;
-        for(int32_t i = 0; i < SCORE.size(); ++i)
-            nMovingAverage += SCORE[i].second;
+        /* Sum the buckets counting for a second inside the window. */
+        uint64_t nMovingAverage = 0;
+        for(uint32_t i = 0; i < nTimespan; ++i)
+        {
+            /* Skip buckets never written, which would count as inside the window for the first seconds after boot. */
+            const uint64_t nBucket = SCORE[i].load(std::memory_order_relaxed);
+            if(nBucket != 0 && (nBucket >> 32) + nTimespan > (nNow & 0xffffffff))
+                nMovingAverage += (nBucket & 0xffffffff);
+        }
 
-        return nMovingAverage / SCORE.size();
+        return static_cast<int32_t>(nMovingAverage / nTimespan);
     }
 
 
@@ -78,33 +74,25 @@ namespace LLP
       *  Increment Score per Second. */
     DDOS_Score &DDOS_Score::operator+=(const uint32_t& nScore)
     {
-        LOCK(MUTEX);
-
         if(nScore)
             debug::log(4, FUNCTION, "DDOS Penalty of +", nScore);
 
-        uint32_t nTime = TIMER.Elapsed();
+        const uint64_t nNow = (steady() & 0xffffffff);
 
-        /* If the Time has been greater than Moving Average Timespan, Set to Add Score on Time Overlap. */
-        if(nTime >= SCORE.size())
-        {
-            reset();
-            nTime = nTime % static_cast<int32_t>(SCORE.size());
-        }
+        /* Add to this second's bucket, restarting it if it last counted an earlier pass of the window. */
+        std::atomic<uint64_t>& nBucket = SCORE[nNow % nTimespan];
 
-        /* Iterate as many seconds as needed, flagging that each has been iterated. */
-        for(uint32_t i = nIterator; i <= nTime; ++i)
+        uint64_t nCurrent = nBucket.load(std::memory_order_relaxed);
+        uint64_t nUpdated = 0;
+        do
         {
-            if(!SCORE[i].first)
-            {
-                SCORE[i].first  = true;
-                SCORE[i].second = 0;
-            }
+            /* Saturate the score rather than let it carry into the second. */
+            if((nCurrent >> 32) == nNow)
+                nUpdated = (nNow << 32) | std::min(uint64_t(0xffffffff), (nCurrent & 0xffffffff) + nScore);
+            else
+                nUpdated = (nNow << 32) | nScore;
         }
-
-        /* Update the Moving Average Iterator and Score for that Second Instance. */
-        SCORE[nTime].second += nScore;
-        nIterator = nTime;
+        while(!nBucket.compare_exchange_weak(nCurrent, nUpdated, std::memory_order_relaxed));
 
         return *this;
     }
@@ -117,16 +105,72 @@ namespace LLP
      **/
     void DDOS_Score::print()
     {
-        for(int32_t i = 0; i < SCORE.size(); ++i)
-            printf(" %s %u |", SCORE[i].first ? "T" : "F", SCORE[i].second);
+        const uint64_t nNow = (steady() & 0xffffffff);
+        for(uint32_t i = 0; i < nTimespan; ++i)
+        {
+            const uint64_t nBucket = SCORE[i].load(std::memory_order_relaxed);
+            printf(" %s %u |", (nBucket != 0 && (nBucket >> 32) + nTimespan > nNow) ? "T" : "F", uint32_t(nBucket & 0xffffffff));
+        }
 
         printf("\n");
     }
 
 
     /* Default Constructor */
-    DDOS_Filter::DDOS_Filter(const uint32_t nTimespan)
+    DDOS_Limit::DDOS_Limit()
+    : nFull (0)
+    {
+    }
+
+
+    /* Take a token from the bucket if one is available. */
+    bool DDOS_Limit::Take(const uint64_t nNow, const uint64_t nInterval, const uint32_t nBurst)
+    {
+        uint64_t nCurrent = nFull.load(std::memory_order_relaxed);
+        uint64_t nUpdated = 0;
+        do
+        {
+            /* A bucket that filled in the past is full as of now. */
+            nUpdated = std::max(nCurrent, nNow) + nInterval;
+
+            /* Refuse once the bucket has been emptied. */
+            if(nUpdated - nNow > nInterval * nBurst)
+                return false;
+        }
+        while(!nFull.compare_exchange_weak(nCurrent, nUpdated, std::memory_order_relaxed));
+
+        return true;
+    }
+
+
+    /* Return a token that was taken but not used. */
+    void DDOS_Limit::Give(const uint64_t nInterval)
+    {
+        uint64_t nCurrent = nFull.load(std::memory_order_relaxed);
+        uint64_t nUpdated = 0;
+        do
+        {
+            /* Stop at an empty time, as a Reset() in between has already filled the bucket. */
+            nUpdated = (nCurrent > nInterval ? nCurrent - nInterval : 0);
+        }
+        while(!nFull.compare_exchange_weak(nCurrent, nUpdated, std::memory_order_relaxed));
+    }
+
+
+    /* Fill the bucket. */
+    void DDOS_Limit::Reset()
+    {
+        nFull.store(0);
+    }
+
+
+    /* Default Constructor */
+    DDOS_Filter::DDOS_Filter(const uint32_t nTimespan, const uint32_t nRateIn, const uint32_t nCommandRateIn)
     : nTotalBans    (0)
+    , nRate         (nRateIn)
+    , nCommandRate  (nCommandRateIn)
+    , rLIMIT        ( )
+    , vCOMMANDS     ( )
     , nBanTimestamp (0)
     , rSCORE        (nTimespan)
     , cSCORE        (nTimespan)
@@ -134,6 +178,33 @@ namespace LLP
     }
 
 
+    /* Check a request against the address and command rates, taking a token from each if allowed. */
+    bool DDOS_Filter::Allow(const uint16_t nCommand)
+    {
+        /* Skip the clock when there are no limits. */
+        if(nRate == 0 && nCommandRate == 0)
+            return true;
+
+        const uint64_t nNow = steady(true);
+
+        /* Check the command's own rate first, each bucket holding a second of requests. */
+        const uint64_t nCommandInterval = (nCommandRate ? 1000000 / nCommandRate : 0);
+        if(nCommandRate && !vCOMMANDS[nCommand & 0xff].Take(nNow, nCommandInterval, nCommandRate))
+            return false;
+
+        /* Check the address, handing back the command's token if the address is over. */
+        if(nRate && !rLIMIT.Take(nNow, 1000000 / nRate, nRate))
+        {
+            if(nCommandRate)
+                vCOMMANDS[nCommand & 0xff].Give(nCommandInterval);
+
+            return false;
+        }
+
+        return true;
+    }
+
+
     /* Ban a Connection, and Flush its Scores. */
     void DDOS_Filter::Ban(const std::string& strViolation)
     {
@@ -154,6 +225,11 @@ namespace LLP
 
         cSCORE.Flush();
         rSCORE.Flush();
+
+        /* Start the limits over for when the ban is lifted. */
+        rLIMIT.Reset();
+        for(auto& tLimit : vCOMMANDS)
+            tLimit.Reset();
     }
 
 
@@ -85,7 +85,7 @@ namespace LLP
 
                 /* Swap our new address back into DDOS map */
                 if(!API_SERVER->DDOS_MAP->count(this->addr))
-                    API_SERVER->DDOS_MAP->insert(std::make_pair(this->addr, new DDOS_Filter(API_SERVER->CONFIG.DDOS_TIMESPAN)));
+                    API_SERVER->DDOS_MAP->insert(std::make_pair(this->addr, new DDOS_Filter(API_SERVER->CONFIG.DDOS_TIMESPAN, API_SERVER->CONFIG.DDOS_RSCORE, API_SERVER->CONFIG.DDOS_COMMANDS)));
 
                 /* Add a connection to score. */
                 this->DDOS = API_SERVER->DDOS_MAP->at(this->addr);
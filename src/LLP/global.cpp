@@ -40,6 +40,14 @@ namespace LLP
     Server<Miner>*       MINING_SERVER;
 
 
+    /* Serialized block responses shared between tritium connections. */
+    BlockCache* BLOCK_CACHE = nullptr;
+
+
+    /* Headers-first parallel block download for initial sync. */
+    SyncQueue*  SYNC_QUEUE  = nullptr;
+
+
     /* Current session identifier. */
     const uint64_t SESSION_ID = LLC::GetRand();
 
@@ -137,11 +145,21 @@ namespace LLP
             CONFIG.DDOS_CSCORE     = config::GetArg(std::string("-cscore"), 1);
             CONFIG.DDOS_RSCORE     = config::GetArg(std::string("-rscore"), 2000);
             CONFIG.DDOS_TIMESPAN   = config::GetArg(std::string("-timespan"), 20);
+            CONFIG.DDOS_COMMANDS   = config::GetArg(std::string("-commandrate"), 1000);
             CONFIG.MANAGER_SLEEP   = 1000; //default: 1 second connection attempts
             CONFIG.SOCKET_TIMEOUT  = config::GetArg(std::string("-timeout"), 120);
 
             /* Create the server instance. */
             TRITIUM_SERVER = new Server<TritiumNode>(CONFIG);
+
+            /* Cache of serialized blocks for syncing peers, sized in megabytes and disabled with 0. */
+            const uint64_t nBlockCache = config::GetArg(std::string("-blockcache"), 256);
+            if(nBlockCache > 0 && !config::fClient.load())
+                BLOCK_CACHE = new BlockCache(nBlockCache * 1024 * 1024);
+
+            /* Download blocks in parallel windows from all connected nodes while synchronizing. */
+            if(config::GetBoolArg(std::string("-parallelsync"), false) && !config::fClient.load())
+                SYNC_QUEUE = new SyncQueue(config::GetArg(std::string("-syncwindow"), 256), config::GetArg(std::string("-syncahead"), 8192));
         }
 
 
@@ -393,6 +411,20 @@ namespace LLP
         /* Shutdown the tritium server and its subsystems. */
         Shutdown<TritiumNode>(TRITIUM_SERVER);
 
+        /* Free the block cache once no connections can use it. */
+        if(BLOCK_CACHE)
+        {
+            delete BLOCK_CACHE;
+            BLOCK_CACHE = nullptr;
+        }
+
+        /* Free the sync queue along with its buffered blocks. */
+        if(SYNC_QUEUE)
+        {
+            delete SYNC_QUEUE;
+            SYNC_QUEUE = nullptr;
+        }
+
         /* Shutdown the lookup server and its subsystems. */
         Shutdown<LookupNode>(LOOKUP_SERVER);
 
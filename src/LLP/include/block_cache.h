@@ -0,0 +1,211 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_BLOCK_CACHE_H
+#define NEXUS_LLP_INCLUDE_BLOCK_CACHE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace LLP
+{
+
+    /** @class BlockCache
+     *
+     *  Bounded cache of block responses, already serialized into their wire packets, shared between all tritium
+     *  connections. Peers syncing from us ask for the same blocks in the same order, so the blocks and their
+     *  transactions only need to be read from disk and serialized for the first one.
+     *
+     *  Entries are keyed by block hash and the specifier the block was sent with, and evicted least recently used
+     *  once the cache is over its size in bytes.
+     *
+     **/
+    class BlockCache
+    {
+    public:
+
+        /** The packets of one block response, in the order they are sent. **/
+        typedef std::vector<std::vector<uint8_t>> Packets;
+
+    private:
+
+        /** A cached response, with the next block hash it was built with. **/
+        struct Entry
+        {
+            /** The block hash and specifier. **/
+            std::pair<uint1024_t, uint8_t> tKey;
+
+            /** The next block when the response was built, as client blocks carry it. **/
+            uint1024_t hashNext;
+
+            /** The serialized packets. **/
+            std::shared_ptr<const Packets> pPackets;
+
+            /** Total size of the packets. **/
+            uint64_t nBytes;
+        };
+
+
+        /** Mutex for thread concurrency. **/
+        mutable std::mutex MUTEX;
+
+
+        /** The maximum total size of cached packets. **/
+        const uint64_t nMaxBytes;
+
+
+        /** The current total size of cached packets. **/
+        uint64_t nBytes;
+
+
+        /** Cached entries, most recently used first. **/
+        std::list<Entry> lEntries;
+
+
+        /** Index into the entries by block hash and specifier. **/
+        std::map<std::pair<uint1024_t, uint8_t>, std::list<Entry>::iterator> mapEntries;
+
+
+        /** Number of responses served from the cache. **/
+        std::atomic<uint64_t> nHits;
+
+
+        /** Number of responses that had to be built. **/
+        std::atomic<uint64_t> nMisses;
+
+
+        /** Number of bytes served from the cache. **/
+        std::atomic<uint64_t> nBytesServed;
+
+    public:
+
+        /** Default Constructor. **/
+        BlockCache() = delete;
+
+
+        /** Copy Constructor. **/
+        BlockCache(const BlockCache& cache) = delete;
+
+
+        /** Copy Assignment. **/
+        BlockCache& operator=(const BlockCache& cache) = delete;
+
+
+        /** Constructor
+         *
+         *  @param[in] nMaxBytesIn The maximum total size of cached packets.
+         *
+         **/
+        BlockCache(const uint64_t nMaxBytesIn);
+
+
+        /** Destructor. **/
+        ~BlockCache();
+
+
+        /** Get
+         *
+         *  Get the cached packets for a block, counting a hit or a miss.
+         *
+         *  @param[in] hashBlock The block hash.
+         *  @param[in] nSpecifier The specifier the block is sent with.
+         *  @param[in] hashNext The current next block hash, entries built with another one are dropped.
+         *
+         *  @return The packets, or nullptr if not cached.
+         *
+         **/
+        std::shared_ptr<const Packets> Get(const uint1024_t& hashBlock, const uint8_t nSpecifier, const uint1024_t& hashNext);
+
+
+        /** Put
+         *
+         *  Add the packets for a block, evicting the least recently used entries if over size.
+         *
+         *  @param[in] hashBlock The block hash.
+         *  @param[in] nSpecifier The specifier the block is sent with.
+         *  @param[in] hashNext The next block hash the packets were built with.
+         *  @param[in] pPackets The serialized packets.
+         *
+         **/
+        void Put(const uint1024_t& hashBlock, const uint8_t nSpecifier, const uint1024_t& hashNext,
+                 const std::shared_ptr<const Packets>& pPackets);
+
+
+        /** Clear
+         *
+         *  Remove all cached entries.
+         *
+         **/
+        void Clear();
+
+
+        /** Size
+         *
+         *  Get the number of cached responses.
+         *
+         **/
+        uint64_t Size() const;
+
+
+        /** Bytes
+         *
+         *  Get the total size of cached packets.
+         *
+         **/
+        uint64_t Bytes() const;
+
+
+        /** Hits
+         *
+         *  Get the number of responses served from the cache.
+         *
+         **/
+        uint64_t Hits() const;
+
+
+        /** Misses
+         *
+         *  Get the number of responses that had to be built.
+         *
+         **/
+        uint64_t Misses() const;
+
+
+        /** BytesServed
+         *
+         *  Get the number of bytes served from the cache.
+         *
+         **/
+        uint64_t BytesServed() const;
+
+
+    private:
+
+        /** erase
+         *
+         *  Remove an entry, MUTEX must be held.
+         *
+         **/
+        void erase(const std::list<Entry>::iterator& it);
+
+    };
+}
+
+#endif
@@ -82,6 +82,10 @@ namespace LLP
         uint32_t DDOS_TIMESPAN;
 
 
+        /** The maximum number of requests of any one command allowed per IP address per second, before they are held back. **/
+        uint32_t DDOS_COMMANDS;
+
+
         /** The time interval (in milliseconds) that the manager thread should use between new outgoing connection attempts **/
         uint32_t MANAGER_SLEEP;
 
@@ -111,6 +115,7 @@ namespace LLP
         , DDOS_CSCORE     (1)    //default: 1 connection per second
         , DDOS_RSCORE     (1000) //default: 1000 requests per second
         , DDOS_TIMESPAN   (60)   //default: 60 second moving average window
+        , DDOS_COMMANDS   (0)    //default: no limit per command
         , MANAGER_SLEEP   (1000) //default: 1000 ms sleeps between connection attempts
         , SOCKET_TIMEOUT  (30)   //default: 30 seconds for socket timeout
         {
@@ -134,6 +139,7 @@ namespace LLP
         , DDOS_CSCORE     (config.DDOS_CSCORE)
         , DDOS_RSCORE     (config.DDOS_RSCORE)
         , DDOS_TIMESPAN   (config.DDOS_TIMESPAN)
+        , DDOS_COMMANDS   (config.DDOS_COMMANDS)
         , MANAGER_SLEEP   (config.MANAGER_SLEEP)
         , SOCKET_TIMEOUT  (config.SOCKET_TIMEOUT)
         {
@@ -159,6 +165,7 @@ namespace LLP
         , DDOS_CSCORE     (std::move(config.DDOS_CSCORE))
         , DDOS_RSCORE     (std::move(config.DDOS_RSCORE))
         , DDOS_TIMESPAN   (std::move(config.DDOS_TIMESPAN))
+        , DDOS_COMMANDS   (std::move(config.DDOS_COMMANDS))
         , MANAGER_SLEEP   (std::move(config.MANAGER_SLEEP))
         , SOCKET_TIMEOUT  (std::move(config.SOCKET_TIMEOUT))
         {
@@ -185,6 +192,7 @@ namespace LLP
             DDOS_CSCORE     = config.DDOS_CSCORE;
             DDOS_RSCORE     = config.DDOS_RSCORE;
             DDOS_TIMESPAN   = config.DDOS_TIMESPAN;
+            DDOS_COMMANDS   = config.DDOS_COMMANDS;
             MANAGER_SLEEP   = config.MANAGER_SLEEP;
             SOCKET_TIMEOUT  = config.SOCKET_TIMEOUT;
 
@@ -213,6 +221,7 @@ namespace LLP
             DDOS_CSCORE     = std::move(config.DDOS_CSCORE);
             DDOS_RSCORE     = std::move(config.DDOS_RSCORE);
             DDOS_TIMESPAN   = std::move(config.DDOS_TIMESPAN);
+            DDOS_COMMANDS   = std::move(config.DDOS_COMMANDS);
             MANAGER_SLEEP   = std::move(config.MANAGER_SLEEP);
             SOCKET_TIMEOUT  = std::move(config.SOCKET_TIMEOUT);
 
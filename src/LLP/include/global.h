@@ -13,8 +13,10 @@ ________________________________________________________________________________
 
 #pragma once
 
+#include <LLP/include/block_cache.h>
 #include <LLP/include/port.h>
 #include <LLP/include/seeds.h>
+#include <LLP/include/sync_queue.h>
 
 #include <LLP/types/tritium.h>
 #include <LLP/types/time.h>
@@ -42,6 +44,14 @@ namespace LLP
     extern Server<Miner>*        MINING_SERVER;
 
 
+    /** Serialized block responses shared between tritium connections, nullptr when disabled. **/
+    extern BlockCache* BLOCK_CACHE;
+
+
+    /** Headers-first parallel block download for initial sync, nullptr when disabled. **/
+    extern SyncQueue* SYNC_QUEUE;
+
+
     /** Current session identifier. **/
     const extern uint64_t SESSION_ID;
 
@@ -16,6 +16,9 @@ ________________________________________________________________________________
 #define NEXUS_LLP_INCLUDE_MANAGER_H
 
 #include <LLP/include/trust_address.h>
+
+#include <Util/templates/rankedset.h>
+
 #include <map>
 #include <vector>
 #include <cstdint>
@@ -363,11 +366,47 @@ namespace LLP
         void update_state(TrustAddress *pAddr, uint8_t nState);
 
 
+        /** update_select
+         *
+         *  Moves an address to its place in the selection index after its score or state changed, or drops it
+         *  if it can no longer be selected.
+         *
+         *  @param[in] hash The hash of the address to update.
+         *
+         **/
+        void update_select(const uint64_t hash);
+
+
     private:
 
+        /** Position of an address in the selection index, best score first, lower latency breaking ties. **/
+        struct SelectKey
+        {
+            double   dScore;
+            uint32_t nLatency;
+            uint64_t hash;
+
+            bool operator<(const SelectKey& key) const
+            {
+                if(dScore != key.dScore)
+                    return dScore > key.dScore;
+
+                if(nLatency != key.nLatency)
+                    return nLatency < key.nLatency;
+
+                return hash < key.hash;
+            }
+        };
+
         /* The map of trust addresses to track. */
         std::map<uint64_t, TrustAddress> mapTrustAddress;
 
+        /* The addresses that can be selected to connect to, in score order. */
+        rankedset<SelectKey> setSelect;
+
+        /* The selection index key of each address in it. */
+        std::map<uint64_t, SelectKey> mapSelect;
+
         /* The map of banned addresses to ignore. */
         std::map<uint64_t, uint32_t> mapBanned;
 
@@ -0,0 +1,158 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_RELAY_QUEUE_H
+#define NEXUS_LLP_INCLUDE_RELAY_QUEUE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/rollingfilter.h>
+
+#include <mutex>
+#include <vector>
+
+namespace LLP
+{
+
+    /** @class RelayQueue
+     *
+     *  Transaction announcements waiting to go to one node. Every transaction the node has told us about, sent us,
+     *  or been sent or announced by us goes into a rolling filter of its known inventory, and is never announced to
+     *  it again. Announcements are held for a short interval so they go out as one notify packet with many hashes,
+     *  rather than one packet per transaction.
+     *
+     **/
+    class RelayQueue
+    {
+        /** Mutex for thread concurrency. **/
+        mutable std::mutex MUTEX;
+
+
+        /** The transactions the node is known to have. **/
+        rollingfilter filterKnown;
+
+
+        /** The announcements waiting to be sent, flagged for legacy. **/
+        std::vector<std::pair<bool, uint512_t>> vPending;
+
+
+        /** The time in ms announcements are held for. **/
+        const uint64_t nInterval;
+
+
+        /** Timestamp in ms of the first waiting announcement. **/
+        uint64_t nFirst;
+
+
+        /** Number of announcements skipped as already known. **/
+        uint64_t nSuppressed;
+
+
+    public:
+
+        /** Default Constructor. **/
+        RelayQueue() = delete;
+
+
+        /** Copy Constructor. **/
+        RelayQueue(const RelayQueue& queue) = delete;
+
+
+        /** Copy Assignment. **/
+        RelayQueue& operator=(const RelayQueue& queue) = delete;
+
+
+        /** Constructor
+         *
+         *  @param[in] nKnown The number of most recent known transactions to remember.
+         *  @param[in] nIntervalIn The time in ms announcements are held for.
+         *
+         **/
+        RelayQueue(const uint32_t nKnown, const uint64_t nIntervalIn);
+
+
+        /** Known
+         *
+         *  Mark a transaction as known to the node.
+         *
+         *  @param[in] hashTx The transaction hash.
+         *
+         **/
+        void Known(const uint512_t& hashTx);
+
+
+        /** Has
+         *
+         *  Check if a transaction is known to the node.
+         *
+         *  @param[in] hashTx The transaction hash.
+         *
+         **/
+        bool Has(const uint512_t& hashTx) const;
+
+
+        /** Queue
+         *
+         *  Queue a transaction to be announced, unless the node already knows it.
+         *
+         *  @param[in] hashTx The transaction hash.
+         *  @param[in] fLegacy Flag for a legacy transaction.
+         *
+         *  @return True if the announcement was queued.
+         *
+         **/
+        bool Queue(const uint512_t& hashTx, const bool fLegacy);
+
+
+        /** Ready
+         *
+         *  Check if the waiting announcements should be sent, once held for the interval or a packet is full.
+         *
+         *  @param[in] nMax The most announcements in one packet.
+         *
+         **/
+        bool Ready(const uint32_t nMax) const;
+
+
+        /** Take
+         *
+         *  Take the oldest waiting announcements.
+         *
+         *  @param[in] nMax The most announcements to take.
+         *
+         *  @return The announcements in the order they were queued, flagged for legacy.
+         *
+         **/
+        std::vector<std::pair<bool, uint512_t>> Take(const uint32_t nMax);
+
+
+        /** Pending
+         *
+         *  Get the number of waiting announcements.
+         *
+         **/
+        uint32_t Pending() const;
+
+
+        /** Suppressed
+         *
+         *  Get the number of announcements skipped as already known.
+         *
+         **/
+        uint64_t Suppressed() const;
+
+    };
+}
+
+#endif
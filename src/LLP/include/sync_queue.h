@@ -0,0 +1,372 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_SYNC_QUEUE_H
+#define NEXUS_LLP_INCLUDE_SYNC_QUEUE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <TAO/Ledger/types/block.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace LLP
+{
+
+    /** @class SyncQueue
+     *
+     *  Tracks a headers-first parallel sync. The sync node sends the header chain ahead of our best block, which is
+     *  cut into windows of heights that are requested from every connected node at once. Blocks arrive out of order,
+     *  are checked against their header hash, and wait in a reorder buffer until they can be connected in height
+     *  order.
+     *
+     *  Each node's throughput is tracked so faster nodes are handed windows first, and a node that has not delivered
+     *  a block within the stall timeout loses its windows to the others.
+     *
+     **/
+    class SyncQueue
+    {
+        /** A range of heights requested from one node. **/
+        struct Window
+        {
+            /** The next height still expected, advanced as blocks arrive. **/
+            uint32_t nStart;
+
+            /** The last height of the window. **/
+            uint32_t nEnd;
+
+            /** The session the window is assigned to, or 0 if it needs to be requested again. **/
+            uint64_t nSession;
+        };
+
+
+        /** Download statistics for one node. **/
+        struct Peer
+        {
+            /** Number of blocks received. **/
+            uint64_t nBlocks;
+
+            /** Number of bytes received. **/
+            uint64_t nBytes;
+
+            /** Timestamp in ms the node was first given a window. **/
+            uint64_t nFirst;
+
+            /** Timestamp in ms of the last block received, or the last window assigned. **/
+            uint64_t nLast;
+
+            /** Number of windows in flight. **/
+            uint32_t nWindows;
+
+            /** Number of times the node stalled. **/
+            uint32_t nStalls;
+        };
+
+
+        /** Mutex for thread concurrency. **/
+        mutable std::mutex MUTEX;
+
+
+        /** The number of heights in each window. **/
+        const uint32_t nWindowSize;
+
+
+        /** The most heights past the connected tip that can be requested. **/
+        const uint32_t nMaxAhead;
+
+
+        /** The number of windows one node can have in flight. **/
+        const uint32_t nMaxWindows;
+
+
+        /** Flag to tell if a sync is running. **/
+        bool fActive;
+
+
+        /** Flag to tell if a header request is outstanding. **/
+        bool fHeadersPending;
+
+
+        /** Flag to tell if the sync node has no more headers. **/
+        bool fHeadersComplete;
+
+
+        /** The next height to connect. **/
+        uint32_t nNextHeight;
+
+
+        /** The height of the last header. **/
+        uint32_t nHeaderHeight;
+
+
+        /** Timestamp in ms of the outstanding header request. **/
+        uint64_t nHeaderRequest;
+
+
+        /** The first height not yet cut into a window. **/
+        uint32_t nNextWindow;
+
+
+        /** Header hashes by height, from the connected tip up. **/
+        std::map<uint32_t, uint1024_t> mapHeaders;
+
+
+        /** Windows in flight, keyed by their last height. **/
+        std::map<uint32_t, Window> mapWindows;
+
+
+        /** Blocks waiting to be connected, by height. **/
+        std::map<uint32_t, std::unique_ptr<TAO::Ledger::Block>> mapBlocks;
+
+
+        /** Download statistics by session. **/
+        std::map<uint64_t, Peer> mapPeers;
+
+
+    public:
+
+        /** Number of stalls before a node is no longer given windows. **/
+        static const uint32_t MAX_STALLS = 3;
+
+
+        /** Time in ms before an unanswered header request is made again. **/
+        static const uint64_t HEADER_TIMEOUT = 10000;
+
+
+        /** Default Constructor. **/
+        SyncQueue() = delete;
+
+
+        /** Copy Constructor. **/
+        SyncQueue(const SyncQueue& queue) = delete;
+
+
+        /** Copy Assignment. **/
+        SyncQueue& operator=(const SyncQueue& queue) = delete;
+
+
+        /** Constructor
+         *
+         *  @param[in] nWindowSizeIn The number of heights in each window.
+         *  @param[in] nMaxAheadIn The most heights past the connected tip that can be requested.
+         *  @param[in] nMaxWindowsIn The number of windows one node can have in flight.
+         *
+         **/
+        SyncQueue(const uint32_t nWindowSizeIn, const uint32_t nMaxAheadIn, const uint32_t nMaxWindowsIn = 2);
+
+
+        /** Destructor. **/
+        ~SyncQueue();
+
+
+        /** Reset
+         *
+         *  Start a new sync from the connected tip, dropping everything from the last one.
+         *
+         *  @param[in] nHeight The height of the best block.
+         *  @param[in] hashBest The hash of the best block.
+         *
+         **/
+        void Reset(const uint32_t nHeight, const uint1024_t& hashBest);
+
+
+        /** Stop
+         *
+         *  Stop the sync and free its buffers.
+         *
+         **/
+        void Stop();
+
+
+        /** Active
+         *
+         *  Check if a sync is running.
+         *
+         **/
+        bool Active() const;
+
+
+        /** AddHeader
+         *
+         *  Add the next header of the chain being synced.
+         *
+         *  @param[in] nHeight The height of the header.
+         *  @param[in] hashBlock The hash of the header.
+         *  @param[in] hashPrev The previous block hash, which has to be the current last header.
+         *
+         *  @return True if the header extends the chain, or is one we already have at its height.
+         *
+         **/
+        bool AddHeader(const uint32_t nHeight, const uint1024_t& hashBlock, const uint1024_t& hashPrev);
+
+
+        /** RequestHeaders
+         *
+         *  Check if more headers should be asked for, marking the request as outstanding. A request that is not
+         *  answered within the header timeout is made again.
+         *
+         *  @param[out] hashFrom The last header to list from.
+         *
+         *  @return True if headers should be requested.
+         *
+         **/
+        bool RequestHeaders(uint1024_t &hashFrom);
+
+
+        /** HeadersReceived
+         *
+         *  Mark the outstanding header request as answered once the sync node's list ends at our last header.
+         *
+         *  @param[in] hashLast The last block the sync node listed.
+         *  @param[in] nPeerHeight The best height of the sync node, the headers are complete once they reach it.
+         *
+         **/
+        void HeadersReceived(const uint1024_t& hashLast, const uint32_t nPeerHeight);
+
+
+        /** Assign
+         *
+         *  Hand the next window to a node, re-using windows freed by stalled nodes first.
+         *
+         *  @param[in] nSession The session of the node.
+         *  @param[in] nPeerHeight The best height the node has.
+         *  @param[out] hashStart The block before the window, to list from.
+         *  @param[out] hashStop The last block of the window.
+         *
+         *  @return True if a window was assigned.
+         *
+         **/
+        bool Assign(const uint64_t nSession, const uint32_t nPeerHeight, uint1024_t &hashStart, uint1024_t &hashStop);
+
+
+        /** Add
+         *
+         *  Add a downloaded block to the reorder buffer.
+         *
+         *  @param[in] nSession The session of the node that sent it.
+         *  @param[in] pBlock The block, checked against the header at its height.
+         *  @param[in] nBytes The size of the block on the wire.
+         *
+         *  @return True if the block is in the header chain, false if it doesn't match.
+         *
+         **/
+        bool Add(const uint64_t nSession, std::unique_ptr<TAO::Ledger::Block>&& pBlock, const uint64_t nBytes);
+
+
+        /** Next
+         *
+         *  Take the next block to connect.
+         *
+         *  @return The block, or nullptr if it hasn't arrived yet.
+         *
+         **/
+        std::unique_ptr<TAO::Ledger::Block> Next();
+
+
+        /** Ready
+         *
+         *  Check if the next block to connect has arrived.
+         *
+         **/
+        bool Ready() const;
+
+
+        /** Done
+         *
+         *  Check if every header has been received and connected.
+         *
+         **/
+        bool Done() const;
+
+
+        /** Stalled
+         *
+         *  Free the windows of nodes that have not delivered a block within the timeout.
+         *
+         *  @param[in] nTimeout The stall timeout in milliseconds.
+         *
+         *  @return The sessions of the stalled nodes.
+         *
+         **/
+        std::vector<uint64_t> Stalled(const uint64_t nTimeout);
+
+
+        /** Remove
+         *
+         *  Free the windows of a disconnected node and drop its statistics.
+         *
+         *  @param[in] nSession The session of the node.
+         *
+         **/
+        void Remove(const uint64_t nSession);
+
+
+        /** Throughput
+         *
+         *  Get the download rate of a node in bytes per second.
+         *
+         *  @param[in] nSession The session of the node.
+         *
+         **/
+        uint64_t Throughput(const uint64_t nSession) const;
+
+
+        /** Height
+         *
+         *  Get the next height to connect.
+         *
+         **/
+        uint32_t Height() const;
+
+
+        /** HeaderHeight
+         *
+         *  Get the height of the last header.
+         *
+         **/
+        uint32_t HeaderHeight() const;
+
+
+        /** Buffered
+         *
+         *  Get the number of blocks waiting to be connected.
+         *
+         **/
+        uint32_t Buffered() const;
+
+
+        /** Windows
+         *
+         *  Get the number of windows in flight or waiting to be requested again.
+         *
+         **/
+        uint32_t Windows() const;
+
+
+    private:
+
+        /** release
+         *
+         *  Free a window from its node, MUTEX must be held.
+         *
+         **/
+        void release(Window& window);
+
+    };
+}
+
+#endif
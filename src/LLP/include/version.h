@@ -24,7 +24,7 @@ namespace LLP
     /* The current Protocol Version. */
     const uint32_t PROTOCOL_MAJOR     = 3;
     const uint32_t PROTOCOL_MINOR     = 6;
-    const uint32_t PROTOCOL_REVISION  = 0;
+    const uint32_t PROTOCOL_REVISION  = 1;
     const uint32_t PROTOCOL_BUILD     = 0;
 
 
@@ -48,6 +48,10 @@ namespace LLP
     const uint32_t MIN_TRITIUM_CLIENT_VERSION = 3060000;
 
 
+    /* Used to define the baseline of compact block relay. */
+    const uint32_t MIN_COMPACT_VERSION = 3060100;
+
+
     /* The name that will be shared with other nodes. */
     const std::string strProtocolName = "Tritium";
 
@@ -34,6 +34,8 @@ namespace LLP
     /* Default constructor */
     AddressManager::AddressManager(uint16_t nPortIn)
     : mapTrustAddress()
+    , setSelect()
+    , mapSelect()
     , mapBanned()
     , mapDNS()
     , MUTEX()
@@ -134,6 +136,7 @@ namespace LLP
 
         /* Update the stats for this address based on the nState. */
         update_state(&trust_addr, nState);
+        update_select(hash);
 
         /* Update the LLD Address database for this entry */
         pDatabase->WriteTrustAddress(hash, trust_addr);
@@ -242,6 +245,7 @@ namespace LLP
         if(it != mapTrustAddress.end())
         {
             it->second.nLatency = lat;
+            update_select(hash);
 
             /* Update the LLD Address database for this entry */
             pDatabase->WriteTrustAddress(hash, it->second);
@@ -270,25 +274,15 @@ namespace LLP
     /*  Select a good address to connect to that isn't already connected. */
     bool AddressManager::StochasticSelect(BaseAddress &addr)
     {
-        std::vector<TrustAddress> vAddresses;
         uint64_t nSelect = 0;
         uint64_t nTimestamp = runtime::unifiedtimestamp();
         uint64_t nRand = LLC::GetRand(nTimestamp);
         uint32_t nHash = LLC::SK32(BEGIN(nRand), END(nRand));
 
+        LOCK(MUTEX);
 
-        /* Put unconnected address info scores into a vector and sort them. */
-        uint8_t nFlags = ConnectState::NEW     |
-                         ConnectState::FAILED  |
-                         ConnectState::DROPPED ;
-
-        /* Critical section: Get address info for the selected nFlags. */
-        {
-            LOCK(MUTEX);
-            get_addresses(vAddresses, nFlags, ConnectState::CONNECTED);
-        }
-
-        uint64_t nSize = vAddresses.size();
+        /* The selection index holds the unconnected addresses, best score first. */
+        uint64_t nSize = setSelect.size();
 
         if(nSize == 0)
             return false;
@@ -300,13 +294,11 @@ namespace LLP
         if(nSelect >= nSize)
           return debug::error(FUNCTION, "index out of bounds");
 
-        /* sort info vector and assign the selected address */
-        std::sort(vAddresses.begin(), vAddresses.end());
-        std::reverse(vAddresses.begin(), vAddresses.end());
+        /* Assign the selected address. */
+        const TrustAddress& select = mapTrustAddress.at(setSelect.at(nSelect).hash);
 
-
-        addr.SetIP(vAddresses[nSelect]);
-        addr.SetPort(vAddresses[nSelect].GetPort());
+        addr.SetIP(select);
+        addr.SetPort(select.GetPort());
 
         return true;
     }
@@ -383,6 +375,8 @@ namespace LLP
 
             /* Make sure the map is empty. */
             mapTrustAddress.clear();
+            setSelect.clear();
+            mapSelect.clear();
             mapBanned.clear();
 
             /* Make sure the database exists. */
@@ -406,6 +400,7 @@ namespace LLP
                         /* Get the hash and load it into the map. */
                         uint64_t hash = addr.GetHash();
                         mapTrustAddress[hash] = addr;
+                        update_select(hash);
 
                         hashLast = hash;
                     }
@@ -496,6 +491,7 @@ namespace LLP
         {
             /* Clear from memory. */
             mapTrustAddress.erase(nHash);
+            update_select(nHash);
 
             /* Clear from disk. */
             if(pDatabase)
@@ -615,4 +611,37 @@ namespace LLP
             pAddr->nState   = nState;
         }
     }
+
+
+    /*  Moves an address to its place in the selection index. */
+    void AddressManager::update_select(const uint64_t hash)
+    {
+        /* Take the address out at its old position. */
+        auto itKey = mapSelect.find(hash);
+        if(itKey != mapSelect.end())
+        {
+            setSelect.erase(itKey->second);
+            mapSelect.erase(itKey);
+        }
+
+        /* Check the address is still known and not banned. */
+        auto it = mapTrustAddress.find(hash);
+        if(it == mapTrustAddress.end() || is_banned(hash))
+            return;
+
+        /* Only unconnected addresses can be selected. */
+        const TrustAddress& trust_addr = it->second;
+        const uint8_t nFlags = ConnectState::NEW     |
+                               ConnectState::FAILED  |
+                               ConnectState::DROPPED ;
+
+        if(!(trust_addr.nState & nFlags) || (trust_addr.nState & ConnectState::CONNECTED))
+            return;
+
+        /* Put it back in at its new score. */
+        const SelectKey key = { trust_addr.Score(), trust_addr.nLatency, hash };
+
+        setSelect.insert(key);
+        mapSelect[hash] = key;
+    }
 }
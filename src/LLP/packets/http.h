@@ -283,8 +283,8 @@ namespace LLP
                 strReply +=
                     debug::safe_printstr("Content-Length: ", strContent.size(), "\r\n");
 
-                /* Set our content type for JSON if applicable. */
-                if(encoding::json::accept(strContent))
+                /* Set our content type for JSON if applicable, unless the content type has already been given. */
+                if(!mapHeaders.count("Content-Type") && encoding::json::accept(strContent))
                     strReply += std::string("Content-Type: application/json\r\n");
             }
 
@@ -292,8 +292,9 @@ namespace LLP
             for(const auto& header : mapHeaders)
                 strReply += debug::safe_printstr(header.first, ": ", header.second, "\r\n");;
 
-            /* Add end of header and content. */
-            strReply += debug::safe_printstr("\r\n", strContent);
+            /* Add end of header and content, appending directly since it may be binary. */
+            strReply += "\r\n";
+            strReply += strContent;
 
             //get the bytes to submit over socket
             std::vector<uint8_t> vBytes(strReply.begin(), strReply.end());
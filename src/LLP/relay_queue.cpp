@@ -0,0 +1,121 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/relay_queue.h>
+
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+#include <algorithm>
+
+namespace LLP
+{
+
+    /* Constructor */
+    RelayQueue::RelayQueue(const uint32_t nKnown, const uint64_t nIntervalIn)
+    : MUTEX       ( )
+    , filterKnown (nKnown)
+    , vPending    ( )
+    , nInterval   (nIntervalIn)
+    , nFirst      (0)
+    , nSuppressed (0)
+    {
+    }
+
+
+    /* Mark a transaction as known to the node. */
+    void RelayQueue::Known(const uint512_t& hashTx)
+    {
+        LOCK(MUTEX);
+        filterKnown.insert(hashTx.Get64(0));
+    }
+
+
+    /* Check if a transaction is known to the node. */
+    bool RelayQueue::Has(const uint512_t& hashTx) const
+    {
+        LOCK(MUTEX);
+        return filterKnown.contains(hashTx.Get64(0));
+    }
+
+
+    /* Queue a transaction to be announced, unless the node already knows it. */
+    bool RelayQueue::Queue(const uint512_t& hashTx, const bool fLegacy)
+    {
+        LOCK(MUTEX);
+
+        /* Skip transactions the node has, or was already announced. */
+        const uint64_t nKey = hashTx.Get64(0);
+        if(filterKnown.contains(nKey))
+        {
+            ++nSuppressed;
+            return false;
+        }
+
+        filterKnown.insert(nKey);
+
+        /* Start the interval on the first announcement. */
+        if(vPending.empty())
+            nFirst = runtime::timestamp(true);
+
+        vPending.push_back(std::make_pair(fLegacy, hashTx));
+
+        return true;
+    }
+
+
+    /* Check if the waiting announcements should be sent, once held for the interval or a packet is full. */
+    bool RelayQueue::Ready(const uint32_t nMax) const
+    {
+        LOCK(MUTEX);
+
+        if(vPending.empty())
+            return false;
+
+        return (vPending.size() >= nMax || nFirst + nInterval <= runtime::timestamp(true));
+    }
+
+
+    /* Take the oldest waiting announcements. */
+    std::vector<std::pair<bool, uint512_t>> RelayQueue::Take(const uint32_t nMax)
+    {
+        LOCK(MUTEX);
+
+        /* Split off the oldest announcements. */
+        const uint64_t nTake = std::min(uint64_t(nMax), uint64_t(vPending.size()));
+        std::vector<std::pair<bool, uint512_t>> vTake(vPending.begin(), vPending.begin() + nTake);
+        vPending.erase(vPending.begin(), vPending.begin() + nTake);
+
+        /* The rest were queued after the first, and go out with the next packet. */
+        if(!vPending.empty())
+            nFirst = 0;
+
+        return vTake;
+    }
+
+
+    /* Get the number of waiting announcements. */
+    uint32_t RelayQueue::Pending() const
+    {
+        LOCK(MUTEX);
+        return static_cast<uint32_t>(vPending.size());
+    }
+
+
+    /* Get the number of announcements skipped as already known. */
+    uint64_t RelayQueue::Suppressed() const
+    {
+        LOCK(MUTEX);
+        return nSuppressed;
+    }
+}
@@ -253,7 +253,7 @@ namespace LLP
          {
              /* Add new filter to map if it doesn't exist. */
              if(!DDOS_MAP->count(addrConnect))
-                 DDOS_MAP->emplace(std::make_pair(addrConnect, new DDOS_Filter(CONFIG.DDOS_TIMESPAN)));
+                 DDOS_MAP->emplace(std::make_pair(addrConnect, new DDOS_Filter(CONFIG.DDOS_TIMESPAN, CONFIG.DDOS_RSCORE, CONFIG.DDOS_COMMANDS)));
 
              /* DDOS Operations: Only executed when DDOS is enabled. */
              if(!addrConnect.IsLocal() && DDOS_MAP->at(addrConnect)->Banned())
@@ -699,7 +699,7 @@ namespace LLP
 
                     /* Create new DDOS Filter if Needed. */
                     if(CONFIG.ENABLE_DDOS && !DDOS_MAP->count(addr))
-                        DDOS_MAP->insert(std::make_pair(addr, new DDOS_Filter(CONFIG.DDOS_TIMESPAN)));
+                        DDOS_MAP->insert(std::make_pair(addr, new DDOS_Filter(CONFIG.DDOS_TIMESPAN, CONFIG.DDOS_RSCORE, CONFIG.DDOS_COMMANDS)));
 
                     /* Establish a new socket with SSL on or off according to server. */
                     Socket sockNew(hSocket, addr, fSSL);
@@ -0,0 +1,407 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/sync_queue.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+#include <algorithm>
+
+namespace LLP
+{
+
+    /* Constructor */
+    SyncQueue::SyncQueue(const uint32_t nWindowSizeIn, const uint32_t nMaxAheadIn, const uint32_t nMaxWindowsIn)
+    : MUTEX            ( )
+    , nWindowSize      (std::max(1u, nWindowSizeIn))
+    , nMaxAhead        (std::max(nWindowSize, nMaxAheadIn))
+    , nMaxWindows      (std::max(1u, nMaxWindowsIn))
+    , fActive          (false)
+    , fHeadersPending  (false)
+    , fHeadersComplete (false)
+    , nNextHeight      (0)
+    , nHeaderHeight    (0)
+    , nHeaderRequest   (0)
+    , nNextWindow      (0)
+    , mapHeaders       ( )
+    , mapWindows       ( )
+    , mapBlocks        ( )
+    , mapPeers         ( )
+    {
+    }
+
+
+    /* Destructor. */
+    SyncQueue::~SyncQueue()
+    {
+    }
+
+
+    /* Start a new sync from the connected tip, dropping everything from the last one. */
+    void SyncQueue::Reset(const uint32_t nHeight, const uint1024_t& hashBest)
+    {
+        LOCK(MUTEX);
+
+        mapHeaders.clear();
+        mapWindows.clear();
+        mapBlocks.clear();
+        mapPeers.clear();
+
+        /* The best block anchors the header chain. */
+        mapHeaders[nHeight] = hashBest;
+
+        fActive          = true;
+        fHeadersPending  = false;
+        fHeadersComplete = false;
+        nNextHeight      = nHeight + 1;
+        nHeaderHeight    = nHeight;
+        nHeaderRequest   = 0;
+        nNextWindow      = nHeight + 1;
+    }
+
+
+    /* Stop the sync and free its buffers. */
+    void SyncQueue::Stop()
+    {
+        LOCK(MUTEX);
+
+        mapHeaders.clear();
+        mapWindows.clear();
+        mapBlocks.clear();
+        mapPeers.clear();
+
+        fActive = false;
+    }
+
+
+    /* Check if a sync is running. */
+    bool SyncQueue::Active() const
+    {
+        LOCK(MUTEX);
+        return fActive;
+    }
+
+
+    /* Add the next header of the chain being synced. */
+    bool SyncQueue::AddHeader(const uint32_t nHeight, const uint1024_t& hashBlock, const uint1024_t& hashPrev)
+    {
+        LOCK(MUTEX);
+
+        /* Check for a header we already have, as lists start from the last one sent. */
+        if(nHeight <= nHeaderHeight)
+        {
+            auto it = mapHeaders.find(nHeight);
+            return (it != mapHeaders.end() && it->second == hashBlock);
+        }
+
+        /* Headers have to extend the last one. */
+        if(!fActive || nHeight != nHeaderHeight + 1)
+            return false;
+
+        auto itPrev = mapHeaders.find(nHeaderHeight);
+        if(itPrev == mapHeaders.end() || itPrev->second != hashPrev)
+            return false;
+
+        /* Nothing is kept above the last header, so a header already at this height is a conflict. */
+        if(!mapHeaders.emplace(nHeight, hashBlock).second)
+            return debug::error(FUNCTION, "conflicting header at height ", nHeight);
+
+        nHeaderHeight = nHeight;
+
+        return true;
+    }
+
+
+    /* Check if more headers should be asked for, marking the request as outstanding. */
+    bool SyncQueue::RequestHeaders(uint1024_t &hashFrom)
+    {
+        LOCK(MUTEX);
+
+        /* Check for a request still waiting on its answer. */
+        const uint64_t nTimestamp = runtime::timestamp(true);
+        if(!fActive || fHeadersComplete || (fHeadersPending && nHeaderRequest + HEADER_TIMEOUT > nTimestamp))
+            return false;
+
+        /* Only keep twice the download horizon of headers ahead. */
+        if(nHeaderHeight >= nNextHeight + nMaxAhead * 2)
+            return false;
+
+        hashFrom        = mapHeaders[nHeaderHeight];
+        nHeaderRequest  = nTimestamp;
+        fHeadersPending = true;
+
+        return true;
+    }
+
+
+    /* Mark the outstanding header request as answered once the sync node's list ends at our last header. */
+    void SyncQueue::HeadersReceived(const uint1024_t& hashLast, const uint32_t nPeerHeight)
+    {
+        LOCK(MUTEX);
+
+        /* Lists of block windows end elsewhere. */
+        if(!fActive || hashLast != mapHeaders[nHeaderHeight])
+            return;
+
+        fHeadersPending = false;
+        if(nHeaderHeight >= nPeerHeight)
+            fHeadersComplete = true;
+    }
+
+
+    /* Hand the next window to a node, re-using windows freed by stalled nodes first. */
+    bool SyncQueue::Assign(const uint64_t nSession, const uint32_t nPeerHeight, uint1024_t &hashStart, uint1024_t &hashStop)
+    {
+        LOCK(MUTEX);
+
+        /* Check the node can take another window. */
+        if(!fActive || nSession == 0)
+            return false;
+
+        /* Start tracking the node on its first window. */
+        const uint64_t nTimestamp = runtime::timestamp(true);
+        if(!mapPeers.count(nSession))
+            mapPeers[nSession] = { 0, 0, nTimestamp, nTimestamp, 0, 0 };
+
+        Peer& peer = mapPeers[nSession];
+        if(peer.nStalls >= MAX_STALLS || peer.nWindows >= nMaxWindows)
+            return false;
+
+        /* Re-use the lowest freed window the node can serve. */
+        Window* pWindow = nullptr;
+        for(auto& window : mapWindows)
+        {
+            if(window.second.nSession == 0 && window.second.nEnd <= nPeerHeight)
+            {
+                pWindow = &window.second;
+                break;
+            }
+        }
+
+        /* Cut a new window from the headers if there are none to re-use. */
+        if(!pWindow)
+        {
+            /* Check the headers and the download horizon. */
+            if(nNextWindow > nHeaderHeight || nNextWindow >= nNextHeight + nMaxAhead || nNextWindow > nPeerHeight)
+                return false;
+
+            const uint32_t nEnd = std::min({nNextWindow + nWindowSize - 1, nHeaderHeight, nPeerHeight});
+            pWindow = &mapWindows[nEnd];
+            pWindow->nStart   = nNextWindow;
+            pWindow->nEnd     = nEnd;
+            pWindow->nSession = 0;
+
+            nNextWindow = nEnd + 1;
+        }
+
+        /* List from the block before the window, up to its last block. */
+        hashStart = mapHeaders[pWindow->nStart - 1];
+        hashStop  = mapHeaders[pWindow->nEnd];
+
+        pWindow->nSession = nSession;
+
+        ++peer.nWindows;
+        peer.nLast = nTimestamp;
+
+        return true;
+    }
+
+
+    /* Add a downloaded block to the reorder buffer. */
+    bool SyncQueue::Add(const uint64_t nSession, std::unique_ptr<TAO::Ledger::Block>&& pBlock, const uint64_t nBytes)
+    {
+        LOCK(MUTEX);
+
+        /* Check the block against its header. */
+        const uint32_t nHeight = pBlock->nHeight;
+        auto itHeader = mapHeaders.find(nHeight);
+        if(!fActive || itHeader == mapHeaders.end() || itHeader->second != pBlock->GetHash())
+            return false;
+
+        /* Count the download for the node. */
+        auto itPeer = mapPeers.find(nSession);
+        if(itPeer != mapPeers.end())
+        {
+            ++itPeer->second.nBlocks;
+            itPeer->second.nBytes += nBytes;
+            itPeer->second.nLast   = runtime::timestamp(true);
+        }
+
+        /* Skip blocks already connected or buffered. */
+        if(nHeight < nNextHeight || mapBlocks.count(nHeight))
+            return true;
+
+        mapBlocks[nHeight] = std::move(pBlock);
+
+        /* Advance the window waiting on this height. */
+        auto itWindow = mapWindows.lower_bound(nHeight);
+        if(itWindow != mapWindows.end() && itWindow->second.nStart == nHeight)
+        {
+            Window& window = itWindow->second;
+            while(window.nStart <= window.nEnd && mapBlocks.count(window.nStart))
+                ++window.nStart;
+
+            /* Retire finished windows. */
+            if(window.nStart > window.nEnd)
+            {
+                release(window);
+                mapWindows.erase(itWindow);
+            }
+        }
+
+        return true;
+    }
+
+
+    /* Take the next block to connect. */
+    std::unique_ptr<TAO::Ledger::Block> SyncQueue::Next()
+    {
+        LOCK(MUTEX);
+
+        /* Check that the next block has arrived. */
+        auto it = mapBlocks.find(nNextHeight);
+        if(it == mapBlocks.end())
+            return nullptr;
+
+        std::unique_ptr<TAO::Ledger::Block> pBlock = std::move(it->second);
+        mapBlocks.erase(it);
+
+        /* Only the header below the next height is still needed, to list windows from. */
+        mapHeaders.erase(nNextHeight - 1);
+        ++nNextHeight;
+
+        return pBlock;
+    }
+
+
+    /* Check if the next block to connect has arrived. */
+    bool SyncQueue::Ready() const
+    {
+        LOCK(MUTEX);
+        return mapBlocks.count(nNextHeight);
+    }
+
+
+    /* Check if every header has been received and connected. */
+    bool SyncQueue::Done() const
+    {
+        LOCK(MUTEX);
+        return fActive && fHeadersComplete && nNextHeight > nHeaderHeight;
+    }
+
+
+    /* Free the windows of nodes that have not delivered a block within the timeout. */
+    std::vector<uint64_t> SyncQueue::Stalled(const uint64_t nTimeout)
+    {
+        LOCK(MUTEX);
+
+        /* Find the nodes that are holding windows without progress. */
+        const uint64_t nTimestamp = runtime::timestamp(true);
+
+        std::vector<uint64_t> vStalled;
+        for(auto& peer : mapPeers)
+        {
+            if(peer.second.nWindows > 0 && peer.second.nLast + nTimeout <= nTimestamp)
+            {
+                ++peer.second.nStalls;
+                vStalled.push_back(peer.first);
+            }
+        }
+
+        /* Free their windows for the other nodes. */
+        for(auto& window : mapWindows)
+        {
+            if(window.second.nSession != 0 && std::find(vStalled.begin(), vStalled.end(), window.second.nSession) != vStalled.end())
+                release(window.second);
+        }
+
+        return vStalled;
+    }
+
+
+    /* Free the windows of a disconnected node and drop its statistics. */
+    void SyncQueue::Remove(const uint64_t nSession)
+    {
+        LOCK(MUTEX);
+
+        for(auto& window : mapWindows)
+        {
+            if(window.second.nSession == nSession)
+                release(window.second);
+        }
+
+        mapPeers.erase(nSession);
+    }
+
+
+    /* Get the download rate of a node in bytes per second. */
+    uint64_t SyncQueue::Throughput(const uint64_t nSession) const
+    {
+        LOCK(MUTEX);
+
+        auto it = mapPeers.find(nSession);
+        if(it == mapPeers.end())
+            return 0;
+
+        return (it->second.nBytes * 1000) / (it->second.nLast - it->second.nFirst + 1);
+    }
+
+
+    /* Get the next height to connect. */
+    uint32_t SyncQueue::Height() const
+    {
+        LOCK(MUTEX);
+        return nNextHeight;
+    }
+
+
+    /* Get the height of the last header. */
+    uint32_t SyncQueue::HeaderHeight() const
+    {
+        LOCK(MUTEX);
+        return nHeaderHeight;
+    }
+
+
+    /* Get the number of blocks waiting to be connected. */
+    uint32_t SyncQueue::Buffered() const
+    {
+        LOCK(MUTEX);
+        return static_cast<uint32_t>(mapBlocks.size());
+    }
+
+
+    /* Get the number of windows in flight or waiting to be requested again. */
+    uint32_t SyncQueue::Windows() const
+    {
+        LOCK(MUTEX);
+        return static_cast<uint32_t>(mapWindows.size());
+    }
+
+
+    /* Free a window from its node, MUTEX must be held. */
+    void SyncQueue::release(Window& window)
+    {
+        /* Check the window is assigned. */
+        if(window.nSession == 0)
+            return;
+
+        auto it = mapPeers.find(window.nSession);
+        if(it != mapPeers.end() && it->second.nWindows > 0)
+            --it->second.nWindows;
+
+        window.nSession = 0;
+    }
+}
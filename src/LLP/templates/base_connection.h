@@ -299,6 +299,16 @@ namespace LLP
         void WritePacket(const PacketType& PACKET);
 
 
+        /** WritePacket
+         *
+         *  Write a single packet that is already serialized to the TCP stream.
+         *
+         *  @param[in] vBytes The bytes of the packet to write.
+         *
+         **/
+        void WritePacket(const std::vector<uint8_t>& vBytes);
+
+
         /** ReadPacket
          *
          *  Non-Blocking Packet reader to build a packet from TCP Connection.
@@ -18,7 +18,10 @@ ________________________________________________________________________________
 #include <Util/include/mutex.h>
 #include <Util/include/runtime.h>
 #include <Util/include/debug.h>
-#include <vector>
+
+#include <array>
+#include <atomic>
+#include <memory>
 
 namespace LLP
 {
@@ -42,35 +45,22 @@ namespace LLP
      *
      *  Class that tracks DDOS attempts on LLP Servers.
      *
-     *  Uses a Timer to calculate Request Score [rScore] and Connection Score [cScore]
-     *  as a unit of Score / Second. Pointer stored by Connection class and
-     *  Server Listener DDOS_MAP.
+     *  Uses a sliding window of per second buckets to calculate Request Score [rScore] and Connection Score [cScore]
+     *  as a unit of Score / Second. Pointer stored by Connection class and Server Listener DDOS_MAP.
+     *
+     *  Every data thread scores the same address, so the buckets are atomics that each pack the second they count
+     *  for with the score in that second. A bucket left over from an earlier pass of the window is restarted in
+     *  place, and no score update or read takes a lock.
      *
      **/
     class DDOS_Score
     {
-        /** Moving Average for tracking DDOS score thresholds. **/
-        std::vector< std::pair<bool, uint32_t> > SCORE;
-
-
-        /** Track time since last call for calculating overlap. **/
-        runtime::timer TIMER;
-
-
-        /** Current time iterator in minutes. **/
-        uint32_t nIterator;
-
+        /** Ring of per second buckets, with the second in the upper 32 bits and the score in the lower 32 bits. **/
+        std::unique_ptr<std::atomic<uint64_t>[]> SCORE;
 
-        /** Internal mutex for thread safety. **/
-        mutable std::mutex MUTEX;
 
-
-        /** Reset
-         *
-         *  Reset the Timer and the Score Flags to be Overwritten.
-         *
-         **/
-        void reset();
+        /** The number of seconds in the moving average. **/
+        const uint32_t nTimespan;
 
     public:
 
@@ -128,6 +118,56 @@ namespace LLP
     };
 
 
+    /** DDOS_Limit
+     *
+     *  Lock-free token bucket, kept as the time in microseconds the bucket would be full again. Taking a token pushes
+     *  that time one interval further out, and is refused once it is more than the burst ahead of now.
+     *
+     **/
+    class DDOS_Limit
+    {
+        /** Time in microseconds the bucket is full again. **/
+        std::atomic<uint64_t> nFull;
+
+    public:
+
+        /** Default Constructor. **/
+        DDOS_Limit();
+
+
+        /** Take
+         *
+         *  Take a token from the bucket if one is available.
+         *
+         *  @param[in] nNow The current time in microseconds.
+         *  @param[in] nInterval The time in microseconds to refill one token.
+         *  @param[in] nBurst The number of tokens the bucket holds.
+         *
+         *  @return True if a token was taken.
+         *
+         **/
+        bool Take(const uint64_t nNow, const uint64_t nInterval, const uint32_t nBurst);
+
+
+        /** Give
+         *
+         *  Return a token that was taken but not used.
+         *
+         *  @param[in] nInterval The time in microseconds to refill one token.
+         *
+         **/
+        void Give(const uint64_t nInterval);
+
+
+        /** Reset
+         *
+         *  Fill the bucket.
+         *
+         **/
+        void Reset();
+    };
+
+
     /** DDOS_Filter
      *
      * Filter to Contain DDOS Scores and Handle DDOS Bans.
@@ -138,6 +178,22 @@ namespace LLP
         /** Keep track of the total times banned. **/
         std::atomic<uint32_t> nTotalBans;
 
+
+        /** Requests per second the address is held to, or zero for no limit. **/
+        const uint32_t nRate;
+
+
+        /** Requests per second of any one command the address is held to, or zero for no limit. **/
+        const uint32_t nCommandRate;
+
+
+        /** Token bucket for all requests from the address. **/
+        DDOS_Limit rLIMIT;
+
+
+        /** Token buckets for each command from the address, by the low byte of the command. **/
+        std::array<DDOS_Limit, 256> vCOMMANDS;
+
     public:
 
         /** Timestamp in the future when ban is over. **/
@@ -157,9 +213,24 @@ namespace LLP
          *  Default Constructor
          *
          * @param[in] nTimespan The timespan to initialize scores with
+         * @param[in] nRateIn The requests per second the address is held to, or zero for no limit.
+         * @param[in] nCommandRateIn The requests per second of one command the address is held to, or zero for no limit.
+         *
+         **/
+        DDOS_Filter(const uint32_t nTimespan, const uint32_t nRateIn = 0, const uint32_t nCommandRateIn = 0);
+
+
+        /** Allow
+         *
+         *  Check a request against the address and command rates, taking a token from each if allowed. A request
+         *  that isn't allowed should be held back and checked again, rather than dropped.
+         *
+         *  @param[in] nCommand The command of the request.
+         *
+         *  @return True if the request can be processed now.
          *
          **/
-        DDOS_Filter(const uint32_t nTimespan);
+        bool Allow(const uint16_t nCommand);
 
 
         /** Ban
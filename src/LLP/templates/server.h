@@ -188,7 +188,7 @@ namespace LLP
             {
                 /* Add new filter to map if it doesn't exist. */
                 if(!DDOS_MAP->count(addrConnect))
-                    DDOS_MAP->emplace(std::make_pair(addrConnect, new DDOS_Filter(CONFIG.DDOS_TIMESPAN)));
+                    DDOS_MAP->emplace(std::make_pair(addrConnect, new DDOS_Filter(CONFIG.DDOS_TIMESPAN, CONFIG.DDOS_RSCORE, CONFIG.DDOS_COMMANDS)));
 
                 /* DDOS Operations: Only executed when DDOS is enabled. */
                 if(!addrConnect.IsLocal() && DDOS_MAP->at(addrConnect)->Banned())
@@ -37,6 +37,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/process.h>
 
 #include <TAO/Ledger/types/client.h>
+#include <TAO/Ledger/types/compactblock.h>
 #include <TAO/Ledger/types/locator.h>
 #include <TAO/Ledger/types/mempool.h>
 #include <TAO/Ledger/types/merkle.h>
@@ -57,6 +58,7 @@ ________________________________________________________________________________
 #include <Util/include/version.h>
 
 
+#include <algorithm>
 #include <climits>
 #include <memory>
 #include <iomanip>
@@ -117,6 +119,7 @@ namespace LLP
     , nSubscriptions(0)
     , nNotifications(0)
     , setSubscriptions()
+    , tRelayQueue(config::GetArg(std::string("-relayknown"), 20000), config::GetArg(std::string("-relayinterval"), 100))
     , nLastPing(0)
     , nLastSamples(0)
     , mapLatencyTracker()
@@ -128,6 +131,7 @@ namespace LLP
     , hashCheckpoint(0)
     , hashBestChain(0)
     , hashLastIndex(0)
+    , hashCompactMissing(0)
     , nConsecutiveOrphans(0)
     , nConsecutiveFails(0)
     , strFullVersion()
@@ -146,6 +150,7 @@ namespace LLP
     , nSubscriptions(0)
     , nNotifications(0)
     , setSubscriptions()
+    , tRelayQueue(config::GetArg(std::string("-relayknown"), 20000), config::GetArg(std::string("-relayinterval"), 100))
     , nLastPing(0)
     , nLastSamples(0)
     , mapLatencyTracker()
@@ -157,6 +162,7 @@ namespace LLP
     , hashCheckpoint(0)
     , hashBestChain(0)
     , hashLastIndex(0)
+    , hashCompactMissing(0)
     , nConsecutiveOrphans(0)
     , nConsecutiveFails(0)
     , strFullVersion()
@@ -175,6 +181,7 @@ namespace LLP
     , nSubscriptions(0)
     , nNotifications(0)
     , setSubscriptions()
+    , tRelayQueue(config::GetArg(std::string("-relayknown"), 20000), config::GetArg(std::string("-relayinterval"), 100))
     , nLastPing(0)
     , nLastSamples(0)
     , mapLatencyTracker()
@@ -186,6 +193,7 @@ namespace LLP
     , hashCheckpoint(0)
     , hashBestChain(0)
     , hashLastIndex(0)
+    , hashCompactMissing(0)
     , nConsecutiveOrphans(0)
     , nConsecutiveFails(0)
     , strFullVersion()
@@ -329,6 +337,23 @@ namespace LLP
                     }
                 }
 
+                /* Announce the transactions waiting for this node, in batches of hashes. */
+                while(tRelayQueue.Ready(ACTION::NOTIFY_MAX_ITEMS))
+                {
+                    /* Build the notification. */
+                    DataStream ssNotify(SER_NETWORK, MIN_PROTO_VERSION);
+                    for(const auto& tx : tRelayQueue.Take(ACTION::NOTIFY_MAX_ITEMS))
+                    {
+                        /* Check for legacy. */
+                        if(tx.first)
+                            ssNotify << uint8_t(SPECIFIER::LEGACY);
+
+                        ssNotify << uint8_t(TYPES::TRANSACTION) << tx.second;
+                    }
+
+                    WritePacket(NewMessage(ACTION::NOTIFY, ssNotify));
+                }
+
                 /* Handle subscribing to events from other nodes. */
                 if(!fInitialized.load() && fSynchronized.load() && nCurrentSession != 0)
                 {
@@ -393,6 +418,24 @@ namespace LLP
                     nLastTimeReceived.store(runtime::timestamp());
                 }
 
+
+                /* Hand the windows of stalled nodes to the others during a parallel sync. */
+                if(SYNC_QUEUE && SYNC_QUEUE->Active()
+                && nCurrentSession == TAO::Ledger::nSyncSession.load()
+                && nCurrentSession != 0)
+                {
+                    /* Get the stall timeout in milliseconds. */
+                    static const uint64_t nStallTimeout = config::GetArg(std::string("-syncstall"), 15) * 1000;
+
+                    /* Log the stalled nodes. */
+                    const std::vector<uint64_t> vStalled = SYNC_QUEUE->Stalled(nStallTimeout);
+                    for(const auto& nSession : vStalled)
+                        debug::log(0, NODE, "Sync window stalled on session ", std::hex, nSession);
+
+                    /* Request their windows again, and give windows to new connections. */
+                    RequestWindows(!vStalled.empty());
+                }
+
                 break;
             }
 
@@ -487,6 +530,13 @@ namespace LLP
                         SwitchNode();
                     }
 
+                    /* Free this node's sync windows for the others. */
+                    if(SYNC_QUEUE && SYNC_QUEUE->Active())
+                    {
+                        SYNC_QUEUE->Remove(nCurrentSession);
+                        RequestWindows(true);
+                    }
+
 
                     LOCK(SESSIONS_MUTEX);
 
@@ -1365,78 +1415,15 @@ namespace LLP
                                 /* Cache the block hash. */
                                 stateLast = state;
 
-                                /* Handle for special sync block type specifier. */
+                                /* Push the block with the requested specifier. */
                                 if(fSyncBlock)
-                                {
-                                    /* Build the sync block from state. */
-                                    TAO::Ledger::SyncBlock block(state);
-
-                                    /* Push message in response. */
-                                    PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::SYNC), block);
-                                }
-
-                                /* Handle for a client block header. */
+                                    PushBlock(state, SPECIFIER::SYNC);
                                 else if(fClientBlock)
-                                {
-                                    /* Build the client block from state. */
-                                    TAO::Ledger::ClientBlock block(state);
-
-                                    /* Push message in response. */
-                                    PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::CLIENT), block);
-                                }
+                                    PushBlock(state, SPECIFIER::CLIENT);
+                                else if(state.nVersion < 7)
+                                    PushBlock(state, SPECIFIER::LEGACY);
                                 else
-                                {
-                                    /* Check for version to send correct type */
-                                    if(state.nVersion < 7)
-                                    {
-                                        /* Build the legacy block from state. */
-                                        Legacy::LegacyBlock block(state);
-
-                                        /* Push message in response. */
-                                        PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::LEGACY), block);
-                                    }
-                                    else
-                                    {
-                                        /* Build the legacy block from state. */
-                                        TAO::Ledger::TritiumBlock block(state);
-
-                                        /* Check for transactions. */
-                                        if(fTransactions)
-                                        {
-                                            /* Loop through transactions. */
-                                            for(const auto& proof : block.vtx)
-                                            {
-                                                /* Basic checks for legacy transactions. */
-                                                if(proof.first == TAO::Ledger::TRANSACTION::LEGACY)
-                                                {
-                                                    /* Check the memory pool. */
-                                                    Legacy::Transaction tx;
-                                                    if(!LLD::Legacy->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
-                                                        continue;
-
-                                                    /* Push message of transaction. */
-                                                    PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::LEGACY), tx);
-                                                }
-
-                                                /* Basic checks for tritium transactions. */
-                                                else if(proof.first == TAO::Ledger::TRANSACTION::TRITIUM)
-                                                {
-                                                    /* Check the memory pool. */
-                                                    TAO::Ledger::Transaction tx;
-                                                    if(!LLD::Ledger->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
-                                                        continue;
-
-
-                                                    /* Push message of transaction. */
-                                                    PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::TRITIUM), tx);
-                                                }
-                                            }
-                                        }
-
-                                        /* Push message in response. */
-                                        PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::TRITIUM), block);
-                                    }
-                                }
+                                    PushBlock(state, fTransactions ? SPECIFIER::TRANSACTIONS : SPECIFIER::TRITIUM);
 
                                 /* Check for stop hash. */
                                 if(--nLimits <= 0 || hashStart == hashStop || fBufferFull.load()) //1MB limit
@@ -1485,6 +1472,7 @@ namespace LLP
 
                                     /* Push the transaction. */
                                     PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::TRITIUM), tx);
+                                    tRelayQueue.Known(hash);
                                 }
                             }
                         }
@@ -1503,6 +1491,7 @@ namespace LLP
 
                                 /* Push the transaction. */
                                 PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::LEGACY), tx);
+                                tRelayQueue.Known(hash);
                             }
                         }
 
@@ -1686,13 +1675,15 @@ namespace LLP
                     ssPacket >> nType;
 
                     /* Check for legacy or transactions specifiers. */
-                    bool fLegacy = false, fTransactions = false, fClient = false;
-                    if(nType == SPECIFIER::LEGACY || nType == SPECIFIER::TRANSACTIONS || nType == SPECIFIER::CLIENT)
+                    bool fLegacy = false, fTransactions = false, fClient = false, fCompact = false;
+                    if(nType == SPECIFIER::LEGACY || nType == SPECIFIER::TRANSACTIONS || nType == SPECIFIER::CLIENT
+                    || nType == SPECIFIER::COMPACT)
                     {
                         /* Set specifiers. */
                         fLegacy       = (nType == SPECIFIER::LEGACY);
                         fTransactions = (nType == SPECIFIER::TRANSACTIONS);
                         fClient       = (nType == SPECIFIER::CLIENT);
+                        fCompact      = (nType == SPECIFIER::COMPACT);
 
                         /* Go to next type in stream. */
                         ssPacket >> nType;
@@ -1727,22 +1718,16 @@ namespace LLP
                                     if(fClient)
                                         return debug::drop(NODE, "ACTION::GET: CLIENT specifier disabled for legacy blocks");
 
-                                    /* Build legacy block from state. */
-                                    Legacy::LegacyBlock block(state);
-
                                     /* Push block as response. */
-                                    PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::LEGACY), block);
+                                    PushBlock(state, SPECIFIER::LEGACY);
                                 }
                                 else
                                 {
                                     /* Handle for client blocks. */
                                     if(fClient)
                                     {
-                                        /* Build the client block and send off. */
-                                        TAO::Ledger::ClientBlock block(state);
-
                                         /* Push the new client block. */
-                                        PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::CLIENT), block);
+                                        PushBlock(state, SPECIFIER::CLIENT);
 
                                         /* Debug output. */
                                         debug::log(3, NODE, "ACTION::GET: CLIENT::BLOCK ", hashBlock.SubString());
@@ -1750,44 +1735,11 @@ namespace LLP
                                         break;
                                     }
 
-                                    /* Build tritium block from state. */
-                                    TAO::Ledger::TritiumBlock block(state);
-
-                                    /* Check for transactions. */
-                                    if(fTransactions)
-                                    {
-                                        /* Loop through transactions. */
-                                        for(const auto& proof : block.vtx)
-                                        {
-                                            /* Basic checks for legacy transactions. */
-                                            if(proof.first == TAO::Ledger::TRANSACTION::LEGACY)
-                                            {
-                                                /* Check the memory pool. */
-                                                Legacy::Transaction tx;
-                                                if(!LLD::Legacy->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
-                                                    continue;
-
-                                                /* Push message of transaction. */
-                                                PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::LEGACY), tx);
-                                            }
-
-                                            /* Basic checks for tritium transactions. */
-                                            else if(proof.first == TAO::Ledger::TRANSACTION::TRITIUM)
-                                            {
-                                                /* Check the memory pool. */
-                                                TAO::Ledger::Transaction tx;
-                                                if(!LLD::Ledger->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
-                                                    continue;
-
-
-                                                /* Push message of transaction. */
-                                                PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::TRITIUM), tx);
-                                            }
-                                        }
-                                    }
-
                                     /* Push block as response. */
-                                    PushMessage(TYPES::BLOCK, uint8_t(SPECIFIER::TRITIUM), block);
+                                    if(fCompact)
+                                        PushBlock(state, SPECIFIER::COMPACT);
+                                    else
+                                        PushBlock(state, fTransactions ? SPECIFIER::TRANSACTIONS : SPECIFIER::TRITIUM);
                                 }
                             }
 
@@ -1804,10 +1756,68 @@ namespace LLP
                             if(fTransactions || fClient)
                                 return debug::drop(NODE, "ACTION::GET::TRANSACTION: invalid specifier for TYPES::TRANSACTION");
 
+                            /* Handle for the transactions missing from a compact block. */
+                            if(fCompact)
+                            {
+                                /* Get the block and the positions of its missing transactions. */
+                                uint1024_t hashBlock;
+                                ssPacket >> hashBlock;
+
+                                std::vector<uint32_t> vIndexes;
+                                ssPacket >> vIndexes;
+
+                                /* Check the database for the block. */
+                                TAO::Ledger::BlockState state;
+                                if(!LLD::Ledger->ReadBlock(hashBlock, state) || state.nVersion < 7)
+                                    break;
+
+                                /* Check for more positions than the block has. */
+                                if(vIndexes.size() >= state.vtx.size())
+                                    return debug::drop(NODE, "ACTION::GET::COMPACT: too many transactions requested");
+
+                                /* Send the transactions, the producer is last in vtx and always sent with the block. */
+                                for(const uint32_t nIndex : vIndexes)
+                                {
+                                    /* Check the position is in the block. */
+                                    if(nIndex + 1 >= state.vtx.size())
+                                        return debug::drop(NODE, "ACTION::GET::COMPACT: transaction out of range");
+
+                                    /* Check for legacy. */
+                                    const auto& proof = state.vtx[nIndex];
+                                    tRelayQueue.Known(proof.second);
+
+                                    if(proof.first == TAO::Ledger::TRANSACTION::LEGACY)
+                                    {
+                                        /* Check legacy database. */
+                                        Legacy::Transaction tx;
+                                        if(LLD::Legacy->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
+                                            PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::LEGACY), tx);
+                                    }
+                                    else if(proof.first == TAO::Ledger::TRANSACTION::TRITIUM)
+                                    {
+                                        /* Check ledger database. */
+                                        TAO::Ledger::Transaction tx;
+                                        if(LLD::Ledger->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
+                                            PushMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::TRITIUM), tx);
+                                    }
+                                }
+
+                                /* Send the compact block again, for the node to rebuild with the transactions. */
+                                PushBlock(state, SPECIFIER::COMPACT);
+
+                                /* Debug output. */
+                                debug::log(3, NODE, "ACTION::GET: COMPACT ", vIndexes.size(), " TRANSACTIONS ", hashBlock.SubString());
+
+                                break;
+                            }
+
                             /* Get the index of transaction. */
                             uint512_t hashTx;
                             ssPacket >> hashTx;
 
+                            /* The node asked for it, so it won't need it announced. */
+                            tRelayQueue.Known(hashTx);
+
                             /* Check for legacy. */
                             if(fLegacy)
                             {
@@ -1985,7 +1995,14 @@ namespace LLP
                             {
                                 /* Check the database for the block. */
                                 if(!LLD::Ledger->HasBlock(hashBlock))
+                                {
+                                    /* Ask for a compact block when we are synchronized, since its transactions will be in our pool. */
+                                    if(nProtocolVersion >= MIN_COMPACT_VERSION && !TAO::Ledger::ChainState::Synchronizing()
+                                    && config::GetBoolArg(std::string("-compactblocks"), true))
+                                        ssResponse << uint8_t(SPECIFIER::COMPACT);
+
                                     ssResponse << uint8_t(TYPES::BLOCK) << hashBlock;
+                                }
 
                                 /* Debug output. */
                                 debug::log(3, NODE, "ACTION::NOTIFY: BLOCK ", hashBlock.SubString());
@@ -2055,6 +2072,9 @@ namespace LLP
                             uint512_t hashTx = 0;
                             ssPacket >> hashTx;
 
+                            /* The node has this transaction, so it is never announced back to it. */
+                            tRelayQueue.Known(hashTx);
+
                             /* Handle for -client mode which deals with merkle transactions. */
                             if(nType == TYPES::SIGCHAIN && config::fClient.load())
                             {
@@ -2209,6 +2229,19 @@ namespace LLP
                                             debug::log(0, NODE, "ACTION::NOTIFY: Synchronization COMPLETE at ", hashBestChain.SubString());
                                             debug::log(0, NODE, "ACTION::NOTIFY: Synchronized ", nBlocks, " blocks in ", nElapsed,
                                                 " seconds [", double(nBlocks / (nElapsed + 1.0)), " blocks/s]" );
+
+                                            /* Stop any parallel sync. */
+                                            if(SYNC_QUEUE)
+                                                SYNC_QUEUE->Stop();
+                                        }
+                                        else if(SYNC_QUEUE && SYNC_QUEUE->Active())
+                                        {
+                                            /* Mark the headers as received, and ask for the next ones along with their windows. */
+                                            SYNC_QUEUE->HeadersReceived(hashLast, nCurrentHeight);
+                                            RequestWindows(true);
+
+                                            /* Check for the sync completing with the last headers. */
+                                            ConnectWindows();
                                         }
                                         else
                                         {
@@ -2259,6 +2292,10 @@ namespace LLP
                                 /* Unsubcribe from last. */
                                 Unsubscribe(SUBSCRIPTION::LASTINDEX);
 
+                                /* Stop any parallel sync. */
+                                if(SYNC_QUEUE)
+                                    SYNC_QUEUE->Stop();
+
                                 /* Log that sync is complete. */
                                 debug::log(0, NODE, "ACTION::NOTIFY: Synchronization COMPLETE at ", hashBestChain.SubString());
                             }
@@ -2588,6 +2625,81 @@ namespace LLP
                         break;
                     }
 
+                    /* Handle for a compact block. */
+                    case SPECIFIER::COMPACT:
+                    {
+                        /* Check for client mode since this method should never be called except by a client. */
+                        if(config::fClient.load())
+                            return debug::drop(NODE, "TYPES::BLOCK::COMPACT: disabled in -client mode");
+
+                        /* Get the block from the stream. */
+                        TAO::Ledger::CompactBlock compact;
+                        ssPacket >> compact;
+
+                        /* Check for a block we already have. */
+                        const uint1024_t hashBlock = compact.GetHash();
+                        if(LLD::Ledger->HasBlock(hashBlock))
+                            break;
+
+                        /* Rebuild the block from our memory pool. */
+                        std::vector<std::pair<uint8_t, uint512_t>> vPool;
+                        TAO::Ledger::mempool.Hashes(vPool);
+
+                        TAO::Ledger::TritiumBlock block;
+                        std::vector<uint32_t> vMissing;
+                        if(!compact.Reconstruct(vPool, block, vMissing))
+                        {
+                            /* Ask for the missing transactions once, and for the full block if that didn't fill it. */
+                            if(!vMissing.empty() && hashCompactMissing != hashBlock)
+                            {
+                                /* Log the missing data. */
+                                debug::log(2, NODE, "TYPES::BLOCK::COMPACT: requesting ", vMissing.size(), " of ",
+                                    compact.vShort.size(), " transactions for ", hashBlock.SubString());
+
+                                hashCompactMissing = hashBlock;
+                                PushMessage(ACTION::GET, uint8_t(SPECIFIER::COMPACT), uint8_t(TYPES::TRANSACTION), hashBlock, vMissing);
+                            }
+                            else
+                            {
+                                /* Log the fallback. */
+                                debug::log(2, NODE, "TYPES::BLOCK::COMPACT: failed to rebuild ", hashBlock.SubString(), ", requesting full block");
+
+                                PushMessage(ACTION::GET, uint8_t(TYPES::BLOCK), hashBlock);
+                            }
+
+                            break;
+                        }
+
+                        /* Process the block. */
+                        TAO::Ledger::Process(block, nStatus);
+
+                        /* Check for transactions that left our pool since rebuilding, the full block path requests them. */
+                        if(nStatus & TAO::Ledger::PROCESS::INCOMPLETE)
+                        {
+                            PushMessage(ACTION::GET, uint8_t(TYPES::BLOCK), hashBlock);
+                            break;
+                        }
+
+                        /* Check for duplicate and ask for previous block. */
+                        if(!(nStatus & TAO::Ledger::PROCESS::DUPLICATE)
+                        && !(nStatus & TAO::Ledger::PROCESS::IGNORED)
+                        &&  (nStatus & TAO::Ledger::PROCESS::ORPHAN))
+                        {
+                            /* Ask for list of blocks. */
+                            PushMessage(ACTION::LIST,
+                                #ifndef DEBUG_MISSING
+                                (config::fClient.load() ? uint8_t(SPECIFIER::CLIENT) : uint8_t(SPECIFIER::TRANSACTIONS)),
+                                #endif
+                                uint8_t(TYPES::BLOCK),
+                                uint8_t(TYPES::LOCATOR),
+                                TAO::Ledger::Locator(TAO::Ledger::ChainState::hashBestChain.load()),
+                                uint1024_t(block.hashPrevBlock)
+                            );
+                        }
+
+                        break;
+                    }
+
                     /* Handle for a tritium transaction. */
                     case SPECIFIER::SYNC:
                     {
@@ -2603,6 +2715,40 @@ namespace LLP
                         TAO::Ledger::SyncBlock block;
                         ssPacket >> block;
 
+                        /* Buffer the blocks of a parallel sync to be connected in order. */
+                        if(SYNC_QUEUE && SYNC_QUEUE->Active())
+                        {
+                            /* Build the block, verifying the producer signature while it is out of order. */
+                            std::unique_ptr<TAO::Ledger::Block> pBlock;
+                            if(block.nVersion >= 7)
+                            {
+                                TAO::Ledger::TritiumBlock* pTritium = new TAO::Ledger::TritiumBlock(block);
+                                pBlock.reset(pTritium);
+
+                                if(!pTritium->VerifyProducer())
+                                    return debug::drop(NODE, "TYPES::BLOCK::SYNC: invalid signature at height ", block.nHeight);
+                            }
+                            else
+                                pBlock.reset(new Legacy::LegacyBlock(block));
+
+                            /* Check the proof of work claims, which need no chain state either. */
+                            if(pBlock->IsProofOfWork() && !pBlock->VerifyWork())
+                                return debug::drop(NODE, "TYPES::BLOCK::SYNC: invalid proof of work at height ", block.nHeight);
+
+                            /* Check the block against the header chain. */
+                            if(!SYNC_QUEUE->Add(nCurrentSession, std::move(pBlock), INCOMING.DATA.size()))
+                            {
+                                debug::log(3, NODE, "TYPES::BLOCK::SYNC: block at height ", block.nHeight, " not in header chain");
+                                break;
+                            }
+
+                            /* Connect what we can, and keep this node busy. */
+                            ConnectWindows();
+                            RequestWindows();
+
+                            break;
+                        }
+
                         /* Check version switch. */
                         if(block.nVersion >= 7)
                         {
@@ -2640,6 +2786,39 @@ namespace LLP
                         TAO::Ledger::ClientBlock block;
                         ssPacket >> block;
 
+                        /* Client blocks are the headers of a parallel sync. */
+                        if(SYNC_QUEUE && SYNC_QUEUE->Active())
+                        {
+                            /* Only take headers from the sync node. */
+                            if(nCurrentSession != TAO::Ledger::nSyncSession.load())
+                                break;
+
+                            /* Check the channel and the proof of work claims, which need no chain state. */
+                            if(block.GetChannel() > (config::fHybrid.load() ? 3 : 2)
+                            || (block.IsProofOfWork() && !block.VerifyWork()))
+                            {
+                                if(fDDOS.load())
+                                    DDOS->rSCORE += 50;
+
+                                return debug::drop(NODE, "TYPES::BLOCK::CLIENT: invalid proof of work at height ", block.nHeight);
+                            }
+
+                            /* Headers that don't extend ours are left for the sync timeout to switch nodes. */
+                            if(!SYNC_QUEUE->AddHeader(block.nHeight, block.GetHash(), block.hashPrevBlock))
+                            {
+                                if(fDDOS.load())
+                                    DDOS->rSCORE += 10;
+
+                                debug::log(3, NODE, "TYPES::BLOCK::CLIENT: header at height ", block.nHeight, " does not extend sync chain");
+                                break;
+                            }
+
+                            /* Reset last time received. */
+                            nLastTimeReceived.store(runtime::timestamp());
+
+                            break;
+                        }
+
                         /* Process the block. */
                         TAO::Ledger::Process(block, nStatus);
 
@@ -2757,6 +2936,7 @@ namespace LLP
 
                         /* Cache our txid. */
                         const uint512_t hashTx = tx.GetHash();
+                        tRelayQueue.Known(hashTx);
 
                         /* Accept into memory pool. */
                         if(TAO::Ledger::mempool.Accept(tx, this))
@@ -2797,6 +2977,7 @@ namespace LLP
 
                         /* Cache our txid. */
                         const uint512_t hashTx = tx.GetHash();
+                        tRelayQueue.Known(hashTx);
 
                         /* Accept into memory pool. */
                         if(TAO::Ledger::mempool.Accept(tx, this))
@@ -3475,17 +3656,9 @@ namespace LLP
                             uint512_t hashTx;
                             ssData >> hashTx;
 
-                            /* Check subscription. */
+                            /* Check subscription, queueing the announcement to go out batched unless the node has it. */
                             if(nNotifications & SUBSCRIPTION::TRANSACTION)
-                            {
-                                /* Check for legacy. */
-                                if(fLegacy)
-                                    ssRelay << uint8_t(SPECIFIER::LEGACY);
-
-                                /* Write transaction to stream. */
-                                ssRelay << uint8_t(TYPES::TRANSACTION);
-                                ssRelay << hashTx;
-                            }
+                                tRelayQueue.Queue(hashTx, fLegacy);
 
                             break;
                         }
@@ -3766,6 +3939,275 @@ namespace LLP
     }
 
 
+    /* Asks the sync node for more headers and hands out block windows to every connected node. */
+    void TritiumNode::RequestWindows(const bool fForce)
+    {
+        /* Don't walk the connections for every block received. */
+        static std::atomic<uint64_t> nLastRequest(0);
+
+        const uint64_t nTimestamp = runtime::timestamp(true);
+        if(!fForce && nLastRequest.load() + 100 > nTimestamp)
+            return;
+
+        nLastRequest.store(nTimestamp);
+
+        /* Ask the sync node for the headers past our last one. */
+        uint1024_t hashFrom;
+        if(SYNC_QUEUE->RequestHeaders(hashFrom))
+        {
+            std::shared_ptr<TritiumNode> pnode = GetNode(TAO::Ledger::nSyncSession.load());
+            if(pnode != nullptr)
+            {
+                try
+                {
+                    pnode->PushMessage(ACTION::LIST,
+                        uint8_t(SPECIFIER::CLIENT),
+                        uint8_t(TYPES::BLOCK),
+                        uint8_t(TYPES::UINT1024_T),
+                        hashFrom,
+                        uint1024_t(0)
+                    );
+                }
+                catch(const std::exception& e)
+                {
+                    debug::error(FUNCTION, e.what());
+                }
+            }
+        }
+
+        /* Get the nodes that have the next blocks, with their download rates. */
+        std::vector<std::pair<uint64_t, std::shared_ptr<TritiumNode>>> vNodes;
+        for(const auto& pnode : TRITIUM_SERVER->GetConnections())
+        {
+            try //we want to catch exceptions thrown by atomic_ptr in the case there was a free on another thread
+            {
+                if(pnode != nullptr && pnode->nCurrentSession != 0 && pnode->nCurrentHeight >= SYNC_QUEUE->Height())
+                    vNodes.push_back(std::make_pair(SYNC_QUEUE->Throughput(pnode->nCurrentSession), pnode));
+            }
+            catch(const std::exception& e) {}
+        }
+
+        /* Leave the sync node to its headers when there are others to download from, as its list notifications
+           can only tell header lists apart from windows by where they end. */
+        if(vNodes.size() > 1)
+        {
+            vNodes.erase(std::remove_if(vNodes.begin(), vNodes.end(),
+                [](const std::pair<uint64_t, std::shared_ptr<TritiumNode>>& pair)
+                {
+                    return pair.second->nCurrentSession == TAO::Ledger::nSyncSession.load();
+                }), vNodes.end());
+        }
+
+        /* Fastest nodes get the lowest windows. */
+        std::sort(vNodes.begin(), vNodes.end(),
+            [](const std::pair<uint64_t, std::shared_ptr<TritiumNode>>& a, const std::pair<uint64_t, std::shared_ptr<TritiumNode>>& b)
+            {
+                return a.first > b.first;
+            });
+
+        /* Hand out the windows. */
+        for(const auto& pair : vNodes)
+        {
+            try
+            {
+                const std::shared_ptr<TritiumNode>& pnode = pair.second;
+
+                uint1024_t hashStart, hashStop;
+                while(SYNC_QUEUE->Assign(pnode->nCurrentSession, pnode->nCurrentHeight, hashStart, hashStop))
+                {
+                    pnode->PushMessage(ACTION::LIST,
+                        uint8_t(SPECIFIER::SYNC),
+                        uint8_t(TYPES::BLOCK),
+                        uint8_t(TYPES::UINT1024_T),
+                        hashStart,
+                        hashStop
+                    );
+                }
+            }
+            catch(const std::exception& e)
+            {
+                debug::error(FUNCTION, e.what());
+            }
+        }
+    }
+
+
+    /* Connects the blocks waiting in the sync queue in height order. */
+    void TritiumNode::ConnectWindows()
+    {
+        /* Only one thread connects at a time, the others leave their blocks for it. */
+        static std::mutex CONNECT_MUTEX;
+
+        do
+        {
+            std::unique_lock<std::mutex> lock(CONNECT_MUTEX, std::try_to_lock);
+            if(!lock.owns_lock())
+                return;
+
+            /* Connect blocks until the next one hasn't arrived. */
+            std::unique_ptr<TAO::Ledger::Block> pBlock;
+            while((pBlock = SYNC_QUEUE->Next()) != nullptr)
+            {
+                uint8_t nStatus = 0;
+                TAO::Ledger::Process(*pBlock, nStatus);
+
+                /* Restart the sync from another node if the chain being synced doesn't connect. */
+                if(!(nStatus & TAO::Ledger::PROCESS::ACCEPTED))
+                {
+                    debug::error(FUNCTION, "sync block at height ", pBlock->nHeight, " failed to connect");
+
+                    SwitchNode();
+                    return;
+                }
+
+                /* Reset last time received. */
+                nLastTimeReceived.store(runtime::timestamp());
+            }
+
+            /* Finish once every header is connected. */
+            if(SYNC_QUEUE->Done())
+            {
+                SYNC_QUEUE->Stop();
+
+                /* Unsubscribe from the sync node's list notifications. */
+                std::shared_ptr<TritiumNode> pnode = GetNode(TAO::Ledger::nSyncSession.load());
+                if(pnode != nullptr)
+                    pnode->Unsubscribe(SUBSCRIPTION::LASTINDEX);
+
+                /* Set state to synchronized. */
+                fSynchronized.store(true);
+                TAO::Ledger::nSyncSession.store(0);
+
+                /* Total blocks synchronized */
+                const uint32_t nBlocks = TAO::Ledger::ChainState::tStateBest.load().nHeight - nSyncStart.load();
+                const uint32_t nElapsed = SYNCTIMER.Elapsed();
+
+                debug::log(0, FUNCTION, "Parallel synchronization COMPLETE at ", TAO::Ledger::ChainState::hashBestChain.load().SubString());
+                debug::log(0, FUNCTION, "Synchronized ", nBlocks, " blocks in ", nElapsed,
+                    " seconds [", double(nBlocks / (nElapsed + 1.0)), " blocks/s]" );
+
+                return;
+            }
+        }
+        while(SYNC_QUEUE->Ready());
+    }
+
+
+    /* Adds a block to the queue to write to the socket, preceded by its transactions for the TRANSACTIONS specifier. */
+    void TritiumNode::PushBlock(const TAO::Ledger::BlockState& state, const uint8_t nSpecifier)
+    {
+        /* Get the block hash once. */
+        const uint1024_t hashBlock = state.GetHash();
+
+        /* Serve the packets another connection already built. */
+        if(BLOCK_CACHE)
+        {
+            const std::shared_ptr<const BlockCache::Packets> pCached = BLOCK_CACHE->Get(hashBlock, nSpecifier, state.hashNextBlock);
+            if(pCached)
+            {
+                for(const auto& vPacket : *pCached)
+                    WritePacket(vPacket);
+
+                return;
+            }
+        }
+
+        /* Serialize the response packets. */
+        std::shared_ptr<BlockCache::Packets> pPackets = std::make_shared<BlockCache::Packets>();
+        switch(nSpecifier)
+        {
+            /* Handle for special sync block type specifier. */
+            case SPECIFIER::SYNC:
+            {
+                /* Build the sync block from state. */
+                TAO::Ledger::SyncBlock block(state);
+                pPackets->push_back(BuildMessage(TYPES::BLOCK, uint8_t(SPECIFIER::SYNC), block));
+
+                break;
+            }
+
+            /* Handle for a client block header. */
+            case SPECIFIER::CLIENT:
+            {
+                /* Build the client block from state. */
+                TAO::Ledger::ClientBlock block(state);
+                pPackets->push_back(BuildMessage(TYPES::BLOCK, uint8_t(SPECIFIER::CLIENT), block));
+
+                break;
+            }
+
+            /* Handle for legacy blocks, less than version 7. */
+            case SPECIFIER::LEGACY:
+            {
+                /* Build the legacy block from state. */
+                Legacy::LegacyBlock block(state);
+                pPackets->push_back(BuildMessage(TYPES::BLOCK, uint8_t(SPECIFIER::LEGACY), block));
+
+                break;
+            }
+
+            /* Handle for tritium blocks relayed as short transaction ids. */
+            case SPECIFIER::COMPACT:
+            {
+                /* Build the compact block from state. */
+                TAO::Ledger::CompactBlock block(state);
+                pPackets->push_back(BuildMessage(TYPES::BLOCK, uint8_t(SPECIFIER::COMPACT), block));
+
+                break;
+            }
+
+            /* Handle for tritium blocks, with or without their transactions. */
+            default:
+            {
+                /* Build the tritium block from state. */
+                TAO::Ledger::TritiumBlock block(state);
+
+                /* Check for transactions. */
+                if(nSpecifier == SPECIFIER::TRANSACTIONS)
+                {
+                    /* Loop through transactions. */
+                    for(const auto& proof : block.vtx)
+                    {
+                        /* Basic checks for legacy transactions. */
+                        if(proof.first == TAO::Ledger::TRANSACTION::LEGACY)
+                        {
+                            /* Check the memory pool. */
+                            Legacy::Transaction tx;
+                            if(!LLD::Legacy->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
+                                continue;
+
+                            pPackets->push_back(BuildMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::LEGACY), tx));
+                        }
+
+                        /* Basic checks for tritium transactions. */
+                        else if(proof.first == TAO::Ledger::TRANSACTION::TRITIUM)
+                        {
+                            /* Check the memory pool. */
+                            TAO::Ledger::Transaction tx;
+                            if(!LLD::Ledger->ReadTx(proof.second, tx, TAO::Ledger::FLAGS::MEMPOOL))
+                                continue;
+
+                            pPackets->push_back(BuildMessage(TYPES::TRANSACTION, uint8_t(SPECIFIER::TRITIUM), tx));
+                        }
+                    }
+                }
+
+                pPackets->push_back(BuildMessage(TYPES::BLOCK, uint8_t(SPECIFIER::TRITIUM), block));
+
+                break;
+            }
+        }
+
+        /* Write the packets to the socket. */
+        for(const auto& vPacket : *pPackets)
+            WritePacket(vPacket);
+
+        /* Share them with other connections. */
+        if(BLOCK_CACHE)
+            BLOCK_CACHE->Put(hashBlock, nSpecifier, state.hashNextBlock, pPackets);
+    }
+
+
     /* Initiates a chain synchronization from the peer. */
     void TritiumNode::Sync()
     {
@@ -3787,6 +4229,16 @@ namespace LLP
         /* Subscribe to this node. */
         Subscribe(SUBSCRIPTION::LASTINDEX | SUBSCRIPTION::BESTCHAIN | SUBSCRIPTION::BESTHEIGHT);
 
+        /* Start a parallel sync by asking this node for the headers past our best block. */
+        if(SYNC_QUEUE)
+        {
+            const TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+            SYNC_QUEUE->Reset(stateBest.nHeight, stateBest.GetHash());
+
+            RequestWindows(true);
+            return;
+        }
+
         /* Ask for list of blocks if this is current sync node. */
         PushMessage(ACTION::LIST,
             config::fClient.load() ? uint8_t(SPECIFIER::CLIENT) : uint8_t(SPECIFIER::SYNC),
@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <LLC/include/random.h>
 
 #include <LLP/include/network.h>
+#include <LLP/include/relay_queue.h>
 #include <LLP/include/version.h>
 #include <LLP/packets/message.h>
 #include <LLP/templates/base_connection.h>
@@ -200,6 +201,7 @@ namespace LLP
                 CLIENT       = 0x44, //specify for blocks to be sent and received for clients
                 REGISTER     = 0x45, //specify that a register is being received and should only keep memory of it.
                 DEPENDANT    = 0x46, //specify that a transaction is a dependant and therfore only process the ledger layer.
+                COMPACT      = 0x47, //specify a compact block, or the transactions missing from one.
             };
         };
 
@@ -265,6 +267,10 @@ namespace LLP
         std::set<uint256_t> setSubscriptions;
 
 
+        /** Transaction announcements waiting for this node, and the transactions it already knows. **/
+        mutable RelayQueue tRelayQueue;
+
+
         /** Inventory class to track caches. **/
         static Inventory tInventory;
 
@@ -299,6 +305,26 @@ namespace LLP
         static void SwitchNode();
 
 
+        /** RequestWindows
+         *
+         *  Asks the sync node for more headers and hands out block windows to every connected node, fastest first,
+         *  during a parallel sync.
+         *
+         *  @param[in] fForce Request now, rather than at most every 100 ms.
+         *
+         **/
+        static void RequestWindows(const bool fForce = false);
+
+
+        /** ConnectWindows
+         *
+         *  Connects the blocks waiting in the sync queue in height order, finishing the sync once every header is
+         *  connected.
+         *
+         **/
+        static void ConnectWindows();
+
+
         /** The block height at the start of the last sync session **/
         static std::atomic<uint32_t> nSyncStart;
 
@@ -379,6 +405,10 @@ namespace LLP
         uint1024_t hashLastIndex;
 
 
+        /** The last compact block this node was asked for missing transactions of. **/
+        uint1024_t hashCompactMissing;
+
+
         /** Counter of total orphans. **/
         uint32_t nConsecutiveOrphans;
 
@@ -589,6 +619,37 @@ namespace LLP
         }
 
 
+        /** BuildMessage
+         *
+         *  Serializes a tritium packet without sending it, for packets that are cached and written later.
+         *
+         *  @param[in] nMsg The message type.
+         *
+         *  @return The bytes of the packet.
+         *
+         **/
+        template<typename... Args>
+        static std::vector<uint8_t> BuildMessage(const uint16_t nMsg, Args&&... args)
+        {
+            DataStream ssData(SER_NETWORK, MIN_PROTO_VERSION);
+            ((ssData << args), ...);
+
+            return NewMessage(nMsg, ssData).GetBytes();
+        }
+
+
+        /** PushBlock
+         *
+         *  Adds a block to the queue to write to the socket, preceded by its transactions for the TRANSACTIONS
+         *  specifier. The serialized packets are shared with other connections through the block cache.
+         *
+         *  @param[in] state The block to send.
+         *  @param[in] nSpecifier The specifier to send the block with.
+         *
+         **/
+        void PushBlock(const TAO::Ledger::BlockState& state, const uint8_t nSpecifier);
+
+
         /** BlockingMessage
          *
          *  Adds a tritium packet to the queue and waits for the peer to send a COMPLETED message.
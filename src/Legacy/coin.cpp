@@ -0,0 +1,89 @@
+/*__________________________________________________________________________________________
+
+			Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+			(c) Copyright The Nexus Developers 2014 - 2023
+
+			Distributed under the MIT software license, see the accompanying
+			file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+			"ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Legacy/types/coin.h>
+#include <Legacy/types/transaction.h>
+
+
+namespace Legacy
+{
+
+	/** Default Constructor. **/
+	Coin::Coin()
+	: nTime      (0)
+	, fCoinBase  (false)
+	, fCoinStake (false)
+	, out        ( )
+	{
+	}
+
+
+	/** Copy Constructor. **/
+	Coin::Coin(const Coin& coin)
+	: nTime      (coin.nTime)
+	, fCoinBase  (coin.fCoinBase)
+	, fCoinStake (coin.fCoinStake)
+	, out        (coin.out)
+	{
+	}
+
+
+	/** Move Constructor. **/
+	Coin::Coin(Coin&& coin) noexcept
+	: nTime      (std::move(coin.nTime))
+	, fCoinBase  (std::move(coin.fCoinBase))
+	, fCoinStake (std::move(coin.fCoinStake))
+	, out        (std::move(coin.out))
+	{
+	}
+
+
+	/** Copy assignment. **/
+	Coin& Coin::operator=(const Coin& coin)
+	{
+		nTime      = coin.nTime;
+		fCoinBase  = coin.fCoinBase;
+		fCoinStake = coin.fCoinStake;
+		out        = coin.out;
+
+		return *this;
+	}
+
+
+	/** Move assignment. **/
+	Coin& Coin::operator=(Coin&& coin) noexcept
+	{
+		nTime      = std::move(coin.nTime);
+		fCoinBase  = std::move(coin.fCoinBase);
+		fCoinStake = std::move(coin.fCoinStake);
+		out        = std::move(coin.out);
+
+		return *this;
+	}
+
+
+	/** Default destructor. **/
+	Coin::~Coin()
+	{
+	}
+
+
+	/* Constructor */
+	Coin::Coin(const Transaction& tx, const uint32_t n)
+	: nTime      (tx.nTime)
+	, fCoinBase  (tx.IsCoinBase())
+	, fCoinStake (tx.IsCoinStake())
+	, out        (tx.vout[n])
+	{
+	}
+}
@@ -95,7 +95,8 @@ namespace Legacy
 
 
     /* Evaluate a script to true or false based on operation codes. */
-    bool EvalScript(std::vector<std::vector<uint8_t> >& stack, const Script& script, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    bool EvalScript(std::vector<std::vector<uint8_t> >& stack, const Script& script, const Transaction& txTo, uint32_t nIn, int32_t nHashType,
+                    const bool fCache)
     {
         LLC::CAutoBN_CTX pctx;
         Script::const_iterator pc = script.begin();
@@ -766,7 +767,7 @@ namespace Legacy
                         // Drop the signature, since there's no way for a signature to sign itself
                         scriptCode.FindAndDelete(Script(vchSig));
 
-                        bool fSuccess = CheckSig(vchSig, vchPubKey, scriptCode, txTo, nIn, nHashType);
+                        bool fSuccess = CheckSig(vchSig, vchPubKey, scriptCode, txTo, nIn, nHashType, fCache);
                         popstack(stack);
                         popstack(stack);
                         stack.push_back(fSuccess ? vchTrue : vchFalse);
@@ -825,7 +826,7 @@ namespace Legacy
                             std::vector<uint8_t>& vchPubKey = stacktop(-ikey);
 
                             // Check signature
-                            if(CheckSig(vchSig, vchPubKey, scriptCode, txTo, nIn, nHashType))
+                            if(CheckSig(vchSig, vchPubKey, scriptCode, txTo, nIn, nHashType, fCache))
                             {
                                 isig++;
                                 nSigsCount--;
@@ -1215,14 +1216,15 @@ namespace Legacy
 
 
     /* Verify a script is a valid */
-    bool VerifyScript(const Script& scriptSig, const Script& scriptPubKey, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    bool VerifyScript(const Script& scriptSig, const Script& scriptPubKey, const Transaction& txTo, uint32_t nIn, int32_t nHashType,
+                      const bool fCache)
     {
         std::vector< std::vector<uint8_t> > stack, stackCopy;
-        if(!EvalScript(stack, scriptSig, txTo, nIn, nHashType))
+        if(!EvalScript(stack, scriptSig, txTo, nIn, nHashType, fCache))
             return false;
 
         stackCopy = stack;
-        if(!EvalScript(stack, scriptPubKey, txTo, nIn, nHashType))
+        if(!EvalScript(stack, scriptPubKey, txTo, nIn, nHashType, fCache))
             return false;
 
         if(stack.empty())
@@ -1241,7 +1243,7 @@ namespace Legacy
             Script pubKey2(pubKeySerialized.begin(), pubKeySerialized.end());
             popstack(stackCopy);
 
-            if(!EvalScript(stackCopy, pubKey2, txTo, nIn, nHashType))
+            if(!EvalScript(stackCopy, pubKey2, txTo, nIn, nHashType, fCache))
                 return false;
 
             if(stackCopy.empty())
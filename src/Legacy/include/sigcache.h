@@ -0,0 +1,156 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LEGACY_INCLUDE_SIGCACHE_H
+#define NEXUS_LEGACY_INCLUDE_SIGCACHE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/mruset.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Legacy
+{
+
+    /** @class SignatureCache
+     *
+     *  Bounded set of legacy script signatures that have already been verified. Signatures are added when a
+     *  transaction is accepted into the mempool, so connecting it with a block doesn't verify them a second time.
+     *
+     *  Entries are keyed by a hash of the signature hash, public key and signature, and the oldest are evicted once
+     *  the cache is full.
+     *
+     **/
+    class SignatureCache
+    {
+        /** Mutex for thread concurrency. **/
+        mutable std::mutex MUTEX;
+
+
+        /** The keys of verified signatures. **/
+        mruset<uint256_t> setValid;
+
+
+        /** Number of lookups found in the cache. **/
+        std::atomic<uint64_t> nHits;
+
+
+        /** Number of lookups not found in the cache. **/
+        std::atomic<uint64_t> nMisses;
+
+
+    public:
+
+        /** Default Constructor. **/
+        SignatureCache() = delete;
+
+
+        /** Copy Constructor. **/
+        SignatureCache(const SignatureCache& cache) = delete;
+
+
+        /** Copy Assignment. **/
+        SignatureCache& operator=(const SignatureCache& cache) = delete;
+
+
+        /** Constructor
+         *
+         *  @param[in] nMaxEntries The number of signatures to keep.
+         *
+         **/
+        SignatureCache(const uint32_t nMaxEntries);
+
+
+        /** Destructor. **/
+        ~SignatureCache();
+
+
+        /** Instance
+         *
+         *  Get the cache shared by all script checks, sized by -sigcachesize.
+         *
+         **/
+        static SignatureCache& Instance();
+
+
+        /** Key
+         *
+         *  Get the cache key of a signature.
+         *
+         *  @param[in] hashSig The signature hash that was signed.
+         *  @param[in] vchPubKey The public key.
+         *  @param[in] vchSig The signature, without its hash type.
+         *
+         **/
+        static uint256_t Key(const uint256_t& hashSig, const std::vector<uint8_t>& vchPubKey, const std::vector<uint8_t>& vchSig);
+
+
+        /** Has
+         *
+         *  Check if a signature has been verified, counting a hit or a miss.
+         *
+         *  @param[in] hashKey The cache key of the signature.
+         *
+         **/
+        bool Has(const uint256_t& hashKey);
+
+
+        /** Add
+         *
+         *  Add a verified signature, evicting the oldest if full.
+         *
+         *  @param[in] hashKey The cache key of the signature.
+         *
+         **/
+        void Add(const uint256_t& hashKey);
+
+
+        /** Clear
+         *
+         *  Remove all cached signatures.
+         *
+         **/
+        void Clear();
+
+
+        /** Size
+         *
+         *  Get the number of cached signatures.
+         *
+         **/
+        uint64_t Size() const;
+
+
+        /** Hits
+         *
+         *  Get the number of lookups found in the cache.
+         *
+         **/
+        uint64_t Hits() const;
+
+
+        /** Misses
+         *
+         *  Get the number of lookups not found in the cache.
+         *
+         **/
+        uint64_t Misses() const;
+
+    };
+}
+
+#endif
@@ -83,11 +83,13 @@ namespace Legacy
      *  @param[in] txTo The transaction being sent to.
      *  @param[in] nIn The input being spent.
      *  @param[in] nHashType The hash type used for signature.
+     *  @param[in] fCache Flag to add the signature to the signature cache once verified.
      *
      *  @return true if the signature is valid.
      *
      **/
-    bool CheckSig(std::vector<uint8_t> vchSig, std::vector<uint8_t> vchPubKey, Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
+    bool CheckSig(std::vector<uint8_t> vchSig, std::vector<uint8_t> vchPubKey, Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType,
+                  const bool fCache = false);
 
 
     /** Sign Signature
@@ -120,6 +122,20 @@ namespace Legacy
      **/
     bool VerifySignature(const Transaction& txFrom, const Transaction& txTo, uint32_t nIn, int32_t nHashType);
 
+
+    /** Verify Inputs
+     *
+     *  Verify the scripts of a transaction's inputs, spread over threads for large transactions.
+     *
+     *  @param[in] txTo The transaction spending the inputs.
+     *  @param[in] vScripts The input indexes to verify, with the script of the output each one spends.
+     *  @param[in] fCache Flag to add the signatures to the signature cache once verified.
+     *
+     *  @return true if every script was verified valid.
+     *
+     **/
+    bool VerifyInputs(const Transaction& txTo, const std::vector<std::pair<uint32_t, Script>>& vScripts, const bool fCache = false);
+
 }
 
 #endif
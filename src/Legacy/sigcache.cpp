@@ -0,0 +1,124 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+
+#include <Legacy/include/sigcache.h>
+
+#include <LLP/include/version.h>
+
+#include <Util/include/args.h>
+#include <Util/include/config.h>
+#include <Util/include/mutex.h>
+
+#include <Util/templates/datastream.h>
+
+namespace Legacy
+{
+
+    /* Constructor */
+    SignatureCache::SignatureCache(const uint32_t nMaxEntries)
+    : MUTEX    ( )
+    , setValid (nMaxEntries)
+    , nHits    (0)
+    , nMisses  (0)
+    {
+    }
+
+
+    /* Destructor. */
+    SignatureCache::~SignatureCache()
+    {
+    }
+
+
+    /* Get the cache shared by all script checks, sized by -sigcachesize. */
+    SignatureCache& SignatureCache::Instance()
+    {
+        static SignatureCache CACHE(static_cast<uint32_t>(config::GetArg(std::string("-sigcachesize"), 50000)));
+        return CACHE;
+    }
+
+
+    /* Get the cache key of a signature. */
+    uint256_t SignatureCache::Key(const uint256_t& hashSig, const std::vector<uint8_t>& vchPubKey, const std::vector<uint8_t>& vchSig)
+    {
+        /* Serialize the preimage, so the length prefixes keep a pubkey and signature from sharing bytes. */
+        DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
+        ss.reserve(256);
+        ss << hashSig << vchPubKey << vchSig;
+
+        return LLC::SK256(ss.begin(), ss.end());
+    }
+
+
+    /* Check if a signature has been verified, counting a hit or a miss. */
+    bool SignatureCache::Has(const uint256_t& hashKey)
+    {
+        bool fHas = false;
+        {
+            LOCK(MUTEX);
+            fHas = setValid.count(hashKey);
+        }
+
+        if(fHas)
+            ++nHits;
+        else
+            ++nMisses;
+
+        return fHas;
+    }
+
+
+    /* Add a verified signature, evicting the oldest if full. */
+    void SignatureCache::Add(const uint256_t& hashKey)
+    {
+        LOCK(MUTEX);
+
+        /* A size of zero disables the cache. */
+        if(setValid.max_size() == 0)
+            return;
+
+        setValid.insert(hashKey);
+    }
+
+
+    /* Remove all cached signatures. */
+    void SignatureCache::Clear()
+    {
+        LOCK(MUTEX);
+        setValid = mruset<uint256_t>(setValid.max_size());
+    }
+
+
+    /* Get the number of cached signatures. */
+    uint64_t SignatureCache::Size() const
+    {
+        LOCK(MUTEX);
+        return setValid.size();
+    }
+
+
+    /* Get the number of lookups found in the cache. */
+    uint64_t SignatureCache::Hits() const
+    {
+        return nHits.load();
+    }
+
+
+    /* Get the number of lookups not found in the cache. */
+    uint64_t SignatureCache::Misses() const
+    {
+        return nMisses.load();
+    }
+}
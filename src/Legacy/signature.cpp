@@ -16,6 +16,7 @@ ________________________________________________________________________________
 
 #include <Legacy/include/enum.h>
 #include <Legacy/include/evaluate.h>
+#include <Legacy/include/sigcache.h>
 #include <Legacy/include/signature.h>
 
 #include <Legacy/types/transaction.h>
@@ -26,13 +27,23 @@ ________________________________________________________________________________
 #include <Util/templates/datastream.h>
 #include <Util/include/base58.h>
 
+#include <algorithm>
+#include <future>
 #include <string>
+#include <thread>
 #include <vector>
 
 
 namespace Legacy
 {
 
+    namespace
+    {
+        /* Transactions with fewer scripts than this per thread are verified on the calling thread. */
+        const uint32_t VERIFY_CHUNK_INPUTS = 8;
+    }
+
+
     /* Signs for a single signature transaction. */
     bool Sign1(const NexusAddress& address, const KeyStore& keystore, uint256_t hash, int32_t nHashType, Script& scriptSigRet)
     {
@@ -143,7 +154,7 @@ namespace Legacy
 
 
     /* Checks that the signature supplied is a valid one. */
-    bool CheckSig(std::vector<uint8_t> vchSig, std::vector<uint8_t> vchPubKey, Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType)
+    bool CheckSig(std::vector<uint8_t> vchSig, std::vector<uint8_t> vchPubKey, Script scriptCode, const Transaction& txTo, uint32_t nIn, int32_t nHashType, const bool fCache)
     {
         // Hash type is one byte tacked on to the end of the signature
         if(vchSig.empty())
@@ -156,12 +167,23 @@ namespace Legacy
         vchSig.pop_back();
         uint256_t sighash = SignatureHash(scriptCode, txTo, nIn, nHashType);
 
+        /* Check for a signature already verified. */
+        SignatureCache& cache = SignatureCache::Instance();
+
+        const uint256_t hashKey = SignatureCache::Key(sighash, vchPubKey, vchSig);
+        if(cache.Has(hashKey))
+            return true;
+
         LLC::ECKey key;
         if(!key.SetPubKey(vchPubKey))
             return false;
         if(!key.Verify(sighash, vchSig, 256))
             return false;
 
+        /* Keep the signature for when the transaction is connected. */
+        if(fCache)
+            cache.Add(hashKey);
+
         return true;
     }
 
@@ -234,4 +256,50 @@ namespace Legacy
         return true;
     }
 
+
+    /* Verify the scripts of a transaction's inputs, spread over threads for large transactions. */
+    bool VerifyInputs(const Transaction& txTo, const std::vector<std::pair<uint32_t, Script>>& vScripts, const bool fCache)
+    {
+        const uint32_t nScripts = static_cast<uint32_t>(vScripts.size());
+
+        /* Split large transactions into one chunk per thread. */
+        const uint32_t nThreads = std::min(std::max(1u, std::thread::hardware_concurrency()), std::max(1u, nScripts / VERIFY_CHUNK_INPUTS));
+        if(nThreads > 1)
+        {
+            const uint32_t nChunk = (nScripts + nThreads - 1) / nThreads;
+
+            /* Stop the other threads once one script fails. */
+            std::atomic<bool> fValid(true);
+
+            std::vector<std::future<void>> vJobs;
+            for(uint32_t nBegin = 0; nBegin < nScripts; nBegin += nChunk)
+            {
+                const uint32_t nEnd = std::min(nBegin + nChunk, nScripts);
+                vJobs.push_back(std::async(std::launch::async, [&txTo, &vScripts, &fValid, fCache, nBegin, nEnd]()
+                {
+                    for(uint32_t n = nBegin; n < nEnd && fValid.load(); ++n)
+                    {
+                        const uint32_t nIn = vScripts[n].first;
+                        if(!VerifyScript(txTo.vin[nIn].scriptSig, vScripts[n].second, txTo, nIn, 0, fCache))
+                            fValid.store(false);
+                    }
+                }));
+            }
+
+            for(auto& job : vJobs)
+                job.get();
+
+            return fValid.load();
+        }
+
+        /* Verify small transactions in order. */
+        for(const auto& script : vScripts)
+        {
+            if(!VerifyScript(txTo.vin[script.first].scriptSig, script.second, txTo, script.first, 0, fCache))
+                return false;
+        }
+
+        return true;
+    }
+
 }
@@ -25,6 +25,7 @@ ________________________________________________________________________________
 #include <Legacy/include/signature.h>
 #include <Legacy/include/trust.h>
 
+#include <Legacy/types/coin.h>
 #include <Legacy/types/legacy.h>
 #include <Legacy/types/merkle.h>
 #include <Legacy/types/script.h>
@@ -41,9 +42,141 @@ ________________________________________________________________________________
 #include <Util/include/runtime.h>
 #include <Util/templates/datastream.h>
 
+#include <algorithm>
+
 namespace Legacy
 {
 
+    namespace
+    {
+        /* Get the outputs fetched from a previous legacy transaction, by output number. */
+        std::map<uint32_t, Coin> legacy_coins(const DataStream& ssInput)
+        {
+            std::map<uint32_t, Coin> mapCoins;
+            ssInput.SetPos(0);
+            ssInput >> mapCoins;
+
+            return mapCoins;
+        }
+
+
+        /* Add the outpoints a transaction spends from, skipping those already fetched. */
+        void collect_inputs(const Transaction& tx, const std::map<uint512_t, std::pair<uint8_t, DataStream> >& inputs,
+                            std::map<uint512_t, std::pair<bool, std::vector<uint32_t>> > &mapPrev)
+        {
+            /* Cannot spend Tritium send-to-Legacy inputs until after v6 grace period ends */
+            const bool fTritium = (tx.nTime >= TAO::Ledger::StartBlockTimelock(7));
+
+            /* Get the number of inputs to the transaction. */
+            const uint32_t nSize = static_cast<uint32_t>(tx.vin.size());
+            for(uint32_t i = (uint32_t)tx.IsCoinStake(); i < nSize; ++i)
+            {
+                /* Skip inputs that are already found, down to the output for legacy ones. */
+                const OutPoint& prevout = tx.vin[i].prevout;
+
+                auto it = inputs.find(prevout.hash);
+                if(it != inputs.end() && (it->second.first != TAO::Ledger::LEGACY || legacy_coins(it->second.second).count(prevout.n)))
+                    continue;
+
+                auto& prev = mapPrev[prevout.hash];
+                prev.first = (prev.first || fTritium);
+                prev.second.push_back(prevout.n);
+            }
+        }
+
+
+        /* Read the collected outpoints in hash order, from the outpoint index where they are indexed. */
+        bool read_inputs(const std::map<uint512_t, std::pair<bool, std::vector<uint32_t>> >& mapPrev,
+                         std::map<uint512_t, std::pair<uint8_t, DataStream> > &inputs)
+        {
+            for(const auto& prev : mapPrev)
+            {
+                const uint512_t& hashPrev = prev.first;
+                const std::vector<uint32_t>& vOutputs = prev.second.second;
+
+                /* Get the highest output spent. */
+                const uint32_t nOutput = *std::max_element(vOutputs.begin(), vOutputs.end());
+
+                /* Get the type of transaction. */
+                auto itInput = inputs.find(hashPrev);
+                if(itInput == inputs.end() && prev.second.first && hashPrev.GetType() == TAO::Ledger::TRITIUM)
+                {
+                    /* Read the previous transaction. */
+                    TAO::Ledger::Transaction txPrev;
+                    if(LLD::Ledger->ReadTx(hashPrev, txPrev))
+                    {   //we can't rely soley on the type byte, so we must revert to legacy if not found in ledger.}
+
+                        /* Check that it is valid. */
+                        if(nOutput >= txPrev.Size())
+                            return debug::error(FUNCTION, "prevout ", nOutput, " is out of range ", txPrev.Size());
+
+                        /* Check for Legacy. */
+                        for(const auto& n : vOutputs)
+                        {
+                            if(txPrev[n].Primitive() != TAO::Operation::OP::LEGACY)
+                                return debug::error(FUNCTION, "can't spend from UTXO with no OP::LEGACY");
+                        }
+
+                        /* Add to the inputs. */
+                        inputs.emplace(hashPrev, std::make_pair(uint8_t(TAO::Ledger::TRITIUM), DataStream(SER_LLD, LLD::DATABASE_VERSION)));
+                        inputs.at(hashPrev).second << txPrev;
+
+                        continue;
+                    }
+                }
+
+                /* Start from the outputs already fetched from this transaction. */
+                std::map<uint32_t, Coin> mapCoins;
+                if(itInput != inputs.end())
+                    mapCoins = legacy_coins(itInput->second.second);
+
+                /* Read the outputs spent from the outpoint index. */
+                bool fIndexed = true;
+                for(const auto& n : vOutputs)
+                {
+                    Coin coin;
+                    if(!LLD::Legacy->ReadOutput(hashPrev, n, coin))
+                    {
+                        fIndexed = false;
+                        break;
+                    }
+
+                    mapCoins[n] = std::move(coin);
+                }
+
+                /* Fall back to the whole transaction for outputs written before the index, or out of its range. */
+                if(!fIndexed)
+                {
+                    /* Read the previous transaction. */
+                    Transaction txPrev;
+                    if(!LLD::Legacy->ReadTx(hashPrev, txPrev))
+                        return debug::error(FUNCTION, "tx ", hashPrev.SubString(), " not found");
+
+                    /* Check that it is valid. */
+                    if(nOutput >= txPrev.vout.size())
+                        return debug::error(FUNCTION, "prevout ", nOutput, " is out of range ", txPrev.vout.size());
+
+                    /* Check that hashes match, as the outputs are keyed by it from here on. */
+                    if(txPrev.GetHash() != hashPrev)
+                        return debug::error(FUNCTION, "prevout.hash mismatch");
+
+                    for(const auto& n : vOutputs)
+                        mapCoins[n] = Coin(txPrev, n);
+                }
+
+                /* Add to the inputs. */
+                if(itInput == inputs.end())
+                    itInput = inputs.emplace(hashPrev, std::make_pair(uint8_t(TAO::Ledger::LEGACY), DataStream(SER_LLD, LLD::DATABASE_VERSION))).first;
+
+                itInput->second.second.clear();
+                itInput->second.second << mapCoins;
+            }
+
+            return true;
+        }
+    }
+
+
     /* Default Constructor. */
     Transaction::Transaction()
     : nVersion  (TRANSACTION_CURRENT_VERSION)
@@ -937,58 +1070,27 @@ namespace Legacy
         if(IsCoinBase())
             return true;
 
-        /* Get the number of inputs to the transaction. */
-        uint32_t nSize = static_cast<uint32_t>(vin.size());
-        for(uint32_t i = (uint32_t)IsCoinStake(); i < nSize; ++i)
-        {
-            /* Skip inputs that are already found. */
-            OutPoint prevout = vin[i].prevout;
-            if(inputs.count(prevout.hash))
-                continue;
-
-            /* Cannot spend Tritium send-to-Legacy inputs until after v6 grace period ends */
-            if(nTime >= TAO::Ledger::StartBlockTimelock(7))
-            {
-                /* Get the type of transaction. */
-                if(prevout.hash.GetType() == TAO::Ledger::TRITIUM)
-                {
-                    /* Read the previous transaction. */
-                    TAO::Ledger::Transaction txPrev;
-                    if(LLD::Ledger->ReadTx(prevout.hash, txPrev))
-                    {   //we can't rely soley on the type byte, so we must revert to legacy if not found in ledger.}
+        /* Read each previous transaction once, however many of its outputs are spent. */
+        std::map<uint512_t, std::pair<bool, std::vector<uint32_t>> > mapPrev;
+        collect_inputs(*this, inputs, mapPrev);
 
-                        /* Check that it is valid. */
-                        if(prevout.n >= txPrev.Size())
-                            return debug::error(FUNCTION, "prevout ", prevout.n, " is out of range ", txPrev.Size());
-
-                        /* Check for Legacy. */
-                        if(txPrev[prevout.n].Primitive() != TAO::Operation::OP::LEGACY)
-                            return debug::error(FUNCTION, "can't spend from UTXO with no OP::LEGACY");
-
-                        /* Add to the inputs. */
-                        inputs.emplace(prevout.hash, std::make_pair(uint8_t(TAO::Ledger::TRITIUM), DataStream(SER_LLD, LLD::DATABASE_VERSION)));
-                        inputs.at(prevout.hash).second << txPrev;
-
-                        continue;
-                    }
-                }
-            }
-
-            /* Read the previous transaction. */
-            Transaction txPrev;
-            if(!LLD::Legacy->ReadTx(prevout.hash, txPrev))
-                return debug::error(FUNCTION, "tx ", prevout.hash.SubString(), " not found");
+        return read_inputs(mapPrev, inputs);
+    }
 
-            /* Check that it is valid. */
-            if(prevout.n >= txPrev.vout.size())
-                return debug::error(FUNCTION, "prevout ", prevout.n, " is out of range ", txPrev.vout.size());
 
-            /* Add to the inputs. */
-            inputs.emplace(prevout.hash, std::make_pair(uint8_t(TAO::Ledger::LEGACY), DataStream(SER_LLD, LLD::DATABASE_VERSION)));
-            inputs.at(prevout.hash).second << txPrev;
+    /* Get the inputs for all the transactions of a block in one pass. */
+    bool Transaction::FetchInputs(const std::vector<Transaction>& vtx, std::map<uint512_t, std::pair<uint8_t, DataStream> >& inputs)
+    {
+        /* Gather the previous transactions of every transaction, sorted by hash. */
+        std::map<uint512_t, std::pair<bool, std::vector<uint32_t>> > mapPrev;
+        for(const auto& tx : vtx)
+        {
+            /* Coinbase has no inputs. */
+            if(!tx.IsCoinBase())
+                collect_inputs(tx, inputs, mapPrev);
         }
 
-        return true;
+        return read_inputs(mapPrev, inputs);
     }
 
 
@@ -1090,8 +1192,16 @@ namespace Legacy
         /* Read all of the inputs. */
         uint64_t nValueIn = 0;
 
+        /* Scripts of the outputs being spent, verified together once every input is read. (...When not syncronizing) */
+        const bool fVerify = !TAO::Ledger::ChainState::Synchronizing();
+        std::vector<std::pair<uint32_t, Script>> vScripts;
+
+        /* Outputs spent from previous legacy transactions, deserialized once however many of them are spent. */
+        std::map<uint512_t, std::map<uint32_t, Coin> > mapPrev;
+
         /* Get the number of inputs to the transaction. */
         uint32_t nSize = static_cast<uint32_t>(vin.size());
+        vScripts.reserve(nSize);
         for(uint32_t i = (uint32_t)fIsCoinStake; i < nSize; ++i)
         {
             /* Check the inputs map to tx inputs. */
@@ -1107,10 +1217,10 @@ namespace Legacy
                 /* Handle for legacy transaction. */
                 case TAO::Ledger::LEGACY:
                 {
-                    /* Get the previous transaction. */
-                    Transaction txPrev;
-                    inputs.at(prevout.hash).second.SetPos(0);
-                    inputs.at(prevout.hash).second >> txPrev;
+                    /* Get the outputs spent from the previous transaction. */
+                    auto itPrev = mapPrev.find(prevout.hash);
+                    if(itPrev == mapPrev.end())
+                        itPrev = mapPrev.emplace(prevout.hash, legacy_coins(inputs.at(prevout.hash).second)).first;
 
                     /* Check indexes for miner and block. */
                     if(nFlags == TAO::Ledger::FLAGS::BLOCK || nFlags == TAO::Ledger::FLAGS::MINER)
@@ -1121,20 +1231,23 @@ namespace Legacy
                     }
 
                     /* Check the inputs range. */
-                    if(prevout.n >= txPrev.vout.size())
+                    auto itCoin = itPrev->second.find(prevout.n);
+                    if(itCoin == itPrev->second.end())
                         return debug::error(FUNCTION, "prevout is out of range");
 
+                    const Coin& coin = itCoin->second;
+
                     /* Check maturity before spend. */
-                    if(txPrev.IsCoinBase() || txPrev.IsCoinStake())
+                    if(coin.fCoinBase || coin.fCoinStake)
                     {
                         /* Read the previous block state. */
                         TAO::Ledger::BlockState statePrev;
-                        if(!LLD::Ledger->ReadBlock(txPrev.GetHash(), statePrev))
+                        if(!LLD::Ledger->ReadBlock(prevout.hash, statePrev))
                             return debug::error(FUNCTION, "failed to read previous tx block");
 
                         /* Check the maturity. */
                         uint32_t nMaturity;
-                        if(txPrev.IsCoinBase())
+                        if(coin.fCoinBase)
                             nMaturity = TAO::Ledger::MaturityCoinBase(state);
                         else
                             nMaturity = TAO::Ledger::MaturityCoinStake(state);
@@ -1144,21 +1257,21 @@ namespace Legacy
                     }
 
                     /* Check the transaction timestamp. */
-                    if(txPrev.nTime > nTime)
+                    if(coin.nTime > nTime)
                         return debug::error(FUNCTION, "transaction timestamp earlier than input transaction");
 
                     /* Check for overflow input values. */
-                    nValueIn += txPrev.vout[prevout.n].nValue;
-                    if(!MoneyRange(txPrev.vout[prevout.n].nValue) || !MoneyRange(nValueIn))
+                    nValueIn += coin.out.nValue;
+                    if(!MoneyRange(coin.out.nValue) || !MoneyRange(nValueIn))
                         return debug::error(FUNCTION, "txin values out of range");
 
                     /* Check for double spends. */
                     if(LLD::Legacy->IsSpent(prevout.hash, prevout.n))
                         return debug::error(FUNCTION, "prev tx ", prevout.hash.SubString(), " is already spent");
 
-                    /* Check the ECDSA signatures. (...When not syncronizing) */
-                    if(!TAO::Ledger::ChainState::Synchronizing() && !VerifySignature(txPrev, *this, i, 0))
-                        return debug::error(FUNCTION, "signature is invalid");
+                    /* Queue the ECDSA signatures to check, the outputs being keyed by the hash they were fetched with. */
+                    if(fVerify)
+                        vScripts.push_back(std::make_pair(i, coin.out.scriptPubKey));
 
                     /* Commit to disk if flagged. */
                     if(nFlags == TAO::Ledger::FLAGS::BLOCK)
@@ -1217,16 +1330,14 @@ namespace Legacy
                     if(LLD::Legacy->IsSpent(prevout.hash, prevout.n))
                         return debug::error(FUNCTION, "prev tx ", prevout.hash.SubString(), " is already spent");
 
-                    /* Check the ECDSA signatures. (...When not syncronizing) */
-                    if(!TAO::Ledger::ChainState::Synchronizing())
+                    /* Queue the ECDSA signatures to check. */
+                    if(fVerify)
                     {
                         /* Check that hashes match. */
                         if(prevout.hash != txPrev.GetHash())
                             return debug::error(FUNCTION, "prevout.hash mismatch");
 
-                        /* Verify the scripts. */
-                        if(!VerifyScript(vin[i].scriptSig, txout.scriptPubKey, *this, i, 0))
-                            return debug::error(FUNCTION, "invalid script");
+                        vScripts.push_back(std::make_pair(i, txout.scriptPubKey));
                     }
 
                     /* Commit to disk if flagged. */
@@ -1249,6 +1360,10 @@ namespace Legacy
             }
         }
 
+        /* Check the ECDSA signatures, caching them on mempool acceptance so the block connect can skip them. */
+        if(!VerifyInputs(*this, vScripts, nFlags == TAO::Ledger::FLAGS::MEMPOOL))
+            return debug::error(FUNCTION, "signature is invalid");
+
         /* Check the coinstake transaction. */
         if(fIsCoinStake)
         {
@@ -1546,16 +1661,15 @@ namespace Legacy
             /* Handle for legacy transaction. */
             case TAO::Ledger::LEGACY:
             {
-                /* Read the previous transaction. */
-                Transaction txPrev;
-                (*mi).second.second.SetPos(0);
-                (*mi).second.second >> txPrev;
+                /* Read the outputs fetched from the previous transaction. */
+                const std::map<uint32_t, Coin> mapCoins = legacy_coins((*mi).second.second);
 
                 /* Check ranges. */
-                if(input.prevout.n >= txPrev.vout.size())
+                auto itCoin = mapCoins.find(input.prevout.n);
+                if(itCoin == mapCoins.end())
                     throw debug::exception(FUNCTION, "prevout.n out of range");
 
-                return txPrev.vout[input.prevout.n];
+                return itCoin->second.out;
             }
 
             /* Handle for tritium transaction. */
@@ -0,0 +1,95 @@
+/*__________________________________________________________________________________________
+
+			Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+			(c) Copyright The Nexus Developers 2014 - 2023
+
+			Distributed under the MIT software license, see the accompanying
+			file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+			"ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LEGACY_TYPES_COIN_H
+#define NEXUS_LEGACY_TYPES_COIN_H
+
+#include <Util/templates/serialize.h>
+#include <Legacy/types/txout.h>
+
+namespace Legacy
+{
+
+	/* Forward declarations. */
+	class Transaction;
+
+
+	/** A single output of a transaction, with what spending it needs to know about the transaction it came from.
+	 *  Indexed by outpoint so inputs can be fetched without reading their whole previous transactions.
+	 */
+	class Coin
+	{
+	public:
+
+		/** The timestamp of the transaction the output belongs to. **/
+		uint32_t nTime;
+
+
+		/** Flag for an output of a coinbase transaction. **/
+		bool fCoinBase;
+
+
+		/** Flag for an output of a coinstake transaction. **/
+		bool fCoinStake;
+
+
+		/** The output itself. **/
+		TxOut out;
+
+
+		//the serialization methods
+		IMPLEMENT_SERIALIZE
+		(
+			READWRITE(nTime);
+			READWRITE(fCoinBase);
+			READWRITE(fCoinStake);
+			READWRITE(out);
+		)
+
+
+		/** Default Constructor. **/
+		Coin();
+
+
+		/** Copy Constructor. **/
+		Coin(const Coin& coin);
+
+
+		/** Move Constructor. **/
+		Coin(Coin&& coin) noexcept;
+
+
+		/** Copy assignment. **/
+		Coin& operator=(const Coin& coin);
+
+
+		/** Move assignment. **/
+		Coin& operator=(Coin&& coin) noexcept;
+
+
+		/** Default destructor. **/
+		~Coin();
+
+
+		/** Constructor
+		 *
+		 *	@param[in] tx The transaction the output belongs to.
+		 *	@param[in] n The output number in the transaction.
+		 *
+		 **/
+		Coin(const Transaction& tx, const uint32_t n);
+	};
+}
+
+#endif
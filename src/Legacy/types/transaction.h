@@ -449,7 +449,8 @@ namespace Legacy
 
 		/** Fetch Inputs
 		 *
-		 *  Get the inputs for a transaction.
+		 *  Get the inputs for a transaction. Legacy inputs are read from the outpoint index as the outputs spent,
+		 *  by output number, falling back to the previous transaction for outputs written before the index.
 		 *
 		 *  @param[in] inputs The inputs map that has prev transactions
 		 *
@@ -459,6 +460,19 @@ namespace Legacy
 		bool FetchInputs(std::map<uint512_t, std::pair<uint8_t, DataStream> >& inputs) const;
 
 
+		/** Fetch Inputs
+		 *
+		 *  Get the inputs for all the transactions of a block in one pass, reading the outpoints in hash order.
+		 *
+		 *  @param[in] vtx The transactions to get the inputs for.
+		 *  @param[in] inputs The inputs map that has prev transactions
+		 *
+		 *  @return true if the inputs were found
+		 *
+		 **/
+		static bool FetchInputs(const std::vector<Transaction>& vtx, std::map<uint512_t, std::pair<uint8_t, DataStream> >& inputs);
+
+
 		/** Connect Inputs
 	     *
 	     *  Mark the inputs in a transaction as spent.
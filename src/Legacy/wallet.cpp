@@ -89,6 +89,9 @@ namespace Legacy
     , vchDefaultKey     ( )
     , vchTrustKey       ( )
     , nWalletUnlockTime (0)
+    , mapCoins          ( )
+    , nCoinsValue       (0)
+    , setUnsettled      ( )
     , cs_wallet         ( )
     , mapWallet         ( )
     {
@@ -222,6 +225,10 @@ namespace Legacy
             //RECURSIVE(cs_wallet);
 
             uint32_t nLoadWalletRet = WalletDB::LoadWallet();
+
+            /* Index the unspent outputs of the loaded transactions, also needed before a rescan. */
+            Wallet::Instance().ReindexCoins();
+
             if(nLoadWalletRet != DB_LOAD_OK)
                 return nLoadWalletRet;
         }
@@ -723,26 +730,28 @@ namespace Legacy
     /* Retrieves the total wallet balance for all confirmed, mature transactions. */
     int64_t Wallet::GetBalance()
     {
-        int64_t nTotalBalance = 0;
-        {
-            /* Lock wallet only to take a snapshot of current transaction map for calculating balance
-             * After unlock, mapWallet can change but it won't affect balance calculation
-             */
-            RECURSIVE(cs_wallet);
+        RECURSIVE(cs_wallet);
 
-            for (const auto& item : mapWallet)
+        /* Start from every unspent output, then take out the ones not spendable yet. */
+        int64_t nTotalBalance = nCoinsValue;
+        for(auto it = setUnsettled.begin(); it != setUnsettled.end(); )
+        {
+            const WalletTx& wtx = mapWallet.at(*it);
+            if(IsSettled(wtx))
             {
-                const WalletTx& wtx = item.second;
-
-                /* Skip any transaction that isn't final, isn't completely confirmed, or has a future timestamp */
-                if (!wtx.IsFinal() || !wtx.IsConfirmed() || wtx.nTime > runtime::unifiedtimestamp())
-                    continue;
+                /* Once in a block, a transaction stays settled until blocks are disconnected. Trusted unconfirmed
+                 * transactions are checked again on every call, as they can still leave the mempool or conflict. */
+                if(wtx.GetDepthInMainChain() > 0)
+                    it = setUnsettled.erase(it);
+                else
+                    ++it;
 
-                nTotalBalance += wtx.GetAvailableCredit();
+                continue;
             }
-        }
-
 
+            nTotalBalance -= GetCoinsValue(*it);
+            ++it;
+        }
 
         return nTotalBalance;
     }
@@ -755,51 +764,53 @@ namespace Legacy
         {
             RECURSIVE(cs_wallet);
             nBalance = 0;
-            for(auto it = mapWallet.begin(); it != mapWallet.end(); ++it)
+
+            /* Outputs are ordered by txid, so each transaction is checked once. */
+            const WalletTx* pwtx = nullptr;
+            uint512_t hashLast = 0;
+            bool fAvailable = false;
+            for(const auto& coin : mapCoins)
             {
-                const WalletTx* pcoin = &(*it).second;
-                if(!pcoin->IsFinal())
-                    continue;
+                const uint512_t& hash = coin.first.first;
+                if(pwtx == nullptr || hash != hashLast)
+                {
+                    pwtx     = &mapWallet.at(hash);
+                    hashLast = hash;
 
-                if(pcoin->GetDepthInMainChain() < nMinDepth)
-                    continue;
+                    const WalletTx& wtx = *pwtx;
+                    fAvailable = wtx.IsFinal() && wtx.GetDepthInMainChain() >= nMinDepth &&
+                                 !((wtx.IsCoinBase() || wtx.IsCoinStake()) && wtx.GetBlocksToMaturity() > 0);
+                }
 
-                if((pcoin->IsCoinBase() || pcoin->IsCoinStake()) && pcoin->GetBlocksToMaturity() > 0)
+                if(!fAvailable)
                     continue;
 
-                for(int i = 0; i < pcoin->vout.size(); i++)
+                const int64_t nValue = coin.second.first;
+                if(strAccount == "*")
                 {
+                    nBalance += nValue;
 
-                    if(!pcoin->IsSpent(i) && IsMine(pcoin->vout[i]) && pcoin->vout[i].nValue > 0)
-                    {
-                        if(strAccount == "*")
-                        {
-                            nBalance += pcoin->vout[i].nValue;
-
-                            continue;
-                        }
-
-                        NexusAddress address;
-                        if(!ExtractAddress(pcoin->vout[i].scriptPubKey, address) || !address.IsValid())
-                            return false;
+                    continue;
+                }
 
-                        if(GetAddressBook().GetAddressBookMap().count(address))
-                        {
-                            std::string strEntry = GetAddressBook().GetAddressBookMap().at(address);
-                            if(strEntry == "" && strAccount == "default")
-                                strEntry = "default";
+                const NexusAddress& address = coin.second.second;
+                if(!address.IsValid())
+                    return false;
 
-                            if(strEntry == "default" && strAccount == "")
-                                strAccount = "default";
+                if(GetAddressBook().GetAddressBookMap().count(address))
+                {
+                    std::string strEntry = GetAddressBook().GetAddressBookMap().at(address);
+                    if(strEntry == "" && strAccount == "default")
+                        strEntry = "default";
 
-                            if(strEntry == strAccount)
-                                nBalance += pcoin->vout[i].nValue;
-                        }
-                        else if(strAccount == "default" || strAccount == "")
-                            nBalance += pcoin->vout[i].nValue;
+                    if(strEntry == "default" && strAccount == "")
+                        strAccount = "default";
 
-                    }
+                    if(strEntry == strAccount)
+                        nBalance += nValue;
                 }
+                else if(strAccount == "default" || strAccount == "")
+                    nBalance += nValue;
             }
         }
 
@@ -812,24 +823,24 @@ namespace Legacy
     {
         int64_t nUnconfirmedBalance = 0;
         {
-            /* Lock wallet only to take a snapshot of current transaction map for calculating balance
-             * After unlock, mapWallet can change but it won't affect balance calculation
-             */
             RECURSIVE(cs_wallet);
 
-            for (const auto& item : mapWallet)
+            /* Only transactions that were unsettled when last checked can be unconfirmed. */
+            for(const auto& hash : setUnsettled)
             {
-                const WalletTx& wtx = item.second;
+                const WalletTx& wtx = mapWallet.at(hash);
+
+                if(wtx.IsFinal() && wtx.IsConfirmed())
+                    continue;
 
-                if (wtx.IsFinal() && wtx.IsConfirmed())
+                /* Immature outputs have no available credit. */
+                if((wtx.IsCoinBase() || wtx.IsCoinStake()) && wtx.GetBlocksToMaturity() > 0)
                     continue;
 
-                nUnconfirmedBalance += wtx.GetAvailableCredit();
+                nUnconfirmedBalance += GetCoinsValue(hash);
             }
         }
 
-
-
         return nUnconfirmedBalance;
     }
 
@@ -885,41 +896,133 @@ namespace Legacy
 
             vCoins.clear();
 
-            for(const auto& item : mapWallet)
+            /* Outputs are ordered by txid, so each transaction is checked once. */
+            const WalletTx* pwtx = nullptr;
+            uint512_t hashLast = 0;
+            bool fAvailable = false;
+            uint32_t nDepth = 0;
+            for(const auto& coin : mapCoins)
             {
-                const WalletTx& wtx = item.second;
-
-                /* Filter transactions not final */
-                if (!wtx.IsFinal())
-                    continue;
+                const uint512_t& hash = coin.first.first;
+                if(pwtx == nullptr || hash != hashLast)
+                {
+                    pwtx     = &mapWallet.at(hash);
+                    hashLast = hash;
 
-                /* Filter unconfirmed transactions unless want unconfirmed */
-                if (fOnlyConfirmed && !wtx.IsConfirmed())
-                    continue;
+                    /* Filter transactions not final, after requested spend time, or unconfirmed unless want unconfirmed */
+                    fAvailable = pwtx->IsFinal() && pwtx->nTime <= nSpendTime && (!fOnlyConfirmed || pwtx->IsConfirmed());
 
-                /* Filter immature minting and staking transactions */
-                if ((wtx.IsCoinBase() || wtx.IsCoinStake()) && wtx.GetBlocksToMaturity() > 0)
-                    continue;
+                    /* Filter immature minting and staking transactions */
+                    if(fAvailable && (pwtx->IsCoinBase() || pwtx->IsCoinStake()) && pwtx->GetBlocksToMaturity() > 0)
+                        fAvailable = false;
 
-                for (uint32_t i = 0; i < wtx.vout.size(); i++)
-                {
-                    /* Filter transactions after requested spend time */
-                    if (wtx.nTime > nSpendTime)
-                        continue;
-
-                    /* To be included in result, vout must not be spent, must belong to current wallet, and must have positive value */
-                    if (!(wtx.IsSpent(i)) && IsMine(wtx.vout[i]) && wtx.vout[i].nValue > 0)
-                    {
-                        /* Create output from the current vout and add to result */
-                        Output txOutput(wtx, i, wtx.GetDepthInMainChain());
-                        vCoins.push_back(txOutput);
-                    }
+                    if(fAvailable)
+                        nDepth = pwtx->GetDepthInMainChain();
                 }
+
+                /* Create output from the current vout and add to result */
+                if(fAvailable)
+                    vCoins.push_back(Output(*pwtx, coin.first.second, nDepth));
             }
         }
     }
 
 
+    /* Rebuild the unspent output index from every transaction in the wallet. */
+    void Wallet::ReindexCoins()
+    {
+        RECURSIVE(cs_wallet);
+
+        mapCoins.clear();
+        setUnsettled.clear();
+        nCoinsValue = 0;
+
+        for(const auto& item : mapWallet)
+            SyncCoins(item.first);
+    }
+
+
+    /* Flag every indexed transaction to have its confirmations checked again. */
+    void Wallet::MarkUnsettled()
+    {
+        RECURSIVE(cs_wallet);
+
+        for(const auto& coin : mapCoins)
+            setUnsettled.insert(setUnsettled.end(), coin.first.first);
+    }
+
+
+    /* Update the unspent output index for a wallet transaction after it was added, changed, or removed. */
+    void Wallet::SyncCoins(const uint512_t& hash)
+    {
+        EraseCoins(hash);
+
+        /* Removed transactions have nothing left to index. */
+        TransactionMap::const_iterator it = mapWallet.find(hash);
+        if(it == mapWallet.end())
+            return;
+
+        /* Index every unspent output belonging to this wallet that has a positive value. */
+        const WalletTx& wtx = it->second;
+        for(uint32_t n = 0; n < wtx.vout.size(); ++n)
+        {
+            const TxOut& txout = wtx.vout[n];
+            if(wtx.IsSpent(n) || txout.nValue <= 0 || !IsMine(txout))
+                continue;
+
+            NexusAddress address;
+            ExtractAddress(txout.scriptPubKey, address);
+
+            mapCoins[std::make_pair(hash, n)] = std::make_pair(txout.nValue, address);
+            nCoinsValue += txout.nValue;
+
+            /* New outputs are checked for confirmations by the next balance request. */
+            setUnsettled.insert(hash);
+        }
+    }
+
+
+    /* Remove all outputs of a transaction from the unspent output index. */
+    void Wallet::EraseCoins(const uint512_t& hash)
+    {
+        auto it = mapCoins.lower_bound(std::make_pair(hash, 0u));
+        while(it != mapCoins.end() && it->first.first == hash)
+        {
+            nCoinsValue -= it->second.first;
+
+            it = mapCoins.erase(it);
+        }
+
+        setUnsettled.erase(hash);
+    }
+
+
+    /* Get the total value of the indexed outputs of a transaction. */
+    int64_t Wallet::GetCoinsValue(const uint512_t& hash) const
+    {
+        int64_t nValue = 0;
+        for(auto it = mapCoins.lower_bound(std::make_pair(hash, 0u)); it != mapCoins.end() && it->first.first == hash; ++it)
+            nValue += it->second.first;
+
+        return nValue;
+    }
+
+
+    /* Check if a transaction's outputs count towards the balance. */
+    bool Wallet::IsSettled(const WalletTx& wtx) const
+    {
+        /* Skip any transaction that isn't final, isn't completely confirmed, or has a future timestamp */
+        if(!wtx.IsFinal() || !wtx.IsConfirmed() || wtx.nTime > runtime::unifiedtimestamp())
+            return false;
+
+        /* Immature minting and staking transactions are not spendable */
+        if((wtx.IsCoinBase() || wtx.IsCoinStake()) && wtx.GetBlocksToMaturity() > 0)
+            return false;
+
+        return true;
+    }
+
+
     /* Mark all transactions in the wallet as "dirty" to force balance recalculation. */
     void Wallet::MarkDirty()
     {
@@ -1037,6 +1140,12 @@ namespace Legacy
         /* since AddToWallet is called directly for self-originating transactions, check for consumption of own coins */
         WalletUpdateSpent(wtx);
 
+        /* Index the outputs of the new or merged transaction. */
+        {
+            RECURSIVE(cs_wallet);
+            SyncCoins(hash);
+        }
+
         return true;
     }
 
@@ -1162,6 +1271,7 @@ namespace Legacy
             if(mapWallet.erase(hash))
             {
                 WalletDB::EraseTx(hash);
+                EraseCoins(hash);
             }
         }
 
@@ -1195,6 +1305,8 @@ namespace Legacy
                     {
                         txPrev.MarkUnspent(txin.prevout.n);
                         txPrev.WriteToDisk(tx.GetHash());
+
+                        SyncCoins(txin.prevout.hash);
                     }
                 }
             }
@@ -1290,6 +1402,12 @@ namespace Legacy
                             }
                         }
 
+                        /* Re-index the outputs now their spent flags are current. */
+                        {
+                            RECURSIVE(cs_wallet);
+                            SyncCoins(hash);
+                        }
+
                         ++nTransactionCount;
                     }
 
@@ -1378,6 +1496,12 @@ namespace Legacy
                             }
                         }
 
+                        /* Re-index the outputs now their spent flags are current. */
+                        {
+                            RECURSIVE(cs_wallet);
+                            SyncCoins(hash);
+                        }
+
                         ++nTransactionCount;
                     }
 
@@ -1515,6 +1639,8 @@ namespace Legacy
 
                         wtx.MarkSpent(txin.prevout.n);
                         wtx.WriteToDisk(txin.prevout.hash);
+
+                        SyncCoins(txin.prevout.hash);
                     }
                 }
             }
@@ -1597,7 +1723,10 @@ namespace Legacy
 
             /* Update mapWallet with repaired transactions */
             for (const auto& map : mapRepaired)
+            {
                 mapWallet[map.first] = map.second;
+                SyncCoins(map.first);
+            }
         }
     }
 
@@ -2116,6 +2245,8 @@ namespace Legacy
                 txPrev.BindWallet(this);
                 txPrev.MarkSpent(txin.prevout.n);
                 txPrev.WriteToDisk(wtxNew.GetHash()); //Stores to wallet database
+
+                SyncCoins(txin.prevout.hash);
             }
         }
 
@@ -2293,116 +2424,80 @@ namespace Legacy
     {
         /* cs_wallet should already be locked when this is called (CreateTransaction) */
         mapCoinsRet.clear();
-        std::vector<uint512_t> vCoins;
 
         nValueRet = 0;
 
         if(config::GetBoolArg("-printselectcoin", false))
             debug::log(0, FUNCTION, "Selecting coins for account ", strAccount);
 
-        /* Build a set of wallet transactions from all transaction in the wallet map */
-        vCoins.reserve(mapWallet.size());
-        for(const auto& item : mapWallet)
-            vCoins.push_back(item.first);
-
-        /* Randomly order the transactions as potential inputs */
-        LLC::random_shuffle(vCoins.begin(), vCoins.end());
-
-        /* Loop through all transactions, finding and adding available unspent balance to the list of outputs until reach nTargetValue */
-        for(const uint512_t& hash : vCoins)
+        /* Check whether an indexed output can be used for this request. */
+        auto fSpendable = [&](const std::pair<uint512_t, uint32_t>& prevout) -> bool
         {
-            /* Get the transaction. */
-            const WalletTx* wtx = &mapWallet[hash];
+            const WalletTx& wtx = mapWallet.at(prevout.first);
 
             /* Can't spend transaction from after spend time */
-            if(wtx->nTime > nSpendTime)
-                continue;
+            if(wtx.nTime > nSpendTime)
+                return false;
 
             /* Can't spend balance that is unconfirmed or not final */
-            if(!wtx->IsFinal() || !wtx->IsConfirmed())
-                continue;
+            if(!wtx.IsFinal() || !wtx.IsConfirmed())
+                return false;
 
             /* Can't spend transaction that has not reached minimum depth setting for mine/theirs */
-            if(wtx->GetDepthInMainChain() < (wtx->IsFromMe() ? nConfMine : nConfTheirs))
-                continue;
+            if(wtx.GetDepthInMainChain() < (wtx.IsFromMe() ? nConfMine : nConfTheirs))
+                return false;
 
             /* Can't spend coinbase or coinstake transactions that are immature */
-            if((wtx->IsCoinBase() || wtx->IsCoinStake()) && wtx->GetBlocksToMaturity() > 0)
-                continue;
+            if((wtx.IsCoinBase() || wtx.IsCoinStake()) && wtx.GetBlocksToMaturity() > 0)
+                return false;
 
-            /* So far, the transaction itself is available, now have to check each output to see if there are any we can use */
-            for(uint32_t i = 0; i < wtx->vout.size(); i++)
-            {
-                /* Check for null values. */
-                if(wtx->vout[i].IsNull())
-                    continue;
+            /* Handle send from specific address here. */
+            const NexusAddress& address = mapCoins.at(prevout).second;
+            if(fromAddress.IsValid())
+                return address.IsValid() && address == fromAddress;
 
-                /* Can't spend outputs that are already spent or not belonging to this wallet */
-                if(wtx->IsSpent(i) || !IsMine(wtx->vout[i]))
-                    continue;
+            /* Handle account selection here. */
+            if(strAccount != "*")
+            {
+                if(!address.IsValid())
+                    return false;
 
-                /* Handle send from specific address here. */
-                if(fromAddress.IsValid())
-                {
-                    NexusAddress address;
-                    if(!ExtractAddress(wtx->vout[i].scriptPubKey, address) || !address.IsValid())
-                        continue;
+                /* Not in address book (no label), include if default requested */
+                if(!GetAddressBook().HasAddress(address))
+                    return strAccount == "default";
 
-                    if(address == fromAddress)
-                    {
-                            /* Address for transaction matches request, include in result */
-                            mapCoinsRet[std::make_pair(hash, i)] = wtx;
-                            nValueRet += wtx->vout[i].nValue;
-                    }
-                }
+                std::string strEntry = GetAddressBook().GetAddressBookName(address);
+                if(strEntry == "")
+                    strEntry = "default";
 
-                /* Handle account selection here. */
-                else if(strAccount != "*")
-                {
-                    NexusAddress address;
-                    if(!ExtractAddress(wtx->vout[i].scriptPubKey, address) || !address.IsValid())
-                        continue;
+                return strEntry == strAccount;
+            }
 
-                    if(Wallet::Instance().GetAddressBook().HasAddress(address))
-                    {
-                        std::string strEntry = Wallet::Instance().GetAddressBook().GetAddressBookName(address);
-                        if(strEntry == "")
-                            strEntry = "default";
+            /* Handle wildcard here, include all outputs. */
+            return true;
+        };
 
-                        if(strEntry == strAccount)
-                        {
-                            /* Account label for transaction address matches request, include in result */
-                            mapCoinsRet[std::make_pair(hash, i)] = wtx;
-                            nValueRet += wtx->vout[i].nValue;
-                        }
-                    }
-                    else if(strAccount == "default")
-                    {
-                        /* Not in address book (no label), include if default requested */
-                        mapCoinsRet[std::make_pair(hash, i)] = wtx;
-                        nValueRet += wtx->vout[i].nValue;
-                    }
-                }
+        /* Randomly order the unspent outputs as potential inputs. */
+        std::vector<std::pair<uint512_t, uint32_t>> vCoins;
+        vCoins.reserve(mapCoins.size());
+        for(const auto& coin : mapCoins)
+            vCoins.push_back(coin.first);
 
-                /* Handle wildcard here, include all transactions. */
-                else
-                {
-                    /* Add transaction with selected vout index to result set */
-                    mapCoinsRet[std::make_pair(hash, i)] = wtx;
+        LLC::random_shuffle(vCoins.begin(), vCoins.end());
 
-                    /* Accumulate total value available to spend in result set */
-                    nValueRet += wtx->vout[i].nValue;
-                }
+        /* Loop through the outputs, adding those we can spend to the result set until reach nTargetValue */
+        for(const auto& prevout : vCoins)
+        {
+            if(!fSpendable(prevout))
+                continue;
 
-                /* If value available to spend in result set exceeds target value, we are done */
-                if(nValueRet >= nTargetValue)
-                    break;
-            }
+            /* Add output to result set, accumulating total value available to spend */
+            mapCoinsRet[prevout] = &mapWallet.at(prevout.first);
+            nValueRet += mapCoins.at(prevout).first;
 
-            /* This is tested twice to break out of both loops */
+            /* If value available to spend in result set exceeds target value, we are done */
             if(nValueRet >= nTargetValue)
                 break;
-
         }
 
         /* Print result set when argument set */
@@ -29,6 +29,7 @@ ________________________________________________________________________________
 #include <LLC/include/eckey.h>
 #include <LLC/types/uint1024.h>
 
+#include <Legacy/types/address.h>
 #include <Legacy/types/legacy.h>
 #include <Legacy/wallet/addressbook.h>
 #include <Legacy/wallet/cryptokeystore.h>
@@ -255,6 +256,18 @@ namespace Legacy
         uint64_t nWalletUnlockTime;
 
 
+        /** Unspent outputs belonging to this wallet, keyed by txid and vout index, holding their value and address. **/
+        std::map<std::pair<uint512_t, uint32_t>, std::pair<int64_t, NexusAddress>> mapCoins;
+
+
+        /** Total value of all outputs in mapCoins. **/
+        int64_t nCoinsValue;
+
+
+        /** Transactions with outputs in mapCoins that were not yet in a block, immature, or future dated when last checked. **/
+        std::set<uint512_t> setUnsettled;
+
+
 
     public:
         /** Mutex for thread concurrency across wallet operations **/
@@ -659,6 +672,23 @@ namespace Legacy
         void AvailableCoins(const uint32_t nSpendTime, std::vector<Output>& vCoins, const bool fOnlyConfirmed = true);
 
 
+        /** ReindexCoins
+         *
+         *  Rebuild the unspent output index from every transaction in the wallet.
+         *
+         **/
+        void ReindexCoins();
+
+
+        /** MarkUnsettled
+         *
+         *  Flag every indexed transaction to have its confirmations checked again. Called when blocks are disconnected,
+         *  as confirmed outputs may have dropped out of the main chain.
+         *
+         **/
+        void MarkUnsettled();
+
+
     /*----------------------------------------------------------------------------------------*/
     /*  Wallet Transactions                                                                   */
     /*----------------------------------------------------------------------------------------*/
@@ -1077,6 +1107,53 @@ namespace Legacy
 
 
     private:
+    /*----------------------------------------------------------------------------------------*/
+    /*  Coin Index                                                                            */
+    /*----------------------------------------------------------------------------------------*/
+        /** SyncCoins
+         *
+         *  Update the unspent output index for a wallet transaction after it was added, changed, or removed.
+         *
+         *  @param[in] hash The txid of the wallet transaction
+         *
+         **/
+        void SyncCoins(const uint512_t& hash);
+
+
+        /** EraseCoins
+         *
+         *  Remove all outputs of a transaction from the unspent output index.
+         *
+         *  @param[in] hash The txid of the wallet transaction
+         *
+         **/
+        void EraseCoins(const uint512_t& hash);
+
+
+        /** GetCoinsValue
+         *
+         *  Get the total value of the indexed outputs of a transaction.
+         *
+         *  @param[in] hash The txid of the wallet transaction
+         *
+         *  @return The value of its unspent outputs
+         *
+         **/
+        int64_t GetCoinsValue(const uint512_t& hash) const;
+
+
+        /** IsSettled
+         *
+         *  Check if a transaction's outputs count towards the balance: final, confirmed, mature, and not future dated.
+         *
+         *  @param[in] wtx The wallet transaction to check
+         *
+         *  @return true if the transaction's outputs are spendable
+         *
+         **/
+        bool IsSettled(const WalletTx& wtx) const;
+
+
     /*----------------------------------------------------------------------------------------*/
     /*  Load Wallet operations - require WalletDB declared friend                            */
     /*----------------------------------------------------------------------------------------*/
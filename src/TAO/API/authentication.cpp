@@ -20,6 +20,7 @@ ________________________________________________________________________________
 #include <TAO/API/include/extract.h>
 
 #include <TAO/API/types/authentication.h>
+#include <TAO/API/types/cache.h>
 
 #include <TAO/Register/types/address.h>
 #include <TAO/Register/types/object.h>
@@ -72,6 +73,9 @@ namespace TAO::API
 
         /* Set our initializing flag as ready now. */
         rSession.fInitializing.store(false);
+
+        /* Drop cached results computed before our sigchain was indexed. */
+        ResultCache::Invalidate(rSession.Genesis());
     }
 
 
@@ -701,6 +705,9 @@ namespace TAO::API
         if(!mapSessions.count(hashSession))
             return;
 
+        /* Drop cached results for the session's sigchain. */
+        ResultCache::Invalidate(mapSessions[hashSession].Genesis());
+
         /* Erase the session from map. */
         mapSessions.erase(hashSession);
     }
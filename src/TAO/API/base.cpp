@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 
 #include <TAO/API/types/base.h>
+#include <TAO/API/types/cache.h>
 #include <TAO/API/types/exception.h>
 
 #include <TAO/API/include/check.h>
@@ -97,9 +98,10 @@ namespace TAO::API
         /* Execute the function map if method is found. */
         if(mapFunctions.find(strMethod) != mapFunctions.end())
         {
-            /* Get the result of command. */
-            const encoding::json& jResults =
-                mapFunctions[strMethod].Execute(jParams, fHelp);
+            /* Get the result of command, through our cache if the function is cached. */
+            const encoding::json jResults = mapFunctions[strMethod].Cached()
+                ? ResultCache::Execute(mapFunctions[strMethod], strMethod, jParams, fHelp)
+                : mapFunctions[strMethod].Execute(jParams, fHelp);
 
             /* Check for operator. */
             if(CheckRequest(jParams, "operator", "string, array"))
@@ -0,0 +1,343 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/API/types/authentication.h>
+#include <TAO/API/types/cache.h>
+#include <TAO/API/types/function.h>
+
+#include <TAO/Operation/include/enum.h>
+#include <TAO/Operation/types/contract.h>
+
+#include <TAO/Register/include/unpack.h>
+
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /* Mutex around our entries. */
+    std::mutex ResultCache::MUTEX;
+
+
+    /* Map of cached entries by key. */
+    std::map<uint256_t, ResultCache::Entry> ResultCache::ENTRIES;
+
+
+    /* Map of keys of entries depending on a given register or sigchain. */
+    std::map<uint256_t, std::set<uint256_t>> ResultCache::DEPENDS;
+
+
+    /* List of keys from most to least recently used. */
+    std::list<uint256_t> ResultCache::RECENT;
+
+
+    /* Generation counter bumped on every invalidation. */
+    std::atomic<uint64_t> ResultCache::GENERATION(0);
+
+
+    /* The key entries depend on for the best chain. */
+    const uint256_t ResultCache::CHAIN = 0;
+
+
+    /* Counters for our metrics. */
+    std::atomic<uint64_t> ResultCache::HITS(0);
+    std::atomic<uint64_t> ResultCache::MISSES(0);
+    std::atomic<uint64_t> ResultCache::INVALIDATED(0);
+
+
+    /* Execute a cached command, returning the cached results if they are still valid. */
+    encoding::json ResultCache::Execute(Function& rFunction, const std::string& strMethod,
+                                        const encoding::json& jParams, const bool fHelp)
+    {
+        /* Check that our cache is enabled. */
+        const uint64_t nMaxEntries = config::GetArg("-apicache", 1000);
+        if(fHelp || nMaxEntries == 0)
+            return rFunction.Execute(jParams, fHelp);
+
+        /* We only cache for active sessions that have finished indexing their sigchain. */
+        uint256_t hashCaller = 0;
+        if(!Authentication::Caller(jParams, hashCaller) || Authentication::Indexing(jParams))
+            return rFunction.Execute(jParams, fHelp);
+
+        /* Build our key from the caller, method and parameters, which dump with their keys sorted. */
+        const uint256_t hashKey =
+            LLC::SK256(hashCaller.ToString() + strMethod + jParams.dump());
+
+        /* Check for a cached entry. */
+        encoding::json jResults;
+        if(Get(hashKey, jResults))
+            return jResults;
+
+        /* Get our generation before we start so we know if anything changed while computing. */
+        const uint64_t nGeneration = Generation();
+
+        /* Track the registers we read while executing, restoring our tracking even if the command throws. */
+        std::set<uint256_t> setDepends = { hashCaller };
+        std::set<uint256_t>* pReads = LLD::RegisterDB::pReads;
+
+        LLD::RegisterDB::pReads = &setDepends;
+        try
+        {
+            jResults = rFunction.Execute(jParams, fHelp);
+        }
+        catch(...)
+        {
+            LLD::RegisterDB::pReads = pReads;
+            throw;
+        }
+        LLD::RegisterDB::pReads = pReads;
+
+        /* Pass our reads up to any outer tracking. */
+        if(pReads)
+            pReads->insert(setDepends.begin(), setDepends.end());
+
+        /* Add our results to the cache. */
+        Insert(hashKey, jResults, setDepends, nGeneration);
+
+        return jResults;
+    }
+
+
+    /* Get a copy of cached results by key. */
+    bool ResultCache::Get(const uint256_t& hashKey, encoding::json &jResults)
+    {
+        {
+            LOCK(MUTEX);
+
+            /* Return a copy of our results if found. */
+            auto itEntry = ENTRIES.find(hashKey);
+            if(itEntry != ENTRIES.end())
+            {
+                /* Move our entry to the front of our used list. */
+                RECENT.splice(RECENT.begin(), RECENT, itEntry->second.itRecent);
+                ++HITS;
+
+                jResults = itEntry->second.jResults;
+                return true;
+            }
+        }
+
+        ++MISSES;
+        return false;
+    }
+
+
+    /* Add results to the cache, unless something was invalidated since they started computing. */
+    bool ResultCache::Insert(const uint256_t& hashKey, const encoding::json& jResults,
+                             const std::set<uint256_t>& setDepends, const uint64_t nGeneration)
+    {
+        /* Check that our cache is enabled. */
+        const uint64_t nMaxEntries = config::GetArg("-apicache", 1000);
+        if(nMaxEntries == 0)
+            return false;
+
+        LOCK(MUTEX);
+
+        /* Don't cache results that may have been computed with stale data. */
+        if(GENERATION.load() != nGeneration || ENTRIES.count(hashKey))
+            return false;
+
+        /* Make room for our new entry, dropping the least recently used. */
+        while(ENTRIES.size() >= nMaxEntries && !RECENT.empty())
+            erase(RECENT.back());
+
+        /* Index our new entry by its dependencies. */
+        for(const auto& hashDepend : setDepends)
+            DEPENDS[hashDepend].insert(hashKey);
+
+        /* Add our new entry. */
+        RECENT.push_front(hashKey);
+        ENTRIES[hashKey] = { jResults, setDepends, RECENT.begin() };
+
+        return true;
+    }
+
+
+    /* Get the current generation of the cache. */
+    uint64_t ResultCache::Generation()
+    {
+        return GENERATION.load();
+    }
+
+
+    /* Drop all entries depending on the given register or sigchain. */
+    void ResultCache::Invalidate(const uint256_t& hashDepend)
+    {
+        /* Bump our generation so results being computed now aren't cached. */
+        ++GENERATION;
+
+        LOCK(MUTEX);
+
+        /* Check for entries depending on this key. */
+        auto itDepend = DEPENDS.find(hashDepend);
+        if(itDepend == DEPENDS.end())
+            return;
+
+        /* Erase every entry, copying our keys first since erasing modifies this index. */
+        const std::set<uint256_t> setKeys = itDepend->second;
+        for(const auto& hashKey : setKeys)
+        {
+            erase(hashKey);
+            ++INVALIDATED;
+        }
+    }
+
+
+    /* Drop all entries depending on the registers and sigchains touched by a transaction. */
+    void ResultCache::Invalidate(const TAO::Ledger::Transaction& tx)
+    {
+        /* Build our list of touched keys, starting with the sigchain itself. */
+        std::set<uint256_t> setTouched = { tx.hashGenesis };
+        for(uint32_t nContract = 0; nContract < tx.Size(); ++nContract)
+        {
+            /* Grab a reference of our contract. */
+            const TAO::Operation::Contract& rContract = tx[nContract];
+
+            /* Add the register the contract operates on. */
+            uint256_t hashAddress;
+            if(TAO::Register::Unpack(rContract, hashAddress))
+                setTouched.insert(hashAddress);
+
+            /* Make sure no exceptions are thrown. */
+            try
+            {
+                /* Seek to our primitive to find recipients. */
+                rContract.SeekToPrimitive();
+
+                uint8_t nOP = 0;
+                rContract >> nOP;
+
+                /* Add the recipients of events, whose unclaimed values change. */
+                switch(nOP)
+                {
+                    /* Debits and transfers lead with the address, then the recipient. */
+                    case TAO::Operation::OP::DEBIT:
+                    case TAO::Operation::OP::TRANSFER:
+                    {
+                        uint256_t hashFrom = 0, hashTo = 0;
+                        rContract >> hashFrom >> hashTo;
+
+                        setTouched.insert(hashTo);
+                        break;
+                    }
+
+                    /* Coinbase leads with the recipient genesis. */
+                    case TAO::Operation::OP::COINBASE:
+                    {
+                        uint256_t hashRecipient = 0;
+                        rContract >> hashRecipient;
+
+                        setTouched.insert(hashRecipient);
+                        break;
+                    }
+                }
+            }
+            catch(const std::exception& e)
+            {
+                debug::warning(FUNCTION, e.what());
+            }
+        }
+
+        /* Drop everything that depends on them. */
+        for(const auto& hashTouched : setTouched)
+            Invalidate(hashTouched);
+    }
+
+
+    /* Drop all entries depending on the best chain. */
+    void ResultCache::InvalidateChain()
+    {
+        Invalidate(CHAIN);
+    }
+
+
+    /* Mark the results being computed on this thread as depending on the best chain. */
+    void ResultCache::DependChain()
+    {
+        /* Only add if we are tracking reads. */
+        if(LLD::RegisterDB::pReads)
+            LLD::RegisterDB::pReads->insert(CHAIN);
+    }
+
+
+    /* Drop all of our entries. */
+    void ResultCache::Clear()
+    {
+        ++GENERATION;
+
+        LOCK(MUTEX);
+
+        /* Count what we dropped. */
+        INVALIDATED += ENTRIES.size();
+
+        ENTRIES.clear();
+        DEPENDS.clear();
+        RECENT.clear();
+    }
+
+
+    /* Get the entries, hit ratio and invalidations of the cache. */
+    encoding::json ResultCache::Metrics()
+    {
+        /* Get a copy of our counters. */
+        const uint64_t nHits   = HITS.load();
+        const uint64_t nMisses = MISSES.load();
+
+        LOCK(MUTEX);
+
+        const encoding::json jRet =
+        {
+            { "entries",     ENTRIES.size()      },
+            { "hits",        nHits               },
+            { "misses",      nMisses             },
+            { "hitrate",     (nHits + nMisses) > 0 ? double(nHits) / (nHits + nMisses) : 0.0 },
+            { "invalidated", INVALIDATED.load()  }
+        };
+
+        return jRet;
+    }
+
+
+    /* Drop an entry and its dependencies, with MUTEX held. */
+    void ResultCache::erase(const uint256_t& hashKey)
+    {
+        /* Find our entry. */
+        auto itEntry = ENTRIES.find(hashKey);
+        if(itEntry == ENTRIES.end())
+            return;
+
+        /* Remove our key from each of its dependencies. */
+        for(const auto& hashDepend : itEntry->second.setDepends)
+        {
+            auto itDepend = DEPENDS.find(hashDepend);
+            if(itDepend == DEPENDS.end())
+                continue;
+
+            /* Clean up empty dependencies. */
+            itDepend->second.erase(hashKey);
+            if(itDepend->second.empty())
+                DEPENDS.erase(itDepend);
+        }
+
+        /* Remove from our used list and map. */
+        RECENT.erase(itEntry->second.itRecent);
+        ENTRIES.erase(itEntry);
+    }
+}
@@ -17,6 +17,7 @@ ________________________________________________________________________________
 #include <TAO/API/types/commands.h>
 
 #include <TAO/API/types/authentication.h>
+#include <TAO/API/types/cache.h>
 #include <TAO/API/types/commands/names.h>
 #include <TAO/API/types/commands/finance.h>
 
@@ -138,8 +139,13 @@ namespace TAO::API
             /* Add stake/immature for NXS only */
             if(hashToken == TOKEN::NXS)
             {
+                /* Immature balances mature with new blocks, so they can only be cached until the next one. */
+                const uint64_t nImmature = GetImmature(hashGenesis);
+                if(nImmature > 0)
+                    ResultCache::DependChain();
+
                 jBalances["stake"]    = FormatBalance(rBalances.second.at("stake"));
-                jBalances["immature"] = FormatBalance(GetImmature(hashGenesis));
+                jBalances["immature"] = FormatBalance(nImmature);
             }
 
             /* Filter results now. */
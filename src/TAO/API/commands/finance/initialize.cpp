@@ -200,6 +200,9 @@ namespace TAO::API
             , "any, account, token, trust"
         );
 
+        /* Cache our lists for polling sessions until a transaction touches them. */
+        mapFunctions["list"].SetCached();
+
 
         /* Handle for all LIST operations. */
         mapFunctions["history"] = Function
@@ -237,6 +240,9 @@ namespace TAO::API
             )
         );
 
+        /* Cache balances for polling sessions until a transaction touches them. */
+        mapFunctions["get/balances"].SetCached();
+
 
         /* Handle for Stake Info. */
         mapFunctions["get/stakeinfo"] = Function
@@ -29,6 +29,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/chainstate.h>
 #include <TAO/Ledger/include/enum.h>
 
+#include <TAO/Ledger/types/metrics.h>
 #include <TAO/Ledger/types/transaction.h>
 
 /* Global TAO namespace. */
@@ -64,9 +65,36 @@ namespace TAO::API
         /* Accumulate these as unsigned values. */
         uint64_t nUniqueAccounts[3] = {0, 0, 0};
 
+        /* Check our volume records for each window first, so we only walk the blocks when they don't cover them. */
+        const uint64_t nWindows[3] = { 86400, 86400 * 7, 86400 * 7 * 4 };
+
+        TAO::Ledger::Volume tWindows[3];
+        const bool fAggregated =
+            TAO::Ledger::aggregator.Window(tBestBlock, nBestTime, nWindows[0], tWindows[0])
+         && TAO::Ledger::aggregator.Window(tBestBlock, nBestTime, nWindows[1], tWindows[1])
+         && TAO::Ledger::aggregator.Window(tBestBlock, nBestTime, nWindows[2], tWindows[2]);
+
+        /* Set our values from the records. */
+        if(fAggregated)
+        {
+            for(uint32_t n = 0; n < 3; ++n)
+            {
+                nTotalTransactions[n] = tWindows[n].nTransactions;
+                nTotalContracts   [n] = tWindows[n].nContracts;
+                nTotalDeposits    [n] = tWindows[n].nDeposits;
+                nTotalWithdraw    [n] = tWindows[n].nWithdraws;
+                nUniqueAccounts   [n] = tWindows[n].nAccounts;
+
+                nMiningEmmission [n]  = tWindows[n].nMining;
+                nStakingEmmission[n]  = tWindows[n].nStaking;
+
+                nStakeChange[n]       = tWindows[n].nStakeChange;
+            }
+        }
+
         /* Iterate backwards until we have reached one whole day. */
         TAO::Ledger::BlockState tPrevBlock = tBestBlock;
-        while(!config::fShutdown.load())
+        while(!fAggregated && !config::fShutdown.load())
         {
             /* Track the amount of stake changed. */
             int64_t nStake = 0;
@@ -205,7 +233,7 @@ namespace TAO::API
 
 
             /* Check our time for days. */
-            if(tPrevBlock.GetBlockTime() + 86400 > nBestTime)
+            if(tPrevBlock.GetBlockTime() + nWindows[0] > nBestTime)
             {
                 /* Set our daily volume values. */
                 nTotalTransactions[0] += (tPrevBlock.vtx.size());
@@ -224,7 +252,7 @@ namespace TAO::API
 
 
             /* Check our time for weeks. */
-            if(tPrevBlock.GetBlockTime() + 86400 * 7 > nBestTime)
+            if(tPrevBlock.GetBlockTime() + nWindows[1] > nBestTime)
             {
                 /* Set our daily volume values. */
                 nTotalTransactions[1] += (tPrevBlock.vtx.size());
@@ -243,7 +271,7 @@ namespace TAO::API
 
 
             /* Check our time for months. */
-            if(tPrevBlock.GetBlockTime() + 86400 * 7 * 4 > nBestTime)
+            if(tPrevBlock.GetBlockTime() + nWindows[2] > nBestTime)
             {
                 /* Set our daily volume values. */
                 nTotalTransactions[2] += (tPrevBlock.vtx.size());
@@ -175,6 +175,9 @@ namespace TAO::API
         const uint256_t hashCrypto =
             TAO::Register::Address(std::string("crypto"), hashGenesis, TAO::Register::Address::CRYPTO);
 
+        /* Derive our crypto keys in parallel so they are cached for the object below. */
+        pCredentials->Prepare({ "auth", "network", "sign" }, 0, strPIN);
+
         /* Create the crypto object. */
         const TAO::Register::Object oCrypto =
             TAO::Register::CreateCrypto
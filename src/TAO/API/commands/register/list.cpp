@@ -15,7 +15,6 @@ ________________________________________________________________________________
 
 #include <TAO/API/types/commands/register.h>
 
-#include <TAO/API/include/compare.h>
 #include <TAO/API/include/check.h>
 #include <TAO/API/include/extract.h>
 #include <TAO/API/include/json.h>
@@ -23,6 +22,8 @@ ________________________________________________________________________________
 #include <TAO/API/include/format.h>
 #include <TAO/API/include/get.h>
 #include <TAO/API/types/exception.h>
+#include <TAO/API/types/page.h>
+#include <TAO/API/types/predicate.h>
 
 #include <TAO/Ledger/include/stake.h>
 
@@ -45,8 +46,14 @@ namespace TAO::API
         std::string strOrder = "desc", strColumn = "modified";
         ExtractList(jParams, strOrder, strColumn, nLimit, nOffset);
 
-        /* Build our object list and sort on insert. */
-        std::set<encoding::json, CompareResults> setRegisters({}, CompareResults(strOrder, strColumn));
+        /* Compile our where clause once for every register. */
+        const Predicate tWhere = Predicate(jParams);
+
+        /* Check if rows need their JSON to pick fields before they can be ranked. */
+        const bool fFieldname = CheckRequest(jParams, "fieldname", "string, array");
+
+        /* Keep only the registers that can land on our page. */
+        ListPage<RegisterRow> tPage(strOrder, nOffset, nLimit);
 
         /* Loop through our types. */
         for(const auto& strType : setTypes)
@@ -73,20 +80,45 @@ namespace TAO::API
                         if(!CheckStandard(jParams, rObject.second))
                             continue;
 
-                        /* Populate the response */
-                        encoding::json jRegister =
-                            StandardToJSON(jParams, rObject.second, rObject.first);
-
-                        /* Check that we match our filters. */
-                        if(!FilterResults(jParams, jRegister))
+                        /* Check the clauses that can be answered by the object itself. */
+                        const uint8_t nMatch = tWhere.Evaluate(rObject.second);
+                        if(nMatch == Predicate::FAIL)
                             continue;
 
-                        /* Filter out our expected fieldnames if specified. */
-                        if(!FilterFieldname(jParams, jRegister))
+                        /* Skip registers that sort after a full page before doing any more work. */
+                        SortKey tKey;
+                        const bool fNative =
+                            (!fFieldname && SortKeyFromObject(rObject.second, strColumn, tKey));
+
+                        if(fNative && !tPage.Accept(tKey))
                             continue;
 
-                        /* Insert into set and automatically sort. */
-                        setRegisters.insert(jRegister);
+                        /* Build our JSON now if we need it to filter or sort by. */
+                        encoding::json jRegister;
+                        if(nMatch == Predicate::UNKNOWN || fFieldname || !fNative)
+                        {
+                            /* Populate the response */
+                            jRegister = StandardToJSON(jParams, rObject.second, rObject.first);
+
+                            /* Check the clauses that needed our JSON. */
+                            if(nMatch == Predicate::UNKNOWN && !tWhere.Evaluate(rObject.second, jRegister))
+                                continue;
+
+                            /* Filter out our expected fieldnames if specified. */
+                            if(!FilterFieldname(jParams, jRegister))
+                                continue;
+
+                            /* Rank by the JSON if the column isn't in the register header. */
+                            if(!fNative)
+                            {
+                                tKey = SortKeyFromJSON(jRegister, strColumn);
+                                if(!tPage.Accept(tKey))
+                                    continue;
+                            }
+                        }
+
+                        /* Insert into our page and automatically sort. */
+                        tPage.Insert(tKey, RegisterRow{rObject.first, rObject.second, jRegister});
                     }
                 }
             }
@@ -107,54 +139,72 @@ namespace TAO::API
                         if(!CheckStandard(jParams, rObject))
                             continue;
 
-                        /* Populate the response */
-                        encoding::json jRegister =
-                            StandardToJSON(jParams, rObject);
-
-                        /* Check that we match our filters. */
-                        if(!FilterResults(jParams, jRegister))
+                        /* Check the clauses that can be answered by the object itself. */
+                        const uint8_t nMatch = tWhere.Evaluate(rObject);
+                        if(nMatch == Predicate::FAIL)
                             continue;
 
-                        /* Filter out our expected fieldnames if specified. */
-                        if(!FilterFieldname(jParams, jRegister))
+                        /* Skip registers that sort after a full page before doing any more work. */
+                        SortKey tKey;
+                        const bool fNative =
+                            (!fFieldname && SortKeyFromObject(rObject, strColumn, tKey));
+
+                        if(fNative && !tPage.Accept(tKey))
                             continue;
 
-                        /* Insert into set and automatically sort. */
-                        setRegisters.insert(jRegister);
+                        /* Build our JSON now if we need it to filter or sort by. */
+                        encoding::json jRegister;
+                        if(nMatch == Predicate::UNKNOWN || fFieldname || !fNative)
+                        {
+                            /* Populate the response */
+                            jRegister = StandardToJSON(jParams, rObject);
+
+                            /* Check the clauses that needed our JSON. */
+                            if(nMatch == Predicate::UNKNOWN && !tWhere.Evaluate(rObject, jRegister))
+                                continue;
+
+                            /* Filter out our expected fieldnames if specified. */
+                            if(!FilterFieldname(jParams, jRegister))
+                                continue;
+
+                            /* Rank by the JSON if the column isn't in the register header. */
+                            if(!fNative)
+                            {
+                                tKey = SortKeyFromJSON(jRegister, strColumn);
+                                if(!tPage.Accept(tKey))
+                                    continue;
+                            }
+                        }
+
+                        /* Insert into our page and automatically sort. */
+                        tPage.Insert(tKey, RegisterRow{uint256_t(0), rObject, jRegister});
                     }
                 }
             }
         }
 
         /* Check that we have results. */
-        if(setRegisters.empty())
+        if(tPage.Total() == 0)
             throw Exception(-74, "No registers found");
 
         /* Check that our offset is in range. */
-        if(nOffset > setRegisters.size())
-            throw Exception(-75, "Value [offset=", nOffset, "] exceeds dataset size [", setRegisters.size(), "]");
+        if(nOffset > tPage.Total())
+            throw Exception(-75, "Value [offset=", nOffset, "] exceeds dataset size [", tPage.Total(), "]");
 
         /* Build our return value. */
         encoding::json jRet = encoding::json::array();
-
-        /* Handle paging and offsets. */
-        uint32_t nTotal = 0;
-        for(const auto& jRegister : setRegisters)
+        for(auto& tRow : tPage.Page())
         {
-            /* Check the offset. */
-            if(++nTotal <= nOffset)
-                continue;
-
-            /* Check the limit */
-            if(jRet.size() == nLimit)
-                break;
+            /* Encode the registers that were ranked without their JSON. */
+            if(tRow.jRegister.is_null())
+                tRow.jRegister = StandardToJSON(jParams, tRow.tObject, tRow.hashRegister);
 
-            jRet.push_back(jRegister);
+            jRet.push_back(tRow.jRegister);
         }
 
         /* Check for over paging. */
         if(jRet.empty())
-            throw Exception(-75, "Value [offset=", nOffset, "] + [limit=", nLimit, "] exceeds dataset size [", setRegisters.size(), "]");
+            throw Exception(-75, "Value [offset=", nOffset, "] + [limit=", nLimit, "] exceeds dataset size [", tPage.Total(), "]");
 
         return jRet;
     }
@@ -55,6 +55,9 @@ namespace TAO::API
         if(!validate_session(tSession, strPIN))
             throw Exception(-139, "Invalid credentials for ", tSession.Genesis().ToString());
 
+        /* Derive the rest of the keys of our crypto register in parallel, only once the credentials are known to be good. */
+        tSession.Credentials()->Prepare({ "network", "sign" }, 0, strPIN);
+
         /* Check if already logged in. */
         uint256_t hashSession = Authentication::SESSION::DEFAULT; //we fallback to this in single user mode.
         if(Authentication::Active(tSession.Genesis(), hashSession))
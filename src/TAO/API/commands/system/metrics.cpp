@@ -13,14 +13,19 @@ ________________________________________________________________________________
 
 #include <LLD/include/global.h>
 
+#include <LLP/include/global.h>
+
 #include <TAO/Ledger/include/constants.h>
 #include <TAO/Ledger/include/chainstate.h>
 #include <TAO/Ledger/include/difficulty.h>
 #include <TAO/Ledger/include/retarget.h>
 #include <TAO/Ledger/include/supply.h>
 
-#include <TAO/Register/types/object.h>
+#include <TAO/Ledger/types/metrics.h>
+
+#include <TAO/Register/types/address.h>
 
+#include <TAO/API/types/cache.h>
 #include <TAO/API/types/commands/system.h>
 #include <TAO/API/include/format.h>
 
@@ -37,267 +42,41 @@ namespace TAO
             /* Build json response. */
             encoding::json jRet;
 
-            /* Keep track of global stats. */
-            uint64_t nTotalStake = 0;
-            uint64_t nTotalTrust = 0;
-            uint64_t nTotalTrustKeys  = 0;
-
-            uint64_t nTotalNames = 0;
-            uint64_t nTotalGlobalNames = 0;
-            uint64_t nTotalNamespacedNames = 0;
-            uint64_t nTotalNamespaces = count_registers("namespace");
-            uint64_t nTotalAccounts   = count_registers("account");
-            uint64_t nTotalTokens     = count_registers("token");
-
-            uint64_t nTotalAppend     = count_registers("append");
-            uint64_t nTotalRaw        = count_registers("raw");
-            uint64_t nTotalReadOnly   = count_registers("readonly");
-
-            /* Calculate count of all registers */
-            uint64_t nTotalRegisters = nTotalNamespaces + nTotalAccounts + nTotalTokens + nTotalAppend + nTotalRaw + nTotalReadOnly;
-
-            /* For list of items we are building. */
-            uint64_t nTotalCrypto = 0;
-            uint64_t nTotalObjects = 0;
-            uint64_t nTotalTokenized = 0;
-
-            /* Special handle if address indexed. */
-            if(config::fIndexAddress.load())
-            {
-                /* Batch read all trust keys. */
-                std::vector<std::pair<uint256_t, TAO::Register::Object>> vTrust;
-                if(LLD::Register->BatchRead("trust_address", vTrust, -1))
-                {
-                    /* Check through all trust accounts. */
-                    for(auto& object : vTrust)
-                    {
-                        /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                        if(!object.second.Parse())
-                            continue;
-
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* Check stake value over 0. */
-                        if(object.second.get<uint64_t>("stake") == 0)
-                            continue;
-
-                        /* Update stake amount. */
-                        nTotalStake += object.second.get<uint64_t>("stake");
-                        nTotalTrust += object.second.get<uint64_t>("trust");
-                        nTotalTrustKeys++;
-                    }
-                }
-            }
-            else
-            {
-                /* Batch read all trust keys. */
-                std::vector<TAO::Register::Object> vTrust;
-                if(LLD::Register->BatchRead("trust", vTrust, -1))
-                {
-                    /* Check through all trust accounts. */
-                    for(auto& object : vTrust)
-                    {
-                        /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                        if(!object.Parse())
-                            continue;
-
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* Check stake value over 0. */
-                        if(object.get<uint64_t>("stake") == 0)
-                            continue;
-
-                        /* Update stake amount. */
-                        nTotalStake += object.get<uint64_t>("stake");
-                        nTotalTrust += object.get<uint64_t>("trust");
-                        nTotalTrustKeys++;
-                    }
-                }
-            }
-
-
-
-            /* Special handle if address indexed. */
-            if(config::fIndexAddress.load())
-            {
-                /* Batch read all names. */
-                std::vector<std::pair<uint256_t, TAO::Register::Object>> vNames;
-                if(LLD::Register->BatchRead("name_address", vNames, -1))
-                {
-                    /* Check through all names. */
-                    for(auto& object : vNames)
-                    {
-                        /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                        if(!object.second.Parse())
-                            continue;
-
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* global */
-                        if(object.second.get<std::string>("namespace") == TAO::Register::NAMESPACE::GLOBAL)
-                            nTotalGlobalNames++;
-
-                        /* namespaced */
-                        else if(object.second.get<std::string>("namespace") != "")
-                            nTotalNamespacedNames ++;
-
-                        /* Update count*/
-                        nTotalNames++;
-                    }
-                }
-            }
-            else
-            {
-                /* Batch read all names. */
-                std::vector<TAO::Register::Object> vNames;
-                if(LLD::Register->BatchRead("name", vNames, -1))
-                {
-                    /* Check through all names. */
-                    for(auto& object : vNames)
-                    {
-                        /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                        if(!object.Parse())
-                            continue;
-
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* global */
-                        if(object.get<std::string>("namespace") == TAO::Register::NAMESPACE::GLOBAL)
-                            nTotalGlobalNames++;
-
-                        /* namespaced */
-                        else if(object.get<std::string>("namespace") != "")
-                            nTotalNamespacedNames ++;
-
-                        /* Update count*/
-                        nTotalNames++;
-                    }
-                }
-            }
-
-
-
-            /* Special handle if address indexed. */
-            if(config::fIndexAddress.load())
-            {
-                /* Batch read all object registers. */
-                std::vector<std::pair<uint256_t, TAO::Register::Object>> vObjects;
-                if(LLD::Register->BatchRead("object_address", vObjects, -1))
-                {
-                    /* Check through all names. */
-                    for(auto& object : vObjects)
-                    {
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* Check if tokenized*/
-                        if(TAO::Register::Address(object.second.hashOwner).IsToken())
-                            nTotalTokenized++;
-
-                        /* Update count*/
-                        nTotalObjects++;
-                    }
-                }
-            }
-            else
-            {
-                /* Batch read all object registers. */
-                std::vector<TAO::Register::Object> vObjects;
-                if(LLD::Register->BatchRead("object", vObjects, -1))
-                {
-                    /* Check through all names. */
-                    for(auto& object : vObjects)
-                    {
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* Check if tokenized*/
-                        if(TAO::Register::Address(object.hashOwner).IsToken())
-                            nTotalTokenized++;
-
-                        /* Update count*/
-                        nTotalObjects++;
-                    }
-                }
-            }
-
-            /* Check by unique owners. */
-            std::set<uint256_t> setOwners;
-
-            /* Special handle if address indexed. */
-            if(config::fIndexAddress.load())
-            {
-                /* Batch read all object registers. */
-                std::vector<std::pair<uint256_t, TAO::Register::Object>> vCrypto;
-                if(LLD::Register->BatchRead("crypto_address", vCrypto, -1))
-                {
-                    /* Check through all names. */
-                    for(auto& rObject : vCrypto)
-                    {
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* Use a set to get unique owners. */
-                        setOwners.insert(rObject.second.hashOwner);
-                        ++nTotalCrypto;
-                    }
-
-                }
-            }
-            else
-            {
-                /* Batch read all object registers. */
-                std::vector<TAO::Register::Object> vCrypto;
-                if(LLD::Register->BatchRead("crypto", vCrypto, -1))
-                {
-                    /* Check through all names. */
-                    for(auto& rObject : vCrypto)
-                    {
-                        /* Increment total register. */
-                        ++nTotalRegisters;
-
-                        /* Use a set to get unique owners. */
-                        setOwners.insert(rObject.hashOwner);
-                        ++nTotalCrypto;
-                    }
-                }
-            }
-
+            /* Get our running metrics, counting them from the register database if they aren't kept, such as in client mode. */
+            TAO::Ledger::Metrics tMetrics;
+            if(!TAO::Ledger::aggregator.Get(tMetrics))
+                tMetrics.Scan();
 
             /* Add register metrics */
             const encoding::json jRegisters =
             {
-                { "total", nTotalRegisters },
+                { "total", tMetrics.Registers() },
                 { "names",
                     {
-                        { "global",    nTotalGlobalNames      },
-                        { "local",     nTotalNames            },
-                        { "namespaced", nTotalNamespacedNames }
+                        { "global",     tMetrics.nGlobalNames                                     },
+                        { "local",      tMetrics.Registers(TAO::Register::Address::NAME)          },
+                        { "namespaced", tMetrics.nNamespacedNames                                 }
                     }
                 },
 
-                { "namespaces", nTotalNamespaces },
+                { "namespaces", tMetrics.Registers(TAO::Register::Address::NAMESPACE) },
 
                 /* Track our total objects. */
                 { "objects",
                     {
-                        { "accounts",  nTotalAccounts  },
-                        { "assets",    nTotalObjects   },
-                        { "crypto",    nTotalCrypto    },
-                        { "tokenized", nTotalTokenized },
-                        { "tokens",    nTotalTokens    }
+                        { "accounts",  tMetrics.Registers(TAO::Register::Address::ACCOUNT) },
+                        { "assets",    tMetrics.Registers(TAO::Register::Address::OBJECT)  },
+                        { "crypto",    tMetrics.Registers(TAO::Register::Address::CRYPTO)  },
+                        { "tokenized", tMetrics.nTokenized                                 },
+                        { "tokens",    tMetrics.Registers(TAO::Register::Address::TOKEN)   }
                     }
                 },
 
                 /* Track our state registers. */
                 { "state",
                     {
-                        { "raw", nTotalRaw           },
-                        { "readonly", nTotalReadOnly }
+                        { "raw",      tMetrics.Registers(TAO::Register::Address::RAW)      },
+                        { "readonly", tMetrics.Registers(TAO::Register::Address::READONLY) }
                     }
                 }
             };
@@ -305,17 +84,39 @@ namespace TAO
             /* Add to the array key now. */
             jRet["registers"] = jRegisters;
 
-            /* Add sig chain metrics */
-            jRet["sigchains"] = setOwners.size();
+            /* Add sig chain metrics, each of which has one crypto register. */
+            jRet["sigchains"] = tMetrics.Registers(TAO::Register::Address::CRYPTO);
+
+            /* Add block cache metrics for blocks served to syncing peers. */
+            if(LLP::BLOCK_CACHE)
+            {
+                const uint64_t nHits   = LLP::BLOCK_CACHE->Hits();
+                const uint64_t nMisses = LLP::BLOCK_CACHE->Misses();
+
+                const encoding::json jCache =
+                {
+                    { "blocks",  LLP::BLOCK_CACHE->Size()        },
+                    { "bytes",   LLP::BLOCK_CACHE->Bytes()       },
+                    { "hits",    nHits                           },
+                    { "misses",  nMisses                         },
+                    { "hitrate", (nHits + nMisses) > 0 ? double(nHits) / (nHits + nMisses) : 0.0 },
+                    { "served",  LLP::BLOCK_CACHE->BytesServed() }
+                };
+
+                jRet["blockcache"] = jCache;
+            }
+
+            /* Add API result cache metrics for polling sessions. */
+            jRet["apicache"] = ResultCache::Metrics();
 
             /* We only need supply data when on a public network or testnet, private and hybrid do not have supply. */
             if(!config::fHybrid.load())
             {
                 /* Add trust metrics */
                 encoding::json jTrust;
-                jTrust["total"]  = nTotalTrustKeys;
-                jTrust["stake"]  = FormatBalance(nTotalStake);
-                jTrust["trust"]  = nTotalTrust;
+                jTrust["total"]  = tMetrics.nStakers;
+                jTrust["stake"]  = FormatBalance(tMetrics.nStake);
+                jTrust["trust"]  = tMetrics.nTrust;
 
                 jRet["trust"] = jTrust;
 
@@ -347,25 +148,5 @@ namespace TAO
             return jRet;
         }
 
-
-        /* Returns the count of registers of the given type in the register DB */
-        uint64_t System::count_registers(const std::string& strType)
-        {
-            /* Special handle if address indexed. */
-            if(config::fIndexAddress.load())
-            {
-                /* Batch read up to 1000 at a time */
-                std::vector<std::pair<uint256_t, TAO::Register::Object>> vRegisters;
-                LLD::Register->BatchRead(strType + "_address", vRegisters, -1);
-
-                return vRegisters.size();
-            }
-
-            /* Batch read all registers . */
-            std::vector<TAO::Register::Object> vRegisters;
-            LLD::Register->BatchRead(strType, vRegisters, -1);
-
-            return vRegisters.size();
-        }
     }
 }
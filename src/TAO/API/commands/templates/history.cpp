@@ -23,15 +23,121 @@ ________________________________________________________________________________
 #include <TAO/API/include/execute.h>
 #include <TAO/API/include/filter.h>
 #include <TAO/API/include/json.h>
+
+#include <TAO/API/types/history.h>
+#include <TAO/API/types/predicate.h>
 #include <TAO/API/types/transaction.h>
 
 #include <TAO/Operation/include/enum.h>
 
 #include <TAO/Register/include/unpack.h>
 
+#include <Util/include/args.h>
+
 /* Global TAO namespace. */
 namespace TAO::API
 {
+    /* Build the JSON of a register after a contract, with the action the contract took on it. */
+    static encoding::json history_json(const TAO::Operation::Contract& rContract, const uint256_t& hashContract)
+    {
+        /* Now let's grab our OP so we can generate some JSON. */
+        const uint8_t nPrimitive = rContract.Primitive();
+
+        /* Grab our register's pre-state. */
+        TAO::Register::Object tObject =
+            ExecuteContract(rContract);
+
+        /* Check if object needs to be parsed. */
+        if(tObject.nType == TAO::Register::REGISTER::OBJECT)
+            tObject.Parse();
+
+        /* Let's start building our json object. */
+        encoding::json jRegister =
+            RegisterToJSON(tObject, hashContract);
+
+        /* Now let's add some meta-data for given operation. */
+        switch(nPrimitive)
+        {
+            /* Handle for CREATE modifier type. */
+            case TAO::Operation::OP::CREATE:
+            {
+                jRegister["action"] = "CREATE";
+                break;
+            }
+
+            /* Handle for MODIFY modifier type. */
+            case TAO::Operation::OP::WRITE:
+            case TAO::Operation::OP::APPEND:
+            {
+                jRegister["action"] = "MODIFY";
+                break;
+            }
+
+            /* Handle for FEES modifier type. */
+            case TAO::Operation::OP::FEE:
+            {
+                jRegister["action"] = "FEE";
+                break;
+            }
+
+            /* Handle for TRANSFER modifier type. */
+            case TAO::Operation::OP::TRANSFER:
+            {
+                /* Seek to the beginning. */
+                rContract.SeekToPrimitive();
+                rContract.Seek(65); //seek to our transfer flag
+
+                /* Get our type byte. */
+                uint8_t nType;
+                rContract >> nType;
+
+                /* Check if this is for tokenized asset. */
+                if(nType == TAO::Operation::TRANSFER::FORCE)
+                {
+                    jRegister["action"] = "TOKENIZE";
+                    break;
+                }
+
+                jRegister["action"] = "TRANSFER";
+                break;
+            }
+
+            /* Handle for CLAIM modifier type. */
+            case TAO::Operation::OP::CLAIM:
+            {
+                jRegister["action"] = "CLAIM";
+                break;
+            }
+
+            /* Handle for DEBIT modifier type. */
+            case TAO::Operation::OP::DEBIT:
+            case TAO::Operation::OP::LEGACY:
+            {
+                jRegister["action"] = "DEBIT";
+                break;
+            }
+
+            /* Handle for CREDIT modifier type. */
+            case TAO::Operation::OP::CREDIT:
+            {
+                jRegister["action"] = "CREDIT";
+                break;
+            }
+
+            /* Handle for TRUST modifier type. */
+            case TAO::Operation::OP::GENESIS:
+            case TAO::Operation::OP::TRUST:
+            case TAO::Operation::OP::MIGRATE:
+            {
+                jRegister["action"] = "TRUST";
+                break;
+            }
+        }
+
+        return jRegister;
+    }
+
+
     /* Lists all transactions for a given register. */
     encoding::json Templates::History(const encoding::json& jParams, const bool fHelp)
     {
@@ -56,6 +162,111 @@ namespace TAO::API
         /* Get the params to apply to the response. */
         ExtractList(jParams, strOrder, strColumn, nLimit, nOffset);
 
+        /* Page straight off our history index when sorting by time, since that is the order it was indexed in. */
+        if(strColumn == "modified" && LLD::Logical->HasHistory(hashRegister))
+        {
+            /* Build our return value. */
+            encoding::json jRet = encoding::json::array();
+            if(nLimit == 0)
+                return jRet;
+
+            /* Get our number of entries and the last one for our total contracts. */
+            uint32_t nCount = 0;
+            if(!LLD::Logical->CountTransactions(hashRegister, nCount))
+                return jRet;
+
+            uint32_t nSequence = nCount - 1;
+
+            HistoryEntry tEntry;
+            if(!LLD::Logical->ReadHistory(hashRegister, nSequence, tEntry))
+                throw Exception(-108, "Failed to read history");
+
+            /* Track our direction and the rows we still have to skip. */
+            const bool fDesc = (strOrder == "desc");
+            uint32_t nSkip = nOffset, nFirst = 0;
+
+            /* Without filters every contract is a row, so we can seek straight to our offset. */
+            if(jParams.find("where") == jParams.end() && !CheckRequest(jParams, "fieldname", "string, array"))
+            {
+                /* Check our offset is in range. */
+                if(nOffset >= tEntry.nRows)
+                    return jRet;
+
+                /* Find the entry holding the first contract on our page, counting from the oldest. */
+                const uint32_t nRow = fDesc ? (tEntry.nRows - 1 - nOffset) : nOffset;
+                if(!LLD::Logical->SeekHistory(hashRegister, nRow, nSequence, tEntry))
+                    throw Exception(-108, "Failed to read history");
+
+                /* Get the position of our first contract inside the entry. */
+                nFirst = fDesc ? (tEntry.nRows - 1 - nRow) : (nRow + tEntry.vContracts.size() - tEntry.nRows);
+                nSkip  = 0;
+            }
+
+            /* Start from the oldest entry if ascending and seeking through filters. */
+            else if(!fDesc)
+            {
+                nSequence = 0;
+                if(!LLD::Logical->ReadHistory(hashRegister, nSequence, tEntry))
+                    throw Exception(-108, "Failed to read history");
+            }
+
+            /* Compile our where clause once for all our rows. */
+            const Predicate tWhere = Predicate(jParams);
+            while(!config::fShutdown.load())
+            {
+                /* Get the transaction from disk. */
+                TAO::API::Transaction tx;
+                if(!LLD::Logical->ReadTx(tEntry.hashTx, tx))
+                    throw Exception(-108, "Failed to read transaction");
+
+                /* Loop through the contracts on our register in our order. */
+                const uint32_t nContracts = tEntry.vContracts.size();
+                for(uint32_t nContract = nFirst; nContract < nContracts; ++nContract)
+                {
+                    /* Get the contract. */
+                    const auto& pairContract = tEntry.vContracts[fDesc ? (nContracts - 1 - nContract) : nContract];
+                    if(pairContract.first >= tx.Size())
+                        throw Exception(-108, "Failed to read transaction");
+
+                    /* Build our register's JSON after the contract. */
+                    encoding::json jRegister =
+                        history_json(tx[pairContract.first], hashRegister);
+
+                    /* Check that we match our filters. */
+                    if(!tWhere.Evaluate(jRegister))
+                        continue;
+
+                    /* Filter out our expected fieldnames if specified. */
+                    if(!FilterFieldname(jParams, jRegister))
+                        continue;
+
+                    /* Check the offset. */
+                    if(nSkip > 0)
+                    {
+                        --nSkip;
+                        continue;
+                    }
+
+                    /* Check the limit */
+                    jRet.push_back(jRegister);
+                    if(jRet.size() == nLimit)
+                        return jRet;
+                }
+
+                /* Move onto our next entry. */
+                if(fDesc ? (nSequence == 0) : (nSequence + 1 == nCount))
+                    break;
+
+                nSequence = fDesc ? (nSequence - 1) : (nSequence + 1);
+                if(!LLD::Logical->ReadHistory(hashRegister, nSequence, tEntry))
+                    throw Exception(-108, "Failed to read history");
+
+                nFirst = 0;
+            }
+
+            return jRet;
+        }
+
         /* Build our object list and sort on insert. */
         std::set<encoding::json, CompareResults> setHistory({}, CompareResults(strOrder, strColumn));
 
@@ -86,99 +297,9 @@ namespace TAO::API
                     if(hashRegister != hashContract)
                         continue;
 
-                    /* Now let's grab our OP so we can generate some JSON. */
-                    const uint8_t nPrimitive = rContract.Primitive();
-
-                    /* Grab our register's pre-state. */
-                    TAO::Register::Object tObject =
-                        ExecuteContract(rContract);
-
-                    /* Check if object needs to be parsed. */
-                    if(tObject.nType == TAO::Register::REGISTER::OBJECT)
-                        tObject.Parse();
-
-                    /* Let's start building our json object. */
+                    /* Build our register's JSON after the contract. */
                     encoding::json jRegister =
-                        RegisterToJSON(tObject, hashContract);
-
-                    /* Now let's add some meta-data for given operation. */
-                    switch(nPrimitive)
-                    {
-                        /* Handle for CREATE modifier type. */
-                        case TAO::Operation::OP::CREATE:
-                        {
-                            jRegister["action"] = "CREATE";
-                            break;
-                        }
-
-                        /* Handle for MODIFY modifier type. */
-                        case TAO::Operation::OP::WRITE:
-                        case TAO::Operation::OP::APPEND:
-                        {
-                            jRegister["action"] = "MODIFY";
-                            break;
-                        }
-
-                        /* Handle for FEES modifier type. */
-                        case TAO::Operation::OP::FEE:
-                        {
-                            jRegister["action"] = "FEE";
-                            break;
-                        }
-
-                        /* Handle for TRANSFER modifier type. */
-                        case TAO::Operation::OP::TRANSFER:
-                        {
-                            /* Seek to the beginning. */
-                            rContract.SeekToPrimitive();
-                            rContract.Seek(65); //seek to our transfer flag
-
-                            /* Get our type byte. */
-                            uint8_t nType;
-                            rContract >> nType;
-
-                            /* Check if this is for tokenized asset. */
-                            if(nType == TAO::Operation::TRANSFER::FORCE)
-                            {
-                                jRegister["action"] = "TOKENIZE";
-                                break;
-                            }
-
-                            jRegister["action"] = "TRANSFER";
-                            break;
-                        }
-
-                        /* Handle for CLAIM modifier type. */
-                        case TAO::Operation::OP::CLAIM:
-                        {
-                            jRegister["action"] = "CLAIM";
-                            break;
-                        }
-
-                        /* Handle for DEBIT modifier type. */
-                        case TAO::Operation::OP::DEBIT:
-                        case TAO::Operation::OP::LEGACY:
-                        {
-                            jRegister["action"] = "DEBIT";
-                            break;
-                        }
-
-                        /* Handle for CREDIT modifier type. */
-                        case TAO::Operation::OP::CREDIT:
-                        {
-                            jRegister["action"] = "CREDIT";
-                            break;
-                        }
-
-                        /* Handle for TRUST modifier type. */
-                        case TAO::Operation::OP::GENESIS:
-                        case TAO::Operation::OP::TRUST:
-                        case TAO::Operation::OP::MIGRATE:
-                        {
-                            jRegister["action"] = "TRUST";
-                            break;
-                        }
-                    }
+                        history_json(rContract, hashContract);
 
                     /* Check that we match our filters. */
                     if(!FilterResults(jParams, jRegister))
@@ -15,9 +15,10 @@ ________________________________________________________________________________
 
 #include <TAO/API/types/authentication.h>
 #include <TAO/API/types/commands/templates.h>
+#include <TAO/API/types/page.h>
+#include <TAO/API/types/predicate.h>
 
 #include <TAO/API/include/check.h>
-#include <TAO/API/include/compare.h>
 #include <TAO/API/include/extract.h>
 #include <TAO/API/include/filter.h>
 #include <TAO/API/include/get.h>
@@ -50,8 +51,14 @@ namespace TAO::API
         if(setAddresses.empty())
             throw Exception(-74, "No registers found");
 
-        /* Build our object list and sort on insert. */
-        std::set<encoding::json, CompareResults> setRegisters({}, CompareResults(strOrder, strColumn));
+        /* Compile our where clause once for every register. */
+        const Predicate tWhere = Predicate(jParams);
+
+        /* Check if rows need their JSON to pick fields before they can be ranked. */
+        const bool fFieldname = CheckRequest(jParams, "fieldname", "string, array");
+
+        /* Keep only the registers that can land on our page. */
+        ListPage<RegisterRow> tPage(strOrder, nOffset, nLimit);
 
         /* Add the register data to the response */
         for(const auto& hashRegister : setAddresses)
@@ -70,38 +77,56 @@ namespace TAO::API
             if(!CheckStandard(jParams, tObject))
                 continue;
 
-            /* Populate the response */
-            encoding::json jRegister =
-                StandardToJSON(jParams, tObject, hashRegister);
-
-            /* Check that we match our filters. */
-            if(!FilterResults(jParams, jRegister))
+            /* Check the clauses that can be answered by the object itself. */
+            const uint8_t nMatch = tWhere.Evaluate(tObject);
+            if(nMatch == Predicate::FAIL)
                 continue;
 
-            /* Filter out our expected fieldnames if specified. */
-            if(!FilterFieldname(jParams, jRegister))
+            /* Skip registers that sort after a full page before doing any more work. */
+            SortKey tKey;
+            const bool fNative =
+                (!fFieldname && SortKeyFromObject(tObject, strColumn, tKey));
+
+            if(fNative && !tPage.Accept(tKey))
                 continue;
 
-            /* Insert into set and automatically sort. */
-            setRegisters.insert(jRegister);
+            /* Build our JSON now if we need it to filter or sort by. */
+            encoding::json jRegister;
+            if(nMatch == Predicate::UNKNOWN || fFieldname || !fNative)
+            {
+                /* Populate the response */
+                jRegister = StandardToJSON(jParams, tObject, hashRegister);
+
+                /* Check the clauses that needed our JSON. */
+                if(nMatch == Predicate::UNKNOWN && !tWhere.Evaluate(tObject, jRegister))
+                    continue;
+
+                /* Filter out our expected fieldnames if specified. */
+                if(!FilterFieldname(jParams, jRegister))
+                    continue;
+
+                /* Rank by the JSON if the column isn't in the register header. */
+                if(!fNative)
+                {
+                    tKey = SortKeyFromJSON(jRegister, strColumn);
+                    if(!tPage.Accept(tKey))
+                        continue;
+                }
+            }
+
+            /* Insert into our page and automatically sort. */
+            tPage.Insert(tKey, RegisterRow{hashRegister, tObject, jRegister});
         }
 
         /* Build our return value. */
         encoding::json jRet = encoding::json::array();
-
-        /* Handle paging and offsets. */
-        uint32_t nTotal = 0;
-        for(const auto& jRegister : setRegisters)
+        for(auto& tRow : tPage.Page())
         {
-            /* Check the offset. */
-            if(++nTotal <= nOffset)
-                continue;
-
-            /* Check the limit */
-            if(jRet.size() == nLimit)
-                break;
+            /* Encode the registers that were ranked without their JSON. */
+            if(tRow.jRegister.is_null())
+                tRow.jRegister = StandardToJSON(jParams, tRow.tObject, tRow.hashRegister);
 
-            jRet.push_back(jRegister);
+            jRet.push_back(tRow.jRegister);
         }
 
         return jRet;
@@ -20,14 +20,97 @@ ________________________________________________________________________________
 #include <TAO/API/include/json.h>
 
 #include <TAO/API/types/exception.h>
+#include <TAO/API/types/history.h>
+#include <TAO/API/types/predicate.h>
 #include <TAO/API/types/commands/templates.h>
 #include <TAO/API/types/transaction.h>
 
 #include <TAO/Ledger/include/constants.h>
 
+#include <Util/include/args.h>
+
 /* Global TAO namespace. */
 namespace TAO::API
 {
+    /* Build the JSON of a transaction with only the contracts for given register, returning false if none are left. */
+    static bool transaction_json(const uint512_t& hashLast, const TAO::API::Transaction& tx,
+                                 const TAO::Register::Address& hashRegister, const uint32_t nVerbose, encoding::json &jTransaction)
+    {
+        /* Read the block state from the the ledger DB using the transaction hash index */
+        TAO::Ledger::BlockState blockState;
+        LLD::Ledger->ReadBlock(hashLast, blockState);
+
+        /* Get the transaction JSON. */
+        jTransaction =
+            TAO::API::TransactionToJSON(tx, blockState, nVerbose);
+
+        /* Check for missing contracts to adjust. */
+        if(jTransaction.find("contracts") == jTransaction.end())
+            return false;
+
+        /* Erase based on having available address. */
+        encoding::json& jContracts = jTransaction["contracts"];
+        jContracts.erase
+        (
+            /* Use custom lambda to sort out contracts that aren't for the address we are searching. */
+            std::remove_if
+            (
+                jContracts.begin(),
+                jContracts.end(),
+
+                /* Lambda function to remove based on address match. */
+                [&](const encoding::json& jValue)
+                {
+                    /* Check for missing value key. */
+                    if(jValue.find("address") != jValue.end())
+                    {
+                        /* Get our address field now. */
+                        const std::string strAddress =
+                            jValue["address"].get<std::string>();
+
+                        /* Check if we have valid address. */
+                        if(TAO::Register::Address(strAddress) == hashRegister)
+                            return false;
+                    }
+
+                    /* Check for from value key. */
+                    if(jValue.find("from") != jValue.end())
+                    {
+                        /* Get our address field now. */
+                        const std::string strAddress =
+                            jValue["from"]["address"].get<std::string>();
+
+                        /* Check if we have valid address. */
+                        if(TAO::Register::Address(strAddress) == hashRegister)
+                            return false;
+                    }
+
+                    /* Check for to value key. */
+                    if(jValue.find("to") != jValue.end())
+                    {
+                        /* Get our address field now. */
+                        const std::string strAddress =
+                            jValue["to"]["address"].get<std::string>();
+
+                        /* Check if we have valid address. */
+                        if(TAO::Register::Address(strAddress) == hashRegister)
+                            return false;
+                    }
+
+                    return true;
+                }
+            ),
+            jContracts.end()
+        );
+
+        /* Check to see whether the transaction has had all children filtered out */
+        if(jContracts.empty())
+            return false;
+
+        return true;
+    }
+
+
     /* Lists all transactions for a given register. */
     encoding::json Templates::Transactions(const encoding::json& jParams, const bool fHelp)
     {
@@ -55,6 +138,74 @@ namespace TAO::API
         /* Get the params to apply to the response. */
         ExtractList(jParams, strOrder, strColumn, nLimit, nOffset);
 
+        /* Page straight off our history index when sorting by time, since that is the order it was indexed in. */
+        if(strColumn == "timestamp" && LLD::Logical->HasHistory(hashRegister))
+        {
+            /* Build our return value. */
+            encoding::json jRet = encoding::json::array();
+            if(nLimit == 0)
+                return jRet;
+
+            /* Get our number of entries. */
+            uint32_t nCount = 0;
+            if(!LLD::Logical->CountTransactions(hashRegister, nCount))
+                return jRet;
+
+            /* Track our direction and the rows we still have to skip. */
+            const bool fDesc = (strOrder == "desc");
+            uint32_t nSkip = nOffset, nSequence = fDesc ? (nCount - 1) : 0;
+
+            /* Without filters every entry is a row, so we can seek straight to our offset. */
+            if(jParams.find("where") == jParams.end() && !CheckRequest(jParams, "fieldname", "string, array"))
+            {
+                /* Check our offset is in range. */
+                if(nOffset >= nCount)
+                    return jRet;
+
+                nSequence = fDesc ? (nSequence - nOffset) : nOffset;
+                nSkip     = 0;
+            }
+
+            /* Compile our where clause once for all our rows. */
+            const Predicate tWhere = Predicate(jParams);
+            while(!config::fShutdown.load())
+            {
+                /* Read our history entry. */
+                HistoryEntry tEntry;
+                if(!LLD::Logical->ReadHistory(hashRegister, nSequence, tEntry))
+                    throw Exception(-108, "Failed to read history");
+
+                /* Get the transaction from disk. */
+                TAO::API::Transaction tx;
+                if(!LLD::Logical->ReadTx(tEntry.hashTx, tx))
+                    throw Exception(-108, "Failed to read transaction");
+
+                /* Get the transaction JSON with only our register's contracts and check our filters. */
+                encoding::json jTransaction;
+                if(transaction_json(tEntry.hashTx, tx, hashRegister, nVerbose, jTransaction)
+                    && tWhere.Evaluate(jTransaction) && FilterFieldname(jParams, jTransaction))
+                {
+                    /* Check the offset and limit. */
+                    if(nSkip > 0)
+                        --nSkip;
+                    else
+                    {
+                        jRet.push_back(jTransaction);
+                        if(jRet.size() == nLimit)
+                            return jRet;
+                    }
+                }
+
+                /* Move onto our next entry. */
+                if(fDesc ? (nSequence == 0) : (nSequence + 1 == nCount))
+                    break;
+
+                nSequence = fDesc ? (nSequence - 1) : (nSequence + 1);
+            }
+
+            return jRet;
+        }
+
         /* Build our object list and sort on insert. */
         std::set<encoding::json, CompareResults> setTransactions({}, CompareResults(strOrder, strColumn));
 
@@ -70,75 +221,9 @@ namespace TAO::API
                 if(!LLD::Logical->ReadTx(hashLast, tx))
                     throw Exception(-108, "Failed to read transaction");
 
-                /* Read the block state from the the ledger DB using the transaction hash index */
-                TAO::Ledger::BlockState blockState;
-                LLD::Ledger->ReadBlock(hashLast, blockState);
-
-                /* Get the transaction JSON. */
-                encoding::json jTransaction =
-                    TAO::API::TransactionToJSON(tx, blockState, nVerbose);
-
-                /* Check for missing contracts to adjust. */
-                if(jTransaction.find("contracts") == jTransaction.end())
-                    continue;
-
-                /* Erase based on having available address. */
-                encoding::json& jContracts = jTransaction["contracts"];
-                jContracts.erase
-                (
-                    /* Use custom lambda to sort out contracts that aren't for the address we are searching. */
-                    std::remove_if
-                    (
-                        jContracts.begin(),
-                        jContracts.end(),
-
-                        /* Lambda function to remove based on address match. */
-                        [&](const encoding::json& jValue)
-                        {
-                            /* Check for missing value key. */
-                            if(jValue.find("address") != jValue.end())
-                            {
-                                /* Get our address field now. */
-                                const std::string strAddress =
-                                    jValue["address"].get<std::string>();
-
-                                /* Check if we have valid address. */
-                                if(TAO::Register::Address(strAddress) == hashRegister)
-                                    return false;
-                            }
-
-                            /* Check for from value key. */
-                            if(jValue.find("from") != jValue.end())
-                            {
-                                /* Get our address field now. */
-                                const std::string strAddress =
-                                    jValue["from"]["address"].get<std::string>();
-
-                                /* Check if we have valid address. */
-                                if(TAO::Register::Address(strAddress) == hashRegister)
-                                    return false;
-                            }
-
-                            /* Check for to value key. */
-                            if(jValue.find("to") != jValue.end())
-                            {
-                                /* Get our address field now. */
-                                const std::string strAddress =
-                                    jValue["to"]["address"].get<std::string>();
-
-                                /* Check if we have valid address. */
-                                if(TAO::Register::Address(strAddress) == hashRegister)
-                                    return false;
-                            }
-
-                            return true;
-                        }
-                    ),
-                    jContracts.end()
-                );
-
-                /* Check to see whether the transaction has had all children filtered out */
-                if(jContracts.empty())
+                /* Get the transaction JSON with only our register's contracts. */
+                encoding::json jTransaction;
+                if(!transaction_json(hashLast, tx, hashRegister, nVerbose, jTransaction))
                     continue;
 
                 /* Apply our where filters now. */
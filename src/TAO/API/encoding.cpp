@@ -0,0 +1,132 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/include/encoding.h>
+#include <TAO/API/types/exception.h>
+
+#include <Util/include/string.h>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /* Get the encoding of a given content-type header, ignoring any parameters such as charset. */
+    bool ContentEncoding(const std::string& strType, uint8_t &nEncoding)
+    {
+        /* Strip our parameters and whitespace. */
+        const std::string strMedia =
+            ToLower(trim(strType.substr(0, strType.find(';'))));
+
+        /* Check our supported types. */
+        if(strMedia == "application/json")
+        {
+            nEncoding = ENCODING::JSON;
+            return true;
+        }
+
+        if(strMedia == "application/cbor")
+        {
+            nEncoding = ENCODING::CBOR;
+            return true;
+        }
+
+        if(strMedia == "application/msgpack" || strMedia == "application/x-msgpack")
+        {
+            nEncoding = ENCODING::MSGPACK;
+            return true;
+        }
+
+        return false;
+    }
+
+
+    /* Get the first supported encoding from an accept header, in the order the client listed them. */
+    uint8_t AcceptEncoding(const std::string& strAccept, const uint8_t nDefault)
+    {
+        /* Split our accepted types by delimiter. */
+        std::vector<std::string> vTypes;
+        ParseString(strAccept, ',', vTypes);
+
+        /* Return the first one we support. */
+        for(const auto& strType : vTypes)
+        {
+            uint8_t nEncoding = nDefault;
+            if(ContentEncoding(strType, nEncoding))
+                return nEncoding;
+        }
+
+        return nDefault;
+    }
+
+
+    /* Get the content-type header for a given encoding. */
+    std::string ContentType(const uint8_t nEncoding)
+    {
+        switch(nEncoding)
+        {
+            case ENCODING::CBOR:
+                return "application/cbor";
+
+            case ENCODING::MSGPACK:
+                return "application/msgpack";
+        }
+
+        return "application/json";
+    }
+
+
+    /* Decode request content from a given encoding, throwing an API exception if it is malformed. */
+    encoding::json DecodeContent(const std::string& strContent, const uint8_t nEncoding)
+    {
+        /* Plain JSON keeps the parser's own exceptions, as it always has. */
+        if(nEncoding == ENCODING::JSON)
+            return encoding::json::parse(strContent);
+
+        try
+        {
+            /* Decode our binary encodings. */
+            if(nEncoding == ENCODING::CBOR)
+                return encoding::json::from_cbor(strContent);
+
+            if(nEncoding == ENCODING::MSGPACK)
+                return encoding::json::from_msgpack(strContent);
+        }
+        catch(const encoding::detail::exception& e)
+        {
+            throw Exception(-5, "content-type [", ContentType(nEncoding), "] malformed: ", e.what());
+        }
+
+        throw Exception(-5, "content encoding [", uint32_t(nEncoding), "] not supported");
+    }
+
+
+    /* Encode response content in a given encoding, writing straight into the content without an intermediate buffer. */
+    void EncodeContent(const encoding::json& jContent, const uint8_t nEncoding, std::string &strContent)
+    {
+        switch(nEncoding)
+        {
+            case ENCODING::CBOR:
+            {
+                encoding::json::to_cbor(jContent, strContent);
+                return;
+            }
+
+            case ENCODING::MSGPACK:
+            {
+                encoding::json::to_msgpack(jContent, strContent);
+                return;
+            }
+        }
+
+        strContent = jContent.dump();
+    }
+}
@@ -12,9 +12,9 @@
 ____________________________________________________________________________________________*/
 
 #include <TAO/API/include/check.h>
-#include <TAO/API/include/evaluate.h>
 #include <TAO/API/include/filter.h>
 #include <TAO/API/types/exception.h>
+#include <TAO/API/types/predicate.h>
 
 #include <TAO/Register/types/object.h>
 
@@ -22,124 +22,6 @@ ________________________________________________________________________________
 
 namespace TAO::API
 {
-    /* Recursive handle for any type of filter by passing in function and type to filter. */
-    template<typename ObjectType>
-    bool FilterStatement(const encoding::json& jStatement, ObjectType& rCheck,
-                         const std::function<bool (const encoding::json&, ObjectType&)>& rFunc)
-    {
-        /* Check for final depth and call our object filter there. */
-        if(jStatement.find("statement") == jStatement.end())
-            return rFunc(jStatement, rCheck); //execute evaluation function when reached final level of recursion
-
-        /* Check for logical operator. */
-        std::string strLogical = "NONE";
-        if(jStatement.find("logical") != jStatement.end())
-            strLogical = jStatement["logical"].get<std::string>();
-
-        /* Check if we need to recurse another level. */
-        if(jStatement.find("statement") != jStatement.end())
-        {
-            /* Loop through our statements recursively. */
-            bool fResult = true;
-            for(uint32_t n = 0; n < jStatement["statement"].size(); ++n)
-            {
-                /* Grab a reference of our clause. */
-                const encoding::json& jClause = jStatement["statement"][n];
-
-                /* If first iteration, set the result by evalute. */
-                if(n == 0)
-                {
-                    fResult = FilterStatement(jClause, rCheck, rFunc);
-                    continue;
-                }
-
-                /* Handle for an AND operator. */
-                if(strLogical == "AND")
-                {
-                    fResult = fResult && FilterStatement(jClause, rCheck, rFunc);
-                    continue;
-                }
-
-                /* Handle for an OR operator. */
-                if(strLogical == "OR")
-                {
-                    fResult = fResult || FilterStatement(jClause, rCheck, rFunc);
-                    continue;
-                }
-            }
-
-            return fResult; //this is where a good request will exit the recursion
-        }
-
-        /* If we reach here, the generated JSON was malformed in some way. */
-        throw Exception(-60, "Query Syntax Error, malformed where clause at ", jStatement.dump(4));
-    }
-
-
-    /* Recursive handle for any type of filter by passing in function and type to filter. */
-    template<typename ObjectType>
-    bool FilterStatement(const encoding::json& jStatement, encoding::json &jCheck, ObjectType& rCheck,
-                         const std::function<bool (const encoding::json&, ObjectType&)>& xEvaluate)
-    {
-        /* Check for final depth and call our object filter there. */
-        if(jStatement.find("statement") == jStatement.end())
-        {
-            /* Check for missing class. */
-            if(jStatement.find("class") == jStatement.end())
-                throw Exception(-60, "Query Syntax Error, malformed where clause at ", jStatement.dump(4));
-
-            /* Check that we are operating on a json object and use that function. */
-            if(jStatement["class"].get<std::string>() == "results")
-                return EvaluateResults(jStatement, jCheck);
-
-            return xEvaluate(jStatement, rCheck); //execute evaluation function when reached final level of recursion
-        }
-
-        /* Check for logical operator. */
-        std::string strLogical = "NONE";
-        if(jStatement.find("logical") != jStatement.end())
-            strLogical = jStatement["logical"].get<std::string>();
-
-        /* Check if we need to recurse another level. */
-        if(jStatement.find("statement") != jStatement.end())
-        {
-            /* Loop through our statements recursively. */
-            bool fResult = true;
-            for(uint32_t n = 0; n < jStatement["statement"].size(); ++n)
-            {
-                /* Grab a reference of our clause. */
-                const encoding::json& jClause = jStatement["statement"][n];
-
-                /* If first iteration, set the result by evalute. */
-                if(n == 0)
-                {
-                    fResult = FilterStatement(jClause, jCheck, rCheck, xEvaluate);
-                    continue;
-                }
-
-                /* Handle for an AND operator. */
-                if(strLogical == "AND")
-                {
-                    fResult = fResult && FilterStatement(jClause, jCheck, rCheck, xEvaluate);
-                    continue;
-                }
-
-                /* Handle for an OR operator. */
-                if(strLogical == "OR")
-                {
-                    fResult = fResult || FilterStatement(jClause, jCheck, rCheck, xEvaluate);
-                    continue;
-                }
-            }
-
-            return fResult; //this is where a good request will exit the recursion
-        }
-
-        /* If we reach here, the generated JSON was malformed in some way. */
-        throw Exception(-60, "Query Syntax Error, malformed where clause at ", jStatement.dump(4));
-    }
-
-
     /* Helper filter, to handle recursion up and down levels of json. This handles only single entries at a time. */
     bool FilterFieldname(const std::string& strField, const encoding::json& jResponse, encoding::json &jFiltered)
     {
@@ -267,7 +149,7 @@ namespace TAO::API
         if(jParams.find("where") == jParams.end())
             return true; //no filters
 
-        return FilterStatement<TAO::Register::Object>(jParams["where"], rObject, EvaluateObject);
+        return Predicate(jParams).EvaluateObject(rObject);
     }
 
 
@@ -278,6 +160,6 @@ namespace TAO::API
         if(jParams.find("where") == jParams.end())
             return true; //no filters
 
-        return FilterStatement<encoding::json>(jParams["where"], jCheck, EvaluateResults);
+        return Predicate(jParams).Evaluate(jCheck);
     }
 }
@@ -0,0 +1,100 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <Util/include/json.h>
+
+#include <string>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /** ENCODING
+     *
+     *  The encodings our API can read requests from and write responses in.
+     *
+     **/
+    struct ENCODING
+    {
+        enum : uint8_t
+        {
+            JSON     = 0x00,
+            CBOR     = 0x01,
+            MSGPACK  = 0x02,
+        };
+    };
+
+
+    /** ContentEncoding
+     *
+     *  Get the encoding of a given content-type header, ignoring any parameters such as charset.
+     *
+     *  @param[in] strType The content-type to check.
+     *  @param[out] nEncoding The encoding of the given content-type.
+     *
+     *  @return true if the content-type has a supported encoding.
+     *
+     **/
+    bool ContentEncoding(const std::string& strType, uint8_t &nEncoding);
+
+
+    /** AcceptEncoding
+     *
+     *  Get the first supported encoding from an accept header, in the order the client listed them.
+     *
+     *  @param[in] strAccept The accept header to check.
+     *  @param[in] nDefault The encoding to use if none are supported.
+     *
+     *  @return The encoding to respond with.
+     *
+     **/
+    uint8_t AcceptEncoding(const std::string& strAccept, const uint8_t nDefault);
+
+
+    /** ContentType
+     *
+     *  Get the content-type header for a given encoding.
+     *
+     *  @param[in] nEncoding The encoding to get the type for.
+     *
+     *  @return The content-type string.
+     *
+     **/
+    std::string ContentType(const uint8_t nEncoding);
+
+
+    /** DecodeContent
+     *
+     *  Decode request content from a given encoding, throwing an API exception if it is malformed.
+     *
+     *  @param[in] strContent The raw bytes of the content.
+     *  @param[in] nEncoding The encoding of the content.
+     *
+     *  @return The decoded json parameters.
+     *
+     **/
+    encoding::json DecodeContent(const std::string& strContent, const uint8_t nEncoding);
+
+
+    /** EncodeContent
+     *
+     *  Encode response content in a given encoding, writing straight into the content without an intermediate buffer.
+     *
+     *  @param[in] jContent The json to encode.
+     *  @param[in] nEncoding The encoding to write.
+     *  @param[out] strContent The content to write into.
+     *
+     **/
+    void EncodeContent(const encoding::json& jContent, const uint8_t nEncoding, std::string &strContent);
+}
@@ -15,8 +15,6 @@ ________________________________________________________________________________
 
 #include <Util/include/json.h>
 
-namespace TAO::Register { class Object; }
-
 namespace TAO::API
 {
     /** Evaluate Wildcard
@@ -31,30 +29,4 @@ namespace TAO::API
      **/
     bool EvaluateWildcard(const std::string& strWildcard, const std::string& strValue);
 
-
-    /** EvaluateResults
-     *
-     *  Determines if an results JSON object should be included in a list based on given clause.
-     *
-     *  @param[in] jClause The clause to check filter for.
-     *  @param[out] jCheck The JSON object we are checking for.
-     *
-     *  @return true if the object should be included in the results.
-     *
-     **/
-    bool EvaluateResults(const encoding::json& jClause, encoding::json &jCheck);
-
-
-    /** EvaluateObject
-     *
-     *  Determines if an object should be included in a list based on given clause.
-     *
-     *  @param[in] jClause The clause to check filter for.
-     *  @param[out] rObject The object we are checking for.
-     *
-     *  @return true if the object should be included in the results.
-     *
-     **/
-    bool EvaluateObject(const encoding::json& jClause, TAO::Register::Object &rObject);
-
 }
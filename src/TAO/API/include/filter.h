@@ -19,40 +19,6 @@ namespace TAO::Register { class Object; }
 
 namespace TAO::API
 {
-    /** FilterStatement
-     *
-     *  Recursive handle for any type of filter by passing in function and type to filter.
-     *  Can process any depth of logical recursion required.
-     *
-     *  @param[in] jStatement The statement to filter by, in JSON encoding.
-     *  @param[in] rCheck The object that we are checking on.
-     *  @param[in] rFunct The function that executes the final clause filter.
-     *
-     *  @return true if the object passes filter checks, false if it shouldn't be included.
-     *
-     **/
-    template<typename ObjectType>
-    bool FilterStatement(const encoding::json& jStatement, ObjectType& rCheck,
-                         const std::function<bool (const encoding::json&, ObjectType&)>& rFunct);
-
-
-    /** FilterStatement
-     *
-     *  Recursive handle for any type of filter by passing in function and type to filter.
-     *  Can process any depth of logical recursion required.
-     *
-     *  @param[in] jStatement The statement to filter by, in JSON encoding.
-     *  @param[in] rCheck The object that we are checking on.
-     *  @param[in] rFunct The function that executes the final clause filter.
-     *
-     *  @return true if the object passes filter checks, false if it shouldn't be included.
-     *
-     **/
-    template<typename ObjectType>
-    bool FilterStatement(const encoding::json& jStatement, encoding::json &jCheck, ObjectType& rCheck,
-                          const std::function<bool (const encoding::json&, ObjectType&)>& xObject);
-
-
     /** FilterFieldname
      *
      *  Helper filter, to handle recursion up and down levels of json. This handles only single entries at a time.
@@ -19,6 +19,7 @@ ________________________________________________________________________________
 #include <LLP/types/tritium.h>
 
 #include <TAO/API/types/authentication.h>
+#include <TAO/API/types/cache.h>
 #include <TAO/API/types/commands.h>
 #include <TAO/API/types/indexing.h>
 #include <TAO/API/types/transaction.h>
@@ -354,6 +355,9 @@ namespace TAO::API
             /* Build our local sigchain events indexes. */
             index_transaction(hashTx, tx);
 
+            /* Drop cached results depending on what we just indexed. */
+            ResultCache::Invalidate(tx);
+
             /* Iterate the transaction contracts. */
             for(uint32_t nContract = 0; nContract < tx.Size(); nContract++)
             {
@@ -403,6 +407,9 @@ namespace TAO::API
                         /* Increment our sequence. */
                         if(!LLD::Logical->IncrementLegacySequence(state.hashOwner))
                             continue;
+
+                        /* Drop cached results for the owner's unclaimed balances. */
+                        ResultCache::Invalidate(hashTo);
                     }
                 }
             }
@@ -0,0 +1,163 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/types/exception.h>
+#include <TAO/API/types/page.h>
+
+#include <TAO/Register/types/object.h>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+
+    /* Default Constructor, for a row missing the column. */
+    SortKey::SortKey()
+    : nType     (MISSING)
+    , nUnsigned (0)
+    , nSigned   (0)
+    , dFloat    (0)
+    , strValue  ( )
+    {
+    }
+
+
+    /* Constructor for an unsigned integer. */
+    SortKey::SortKey(const uint64_t nValue)
+    : nType     (UNSIGNED)
+    , nUnsigned (nValue)
+    , nSigned   (0)
+    , dFloat    (0)
+    , strValue  ( )
+    {
+    }
+
+
+    /* Get the value of a numeric key as a floating point, to compare across numeric types. */
+    long double SortKey::number() const
+    {
+        if(nType == UNSIGNED)
+            return static_cast<long double>(nUnsigned);
+
+        if(nType == SIGNED)
+            return static_cast<long double>(nSigned);
+
+        return static_cast<long double>(dFloat);
+    }
+
+
+    /* Check if a row with this key comes before a row with another. */
+    bool SortKey::Before(const SortKey& key, const bool fDesc) const
+    {
+        /* Rows missing the column always go last. */
+        if(nType == MISSING || key.nType == MISSING)
+            return (nType != MISSING && key.nType == MISSING);
+
+        /* Strings sort among themselves, after numbers. */
+        if((nType == STRING) != (key.nType == STRING))
+            return (nType != STRING);
+
+        if(nType == STRING)
+            return fDesc ? (strValue > key.strValue) : (strValue < key.strValue);
+
+        /* Compare integers of the same type exactly. */
+        if(nType == UNSIGNED && key.nType == UNSIGNED)
+            return fDesc ? (nUnsigned > key.nUnsigned) : (nUnsigned < key.nUnsigned);
+
+        if(nType == SIGNED && key.nType == SIGNED)
+            return fDesc ? (nSigned > key.nSigned) : (nSigned < key.nSigned);
+
+        return fDesc ? (number() > key.number()) : (number() < key.number());
+    }
+
+
+    /* Check if two keys hold the same value. */
+    bool SortKey::Equals(const SortKey& key) const
+    {
+        return !Before(key, false) && !key.Before(*this, false);
+    }
+
+
+    /* Get the sort key of a column straight from an object register. */
+    bool SortKeyFromObject(const TAO::Register::Object& rObject, const std::string& strColumn, SortKey &key)
+    {
+        /* Check the register's header. */
+        if(strColumn == "modified")
+        {
+            key = SortKey(rObject.nModified);
+            return true;
+        }
+
+        if(strColumn == "created")
+        {
+            key = SortKey(rObject.nCreated);
+            return true;
+        }
+
+        if(strColumn == "version")
+        {
+            key = SortKey(rObject.nVersion);
+            return true;
+        }
+
+        /* Members are left to the JSON, since standards are free to reformat them. */
+        return false;
+    }
+
+
+    /* Get the sort key of a column from a JSON result, using . to move down levels. */
+    SortKey SortKeyFromJSON(const encoding::json& jResult, const std::string& strColumn)
+    {
+        /* Check for nested sorting values and handle recursively. */
+        const auto nFind = strColumn.find(".");
+        if(nFind != strColumn.npos)
+        {
+            const std::string strNext = strColumn.substr(0, nFind);
+            if(!jResult.is_object() || jResult.find(strNext) == jResult.end())
+                return SortKey();
+
+            return SortKeyFromJSON(jResult[strNext], strColumn.substr(nFind + 1));
+        }
+
+        /* Check for sort by missing parameter. */
+        if(!jResult.is_object() || jResult.find(strColumn) == jResult.end())
+            return SortKey();
+
+        const encoding::json& jValue = jResult[strColumn];
+
+        SortKey key;
+        if(jValue.is_number_unsigned())
+        {
+            key.nType     = SortKey::UNSIGNED;
+            key.nUnsigned = jValue.get<uint64_t>();
+        }
+        else if(jValue.is_number_integer())
+        {
+            key.nType   = SortKey::SIGNED;
+            key.nSigned = jValue.get<int64_t>();
+        }
+        else if(jValue.is_number_float())
+        {
+            key.nType  = SortKey::FLOAT;
+            key.dFloat = jValue.get<double>();
+        }
+        else if(jValue.is_string())
+        {
+            key.nType    = SortKey::STRING;
+            key.strValue = jValue.get<std::string>();
+        }
+        else
+            throw Exception(-57, "Invalid Parameter [", strColumn, "=", jValue.type_name(), "]");
+
+        return key;
+    }
+}
@@ -0,0 +1,616 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/include/evaluate.h>
+#include <TAO/API/include/get.h>
+
+#include <TAO/API/types/exception.h>
+#include <TAO/API/types/predicate.h>
+
+#include <TAO/Register/include/enum.h>
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/object.h>
+
+#include <Util/include/string.h>
+
+#include <Util/types/precision.h>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    /* Get a numeric comparison of two values. */
+    template<typename Type>
+    static int32_t order(const Type& a, const Type& b)
+    {
+        if(a < b)
+            return -1;
+
+        if(b < a)
+            return 1;
+
+        return 0;
+    }
+
+
+    /* Compiles the where clause of a request, if there is one. */
+    Predicate::Predicate(const encoding::json& jParams)
+    : vNodes   ( )
+    , fResults (false)
+    {
+        /* Check for a where clause. */
+        if(jParams.find("where") == jParams.end())
+            return; //no filters
+
+        compile(jParams["where"]);
+    }
+
+
+    /* Check if there are no statements to filter by. */
+    bool Predicate::Empty() const
+    {
+        return vNodes.empty();
+    }
+
+
+    /* Check if any clause may need the JSON to be checked. */
+    bool Predicate::Results() const
+    {
+        return fResults;
+    }
+
+
+    /* Check an object register without its JSON. */
+    uint8_t Predicate::Evaluate(const TAO::Register::Object& rObject) const
+    {
+        /* Check for no filters. */
+        if(vNodes.empty())
+            return MATCH;
+
+        return object(0, rObject);
+    }
+
+
+    /* Check an object register and its JSON, filtering arrays in the JSON like FilterResults. */
+    bool Predicate::Evaluate(const TAO::Register::Object& rObject, encoding::json &jResults) const
+    {
+        /* Check for no filters. */
+        if(vNodes.empty())
+            return true;
+
+        return results(0, &rObject, &jResults);
+    }
+
+
+    /* Check a JSON result that has no object register behind it. */
+    bool Predicate::Evaluate(encoding::json &jResults) const
+    {
+        /* Check for no filters. */
+        if(vNodes.empty())
+            return true;
+
+        return results(0, nullptr, &jResults);
+    }
+
+
+    /* Check an object register that has no JSON, with every clause on the object. */
+    bool Predicate::EvaluateObject(const TAO::Register::Object& rObject) const
+    {
+        /* Check for no filters. */
+        if(vNodes.empty())
+            return true;
+
+        return results(0, &rObject, nullptr);
+    }
+
+
+    /* Compile a statement and its groups, returning the index of its node. */
+    uint32_t Predicate::compile(const encoding::json& jStatement)
+    {
+        /* Reserve our node first, since our groups are added after it. */
+        const uint32_t nIndex = vNodes.size();
+        vNodes.emplace_back();
+
+        /* Check for a group of statements. */
+        if(jStatement.find("statement") != jStatement.end())
+        {
+            /* Check for logical operator. */
+            uint8_t nLogical = LOGICAL::SINGLE;
+            if(jStatement.find("logical") != jStatement.end())
+            {
+                const std::string strLogical = jStatement["logical"].get<std::string>();
+                if(strLogical == "AND")
+                    nLogical = LOGICAL::AND;
+
+                if(strLogical == "OR")
+                    nLogical = LOGICAL::OR;
+            }
+
+            /* Compile our statements recursively. */
+            std::vector<uint32_t> vChildren;
+            for(const auto& jClause : jStatement["statement"])
+                vChildren.push_back(compile(jClause));
+
+            /* Set our node now that the vector is done growing. */
+            Node& tNode     = vNodes[nIndex];
+            tNode.fGroup    = true;
+            tNode.nLogical  = nLogical;
+            tNode.vChildren = vChildren;
+
+            return nIndex;
+        }
+
+        /* Check for a complete clause. */
+        if(jStatement.find("class") == jStatement.end() || jStatement.find("field") == jStatement.end()
+        || jStatement.find("operator") == jStatement.end() || jStatement.find("value") == jStatement.end()
+        || !jStatement["value"].is_string())
+            throw Exception(-60, "Query Syntax Error, malformed where clause at ", jStatement.dump(4));
+
+        /* Build our clause. */
+        Clause tClause;
+        tClause.strField = jStatement["field"].get<std::string>();
+        tClause.strValue = jStatement["value"].get<std::string>();
+
+        /* Check our class. */
+        const std::string strClass = jStatement["class"].get<std::string>();
+        if(strClass == "results")
+            tClause.nClass = CLASS::RESULTS;
+        else if(strClass == "object")
+            tClause.nClass = CLASS::OBJECT;
+        else
+            throw Exception(-56, "Query Syntax Error: cannot mix [results] with [", strClass, "]");
+
+        /* Find the fields in the register header. */
+        tClause.nHeader = HEADER::NONE;
+        if(tClause.strField == "version")
+            tClause.nHeader = HEADER::VERSION;
+        else if(tClause.strField == "created")
+            tClause.nHeader = HEADER::CREATED;
+        else if(tClause.strField == "modified")
+            tClause.nHeader = HEADER::MODIFIED;
+        else if(tClause.strField == "owner" && tClause.nClass == CLASS::OBJECT)
+            tClause.nHeader = HEADER::OWNER; //results have the owner as formatted string
+
+        /* Results clauses on anything but the header need the JSON. */
+        if(tClause.nClass == CLASS::RESULTS && tClause.nHeader == HEADER::NONE)
+            fResults = true;
+
+        /* Split our field into its levels. */
+        ParseString(tClause.strField, '.', tClause.vPath);
+
+        /* Parse our operator. */
+        const std::string strOP = jStatement["operator"].get<std::string>();
+        if(strOP == "!=")
+            tClause.nCompare = COMPARE::NOT;
+        else
+        {
+            tClause.nCompare = 0;
+            if(strOP.find("<") != strOP.npos)
+                tClause.nCompare |= COMPARE::LESS;
+
+            if(strOP.find("=") != strOP.npos)
+                tClause.nCompare |= COMPARE::EQUAL;
+
+            if(strOP.find(">") != strOP.npos)
+                tClause.nCompare |= COMPARE::GREATER;
+        }
+
+        /* Parse our value for every type it may be compared as. */
+        tClause.fWildcard = (tClause.strValue.find("*") != tClause.strValue.npos);
+        if(tClause.fWildcard && tClause.strValue.find("**") != tClause.strValue.npos)
+            throw Exception(-56, "Query Syntax Error: duplicate wildcard not allowed ", tClause.strValue);
+
+        tClause.fUnsigned = false;
+        tClause.nUnsigned = 0;
+        tClause.fSigned   = false;
+        tClause.nSigned   = 0;
+        tClause.fFloat    = false;
+        tClause.dFloat    = 0;
+
+        /* Values that aren't numbers only throw if they are compared to one. */
+        try
+        {
+            tClause.nUnsigned = std::stoull(tClause.strValue);
+            tClause.fUnsigned = true;
+        }
+        catch(const std::exception& e) { }
+
+        try
+        {
+            tClause.nSigned = std::stoll(tClause.strValue);
+            tClause.fSigned = true;
+        }
+        catch(const std::exception& e) { }
+
+        try
+        {
+            tClause.dFloat = std::stod(tClause.strValue);
+            tClause.fFloat = true;
+        }
+        catch(const std::exception& e) { }
+
+        /* Only object members can be hashes, and addresses are given in base58, the rest in hex. */
+        if(tClause.nClass == CLASS::OBJECT)
+        {
+            tClause.hash256 = uint256_t(tClause.strValue);
+            if(tClause.strField == "token" || tClause.strField == "address")
+                tClause.hash256 = TAO::Register::Address(tClause.strValue);
+
+            tClause.hash512  = uint512_t(tClause.strValue);
+            tClause.hash1024 = uint1024_t(tClause.strValue);
+        }
+
+        /* Set our node. */
+        Node& tNode    = vNodes[nIndex];
+        tNode.fGroup   = false;
+        tNode.nLogical = LOGICAL::SINGLE;
+        tNode.tClause  = tClause;
+
+        return nIndex;
+    }
+
+
+    /* Check a node with only the object, and the clauses that need JSON left unknown. */
+    uint8_t Predicate::object(const uint32_t nNode, const TAO::Register::Object& rObject) const
+    {
+        /* Grab a reference of our node. */
+        const Node& tNode = vNodes[nNode];
+
+        /* Check our clauses that can be answered by the object. */
+        if(!tNode.fGroup)
+        {
+            /* Check for results clauses we can't answer yet. */
+            if(tNode.tClause.nClass == CLASS::RESULTS && tNode.tClause.nHeader == HEADER::NONE)
+                return UNKNOWN;
+
+            return clause(tNode.tClause, rObject) ? MATCH : FAIL;
+        }
+
+        /* An empty group passes everything. */
+        if(tNode.vChildren.empty())
+            return MATCH;
+
+        /* Without a logical operator only the first statement counts. */
+        if(tNode.nLogical == LOGICAL::SINGLE)
+            return object(tNode.vChildren[0], rObject);
+
+        /* Check our statements in order, since the results are filtered as they are checked. */
+        bool fUnknown = false;
+        for(const auto& nChild : tNode.vChildren)
+        {
+            const uint8_t nResult = object(nChild, rObject);
+
+            /* Any failing statement fails an AND. */
+            if(tNode.nLogical == LOGICAL::AND && nResult == FAIL)
+                return FAIL;
+
+            /* A passing statement only decides an OR if nothing before it needed the JSON. */
+            if(tNode.nLogical == LOGICAL::OR && nResult == MATCH)
+                return fUnknown ? UNKNOWN : MATCH;
+
+            if(nResult == UNKNOWN)
+                fUnknown = true;
+        }
+
+        /* Otherwise every statement passed an AND or failed an OR. */
+        if(fUnknown)
+            return UNKNOWN;
+
+        return (tNode.nLogical == LOGICAL::AND) ? MATCH : FAIL;
+    }
+
+
+    /* Check a node with the object and its JSON, either of which can be missing. */
+    bool Predicate::results(const uint32_t nNode, const TAO::Register::Object* pObject, encoding::json* pResults) const
+    {
+        /* Grab a reference of our node. */
+        const Node& tNode = vNodes[nNode];
+
+        /* Check our final clauses. */
+        if(!tNode.fGroup)
+        {
+            /* Grab a reference of our clause. */
+            const Clause& tClause = tNode.tClause;
+
+            /* Check for object clauses. */
+            if(tClause.nClass == CLASS::OBJECT)
+            {
+                if(!pObject)
+                    throw Exception(-56, "Query Syntax Error: cannot mix [results] with [object]");
+
+                return clause(tClause, *pObject);
+            }
+
+            /* Check the header of the object for results, which is written to JSON unchanged. */
+            if(pObject && tClause.nHeader != HEADER::NONE)
+                return clause(tClause, *pObject);
+
+            /* Otherwise we need the JSON. */
+            if(!pResults)
+                throw Exception(-56, "Query Syntax Error: cannot mix [object] with [results]");
+
+            return clause(tClause, 0, *pResults);
+        }
+
+        /* An empty group passes everything. */
+        if(tNode.vChildren.empty())
+            return true;
+
+        /* Without a logical operator only the first statement counts. */
+        if(tNode.nLogical == LOGICAL::SINGLE)
+            return results(tNode.vChildren[0], pObject, pResults);
+
+        /* Check our statements in order, exiting as soon as the outcome is known. */
+        for(const auto& nChild : tNode.vChildren)
+        {
+            const bool fResult = results(nChild, pObject, pResults);
+
+            if(tNode.nLogical == LOGICAL::AND && !fResult)
+                return false;
+
+            if(tNode.nLogical == LOGICAL::OR && fResult)
+                return true;
+        }
+
+        return (tNode.nLogical == LOGICAL::AND);
+    }
+
+
+    /* Check if a comparison passes. */
+    bool Predicate::compare(const Clause& tClause, const int32_t nCompare) const
+    {
+        /* Check our not operator. */
+        if(tClause.nCompare & COMPARE::NOT)
+            return (nCompare != 0);
+
+        /* Check the rest of our combinations. */
+        return ((tClause.nCompare & COMPARE::EQUAL)   && nCompare == 0)
+            || ((tClause.nCompare & COMPARE::LESS)    && nCompare <  0)
+            || ((tClause.nCompare & COMPARE::GREATER) && nCompare >  0);
+    }
+
+
+    /* Check a clause on the object. */
+    bool Predicate::clause(const Clause& tClause, const TAO::Register::Object& rObject) const
+    {
+        /* Check the register's header. */
+        switch(tClause.nHeader)
+        {
+            case HEADER::VERSION:
+            case HEADER::CREATED:
+            case HEADER::MODIFIED:
+            {
+                /* Check for correct types. */
+                if(!tClause.fUnsigned)
+                    throw Exception(-57, "Query Syntax Error: [", tClause.strField, "] requires a number");
+
+                /* Grab the header value to check. */
+                uint64_t nValue = rObject.nModified;
+                if(tClause.nHeader == HEADER::VERSION)
+                    nValue = rObject.nVersion;
+
+                if(tClause.nHeader == HEADER::CREATED)
+                    nValue = rObject.nCreated;
+
+                return compare(tClause, order(nValue, tClause.nUnsigned));
+            }
+
+            case HEADER::OWNER:
+            {
+                /* Owners are only equal or not. */
+                if(tClause.nCompare & (COMPARE::LESS | COMPARE::GREATER))
+                    return false;
+
+                return compare(tClause, (rObject.hashOwner == tClause.hash256) ? 0 : 1);
+            }
+        }
+
+        /* Check for the available type. */
+        if(!rObject.Check(tClause.strField))
+            return false;
+
+        /* Now let's check our type. */
+        uint8_t nType = 0;
+        rObject.Type(tClause.strField, nType);
+
+        /* Switch based on type. */
+        switch(nType)
+        {
+            /* Check for integer types. */
+            case TAO::Register::TYPES::UINT8_T:
+            case TAO::Register::TYPES::UINT16_T:
+            case TAO::Register::TYPES::UINT32_T:
+            case TAO::Register::TYPES::UINT64_T:
+            {
+                /* We need to switch to decode the correct type out of the object register. */
+                uint64_t nValue = 0; //we will store all in 64 bits
+                switch(nType)
+                {
+                    case TAO::Register::TYPES::UINT8_T:
+                        nValue = rObject.get<uint8_t>(tClause.strField);
+                        break;
+
+                    case TAO::Register::TYPES::UINT16_T:
+                        nValue = rObject.get<uint16_t>(tClause.strField);
+                        break;
+
+                    case TAO::Register::TYPES::UINT32_T:
+                        nValue = rObject.get<uint32_t>(tClause.strField);
+                        break;
+
+                    case TAO::Register::TYPES::UINT64_T:
+                        nValue = rObject.get<uint64_t>(tClause.strField);
+                        break;
+                }
+
+                /* Special rule for balances that need to cast in and out of double. */
+                if(tClause.strField == "balance" || tClause.strField == "stake" || tClause.strField == "supply")
+                {
+                    if(!tClause.fFloat)
+                        throw Exception(-57, "Query Syntax Error: [", tClause.strField, "] requires a number");
+
+                    return compare(tClause, order(nValue, uint64_t(tClause.dFloat * GetFigures(rObject))));
+                }
+
+                /* Check for correct types. */
+                if(!tClause.fUnsigned)
+                    throw Exception(-57, "Query Syntax Error: [", tClause.strField, "] requires a number");
+
+                return compare(tClause, order(nValue, tClause.nUnsigned));
+            }
+
+            /* Check for uint256_t type. */
+            case TAO::Register::TYPES::UINT256_T:
+                return compare(tClause, order(rObject.get<uint256_t>(tClause.strField), tClause.hash256));
+
+            /* Check for uint512_t type. */
+            case TAO::Register::TYPES::UINT512_T:
+                return compare(tClause, order(rObject.get<uint512_t>(tClause.strField), tClause.hash512));
+
+            /* Check for uint1024_t type. */
+            case TAO::Register::TYPES::UINT1024_T:
+                return compare(tClause, order(rObject.get<uint1024_t>(tClause.strField), tClause.hash1024));
+
+            /* Check for string type. */
+            case TAO::Register::TYPES::STRING:
+            {
+                /* Check syntax to omit < and > operators for string comparisons. */
+                if(tClause.nCompare & (COMPARE::LESS | COMPARE::GREATER))
+                    throw Exception(-57, "Query Syntax Error: only '=' and '!=' operator allowed for type [string]");
+
+                /* Grab our value from object */
+                const std::string strValue = rObject.get<std::string>(tClause.strField);
+
+                /* Handle for all characters wildcard. */
+                if(tClause.fWildcard)
+                    return compare(tClause, EvaluateWildcard(tClause.strValue, strValue) ? 0 : 1);
+
+                return compare(tClause, (strValue == tClause.strValue) ? 0 : 1);
+            }
+        }
+
+        return false;
+    }
+
+
+    /* Check a results clause on a JSON value, filtering arrays down to their passing entries. */
+    bool Predicate::clause(const Clause& tClause, const uint32_t nLevel, encoding::json &jCheck) const
+    {
+        /* Check that we have any nested parameters. */
+        if(nLevel + 1 < tClause.vPath.size() && jCheck.is_object())
+        {
+            /* Check that we have nested values. */
+            auto it = jCheck.find(tClause.vPath[nLevel]);
+            if(it != jCheck.end())
+                return clause(tClause, nLevel + 1, *it);
+        }
+
+        /* Check now for arrays we need to recurse and reduce. */
+        if(jCheck.is_array())
+        {
+            /* Now we need to build our return value. */
+            encoding::json jRet = encoding::json::array();
+            for(auto& jValue : jCheck)
+            {
+                /* Check our values recursively. */
+                if(clause(tClause, nLevel, jValue))
+                    jRet.push_back(jValue);
+            }
+
+            /* Check that we added values. */
+            if(!jRet.empty())
+            {
+                /* Copy our new filtered array to current key. */
+                jCheck = jRet;
+                return true;
+            }
+        }
+
+        /* Handle checking for an object. */
+        if(jCheck.is_object())
+        {
+            /* Rebuild the name left to find if we couldn't move down a level. */
+            std::string strName = tClause.vPath[nLevel];
+            for(uint32_t n = nLevel + 1; n < tClause.vPath.size(); ++n)
+                strName += "." + tClause.vPath[n];
+
+            /* Check that field exists in object. */
+            auto it = jCheck.find(strName);
+            if(it == jCheck.end())
+                return false;
+
+            return clause(tClause, nLevel, *it);
+        }
+
+        /* Check our types to compare now. */
+        if(jCheck.is_string())
+        {
+            /* Check syntax to omit < and > operators for string comparisons. */
+            if(tClause.nCompare & (COMPARE::LESS | COMPARE::GREATER))
+                throw Exception(-57, "Query Syntax Error: only '=' and '!=' operator allowed for type [string]");
+
+            /* Grab a reference of our string to check. */
+            const std::string& strCheck = jCheck.get_ref<const std::string&>();
+
+            /* Handle for all characters wildcard. */
+            if(tClause.fWildcard)
+                return compare(tClause, EvaluateWildcard(tClause.strValue, strCheck) ? 0 : 1);
+
+            return compare(tClause, (strCheck == tClause.strValue) ? 0 : 1);
+        }
+
+        /* Check now for floating points. */
+        if(jCheck.is_number_float())
+        {
+            /* Compare in fixed point to avoid rounding errors. */
+            const precision_t dValue = precision_t(jCheck.dump());
+            const precision_t dCheck = precision_t(tClause.strValue);
+
+            return compare(tClause, order(dValue, dCheck));
+        }
+
+        /* Handle for unsigned integers. */
+        if(jCheck.is_number_unsigned())
+        {
+            /* Check for correct types. */
+            if(!tClause.fUnsigned)
+                throw Exception(-57, "Query Syntax Error: [", tClause.strField, "] requires a number");
+
+            return compare(tClause, order(jCheck.get<uint64_t>(), tClause.nUnsigned));
+        }
+
+        /* Handle for signed integers. */
+        if(jCheck.is_number_integer())
+        {
+            /* Check for correct types. */
+            if(!tClause.fSigned)
+                throw Exception(-57, "Query Syntax Error: [", tClause.strField, "] requires a number");
+
+            return compare(tClause, order(jCheck.get<int64_t>(), tClause.nSigned));
+        }
+
+        /* Check now for booleans. */
+        if(jCheck.is_boolean())
+        {
+            /* Check syntax to omit < and > operators for boolean comparisons. */
+            if(tClause.nCompare & (COMPARE::LESS | COMPARE::GREATER))
+                throw Exception(-57, "Query Syntax Error: only '=' and '!=' operator allowed for type [bool]");
+
+            /* Grab a copy of our boolean values to check */
+            const bool fCheck = (ToLower(tClause.strValue) == "true");
+
+            return compare(tClause, (jCheck.get<bool>() == fCheck) ? 0 : 1);
+        }
+
+        return false;
+    }
+}
@@ -15,6 +15,7 @@ ________________________________________________________________________________
 
 #include <LLP/include/global.h>
 
+#include <TAO/API/types/history.h>
 #include <TAO/API/types/transaction.h>
 
 #include <TAO/Operation/include/enum.h>
@@ -545,8 +546,32 @@ namespace TAO::API
                 }
             }
 
+            /* Skip over registers we have already pushed. */
+            if(setRegisters.count(hashRegister))
+                continue;
+
+            /* Build our history entry with this and every later contract on given register. */
+            HistoryEntry tEntry;
+            tEntry.hashTx     = hash;
+            tEntry.nTimestamp = nTimestamp;
+            for(uint32_t nHistory = nContract; nHistory < vContracts.size(); ++nHistory)
+            {
+                /* Grab reference of our contract. */
+                const TAO::Operation::Contract& rHistory = vContracts[nHistory];
+
+                /* Make sure we bind the contract here. */
+                rHistory.Bind(this, hash);
+
+                /* Check that our address matches the contract. */
+                uint256_t hashContract;
+                if(!TAO::Register::Unpack(rHistory, hashContract) || hashContract != hashRegister)
+                    continue;
+
+                tEntry.vContracts.push_back(std::make_pair(nHistory, rHistory.Primitive()));
+            }
+
             /* Push transaction to the queue so we can track what modified given register. */
-            if(!setRegisters.count(hashRegister) && LLD::Logical->PushTransaction(hashRegister, hash))
+            if(LLD::Logical->PushTransaction(hashRegister, tEntry))
             {
                 debug::log(3, "Pushing Transaction ", hash.SubString(), " to register ", hashRegister.ToString(), " transaction log");
 
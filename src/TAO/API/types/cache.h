@@ -0,0 +1,205 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/include/json.h>
+
+#include <atomic>
+#include <list>
+#include <map>
+#include <mutex>
+#include <set>
+
+//forward declarations
+namespace TAO::Ledger { class Transaction; }
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+    class Function;
+
+    /** @class ResultCache
+     *
+     *  Caches the results of commands polled by sessions, keyed by the caller, command and parameters. Each entry
+     *  records the registers read while computing it along with the caller's sigchain, and is dropped as soon as a
+     *  transaction in the mempool, a block or the indexing threads touches any of them.
+     *
+     **/
+    class ResultCache
+    {
+        /** An entry of cached results. **/
+        struct Entry
+        {
+            /** The results of the command. **/
+            encoding::json jResults;
+
+
+            /** The registers and sigchains the results depend on. **/
+            std::set<uint256_t> setDepends;
+
+
+            /** The position of this entry in our least recently used list. **/
+            std::list<uint256_t>::iterator itRecent;
+        };
+
+
+        /** Mutex around our entries. **/
+        static std::mutex MUTEX;
+
+
+        /** Map of cached entries by key. **/
+        static std::map<uint256_t, Entry> ENTRIES;
+
+
+        /** Map of keys of entries depending on a given register or sigchain. **/
+        static std::map<uint256_t, std::set<uint256_t>> DEPENDS;
+
+
+        /** List of keys from most to least recently used. **/
+        static std::list<uint256_t> RECENT;
+
+
+        /** Generation counter bumped on every invalidation, so results computed across one aren't cached. **/
+        static std::atomic<uint64_t> GENERATION;
+
+
+        /** The key entries depend on for the best chain, which no register or sigchain can have. **/
+        static const uint256_t CHAIN;
+
+
+        /** Counters for our metrics. **/
+        static std::atomic<uint64_t> HITS;
+        static std::atomic<uint64_t> MISSES;
+        static std::atomic<uint64_t> INVALIDATED;
+
+
+    public:
+
+        /** Execute
+         *
+         *  Execute a cached command, returning the cached results if they are still valid.
+         *
+         *  @param[in] rFunction The function of the command to execute.
+         *  @param[in] strMethod The method being executed.
+         *  @param[in] jParams The json formatted parameters.
+         *  @param[in] fHelp Flag if help is invoked.
+         *
+         *  @return The json formatted response.
+         *
+         **/
+        static encoding::json Execute(Function& rFunction, const std::string& strMethod,
+                                      const encoding::json& jParams, const bool fHelp);
+
+
+        /** Get
+         *
+         *  Get a copy of cached results by key.
+         *
+         *  @param[in] hashKey The key of the entry.
+         *  @param[out] jResults The cached results.
+         *
+         *  @return true if the entry was found.
+         *
+         **/
+        static bool Get(const uint256_t& hashKey, encoding::json &jResults);
+
+
+        /** Insert
+         *
+         *  Add results to the cache, unless anything was invalidated since they started computing.
+         *
+         *  @param[in] hashKey The key of the entry.
+         *  @param[in] jResults The results to cache.
+         *  @param[in] setDepends The registers and sigchains the results depend on.
+         *  @param[in] nGeneration The generation of the cache when the results started computing.
+         *
+         *  @return true if the entry was added.
+         *
+         **/
+        static bool Insert(const uint256_t& hashKey, const encoding::json& jResults,
+                           const std::set<uint256_t>& setDepends, const uint64_t nGeneration);
+
+
+        /** Generation
+         *
+         *  Get the current generation of the cache, which changes on every invalidation.
+         *
+         **/
+        static uint64_t Generation();
+
+
+        /** Invalidate
+         *
+         *  Drop all entries depending on the given register or sigchain.
+         *
+         *  @param[in] hashDepend The register address or genesis-id that changed.
+         *
+         **/
+        static void Invalidate(const uint256_t& hashDepend);
+
+
+        /** Invalidate
+         *
+         *  Drop all entries depending on the registers and sigchains touched by a transaction.
+         *
+         *  @param[in] tx The transaction that was accepted, connected or indexed.
+         *
+         **/
+        static void Invalidate(const TAO::Ledger::Transaction& tx);
+
+
+        /** InvalidateChain
+         *
+         *  Drop all entries depending on the best chain, called when a new best block is set.
+         *
+         **/
+        static void InvalidateChain();
+
+
+        /** DependChain
+         *
+         *  Mark the results being computed on this thread as depending on the best chain, for values such as
+         *  immature balances that change with new blocks rather than with the registers they were read from.
+         *
+         **/
+        static void DependChain();
+
+
+        /** Clear
+         *
+         *  Drop all of our entries.
+         *
+         **/
+        static void Clear();
+
+
+        /** Metrics
+         *
+         *  Get the entries, hit ratio and invalidations of the cache.
+         *
+         *  @return The json formatted metrics.
+         *
+         **/
+        static encoding::json Metrics();
+
+
+    private:
+
+        /* Drop an entry and its dependencies, with MUTEX held. */
+        static void erase(const uint256_t& hashKey);
+
+    };
+}
@@ -133,20 +133,5 @@ namespace TAO::API
          **/
         encoding::json Metrics(const encoding::json& params, const bool fHelp);
 
-
-
-    private:
-
-        /** count_registers
-        *
-        *  Returns the count of registers of the given type in the register DB
-        *
-        *  @param[in] strType the register type to count
-        *
-        *  @return number of unique registers in the register DB of the specified type.
-        *
-        **/
-        uint64_t count_registers(const std::string& strType);
-
     };
 }
@@ -53,6 +53,10 @@ namespace TAO::API
         std::set<std::string> setNouns;
 
 
+        /** Flag to cache results for polling sessions. **/
+        bool fCached;
+
+
     public:
 
 
@@ -63,6 +67,7 @@ namespace TAO::API
         , nMaxVersion (0)
         , strMessage  ( )
         , setNouns    ( )
+        , fCached     (false)
         {
         }
 
@@ -82,6 +87,7 @@ namespace TAO::API
         , nMaxVersion (0)
         , strMessage  ( )
         , setNouns    ( )
+        , fCached     (false)
         {
         }
 
@@ -101,6 +107,7 @@ namespace TAO::API
         , nMaxVersion (0)
         , strMessage  ( )
         , setNouns    ( )
+        , fCached     (false)
         {
             /* Grab our nouns to add to the set. */
             ParseString(strNouns, ',', setNouns, true); //true to trim spaces
@@ -124,6 +131,7 @@ namespace TAO::API
         , nMaxVersion (nMaxVersionIn)
         , strMessage  (strMessageIn)
         , setNouns    ( )
+        , fCached     (false)
         {
         }
 
@@ -146,6 +154,7 @@ namespace TAO::API
         , nMaxVersion (nMaxVersionIn)
         , strMessage  (strMessageIn)
         , setNouns    ( )
+        , fCached     (false)
         {
         }
 
@@ -175,6 +184,31 @@ namespace TAO::API
         }
 
 
+        /** SetCached
+         *
+         *  Set if results of this function can be cached for polling sessions, which is only safe for functions
+         *  whose results don't change unless a register or sigchain they read from does.
+         *
+         *  @param[in] fCachedIn Flag to cache results.
+         *
+         **/
+        void SetCached(const bool fCachedIn = true)
+        {
+            fCached = fCachedIn;
+        }
+
+
+        /** Cached
+         *
+         *  Check if results of this function can be cached.
+         *
+         **/
+        bool Cached() const
+        {
+            return fCached;
+        }
+
+
         /** Status
          *
          *  Get status message for current function.
@@ -0,0 +1,70 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/serialize.h>
+
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+
+    /** @class HistoryEntry
+     *
+     *  An entry in the history index of a register, one per transaction that modified it, kept under the same
+     *  sequence number as the register's transaction index so a page of history can be read from either end.
+     *
+     **/
+    class HistoryEntry
+    {
+    public:
+
+        /** The txid of the transaction that modified the register. **/
+        uint512_t hashTx;
+
+
+        /** The timestamp of the transaction. **/
+        uint64_t nTimestamp;
+
+
+        /** The number of contracts on the register up to and including this entry, for seeking by offset. **/
+        uint32_t nRows;
+
+
+        /** The index and primitive of every contract in the transaction on the register. **/
+        std::vector<std::pair<uint32_t, uint8_t>> vContracts;
+
+
+        /** Default Constructor. **/
+        HistoryEntry()
+        : hashTx     (0)
+        , nTimestamp (0)
+        , nRows      (0)
+        , vContracts ( )
+        {
+        }
+
+
+        IMPLEMENT_SERIALIZE
+        (
+            READWRITE(hashTx);
+            READWRITE(nTimestamp);
+            READWRITE(nRows);
+            READWRITE(vContracts);
+        )
+    };
+}
@@ -0,0 +1,319 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/object.h>
+
+#include <Util/include/json.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+
+    /** @class SortKey
+     *
+     *  The typed value of the column a list is sorted by, so rows can be ordered without keeping their JSON.
+     *
+     **/
+    class SortKey
+    {
+    public:
+
+        /** The types of value a column can hold. **/
+        enum : uint8_t
+        {
+            MISSING  = 0x00,
+            UNSIGNED = 0x01,
+            SIGNED   = 0x02,
+            FLOAT    = 0x03,
+            STRING   = 0x04,
+        };
+
+
+        /** The type of the value. **/
+        uint8_t nType;
+
+
+        /** The value for unsigned integers. **/
+        uint64_t nUnsigned;
+
+
+        /** The value for signed integers. **/
+        int64_t nSigned;
+
+
+        /** The value for floating points. **/
+        double dFloat;
+
+
+        /** The value for strings. **/
+        std::string strValue;
+
+
+        /** Default Constructor, for a row missing the column. **/
+        SortKey();
+
+
+        /** Constructor for an unsigned integer. **/
+        explicit SortKey(const uint64_t nValue);
+
+
+        /** Before
+         *
+         *  Check if a row with this key comes before a row with another.
+         *  Rows missing the column come after all the rest.
+         *
+         *  @param[in] key The key to compare against.
+         *  @param[in] fDesc Flag for descending order.
+         *
+         *  @return true if this key comes first, false if the other does or they are equal.
+         *
+         **/
+        bool Before(const SortKey& key, const bool fDesc) const;
+
+
+        /** Equals
+         *
+         *  Check if two keys hold the same value.
+         *
+         *  @param[in] key The key to compare against.
+         *
+         **/
+        bool Equals(const SortKey& key) const;
+
+    private:
+
+        /* Get the value of a numeric key as a floating point, to compare across numeric types. */
+        long double number() const;
+    };
+
+
+    /** SortKeyFromObject
+     *
+     *  Get the sort key of a column straight from an object register, for the register header columns that every
+     *  standard writes to JSON unchanged.
+     *
+     *  @param[in] rObject The object register to get the column from.
+     *  @param[in] strColumn The column we are sorting by.
+     *  @param[out] key The sort key.
+     *
+     *  @return true if the column could be found without building the JSON.
+     *
+     **/
+    bool SortKeyFromObject(const TAO::Register::Object& rObject, const std::string& strColumn, SortKey &key);
+
+
+    /** SortKeyFromJSON
+     *
+     *  Get the sort key of a column from a JSON result, using . to move down levels.
+     *
+     *  @param[in] jResult The result to get the column from.
+     *  @param[in] strColumn The column we are sorting by.
+     *
+     *  @return The sort key, which is missing if the result has no such column.
+     *
+     **/
+    SortKey SortKeyFromJSON(const encoding::json& jResult, const std::string& strColumn);
+
+
+    /** RegisterRow
+     *
+     *  A register kept for a page of a list, with its JSON if it had to be built to filter or sort by.
+     *
+     **/
+    struct RegisterRow
+    {
+        /** The register address. **/
+        TAO::Register::Address hashRegister;
+
+
+        /** The object register. **/
+        TAO::Register::Object tObject;
+
+
+        /** The JSON of the register, or null if not built yet. **/
+        encoding::json jRegister;
+    };
+
+
+    /** @class ListPage
+     *
+     *  Keeps only the rows of a list that can land on the requested page. Rows are ranked by their sort key in a
+     *  bounded heap of offset + limit entries, so the worst of them is dropped as soon as a better row is found,
+     *  and the caller can check if a row would be kept before doing any more work on it.
+     *
+     *  Rows with equal keys keep the order they were added in.
+     *
+     **/
+    template<typename Type>
+    class ListPage
+    {
+        /** A kept row. **/
+        struct Entry
+        {
+            /** The key the row is sorted by. **/
+            SortKey key;
+
+
+            /** The order the row was added in. **/
+            uint64_t nSequence;
+
+
+            /** The row data. **/
+            Type tValue;
+        };
+
+
+        /** Flag for descending order. **/
+        const bool fDesc;
+
+
+        /** The number of rows to skip. **/
+        const uint32_t nOffset;
+
+
+        /** The number of rows to return. **/
+        const uint32_t nLimit;
+
+
+        /** The number of rows to keep. **/
+        const uint64_t nKeep;
+
+
+        /** The number of rows added. **/
+        uint64_t nTotal;
+
+
+        /** The kept rows, as a heap with the last of them at the front. **/
+        std::vector<Entry> vHeap;
+
+
+        /* Check if an entry comes before another. */
+        bool before(const Entry& a, const Entry& b) const
+        {
+            if(a.key.Before(b.key, fDesc))
+                return true;
+
+            if(b.key.Before(a.key, fDesc))
+                return false;
+
+            return a.nSequence < b.nSequence;
+        }
+
+    public:
+
+        /** Default Constructor Disabled. **/
+        ListPage() = delete;
+
+
+        /** Constructor
+         *
+         *  @param[in] strOrder The order we are sorting by.
+         *  @param[in] nOffsetIn The number of rows to skip.
+         *  @param[in] nLimitIn The number of rows to return.
+         *
+         **/
+        ListPage(const std::string& strOrder, const uint32_t nOffsetIn, const uint32_t nLimitIn)
+        : fDesc   (strOrder == "desc")
+        , nOffset (nOffsetIn)
+        , nLimit  (nLimitIn)
+        , nKeep   (uint64_t(nOffsetIn) + nLimitIn)
+        , nTotal  (0)
+        , vHeap   ( )
+        {
+        }
+
+
+        /** Accept
+         *
+         *  Check if a row with a given key could still land on the page, so work on the rest can be skipped.
+         *
+         *  @param[in] key The key of the row.
+         *
+         *  @return true if the row would be kept.
+         *
+         **/
+        bool Accept(const SortKey& key) const
+        {
+            /* Keep everything until the page is full, so an empty page always has an exact total. */
+            if(vHeap.size() < nKeep || nLimit == 0)
+                return true;
+
+            /* Later rows only displace the last kept row if they come strictly before it. */
+            return key.Before(vHeap.front().key, fDesc);
+        }
+
+
+        /** Insert
+         *
+         *  Add a row that passed the filters, dropping the last kept row if there are too many.
+         *
+         *  @param[in] key The key of the row.
+         *  @param[in] tValue The row data.
+         *
+         **/
+        void Insert(const SortKey& key, Type&& tValue)
+        {
+            const auto fCompare = [this](const Entry& a, const Entry& b) { return before(a, b); };
+
+            vHeap.push_back(Entry{key, nTotal++, std::move(tValue)});
+            std::push_heap(vHeap.begin(), vHeap.end(), fCompare);
+
+            if(vHeap.size() > nKeep)
+            {
+                std::pop_heap(vHeap.begin(), vHeap.end(), fCompare);
+                vHeap.pop_back();
+            }
+        }
+
+
+        /** Total
+         *
+         *  Get the number of rows added. Rows skipped by Accept are not counted, which only happens once the page
+         *  is full.
+         *
+         **/
+        uint64_t Total() const
+        {
+            return nTotal;
+        }
+
+
+        /** Page
+         *
+         *  Take the rows on the page, in order.
+         *
+         *  @return The rows after the offset, up to the limit.
+         *
+         **/
+        std::vector<Type> Page()
+        {
+            const auto fCompare = [this](const Entry& a, const Entry& b) { return before(a, b); };
+            std::sort_heap(vHeap.begin(), vHeap.end(), fCompare);
+
+            std::vector<Type> vPage;
+            for(uint64_t n = nOffset; n < vHeap.size() && vPage.size() < nLimit; ++n)
+                vPage.push_back(std::move(vHeap[n].tValue));
+
+            vHeap.clear();
+
+            return vPage;
+        }
+    };
+}
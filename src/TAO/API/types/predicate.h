@@ -0,0 +1,281 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/include/json.h>
+
+#include <string>
+#include <vector>
+
+namespace TAO::Register { class Object; }
+
+/* Global TAO namespace. */
+namespace TAO::API
+{
+
+    /** @class Predicate
+     *
+     *  A where clause compiled once per request. The statement tree is flattened, operators and values are parsed
+     *  up front, and clauses on the register header or object members are checked straight on the object, so the
+     *  JSON of a register only has to be built when a results clause can't be answered without it.
+     *
+     **/
+    class Predicate
+    {
+    public:
+
+        /** The outcomes of checking an object without its JSON. **/
+        enum : uint8_t
+        {
+            FAIL    = 0x00,
+            MATCH   = 0x01,
+            UNKNOWN = 0x02,
+        };
+
+    private:
+
+        /** The classes of clauses. **/
+        struct CLASS
+        {
+            enum : uint8_t
+            {
+                RESULTS = 0x01,
+                OBJECT  = 0x02,
+            };
+        };
+
+
+        /** The register header fields that can be checked on the object. **/
+        struct HEADER
+        {
+            enum : uint8_t
+            {
+                NONE     = 0x00,
+                VERSION  = 0x01,
+                CREATED  = 0x02,
+                MODIFIED = 0x03,
+                OWNER    = 0x04,
+            };
+        };
+
+
+        /** The logical operators of a group. **/
+        struct LOGICAL
+        {
+            enum : uint8_t
+            {
+                SINGLE = 0x00,
+                AND    = 0x01,
+                OR     = 0x02,
+            };
+        };
+
+
+        /** The comparisons an operator passes on. **/
+        struct COMPARE
+        {
+            enum : uint8_t
+            {
+                LESS    = 0x01,
+                EQUAL   = 0x02,
+                GREATER = 0x04,
+                NOT     = 0x08,
+            };
+        };
+
+
+        /** A single compiled clause. **/
+        struct Clause
+        {
+            /** The class of the clause, results or object. **/
+            uint8_t nClass;
+
+
+            /** The register header field the clause is on, if any. **/
+            uint8_t nHeader;
+
+
+            /** The comparisons that pass, as flags. **/
+            uint8_t nCompare;
+
+
+            /** The field name. **/
+            std::string strField;
+
+
+            /** The field name split into its levels, for results. **/
+            std::vector<std::string> vPath;
+
+
+            /** The value to compare against. **/
+            std::string strValue;
+
+
+            /** Flag for wildcard values. **/
+            bool fWildcard;
+
+
+            /** Flag and value if the value is an unsigned integer. **/
+            bool fUnsigned;
+            uint64_t nUnsigned;
+
+
+            /** Flag and value if the value is a signed integer. **/
+            bool fSigned;
+            int64_t nSigned;
+
+
+            /** Flag and value if the value is a floating point, for balances. **/
+            bool fFloat;
+            double dFloat;
+
+
+            /** The value as hashes, for hash members. **/
+            uint256_t hash256;
+            uint512_t hash512;
+            uint1024_t hash1024;
+        };
+
+
+        /** A node of the flattened statement tree. **/
+        struct Node
+        {
+            /** Flag for a group of statements, otherwise a clause. **/
+            bool fGroup;
+
+
+            /** The logical operator of a group. **/
+            uint8_t nLogical;
+
+
+            /** The nodes of a group. **/
+            std::vector<uint32_t> vChildren;
+
+
+            /** The clause, if not a group. **/
+            Clause tClause;
+        };
+
+
+        /** The statement tree, with the root first. **/
+        std::vector<Node> vNodes;
+
+
+        /** Flag for results clauses that need the JSON to check. **/
+        bool fResults;
+
+
+        /* Compile a statement and its groups, returning the index of its node. */
+        uint32_t compile(const encoding::json& jStatement);
+
+
+        /* Check a node with only the object, and the clauses that need JSON left unknown. */
+        uint8_t object(const uint32_t nNode, const TAO::Register::Object& rObject) const;
+
+
+        /* Check a node with the object and its JSON, either of which can be missing. */
+        bool results(const uint32_t nNode, const TAO::Register::Object* pObject, encoding::json* pResults) const;
+
+
+        /* Check a clause on the object. */
+        bool clause(const Clause& tClause, const TAO::Register::Object& rObject) const;
+
+
+        /* Check a results clause on a JSON value, filtering arrays down to their passing entries. */
+        bool clause(const Clause& tClause, const uint32_t nLevel, encoding::json &jCheck) const;
+
+
+        /* Check if a comparison passes. */
+        bool compare(const Clause& tClause, const int32_t nCompare) const;
+
+    public:
+
+        /** Constructor
+         *
+         *  Compiles the where clause of a request, if there is one.
+         *
+         *  @param[in] jParams The input parameters for the command.
+         *
+         **/
+        Predicate(const encoding::json& jParams);
+
+
+        /** Empty
+         *
+         *  Check if there are no statements to filter by.
+         *
+         **/
+        bool Empty() const;
+
+
+        /** Results
+         *
+         *  Check if any clause may need the JSON to be checked.
+         *
+         **/
+        bool Results() const;
+
+
+        /** Evaluate
+         *
+         *  Check an object register without its JSON. Clauses on results fields other than the register header are
+         *  unknown, and the JSON is only needed if they decide the outcome.
+         *
+         *  @param[in] rObject The object register to check.
+         *
+         *  @return FAIL or MATCH if the outcome is known, UNKNOWN if the JSON has to be checked.
+         *
+         **/
+        uint8_t Evaluate(const TAO::Register::Object& rObject) const;
+
+
+        /** Evaluate
+         *
+         *  Check an object register and its JSON, filtering arrays in the JSON like FilterResults.
+         *
+         *  @param[in] rObject The object register to check.
+         *  @param[out] jResults The JSON of the object register.
+         *
+         *  @return true if the object register should be included in the results.
+         *
+         **/
+        bool Evaluate(const TAO::Register::Object& rObject, encoding::json &jResults) const;
+
+
+        /** Evaluate
+         *
+         *  Check a JSON result that has no object register behind it.
+         *
+         *  @param[out] jResults The JSON to check.
+         *
+         *  @return true if the result should be included.
+         *
+         **/
+        bool Evaluate(encoding::json &jResults) const;
+
+
+        /** EvaluateObject
+         *
+         *  Check an object register that has no JSON, with every clause on the object.
+         *
+         *  @param[in] rObject The object register to check.
+         *
+         *  @return true if the object register should be included.
+         *
+         **/
+        bool EvaluateObject(const TAO::Register::Object& rObject) const;
+    };
+}
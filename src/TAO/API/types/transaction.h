@@ -118,9 +118,13 @@ namespace TAO::API
                 READWRITE(nStatus);
                 READWRITE(hashNextTx);
 
-                /* Reset our cache if deserializing. */
+                /* Reset our cache if deserializing, the kept bytes only cover the base transaction. */
                 if(fRead)
+                {
                     hashCache = 0;
+                    pBytes.reset();
+                    fDecoded  = false;
+                }
             }
         )
 
@@ -53,7 +53,7 @@ namespace TAO
         , vOffsets       ( )
         , vchBlockSig    ( )
         , vMissing       ( )
-        , vMerkleTree    ( )
+        , tMerkleTree    ( )
         , hashMissing    (0)
         , fConflicted    (false)
         {
@@ -73,7 +73,7 @@ namespace TAO
         , vOffsets       (block.vOffsets)
         , vchBlockSig    (block.vchBlockSig)
         , vMissing       (block.vMissing)
-        , vMerkleTree    (block.vMerkleTree)
+        , tMerkleTree    (block.tMerkleTree)
         , hashMissing    (block.hashMissing)
         , fConflicted    (block.fConflicted)
         {
@@ -92,7 +92,7 @@ namespace TAO
         , vOffsets       (std::move(block.vOffsets))
         , vchBlockSig    (std::move(block.vchBlockSig))
         , vMissing       (std::move(block.vMissing))
-        , vMerkleTree    (std::move(block.vMerkleTree))
+        , tMerkleTree    (std::move(block.tMerkleTree))
         , hashMissing    (std::move(block.hashMissing))
         , fConflicted    (std::move(block.fConflicted))
         {
@@ -113,7 +113,7 @@ namespace TAO
             vOffsets       = block.vOffsets;
             vchBlockSig    = block.vchBlockSig;
             vMissing       = block.vMissing;
-            vMerkleTree    = block.vMerkleTree;
+            tMerkleTree    = block.tMerkleTree;
             hashMissing    = block.hashMissing;
             fConflicted    = block.fConflicted;
 
@@ -135,7 +135,7 @@ namespace TAO
             vOffsets       = std::move(block.vOffsets);
             vchBlockSig    = std::move(block.vchBlockSig);
             vMissing       = std::move(block.vMissing);
-            vMerkleTree    = std::move(block.vMerkleTree);
+            tMerkleTree    = std::move(block.tMerkleTree);
             hashMissing    = std::move(block.hashMissing);
 
             fConflicted    = std::move(block.fConflicted);
@@ -162,7 +162,7 @@ namespace TAO
         , vOffsets       ( )
         , vchBlockSig    ( )
         , vMissing       ( )
-        , vMerkleTree    ( )
+        , tMerkleTree    ( )
         , hashMissing    (0)
         , fConflicted    (false)
         {
@@ -291,60 +291,38 @@ namespace TAO
         /* Generate the Merkle Tree from uint512_t hashes. */
         uint512_t Block::BuildMerkleTree(const std::vector<uint512_t>& vtx) const
         {
-            /* Build the in memory cache of merkle tree. */
-            vMerkleTree.clear();
-            for(const auto& hash : vtx)
-                vMerkleTree.push_back(hash);
-
-            /* Compute the merkle root. */
-            uint32_t i = 0;
-            uint32_t j = 0;
-            for(uint32_t nSize = static_cast<uint32_t>(vtx.size()); nSize > 1; nSize = (nSize + 1) >> 1)
-            {
-                for(i = 0; i < nSize; i += 2)
-                {
-                    /* get the references to the left and right leaves in the merkle tree */
-                    const uint512_t& hashLeft  = vMerkleTree[j + i];
-                    const uint512_t& hashRight = vMerkleTree[j + std::min(i + 1, nSize - 1)];
-
-                    vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft),  END(hashLeft),
-                                                     BEGIN(hashRight), END(hashRight)));
-                }
-
-                j += nSize;
-            }
-
-            return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
+            return tMerkleTree.Build(vtx);
         }
 
 
         /* Generate the Merkle Tree from uint512_t hashes. */
         uint512_t Block::BuildMerkleTree(const std::vector<std::pair<uint8_t, uint512_t> >& vtx) const
         {
-            /* Build the in memory cache of merkle tree. */
-            vMerkleTree.clear();
+            /* Strip the transaction types. */
+            std::vector<uint512_t> vHashes;
+            vHashes.reserve(vtx.size());
             for(const auto& hash : vtx)
-                vMerkleTree.push_back(hash.second);
+                vHashes.push_back(hash.second);
 
-            /* Compute the merkle root. */
-            uint32_t i = 0;
-            uint32_t j = 0;
-            for(uint32_t nSize = static_cast<uint32_t>(vtx.size()); nSize > 1; nSize = (nSize + 1) / 2)
-            {
-                for(i = 0; i < nSize; i += 2)
-                {
-                    /* get the references to the left and right leaves in the merkle tree */
-                    const uint512_t& hashLeft  = vMerkleTree[j + i];
-                    const uint512_t& hashRight = vMerkleTree[j + std::min(i + 1, nSize - 1)];
+            return tMerkleTree.Build(vHashes);
+        }
 
-                    vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft),  END(hashLeft),
-                                                     BEGIN(hashRight), END(hashRight)));
-                }
 
-                j += nSize;
+        /* Update one leaf of the cached merkle tree. */
+        uint512_t Block::UpdateMerkleTree(const std::vector<uint512_t>& vtx, const uint32_t nIndex) const
+        {
+            /* The cached tree has to match every other leaf, otherwise rebuild it. */
+            const std::vector<uint512_t>& vLeaves = tMerkleTree.Leaves();
+            if(vLeaves.size() != vtx.size() || nIndex >= vtx.size())
+                return tMerkleTree.Build(vtx);
+
+            for(uint32_t n = 0; n < vtx.size(); ++n)
+            {
+                if(n != nIndex && vLeaves[n] != vtx[n])
+                    return tMerkleTree.Build(vtx);
             }
 
-            return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
+            return tMerkleTree.Update(nIndex, vtx[nIndex]);
         }
 
 
@@ -352,25 +330,10 @@ namespace TAO
         std::vector<uint512_t> Block::GetMerkleBranch(const std::vector<uint512_t>& vtx, uint32_t nIndex) const
         {
             /* Build merkle tree if it's not already built. */
-            if (vMerkleTree.empty())
+            if(tMerkleTree.Size() != vtx.size())
                 BuildMerkleTree(vtx);
 
-            /* Merkle branch to return. */
-            std::vector<uint512_t> vMerkleBranch;
-
-            /* Loop through the transactions to generate merkle path. */
-            uint32_t j = 0;
-            for (uint32_t nSize = vtx.size(); nSize > 1; nSize = (nSize + 1) / 2)
-            {
-                /* Grab the next instance from cached memory. */
-                uint32_t i = std::min(nIndex^1, nSize - 1);
-                vMerkleBranch.push_back(vMerkleTree[j + i]);
-
-                nIndex >>= 1;
-                j += nSize;
-            }
-
-            return vMerkleBranch;
+            return tMerkleTree.Branch(nIndex);
         }
 
 
@@ -378,29 +341,13 @@ namespace TAO
         std::vector<uint512_t> Block::GetMerkleBranch(const std::vector<std::pair<uint8_t, uint512_t>>& vtx, uint32_t nIndex) const
         {
             /* Build merkle tree if it's not already built. */
-            if (vMerkleTree.empty())
+            if(tMerkleTree.Size() != vtx.size())
                 BuildMerkleTree(vtx);
 
-            /* Merkle branch to return. */
-            std::vector<uint512_t> vMerkleBranch;
-
-            /* Loop through the transactions to generate merkle path. */
-            uint32_t j = 0;
-            for (uint32_t nSize = vtx.size(); nSize > 1; nSize = (nSize + 1) / 2)
-            {
-                /* Grab the next instance from cached memory. */
-                uint32_t i = std::min(nIndex^1, nSize - 1);
-                vMerkleBranch.push_back(vMerkleTree[j + i]);
-
-                nIndex >>= 1;
-                j += nSize;
-            }
-
-            return vMerkleBranch;
+            return tMerkleTree.Branch(nIndex);
         }
 
 
-
         /* Check the merkle branch of a transaction at given index. */
         uint512_t Block::CheckMerkleBranch(const uint512_t& hash, const std::vector<uint512_t>& vMerkleBranch, uint32_t nIndex)
         {
@@ -23,6 +23,9 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/genesis_block.h>
 #include <TAO/Ledger/include/timelocks.h>
 
+#include <TAO/Ledger/types/header_index.h>
+#include <TAO/Ledger/types/metrics.h>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -236,7 +239,11 @@ namespace TAO
 
                             /* Set the best to older block. */
                             LLD::TxnBegin();
-                            stateAncestor.SetBest();
+                            if(!stateAncestor.SetBest())
+                            {
+                                LLD::TxnAbort();
+                                return debug::error(FUNCTION, "failed to revert to hardcoded ancestor");
+                            }
                             LLD::TxnCommit();
 
                             break;
@@ -265,13 +272,23 @@ namespace TAO
 
                 /* Set the best to older block. */
                 LLD::TxnBegin();
-                state.SetBest();
+                if(!state.SetBest())
+                {
+                    LLD::TxnAbort();
+                    return debug::error(FUNCTION, "failed to rewind ", nForkblocks, " blocks");
+                }
                 LLD::TxnCommit();
 
                 /* Debug Output. */
                 debug::log(0, FUNCTION, "-forkblocks=XXX requested removal of ", nForkblocks, " blocks");
             }
 
+            /* Load the most recent headers into memory. */
+            headers.Load(tStateBest.load(), config::GetArg("-headerindex", 10000));
+
+            /* Load the running metrics of the chain, counting them again if they aren't as of the best block. */
+            aggregator.Load(tStateBest.load().GetHash(), config::GetArg("-metricsheights", 100000));
+
             /* Fill out the best chain stats. */
             nBestHeight     = tStateBest.load().nHeight;
             nBestChainTrust = tStateBest.load().nChainTrust;
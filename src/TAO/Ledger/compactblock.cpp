@@ -0,0 +1,241 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+
+#include <LLD/hash/xxh3.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Ledger/types/compactblock.h>
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Util/include/runtime.h>
+#include <Util/templates/datastream.h>
+
+#include <map>
+#include <set>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* Default constructor. */
+        CompactBlock::CompactBlock()
+        : Block    ( )
+        , nTime    (runtime::unifiedtimestamp())
+        , producer ( )
+        , ssSystem ( )
+        , vShort   ( )
+        {
+        }
+
+
+        /* Copy constructor. */
+        CompactBlock::CompactBlock(const CompactBlock& block)
+        : Block    (block)
+        , nTime    (block.nTime)
+        , producer (block.producer)
+        , ssSystem (block.ssSystem)
+        , vShort   (block.vShort)
+        {
+        }
+
+
+        /* Move constructor. */
+        CompactBlock::CompactBlock(CompactBlock&& block) noexcept
+        : Block    (std::move(block))
+        , nTime    (std::move(block.nTime))
+        , producer (std::move(block.producer))
+        , ssSystem (std::move(block.ssSystem))
+        , vShort   (std::move(block.vShort))
+        {
+        }
+
+
+        /* Copy assignment. */
+        CompactBlock& CompactBlock::operator=(const CompactBlock& block)
+        {
+            nVersion       = block.nVersion;
+            hashPrevBlock  = block.hashPrevBlock;
+            hashMerkleRoot = block.hashMerkleRoot;
+            nChannel       = block.nChannel;
+            nHeight        = block.nHeight;
+            nBits          = block.nBits;
+            nNonce         = block.nNonce;
+            vOffsets       = block.vOffsets;
+            vchBlockSig    = block.vchBlockSig;
+            vMissing       = block.vMissing;
+            hashMissing    = block.hashMissing;
+            fConflicted    = block.fConflicted;
+
+            nTime          = block.nTime;
+            producer       = block.producer;
+            ssSystem       = block.ssSystem;
+            vShort         = block.vShort;
+
+            return *this;
+        }
+
+
+        /* Move assignment. */
+        CompactBlock& CompactBlock::operator=(CompactBlock&& block) noexcept
+        {
+            nVersion       = std::move(block.nVersion);
+            hashPrevBlock  = std::move(block.hashPrevBlock);
+            hashMerkleRoot = std::move(block.hashMerkleRoot);
+            nChannel       = std::move(block.nChannel);
+            nHeight        = std::move(block.nHeight);
+            nBits          = std::move(block.nBits);
+            nNonce         = std::move(block.nNonce);
+            vOffsets       = std::move(block.vOffsets);
+            vchBlockSig    = std::move(block.vchBlockSig);
+            vMissing       = std::move(block.vMissing);
+            hashMissing    = std::move(block.hashMissing);
+            fConflicted    = std::move(block.fConflicted);
+
+            nTime          = std::move(block.nTime);
+            producer       = std::move(block.producer);
+            ssSystem       = std::move(block.ssSystem);
+            vShort         = std::move(block.vShort);
+
+            return *this;
+        }
+
+
+        /* Destructor. */
+        CompactBlock::~CompactBlock()
+        {
+        }
+
+
+        /* Copy Constructor. */
+        CompactBlock::CompactBlock(const TritiumBlock& block)
+        : Block    (block)
+        , nTime    (block.nTime)
+        , producer (block.producer)
+        , ssSystem (block.ssSystem)
+        , vShort   ( )
+        {
+            /* Key the short ids by the block hash. */
+            const uint1024_t hashBlock = block.GetHash();
+
+            vShort.reserve(block.vtx.size());
+            for(const auto& proof : block.vtx)
+                vShort.push_back(std::make_pair(proof.first, ShortID(hashBlock, proof.second)));
+        }
+
+
+        /* Copy Constructor. */
+        CompactBlock::CompactBlock(const BlockState& state)
+        : CompactBlock(TritiumBlock(state))
+        {
+        }
+
+
+        /* Get the Signature Hash of the block, the same as the tritium block it was built from. */
+        uint1024_t CompactBlock::SignatureHash() const
+        {
+            /* Create a data stream to get the hash. */
+            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
+            ss.reserve(256);
+
+            /* Serialize the data to hash into a stream. */
+            ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << nTime << vOffsets;
+
+            return LLC::SK1024(ss.begin(), ss.end());
+        }
+
+
+        /* Get the short id of a transaction in a given block. */
+        uint64_t CompactBlock::ShortID(const uint1024_t& hashBlock, const uint512_t& hashTx)
+        {
+            return XXH64(hashTx.begin(), 64, hashBlock.Get64(0) ^ hashBlock.Get64(1));
+        }
+
+
+        /* Rebuild the full tritium block from a pool of known transactions. */
+        bool CompactBlock::Reconstruct(const std::vector<std::pair<uint8_t, uint512_t> >& vPool,
+                                       TritiumBlock &block, std::vector<uint32_t> &vMissing) const
+        {
+            /* Get the key for our short ids. */
+            const uint1024_t hashBlock = GetHash();
+
+            /* Only track the short ids in this block, so the pool is one pass without storing every id. */
+            std::map<std::pair<uint8_t, uint64_t>, uint512_t> mapFound;
+            for(const auto& id : vShort)
+                mapFound.emplace(id, uint512_t(0));
+
+            /* Match the pool against them, keeping ids that more than one transaction maps to. */
+            std::set<std::pair<uint8_t, uint64_t>> setAmbiguous;
+            for(const auto& tx : vPool)
+            {
+                auto it = mapFound.find(std::make_pair(tx.first, ShortID(hashBlock, tx.second)));
+                if(it == mapFound.end())
+                    continue;
+
+                if(it->second != 0 && it->second != tx.second)
+                    setAmbiguous.insert(it->first);
+
+                it->second = tx.second;
+            }
+
+            /* Copy the header. */
+            block.nVersion       = nVersion;
+            block.hashPrevBlock  = hashPrevBlock;
+            block.hashMerkleRoot = hashMerkleRoot;
+            block.nChannel       = nChannel;
+            block.nHeight        = nHeight;
+            block.nBits          = nBits;
+            block.nNonce         = nNonce;
+            block.vOffsets       = vOffsets;
+            block.vchBlockSig    = vchBlockSig;
+            block.nTime          = nTime;
+            block.producer       = producer;
+            block.ssSystem       = ssSystem;
+
+            /* Fill in the transactions we know. */
+            block.vtx.clear();
+            block.vtx.reserve(vShort.size());
+
+            vMissing.clear();
+            for(uint32_t n = 0; n < vShort.size(); ++n)
+            {
+                const uint512_t& hashTx = mapFound[vShort[n]];
+                if(hashTx == 0 || setAmbiguous.count(vShort[n]))
+                    vMissing.push_back(n);
+
+                block.vtx.push_back(std::make_pair(vShort[n].first, hashTx));
+            }
+
+            /* Check for missing transactions. */
+            if(!vMissing.empty())
+                return false;
+
+            /* Check the merkle root, which catches an id collision with a transaction that isn't in the block. */
+            std::vector<uint512_t> vHashes;
+            vHashes.reserve(block.vtx.size() + 1);
+            for(const auto& proof : block.vtx)
+                vHashes.push_back(proof.second);
+
+            vHashes.push_back(producer.GetHash());
+
+            return (hashMerkleRoot == block.BuildMerkleTree(vHashes));
+        }
+    }
+}
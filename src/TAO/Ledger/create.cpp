@@ -16,6 +16,7 @@ ________________________________________________________________________________
 #include <Legacy/types/transaction.h>
 #include <Legacy/types/legacy.h>
 
+#include <LLC/include/argon2.h>
 #include <LLC/types/bignum.h>
 #include <TAO/Register/types/address.h>
 #include <LLC/types/uint1024.h>
@@ -382,6 +383,9 @@ namespace TAO::Ledger
         /* Get the session */
         const uint256_t hashGenesis = user->Genesis();
 
+        /* Our producer's keys don't queue behind logins. */
+        const LLC::Argon2Priority tPriority;
+
         /* Only allow prime, hash, and private channels. */
         if(nChannel < 1 || nChannel > 3)
             return debug::error(FUNCTION, "Invalid channel: ", nChannel);
@@ -448,8 +452,8 @@ namespace TAO::Ledger
             /* Producer transaction is last. */
             vHashes.push_back(rBlockRet.producer.GetHash(true));
 
-            /* Build the block's merkle root. */
-            rBlockRet.hashMerkleRoot = rBlockRet.BuildMerkleTree(vHashes);
+            /* Only the producer changed, so rehash its path in the cached merkle tree. */
+            rBlockRet.hashMerkleRoot = rBlockRet.UpdateMerkleTree(vHashes, static_cast<uint32_t>(vHashes.size() - 1));
         }
         else //block not cached, set up new block
         {
@@ -31,6 +31,8 @@ ________________________________________________________________________________
 
 #include <Util/include/debug.h>
 
+#include <future>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -45,6 +47,7 @@ namespace TAO
         , strPassword (sigchain.strPassword)
         , MUTEX       ( )
         , pairCache   (sigchain.pairCache)
+        , mapKeys     (sigchain.mapKeys)
         , hashGenesis (sigchain.hashGenesis)
         {
         }
@@ -56,6 +59,7 @@ namespace TAO
         , strPassword (std::move(sigchain.strPassword.c_str()))
         , MUTEX       ( )
         , pairCache   (std::move(sigchain.pairCache))
+        , mapKeys     (std::move(sigchain.mapKeys))
         , hashGenesis (std::move(sigchain.hashGenesis))
         {
         }
@@ -73,6 +77,7 @@ namespace TAO
         , strPassword (strPasswordIn.c_str())
         , MUTEX       ( )
         , pairCache   (std::make_pair(std::numeric_limits<uint32_t>::max(), ""))
+        , mapKeys     ( )
         , hashGenesis (Credentials::Genesis(strUsernameIn))
         {
         }
@@ -238,6 +243,30 @@ namespace TAO
         /* This function is responsible for genearting the private key in the keychain of a specific account. */
         uint512_t Credentials::Generate(const std::string& strType, const uint32_t nKeyID, const SecureString& strSecret) const
         {
+            /* Our cache holds a hash of the secret, salted by our genesis, rather than the secret itself. */
+            std::vector<uint8_t> vCheck(strSecret.begin(), strSecret.end());
+            vCheck.insert(vCheck.end(), hashGenesis.begin(), hashGenesis.end());
+
+            const uint256_t hashSecret = LLC::SK256(vCheck);
+            {
+                LOCK(MUTEX);
+
+                /* Check our key cache, only valid if derived with the same secret. */
+                const auto it = mapKeys.find(std::make_pair(strType, nKeyID));
+                if(it != mapKeys.end() && it->second.first == hashSecret)
+                {
+                    /* Get the bytes from secure allocator. */
+                    const std::vector<uint8_t> vBytes =
+                        std::vector<uint8_t>(it->second.second.begin(), it->second.second.end());
+
+                    /* Set the bytes of return value. */
+                    uint512_t hashKey;
+                    hashKey.SetBytes(vBytes);
+
+                    return hashKey;
+                }
+            }
+
             /* Generate the Secret Phrase */
             std::vector<uint8_t> vUsername(strUsername.begin(), strUsername.end());
             vUsername.insert(vUsername.end(), (uint8_t*)&nKeyID, (uint8_t*)&nKeyID + sizeof(nKeyID));
@@ -262,10 +291,43 @@ namespace TAO
                             std::max(1u, uint32_t(config::GetArg("-argon2", 12))),
                             uint32_t(1 << std::max(4u, uint32_t(config::GetArg("-argon2_memory", 16)))));
 
+            /* Set the cache items. */
+            {
+                LOCK(MUTEX);
+
+                /* Keep our cache bounded, there are only a handful of key types per sigchain. */
+                if(mapKeys.size() >= 16)
+                    mapKeys.clear();
+
+                /* Grab our key's binary data. */
+                const std::vector<uint8_t> vBytes = hashKey.GetBytes();
+
+                /* Set our cache record now with it. */
+                mapKeys[std::make_pair(strType, nKeyID)] =
+                    std::make_pair(hashSecret, SecureString(vBytes.begin(), vBytes.end()));
+            }
+
             return hashKey;
         }
 
 
+        /* Derives the private keys for the given key types concurrently and stores them in the key cache. */
+        void Credentials::Prepare(const std::vector<std::string>& vTypes, const uint32_t nKeyID, const SecureString& strSecret) const
+        {
+            /* Launch a derivation per key type, bounded by the argon2 slot limit. */
+            std::vector<std::future<uint512_t>> vDerive;
+            for(const auto& strType : vTypes)
+                vDerive.push_back(std::async(std::launch::async, [this, strType, nKeyID, &strSecret]
+                {
+                    return Generate(strType, nKeyID, strSecret);
+                }));
+
+            /* Wait for our keys, this will rethrow any argon2 failures. */
+            for(auto& tDerive : vDerive)
+                tDerive.get();
+        }
+
+
         /* This function version using far stronger argon2 hashing since the only data input is the seed phrase itself. */
         uint512_t Credentials::Generate(const SecureString& strSecret) const
         {
@@ -317,6 +379,7 @@ namespace TAO
             };
 
             /* Run the argon2 computation. */
+            const LLC::Argon2Slot tSlot;
             int32_t nRet = argon2id_ctx(&context);
             if(nRet != ARGON2_OK)
                 throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
@@ -487,6 +550,10 @@ namespace TAO
         void Credentials::Update(const SecureString& strPasswordNew)
         {
             strPassword = strPasswordNew.c_str();
+
+            /* Our typed keys are seeded by the password, so they are no longer valid. */
+            LOCK(MUTEX);
+            mapKeys.clear();
         }
 
 
@@ -497,6 +564,13 @@ namespace TAO
             encrypt(strPassword);
             encrypt(pairCache);
             encrypt(hashGenesis);
+
+            /* Our typed keys are held the same as our sequence key. */
+            for(const auto& pairKey : mapKeys)
+            {
+                encrypt(pairKey.second.first);
+                encrypt(pairKey.second.second);
+            }
         }
 
 
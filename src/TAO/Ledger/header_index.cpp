@@ -0,0 +1,380 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLD/include/global.h>
+
+#include <TAO/Ledger/types/header_index.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+#include <algorithm>
+#include <unordered_set>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        HeaderIndex headers;
+
+
+        /* Get the compact header of a block state, without any links. */
+        static HeaderIndex::Header compact_header(const BlockState& state)
+        {
+            HeaderIndex::Header header;
+            header.hash        = state.GetHash();
+            header.nHeight     = state.nHeight;
+            header.nChannel    = state.GetChannel();
+            header.nBits       = state.nBits;
+            header.nTime       = state.GetBlockTime();
+            header.nChainTrust = state.nChainTrust;
+            header.pprev       = nullptr;
+            header.pnext       = nullptr;
+
+            for(uint32_t n = 0; n < HeaderIndex::CHANNELS; ++n)
+                header.plast[n] = nullptr;
+
+            return header;
+        }
+
+
+        /* Constructor */
+        HeaderIndex::HeaderIndex(const uint32_t nMaxIn)
+        : MUTEX       ( )
+        , mapHeaders  ( )
+        , nMaxHeights (nMaxIn)
+        , nTop        (0)
+        , nFloor      (0)
+        {
+        }
+
+
+        /* Find a header by hash, or nullptr if it isn't indexed. */
+        HeaderIndex::Header* HeaderIndex::find(const uint1024_t& hash)
+        {
+            auto it = mapHeaders.find(hash);
+            if(it == mapHeaders.end())
+                return nullptr;
+
+            return &it->second;
+        }
+
+
+        /* Find a header by hash, or nullptr if it isn't indexed. */
+        const HeaderIndex::Header* HeaderIndex::find(const uint1024_t& hash) const
+        {
+            auto it = mapHeaders.find(hash);
+            if(it == mapHeaders.end())
+                return nullptr;
+
+            return &it->second;
+        }
+
+
+        /* Add a header, linked to its previous block if it is indexed. */
+        HeaderIndex::Header* HeaderIndex::insert(const Header& header, const uint1024_t& hashPrev)
+        {
+            /* Headers never change once indexed. */
+            Header* pheader = find(header.hash);
+            if(pheader)
+                return pheader;
+
+            /* The nodes of the map don't move, so the links stay valid until the header is removed. */
+            pheader = &mapHeaders.emplace(header.hash, header).first->second;
+            pheader->pprev = (hashPrev == 0 ? nullptr : find(hashPrev));
+            pheader->pnext = nullptr;
+
+            /* Carry the last block of every channel over from the previous block. */
+            for(uint32_t n = 0; n < CHANNELS; ++n)
+                pheader->plast[n] = (pheader->pprev ? pheader->pprev->plast[n] : nullptr);
+
+            if(pheader->nChannel < CHANNELS)
+                pheader->plast[pheader->nChannel] = pheader;
+
+            /* Track the range of heights. */
+            if(mapHeaders.size() == 1)
+                nFloor = pheader->nHeight;
+
+            nTop   = std::max(nTop, pheader->nHeight);
+            nFloor = std::min(nFloor, pheader->nHeight);
+
+            return pheader;
+        }
+
+
+        /* Remove headers, clearing every link to them. */
+        void HeaderIndex::remove(const std::vector<uint1024_t>& vHashes)
+        {
+            /* Get the headers being removed. */
+            std::unordered_set<const Header*> setRemove;
+            for(const auto& hash : vHashes)
+            {
+                const Header* pheader = find(hash);
+                if(pheader)
+                    setRemove.insert(pheader);
+            }
+
+            if(setRemove.empty())
+                return;
+
+            /* Clear the links from the headers that remain. */
+            for(auto& item : mapHeaders)
+            {
+                Header& header = item.second;
+                if(setRemove.count(&header))
+                    continue;
+
+                if(setRemove.count(header.pprev))
+                    header.pprev = nullptr;
+
+                if(setRemove.count(header.pnext))
+                    header.pnext = nullptr;
+
+                for(uint32_t n = 0; n < CHANNELS; ++n)
+                {
+                    if(setRemove.count(header.plast[n]))
+                        header.plast[n] = nullptr;
+                }
+            }
+
+            for(const auto& pheader : setRemove)
+                mapHeaders.erase(pheader->hash);
+        }
+
+
+        /* Remove the headers that have fallen out of the most recent heights. */
+        void HeaderIndex::prune()
+        {
+            /* Let the index grow by an eighth before pruning, so the links are cleared in batches. */
+            if(nTop < nFloor + nMaxHeights + std::max(1u, nMaxHeights / 8))
+                return;
+
+            /* Keep the most recent heights. */
+            const uint32_t nKeep = nTop - nMaxHeights + 1;
+
+            std::vector<uint1024_t> vRemove;
+            for(const auto& item : mapHeaders)
+            {
+                if(item.second.nHeight < nKeep)
+                    vRemove.push_back(item.first);
+            }
+
+            remove(vRemove);
+            nFloor = nKeep;
+        }
+
+
+        /* Fill the index from the ledger, walking back from the best block. */
+        uint32_t HeaderIndex::Load(const BlockState& stateBest, const uint32_t nMaxIn)
+        {
+            {
+                LOCK(MUTEX);
+
+                mapHeaders.clear();
+                nMaxHeights = nMaxIn;
+                nTop        = 0;
+                nFloor      = 0;
+            }
+
+            if(nMaxIn == 0 || stateBest.IsNull())
+                return 0;
+
+            runtime::timer timer;
+            timer.Start();
+
+            /* Read the compact headers back from the best block. */
+            std::vector<std::pair<Header, uint1024_t>> vHeaders;
+            vHeaders.push_back(std::make_pair(compact_header(stateBest), stateBest.hashPrevBlock));
+
+            BlockState state = stateBest;
+            while(vHeaders.size() < nMaxIn && state.hashPrevBlock != 0)
+            {
+                if(!LLD::Ledger->ReadBlock(state.hashPrevBlock, state))
+                    break;
+
+                vHeaders.push_back(std::make_pair(compact_header(state), state.hashPrevBlock));
+            }
+
+            /* Link them up from the oldest, along the best chain. */
+            LOCK(MUTEX);
+            mapHeaders.reserve(vHeaders.size());
+            for(auto it = vHeaders.rbegin(); it != vHeaders.rend(); ++it)
+            {
+                Header* pheader = insert(it->first, it->second);
+                if(pheader->pprev)
+                    pheader->pprev->pnext = pheader;
+            }
+
+            debug::log(0, FUNCTION, "Loaded ", mapHeaders.size(), " headers in ", timer.ElapsedMilliseconds(), " ms");
+
+            return static_cast<uint32_t>(mapHeaders.size());
+        }
+
+
+        /* Add the header of a block state that was written to the ledger. */
+        void HeaderIndex::Insert(const BlockState& state)
+        {
+            LOCK(MUTEX);
+
+            if(nMaxHeights == 0)
+                return;
+
+            insert(compact_header(state), state.hashPrevBlock);
+            prune();
+        }
+
+
+        /* Link a block as the next block of its previous block. */
+        void HeaderIndex::Connect(const uint1024_t& hash)
+        {
+            LOCK(MUTEX);
+
+            Header* pheader = find(hash);
+            if(pheader && pheader->pprev)
+                pheader->pprev->pnext = pheader;
+        }
+
+
+        /* Unlink a block from being the next block of its previous block. */
+        void HeaderIndex::Disconnect(const uint1024_t& hash)
+        {
+            LOCK(MUTEX);
+
+            Header* pheader = find(hash);
+            if(pheader && pheader->pprev && pheader->pprev->pnext == pheader)
+                pheader->pprev->pnext = nullptr;
+        }
+
+
+        /* Remove the header of a block erased from the ledger. */
+        void HeaderIndex::Erase(const uint1024_t& hash)
+        {
+            LOCK(MUTEX);
+            remove(std::vector<uint1024_t>(1, hash));
+        }
+
+
+        /* Check if a block is indexed. */
+        bool HeaderIndex::Has(const uint1024_t& hash) const
+        {
+            LOCK(MUTEX);
+            return find(hash) != nullptr;
+        }
+
+
+        /* Get the next block in the best chain. */
+        bool HeaderIndex::Next(const uint1024_t& hash, uint1024_t &hashNext) const
+        {
+            LOCK(MUTEX);
+
+            const Header* pheader = find(hash);
+            if(!pheader || !pheader->pnext)
+                return false;
+
+            hashNext = pheader->pnext->hash;
+
+            return true;
+        }
+
+
+        /* Get the last block of a channel at or before a block, not counting the genesis. */
+        bool HeaderIndex::Last(const uint1024_t& hash, const uint32_t nChannel, uint1024_t &hashLast) const
+        {
+            if(nChannel >= CHANNELS)
+                return false;
+
+            LOCK(MUTEX);
+
+            const Header* pheader = find(hash);
+            if(!pheader)
+                return false;
+
+            /* The genesis is left for the ledger walk, which reports it as not found. */
+            const Header* plast = pheader->plast[nChannel];
+            if(!plast || plast->nHeight == 0)
+                return false;
+
+            hashLast = plast->hash;
+
+            return true;
+        }
+
+
+        /* Find the blocks to disconnect and connect to move the best chain to a new block. */
+        bool HeaderIndex::Fork(const uint1024_t& hashBest, const uint1024_t& hashNew,
+                               std::vector<uint1024_t> &vDisconnect, std::vector<uint1024_t> &vConnect, uint1024_t &hashFork) const
+        {
+            LOCK(MUTEX);
+
+            const Header* pfork   = find(hashBest);
+            const Header* plonger = find(hashNew);
+            if(!pfork || !plonger)
+                return false;
+
+            vDisconnect.clear();
+            vConnect.clear();
+            while(pfork != plonger)
+            {
+                /* Find the root block in common. */
+                while(plonger->nHeight > pfork->nHeight)
+                {
+                    vConnect.push_back(plonger->hash);
+
+                    plonger = plonger->pprev;
+                    if(!plonger)
+                        return false;
+                }
+
+                /* Break if found. */
+                if(pfork == plonger)
+                    break;
+
+                /* Iterate backwards to find fork. */
+                vDisconnect.push_back(pfork->hash);
+
+                pfork = pfork->pprev;
+                if(!pfork)
+                    return false;
+            }
+
+            hashFork = pfork->hash;
+
+            return true;
+        }
+
+
+        /* Get the number of headers indexed. */
+        uint32_t HeaderIndex::Size() const
+        {
+            LOCK(MUTEX);
+            return static_cast<uint32_t>(mapHeaders.size());
+        }
+
+
+        /* Remove all headers. */
+        void HeaderIndex::Clear()
+        {
+            LOCK(MUTEX);
+
+            mapHeaders.clear();
+            nTop   = 0;
+            nFloor = 0;
+        }
+    }
+}
@@ -17,6 +17,8 @@ ________________________________________________________________________________
 
 #include <LLC/types/uint1024.h>
 
+#include <vector>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -102,6 +104,17 @@ namespace TAO
         bool PrimeCheck(const uint1024_t& hashTest);
 
 
+        /** PrimeCheck
+         *
+         *  Determines if each of the given numbers is prime, running the fermat tests as one batch.
+         *
+         *	@param[in] vTest The numbers to test for primality
+         *  @param[out] vPrime True for each number that passes prime tests.
+         *
+         **/
+        void PrimeCheck(const std::vector<uint1024_t>& vTest, std::vector<bool> &vPrime);
+
+
         /** FermatTest
          *
          *  Used after Miller-Rabin and Divisor tests to verify primality.
@@ -16,6 +16,8 @@ ________________________________________________________________________________
 
 #include <LLD/include/global.h>
 
+#include <TAO/API/types/cache.h>
+
 #include <TAO/Operation/include/execute.h>
 #include <TAO/Operation/include/enum.h>
 #include <TAO/Operation/types/contract.h>
@@ -28,6 +30,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/types/mempool.h>
 
 #include <TAO/Ledger/include/create.h>
+#include <TAO/Ledger/include/enum.h>
 
 
 /* Global TAO namespace. */
@@ -214,6 +217,9 @@ namespace TAO
                 /* Set the internal memory. */
                 mapLedger[hashTx] = tx;
 
+                /* Drop cached API results that depend on what this transaction touched. */
+                TAO::API::ResultCache::Invalidate(tx);
+
                 /* Update map claimed if not first tx. */
                 if(!tx.IsFirst())
                     mapClaimed[tx.hashPrevTx] = hashTx;
@@ -458,6 +464,9 @@ namespace TAO
                 /* Get a reference from the map. */
                 const TAO::Ledger::Transaction& tx = mapLedger[hashTx];
 
+                /* Drop cached API results that depend on what this transaction touched. */
+                TAO::API::ResultCache::Invalidate(tx);
+
                 /* Erase from the memory map. */
                 mapClaimed.erase(tx.hashPrevTx);
                 mapOrphans.erase(tx.hashPrevTx);
@@ -726,6 +735,29 @@ namespace TAO
         }
 
 
+        /* Get the type and hash of every transaction in the pool, including conflicted ones. */
+        void Mempool::Hashes(std::vector<std::pair<uint8_t, uint512_t>> &vtx) const
+        {
+            RECURSIVE(MUTEX);
+
+            vtx.reserve(vtx.size() + mapLedger.size() + mapConflicts.size() + mapLegacy.size() + mapLegacyConflicts.size());
+
+            /* Add the tritium transactions. */
+            for(const auto& tx : mapLedger)
+                vtx.emplace_back(TRANSACTION::TRITIUM, tx.first);
+
+            for(const auto& tx : mapConflicts)
+                vtx.emplace_back(TRANSACTION::TRITIUM, tx.first);
+
+            /* Add the legacy transactions. */
+            for(const auto& tx : mapLegacy)
+                vtx.emplace_back(TRANSACTION::LEGACY, tx.first);
+
+            for(const auto& tx : mapLegacyConflicts)
+                vtx.emplace_back(TRANSACTION::LEGACY, tx.first);
+        }
+
+
         /* Gets the size of the memory pool. */
         uint32_t Mempool::Size()
         {
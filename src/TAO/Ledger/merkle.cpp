@@ -12,15 +12,19 @@
 ____________________________________________________________________________________________*/
 
 #include <LLD/include/global.h>
+#include <LLD/cache/template_lru.h>
 
 #include <TAO/API/include/execute.h>
 
 #include <TAO/Register/include/unpack.h>
 
 #include <TAO/Ledger/types/merkle.h>
+#include <TAO/Ledger/types/merkle_tree.h>
 #include <TAO/Ledger/types/state.h>
 #include <TAO/Ledger/types/client.h>
 
+#include <memory>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -29,6 +33,10 @@ namespace TAO
     namespace Ledger
     {
 
+        /* Merkle trees of recently proven blocks, so every transaction of a block shares one build. */
+        LLD::TemplateLRU<uint1024_t, std::shared_ptr<MerkleTree>> cacheMerkle(32);
+
+
         /* The default constructor. */
         MerkleTx::MerkleTx()
         : Transaction   ( )
@@ -203,8 +211,23 @@ namespace TAO
             if(nIndex == state.vtx.size())
                 return false;
 
+            /* Get the block's merkle tree, building it if this block isn't cached. */
+            const uint1024_t hashState = state.GetHash();
+
+            std::shared_ptr<MerkleTree> pTree;
+            if(!cacheMerkle.Get(hashState, pTree) || pTree->Size() != state.vtx.size())
+            {
+                std::vector<uint512_t> vHashes;
+                vHashes.reserve(state.vtx.size());
+                for(const auto& proof : state.vtx)
+                    vHashes.push_back(proof.second);
+
+                pTree = std::make_shared<MerkleTree>(vHashes);
+                cacheMerkle.Put(hashState, pTree);
+            }
+
             /* Build merkle branch. */
-            vMerkleBranch = state.GetMerkleBranch(state.vtx, nIndex);
+            vMerkleBranch = pTree->Branch(nIndex);
 
             return true;
         }
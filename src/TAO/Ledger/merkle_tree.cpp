@@ -0,0 +1,248 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+
+#include <TAO/Ledger/types/merkle_tree.h>
+
+#include <Util/include/debug.h>
+
+#include <algorithm>
+#include <future>
+#include <thread>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        namespace
+        {
+            /* Levels with fewer pairs than this per thread are hashed on the calling thread. */
+            const uint32_t MERKLE_CHUNK_PAIRS = 1024;
+
+
+            /* Hash node nIndex of the level above from its pair on this level. */
+            uint512_t merkle_node(const std::vector<uint512_t>& vLevel, const uint32_t nIndex)
+            {
+                const uint512_t& hashLeft  = vLevel[nIndex * 2];
+                const uint512_t& hashRight = vLevel[std::min(nIndex * 2 + 1, static_cast<uint32_t>(vLevel.size()) - 1)];
+
+                return LLC::SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashRight), END(hashRight));
+            }
+
+
+            /* Hash a whole level into the level above. */
+            void merkle_level(const std::vector<uint512_t>& vLevel, std::vector<uint512_t> &vNext)
+            {
+                const uint32_t nSize  = static_cast<uint32_t>(vLevel.size());
+                const uint32_t nPairs = nSize / 2;
+
+                vNext.resize((nSize + 1) / 2);
+
+                /* Split large levels into one chunk per thread, the pairs sit back to back so each chunk is one batch. */
+                const uint32_t nThreads = std::min(std::max(1u, std::thread::hardware_concurrency()), std::max(1u, nPairs / MERKLE_CHUNK_PAIRS));
+                if(nThreads > 1)
+                {
+                    const uint32_t nChunk = (nPairs + nThreads - 1) / nThreads;
+
+                    std::vector<std::future<void>> vJobs;
+                    for(uint32_t nBegin = 0; nBegin < nPairs; nBegin += nChunk)
+                    {
+                        const uint32_t nCount = std::min(nChunk, nPairs - nBegin);
+                        vJobs.push_back(std::async(std::launch::async, [&vLevel, &vNext, nBegin, nCount]()
+                        {
+                            LLC::SK512((uint8_t *)&vLevel[nBegin * 2], 128, nCount, &vNext[nBegin]);
+                        }));
+                    }
+
+                    for(auto& job : vJobs)
+                        job.get();
+                }
+                else if(nPairs > 0)
+                    LLC::SK512((uint8_t *)&vLevel[0], 128, nPairs, &vNext[0]);
+
+                /* An odd node out is hashed with itself. */
+                if(nSize & 1)
+                    vNext[nPairs] = merkle_node(vLevel, nPairs);
+            }
+        }
+
+
+        /* Default Constructor. */
+        MerkleTree::MerkleTree()
+        : vLevels (1)
+        {
+        }
+
+
+        /* Copy Constructor. */
+        MerkleTree::MerkleTree(const MerkleTree& tree)
+        : vLevels (tree.vLevels)
+        {
+        }
+
+
+        /* Move Constructor. */
+        MerkleTree::MerkleTree(MerkleTree&& tree) noexcept
+        : vLevels (std::move(tree.vLevels))
+        {
+            tree.vLevels.resize(1);
+        }
+
+
+        /* Copy Assignment Operator */
+        MerkleTree& MerkleTree::operator=(const MerkleTree& tree)
+        {
+            vLevels = tree.vLevels;
+
+            return *this;
+        }
+
+
+        /* Move Assignment Operator */
+        MerkleTree& MerkleTree::operator=(MerkleTree&& tree) noexcept
+        {
+            vLevels = std::move(tree.vLevels);
+            tree.vLevels.resize(1);
+
+            return *this;
+        }
+
+
+        /* Destructor. */
+        MerkleTree::~MerkleTree()
+        {
+        }
+
+
+        /* Build a tree from a list of leaves. */
+        MerkleTree::MerkleTree(const std::vector<uint512_t>& vLeaves)
+        : vLevels (1)
+        {
+            Build(vLeaves);
+        }
+
+
+        /* Build the tree from a list of leaves, replacing anything already held. */
+        uint512_t MerkleTree::Build(const std::vector<uint512_t>& vLeaves)
+        {
+            vLevels.assign(1, vLeaves);
+
+            /* Hash each level into the next until one node is left. */
+            while(vLevels.back().size() > 1)
+            {
+                vLevels.emplace_back();
+                merkle_level(vLevels[vLevels.size() - 2], vLevels.back());
+            }
+
+            return Root();
+        }
+
+
+        /* Add a leaf to the end of the tree, recomputing the right edge only. */
+        uint512_t MerkleTree::Append(const uint512_t& hashLeaf)
+        {
+            vLevels[0].push_back(hashLeaf);
+
+            /* Only the last node of every level above can change. */
+            for(uint32_t nLevel = 0; vLevels[nLevel].size() > 1; ++nLevel)
+            {
+                if(vLevels.size() == nLevel + 1)
+                    vLevels.emplace_back();
+
+                /* Replace the last parent, or add one if this level grew an odd node. */
+                const uint32_t nParent = static_cast<uint32_t>(vLevels[nLevel].size() - 1) / 2;
+                const uint512_t hashNode = merkle_node(vLevels[nLevel], nParent);
+
+                std::vector<uint512_t>& vNext = vLevels[nLevel + 1];
+                if(nParent < vNext.size())
+                    vNext[nParent] = hashNode;
+                else
+                    vNext.push_back(hashNode);
+            }
+
+            return Root();
+        }
+
+
+        /* Replace a leaf, recomputing its path to the root only. */
+        uint512_t MerkleTree::Update(const uint32_t nIndex, const uint512_t& hashLeaf)
+        {
+            /* Check the leaf is in range. */
+            if(nIndex >= vLevels[0].size())
+                throw debug::exception(FUNCTION, "leaf ", nIndex, " out of range of ", vLevels[0].size());
+
+            vLevels[0][nIndex] = hashLeaf;
+
+            /* Walk the parents up to the root. */
+            uint32_t nNode = nIndex;
+            for(uint32_t nLevel = 0; nLevel + 1 < vLevels.size(); ++nLevel)
+            {
+                nNode >>= 1;
+                vLevels[nLevel + 1][nNode] = merkle_node(vLevels[nLevel], nNode);
+            }
+
+            return Root();
+        }
+
+
+        /* Get the merkle root, or zero for an empty tree. */
+        uint512_t MerkleTree::Root() const
+        {
+            return vLevels.back().empty() ? 0 : vLevels.back().back();
+        }
+
+
+        /* Get the merkle branch proving a leaf. */
+        std::vector<uint512_t> MerkleTree::Branch(uint32_t nIndex) const
+        {
+            /* Grab the sibling on each level below the root. */
+            std::vector<uint512_t> vMerkleBranch;
+            for(uint32_t nLevel = 0; nLevel + 1 < vLevels.size(); ++nLevel)
+            {
+                const std::vector<uint512_t>& vLevel = vLevels[nLevel];
+                vMerkleBranch.push_back(vLevel[std::min(nIndex ^ 1, static_cast<uint32_t>(vLevel.size()) - 1)]);
+
+                nIndex >>= 1;
+            }
+
+            return vMerkleBranch;
+        }
+
+
+        /* Get the leaves of the tree. */
+        const std::vector<uint512_t>& MerkleTree::Leaves() const
+        {
+            return vLevels[0];
+        }
+
+
+        /* Get the number of leaves in the tree. */
+        uint32_t MerkleTree::Size() const
+        {
+            return static_cast<uint32_t>(vLevels[0].size());
+        }
+
+
+        /* Remove every level of the tree. */
+        void MerkleTree::Clear()
+        {
+            vLevels.assign(1, std::vector<uint512_t>());
+        }
+    }
+}
@@ -0,0 +1,695 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Legacy/include/evaluate.h>
+#include <Legacy/types/transaction.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <TAO/Register/include/enum.h>
+#include <TAO/Register/include/unpack.h>
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/object.h>
+
+#include <TAO/Ledger/include/enum.h>
+#include <TAO/Ledger/types/metrics.h>
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* The running metrics of the chain. */
+        Aggregator aggregator;
+
+
+        /* Read every register of a given address type, whether or not the register database indexes addresses. */
+        template<typename Function>
+        void scan_registers(const std::string& strType, const Function& fnObject)
+        {
+            /* Special handle if address indexed. */
+            if(config::fIndexAddress.load())
+            {
+                std::vector<std::pair<uint256_t, TAO::Register::Object>> vRegisters;
+                LLD::Register->BatchRead(strType + "_address", vRegisters, -1);
+
+                for(auto& rRegister : vRegisters)
+                    fnObject(rRegister.second);
+
+                return;
+            }
+
+            /* Batch read all registers. */
+            std::vector<TAO::Register::Object> vRegisters;
+            LLD::Register->BatchRead(strType, vRegisters, -1);
+
+            for(auto& rRegister : vRegisters)
+                fnObject(rRegister);
+        }
+
+
+        /* Default Constructor. */
+        Volume::Volume()
+        : nFirst        (0)
+        , nTime         (0)
+        , nTransactions (0)
+        , nContracts    (0)
+        , nAccounts     (0)
+        , nDeposits     (0)
+        , nWithdraws    (0)
+        , nMining       (0)
+        , nStaking      (0)
+        , nStakeChange  (0)
+        {
+        }
+
+
+        /* Remove the totals of an earlier record, leaving the volume of the blocks between them. */
+        Volume& Volume::operator-=(const Volume& tVolume)
+        {
+            nTransactions -= tVolume.nTransactions;
+            nContracts    -= tVolume.nContracts;
+            nAccounts     -= tVolume.nAccounts;
+            nDeposits     -= tVolume.nDeposits;
+            nWithdraws    -= tVolume.nWithdraws;
+            nMining       -= tVolume.nMining;
+            nStaking      -= tVolume.nStaking;
+            nStakeChange  -= tVolume.nStakeChange;
+
+            return *this;
+        }
+
+
+        /* Add the contracts of a tritium transaction, counting accounts not yet seen in this block. */
+        void Volume::Add(const Transaction& tx, std::set<uint256_t> &setAccounts)
+        {
+            /* Increment total contracts. */
+            nContracts += tx.Size();
+
+            /* Iterate all of our contracts. */
+            for(uint32_t n = 0; n < tx.Size(); ++n)
+            {
+                /* Grab a reference of our contract. */
+                const TAO::Operation::Contract& rContract = tx[n];
+
+                /* Check for an available address that was modified. */
+                uint256_t hashAddress;
+                if(TAO::Register::Unpack(rContract, hashAddress) && setAccounts.insert(hashAddress).second)
+                    ++nAccounts;
+
+                /* Unpack our total now from contracts. */
+                uint64_t nTotal = 0;
+                if(!TAO::Register::Unpack(rContract, nTotal))
+                    continue;
+
+                /* Check for trust transactions. */
+                const uint8_t nPrimitive = rContract.Primitive();
+                if(nPrimitive == TAO::Operation::OP::TRUST)
+                {
+                    /* Accumulate our trust totals. */
+                    nStaking += nTotal;
+
+                    /* Skip to stake change. */
+                    rContract.SeekToPrimitive();
+                    rContract.Seek(73);
+
+                    /* Get our stake change value. */
+                    int64_t nChange = 0;
+                    rContract >> nChange;
+
+                    nStakeChange += nChange;
+                }
+
+                /* Check for genesis transactions. */
+                else if(nPrimitive == TAO::Operation::OP::GENESIS)
+                {
+                    /* Accumulate our inflation totals. */
+                    nStaking += nTotal;
+
+                    /* Get our pre-state to find stake. */
+                    TAO::Register::Object tPreState = rContract.PreState();
+                    if(!tPreState.Parse())
+                        continue;
+
+                    /* Our balance is our committed stake. */
+                    nStakeChange += tPreState.get<uint64_t>("balance");
+                }
+
+                /* Check only for credits from legacy. */
+                else if(nPrimitive == TAO::Operation::OP::CREDIT)
+                {
+                    uint512_t hashPrevTx;
+                    if(TAO::Register::Unpack(rContract, hashPrevTx) && hashPrevTx.GetType() == TAO::Ledger::LEGACY)
+                        nWithdraws += nTotal;
+                }
+
+                /* Check for a legacy deposit. */
+                else if(nPrimitive == TAO::Operation::OP::LEGACY)
+                    nDeposits += nTotal;
+
+                /* Check for our coinbase minting. */
+                else if(nPrimitive == TAO::Operation::OP::COINBASE)
+                    nMining += nTotal;
+            }
+        }
+
+
+        /* Add the outputs of a legacy transaction, counting accounts not yet seen in this block. */
+        void Volume::Add(const Legacy::Transaction& tx, std::set<uint256_t> &setAccounts)
+        {
+            /* Loop through all of our outputs to check. */
+            for(const Legacy::TxOut& out : tx.vout)
+            {
+                /* See if we are sending to register. */
+                uint256_t hashAddress;
+                if(Legacy::ExtractRegister(out.scriptPubKey, hashAddress) && setAccounts.insert(hashAddress).second)
+                    ++nAccounts;
+
+                /* Check for legacy to legacy transactions. */
+                Legacy::NexusAddress addrAccount;
+                if(Legacy::ExtractAddress(out.scriptPubKey, addrAccount) && setAccounts.insert(addrAccount.GetHash256()).second)
+                    ++nAccounts;
+            }
+        }
+
+
+        /* Default Constructor. */
+        Metrics::Metrics()
+        : hashBest         (0)
+        , mapRegisters     ( )
+        , nGlobalNames     (0)
+        , nNamespacedNames (0)
+        , nTokenized       (0)
+        , nStakers         (0)
+        , nStake           (0)
+        , nTrust           (0)
+        {
+        }
+
+
+        /* Get the number of registers of a given address type. */
+        uint64_t Metrics::Registers(const uint8_t nType) const
+        {
+            /* Check for registers of this type. */
+            const auto it = mapRegisters.find(nType);
+            if(it == mapRegisters.end())
+                return 0;
+
+            return it->second;
+        }
+
+
+        /* Get the number of registers of every type. */
+        uint64_t Metrics::Registers() const
+        {
+            uint64_t nTotal = 0;
+            for(const auto& rType : mapRegisters)
+                nTotal += rType.second;
+
+            return nTotal;
+        }
+
+
+        /* Apply the contracts of a transaction that was connected, or reverse them for one that was disconnected. */
+        void Metrics::Apply(const Transaction& tx, const bool fConnect)
+        {
+            /* Adjust a counter up when connecting, or down when disconnecting. */
+            const auto adjust = [fConnect](uint64_t& nCounter, const uint64_t nAmount)
+            {
+                nCounter = fConnect ? (nCounter + nAmount) : (nCounter - nAmount);
+            };
+
+            /* Move a trust account's stake and trust from one state to another, in the direction we are applying. */
+            const auto restake = [this, fConnect](uint64_t nStakeFrom, uint64_t nTrustFrom, uint64_t nStakeTo, uint64_t nTrustTo)
+            {
+                /* Disconnecting moves from the new state back to the old one. */
+                if(!fConnect)
+                {
+                    std::swap(nStakeFrom, nStakeTo);
+                    std::swap(nTrustFrom, nTrustTo);
+                }
+
+                /* Only trust accounts with stake are counted. */
+                if(nStakeFrom > 0)
+                {
+                    --nStakers;
+                    nStake -= nStakeFrom;
+                    nTrust -= nTrustFrom;
+                }
+
+                if(nStakeTo > 0)
+                {
+                    ++nStakers;
+                    nStake += nStakeTo;
+                    nTrust += nTrustTo;
+                }
+            };
+
+            /* Check through all of our contracts. */
+            for(uint32_t n = 0; n < tx.Size(); ++n)
+            {
+                /* Grab a reference of our contract. */
+                const TAO::Operation::Contract& rContract = tx[n];
+
+                /* Make sure no exceptions are thrown. */
+                try
+                {
+                    /* Seek to our primitive. */
+                    rContract.SeekToPrimitive();
+
+                    uint8_t nOP = 0;
+                    rContract >> nOP;
+
+                    switch(nOP)
+                    {
+                        /* Count new registers by their address type. */
+                        case TAO::Operation::OP::CREATE:
+                        {
+                            TAO::Register::Address hashAddress;
+                            rContract >> hashAddress;
+
+                            uint8_t nType = 0;
+                            rContract >> nType;
+
+                            std::vector<uint8_t> vchData;
+                            rContract >> vchData;
+
+                            adjust(mapRegisters[hashAddress.GetType()], 1);
+
+                            /* Names are counted by their namespace too. */
+                            if(hashAddress.IsName())
+                            {
+                                TAO::Register::Object tName;
+                                tName.nType = nType;
+                                tName.SetState(vchData);
+
+                                /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
+                                if(!tName.Parse())
+                                    break;
+
+                                const std::string strNamespace = tName.get<std::string>("namespace");
+                                if(strNamespace == TAO::Register::NAMESPACE::GLOBAL)
+                                    adjust(nGlobalNames, 1);
+
+                                else if(strNamespace != "")
+                                    adjust(nNamespacedNames, 1);
+                            }
+
+                            break;
+                        }
+
+                        /* Assets are tokenized by forcing a transfer to a token. */
+                        case TAO::Operation::OP::TRANSFER:
+                        {
+                            TAO::Register::Address hashAddress, hashTransfer;
+                            rContract >> hashAddress >> hashTransfer;
+
+                            uint8_t nForce = 0;
+                            rContract >> nForce;
+
+                            if(hashAddress.IsObject() && hashTransfer.IsToken() && nForce == TAO::Operation::TRANSFER::FORCE)
+                                adjust(nTokenized, 1);
+
+                            break;
+                        }
+
+                        /* Trust sets a new score and changes stake. */
+                        case TAO::Operation::OP::TRUST:
+                        {
+                            uint512_t hashLastTrust = 0;
+                            rContract >> hashLastTrust;
+
+                            uint64_t nScore = 0;
+                            rContract >> nScore;
+
+                            int64_t nChange = 0;
+                            rContract >> nChange;
+
+                            /* Get our pre-state to find the previous stake. */
+                            TAO::Register::Object tPreState = rContract.PreState();
+                            if(!tPreState.Parse())
+                                break;
+
+                            const uint64_t nStakePrev = tPreState.get<uint64_t>("stake");
+                            restake(nStakePrev, tPreState.get<uint64_t>("trust"), nStakePrev + nChange, nScore);
+
+                            break;
+                        }
+
+                        /* Genesis moves the balance into stake. */
+                        case TAO::Operation::OP::GENESIS:
+                        {
+                            /* Get our pre-state to find the balance. */
+                            TAO::Register::Object tPreState = rContract.PreState();
+                            if(!tPreState.Parse())
+                                break;
+
+                            const uint64_t nTrustPrev = tPreState.get<uint64_t>("trust");
+                            restake(tPreState.get<uint64_t>("stake"), nTrustPrev, tPreState.get<uint64_t>("balance"), nTrustPrev);
+
+                            break;
+                        }
+
+                        /* Migrate sets the stake and trust of a legacy trust key. */
+                        case TAO::Operation::OP::MIGRATE:
+                        {
+                            uint512_t hashTx = 0;
+                            rContract >> hashTx;
+
+                            uint256_t hashAccount = 0;
+                            rContract >> hashAccount;
+
+                            uint576_t hashTrust = 0;
+                            rContract >> hashTrust;
+
+                            uint64_t nAmount = 0;
+                            rContract >> nAmount;
+
+                            uint32_t nScore = 0;
+                            rContract >> nScore;
+
+                            /* Get our pre-state to find the previous stake. */
+                            TAO::Register::Object tPreState = rContract.PreState();
+                            if(!tPreState.Parse())
+                                break;
+
+                            restake(tPreState.get<uint64_t>("stake"), tPreState.get<uint64_t>("trust"), nAmount, nScore);
+
+                            break;
+                        }
+                    }
+                }
+                catch(const std::exception& e)
+                {
+                    debug::warning(FUNCTION, e.what());
+                }
+            }
+        }
+
+
+        /* Count our totals from the registers in the register database. */
+        void Metrics::Scan()
+        {
+            /* The address types we keep in the register database. */
+            const std::map<uint8_t, std::string> mapTypes =
+            {
+                { TAO::Register::Address::READONLY,  "readonly"  },
+                { TAO::Register::Address::APPEND,    "append"    },
+                { TAO::Register::Address::RAW,       "raw"       },
+                { TAO::Register::Address::OBJECT,    "object"    },
+                { TAO::Register::Address::CRYPTO,    "crypto"    },
+                { TAO::Register::Address::ACCOUNT,   "account"   },
+                { TAO::Register::Address::TOKEN,     "token"     },
+                { TAO::Register::Address::TRUST,     "trust"     },
+                { TAO::Register::Address::NAME,      "name"      },
+                { TAO::Register::Address::NAMESPACE, "namespace" }
+            };
+
+            /* Reset our totals. */
+            const uint1024_t hashBestIn = hashBest;
+            *this   = Metrics();
+            hashBest = hashBestIn;
+
+            /* Check through every register of every type. */
+            for(const auto& rType : mapTypes)
+            {
+                const uint8_t nType = rType.first;
+                scan_registers(rType.second, [this, nType](TAO::Register::Object& rObject)
+                {
+                    /* Increment total register. */
+                    ++mapRegisters[nType];
+
+                    /* Count tokenized assets. */
+                    if(nType == TAO::Register::Address::OBJECT && TAO::Register::Address(rObject.hashOwner).IsToken())
+                        ++nTokenized;
+
+                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
+                    if((nType != TAO::Register::Address::NAME && nType != TAO::Register::Address::TRUST) || !rObject.Parse())
+                        return;
+
+                    /* Count names by namespace. */
+                    if(nType == TAO::Register::Address::NAME)
+                    {
+                        const std::string strNamespace = rObject.get<std::string>("namespace");
+                        if(strNamespace == TAO::Register::NAMESPACE::GLOBAL)
+                            ++nGlobalNames;
+
+                        else if(strNamespace != "")
+                            ++nNamespacedNames;
+
+                        return;
+                    }
+
+                    /* Count trust accounts with stake. */
+                    const uint64_t nStakeAccount = rObject.get<uint64_t>("stake");
+                    if(nStakeAccount == 0)
+                        return;
+
+                    ++nStakers;
+                    nStake += nStakeAccount;
+                    nTrust += rObject.get<uint64_t>("trust");
+                });
+            }
+        }
+
+
+        /* Default Constructor. */
+        Aggregator::Aggregator()
+        : MUTEX       ( )
+        , tMetrics    ( )
+        , fReady      (false)
+        , nMaxHeights (100000)
+        {
+        }
+
+
+        /* Read our metrics from the ledger, counting them from the register database if they aren't as of the best block. */
+        void Aggregator::Load(const uint1024_t& hashBest, const uint32_t nMaxIn)
+        {
+            LOCK(MUTEX);
+
+            /* Set our volume records to keep. */
+            nMaxHeights = std::max(nMaxIn, 1u);
+
+            /* Clients don't have the registers or blocks to aggregate. */
+            if(config::fClient.load())
+                return;
+
+            /* Check for metrics written with our best chain. */
+            if(LLD::Ledger->ReadMetrics(tMetrics) && tMetrics.hashBest == hashBest)
+            {
+                fReady = true;
+                return;
+            }
+
+            /* Count our metrics from scratch otherwise. */
+            runtime::timer timer;
+            timer.Start();
+
+            tMetrics.hashBest = hashBest;
+            tMetrics.Scan();
+
+            /* Write them so we only need to do this once. */
+            if(!LLD::Ledger->WriteMetrics(tMetrics))
+                debug::warning(FUNCTION, "failed to write metrics");
+
+            fReady = true;
+
+            debug::log(0, FUNCTION, "Counted metrics of ", tMetrics.Registers(), " registers in ", timer.ElapsedMilliseconds(), " ms");
+        }
+
+
+        /* Apply a transaction that was connected to the running metrics. */
+        void Aggregator::Connect(const Transaction& tx)
+        {
+            LOCK(MUTEX);
+
+            /* Our metrics will be counted again on load if we aren't ready. */
+            if(fReady)
+                tMetrics.Apply(tx, true);
+        }
+
+
+        /* Reverse a transaction that was disconnected from the running metrics. */
+        void Aggregator::Disconnect(const Transaction& tx)
+        {
+            LOCK(MUTEX);
+
+            /* Our metrics will be counted again on load if we aren't ready. */
+            if(fReady)
+                tMetrics.Apply(tx, false);
+        }
+
+
+        /* Write the volume record of a connected block, pruning the record that fell out of the recent heights. */
+        void Aggregator::Connect(const BlockState& state, const Volume& tVolume)
+        {
+            /* Clients don't have the transactions to aggregate. */
+            if(config::fClient.load())
+                return;
+
+            /* Build our record for this block, starting a new run if the previous block has none. */
+            Volume tRecord = tVolume;
+            tRecord.nFirst        = state.nHeight;
+            tRecord.nTime         = state.GetBlockTime();
+            tRecord.nTransactions = state.vtx.size();
+
+            /* Accumulate onto the previous block's record. */
+            Volume tPrev;
+            if(state.nHeight > 0 && LLD::Ledger->ReadVolume(state.nHeight - 1, tPrev))
+            {
+                tRecord.nFirst         = tPrev.nFirst;
+                tRecord.nTransactions += tPrev.nTransactions;
+                tRecord.nContracts    += tPrev.nContracts;
+                tRecord.nAccounts     += tPrev.nAccounts;
+                tRecord.nDeposits     += tPrev.nDeposits;
+                tRecord.nWithdraws    += tPrev.nWithdraws;
+                tRecord.nMining       += tPrev.nMining;
+                tRecord.nStaking      += tPrev.nStaking;
+                tRecord.nStakeChange  += tPrev.nStakeChange;
+            }
+
+            /* Write our record, overwriting any left at this height by a chain that was reorganized away. */
+            if(!LLD::Ledger->WriteVolume(state.nHeight, tRecord))
+                debug::warning(FUNCTION, "failed to write volume for height ", state.nHeight);
+
+            /* Prune the record that fell out of our recent heights. */
+            uint32_t nMax = 0;
+            {
+                LOCK(MUTEX);
+                nMax = nMaxHeights;
+            }
+
+            if(state.nHeight >= nMax)
+                LLD::Ledger->EraseVolume(state.nHeight - nMax);
+        }
+
+
+        /* Erase the volume record of a disconnected block. */
+        void Aggregator::Disconnect(const BlockState& state)
+        {
+            /* Clients don't have the transactions to aggregate. */
+            if(config::fClient.load())
+                return;
+
+            LLD::Ledger->EraseVolume(state.nHeight);
+        }
+
+
+        /* Write our running metrics along with a new best chain pointer. */
+        void Aggregator::Commit(const uint1024_t& hashBest)
+        {
+            LOCK(MUTEX);
+
+            /* Our metrics will be counted again on load if we aren't ready. */
+            if(!fReady)
+                return;
+
+            /* Write our metrics as of this block. */
+            tMetrics.hashBest = hashBest;
+            if(!LLD::Ledger->WriteMetrics(tMetrics))
+                debug::warning(FUNCTION, "failed to write metrics");
+        }
+
+
+        /* Put back running metrics copied before a reorganization that failed. */
+        void Aggregator::Restore(const Metrics& tMetricsIn)
+        {
+            LOCK(MUTEX);
+
+            /* Our metrics will be counted again on load if we aren't ready. */
+            if(fReady)
+                tMetrics = tMetricsIn;
+        }
+
+
+        /* Get a copy of our running metrics. */
+        bool Aggregator::Get(Metrics &tMetricsOut) const
+        {
+            LOCK(MUTEX);
+
+            /* Check that we are consistent with the best chain. */
+            if(!fReady)
+                return false;
+
+            tMetricsOut = tMetrics;
+            return true;
+        }
+
+
+        /* Get the volume of the blocks up to a best block with timestamps within a number of seconds of a given time. */
+        bool Aggregator::Window(const BlockState& state, const uint64_t nTime, const uint64_t nSeconds, Volume &tVolume) const
+        {
+            /* Clients don't have the transactions to aggregate. */
+            if(config::fClient.load())
+                return false;
+
+            /* Get the record of our best block. */
+            Volume tBest;
+            if(!LLD::Ledger->ReadVolume(state.nHeight, tBest))
+                return false;
+
+            /* Get the lowest height we still have records for. */
+            uint32_t nLow = tBest.nFirst;
+            {
+                LOCK(MUTEX);
+                if(state.nHeight >= nMaxHeights)
+                    nLow = std::max(nLow, state.nHeight - nMaxHeights + 1);
+            }
+
+            /* Check that our lowest record is before the window, so the window starts above it. */
+            Volume tLow;
+            if(!LLD::Ledger->ReadVolume(nLow, tLow) || tLow.nTime + nSeconds > nTime)
+                return false;
+
+            /* Find the first block inside our window, as block times only ever move forward a little. */
+            uint32_t nBegin = nLow + 1, nEnd = state.nHeight + 1;
+            while(nBegin < nEnd)
+            {
+                const uint32_t nMiddle = nBegin + (nEnd - nBegin) / 2;
+
+                /* Read the record at this height. */
+                Volume tMiddle;
+                if(!LLD::Ledger->ReadVolume(nMiddle, tMiddle))
+                    return false;
+
+                /* Check which side of the window we are on. */
+                if(tMiddle.nTime + nSeconds > nTime)
+                    nEnd = nMiddle;
+                else
+                    nBegin = nMiddle + 1;
+            }
+
+            /* Our window is every block after the one before it. */
+            Volume tBase;
+            if(!LLD::Ledger->ReadVolume(nBegin - 1, tBase))
+                return false;
+
+            tVolume  = tBest;
+            tVolume -= tBase;
+
+            return true;
+        }
+    }
+}
@@ -12,12 +12,15 @@
 ____________________________________________________________________________________________*/
 
 #include <TAO/Ledger/include/prime.h>
+#include <LLC/include/montgomery.h>
 #include <LLC/types/bignum.h>
 #include <openssl/bn.h>
 
 #include <Util/include/debug.h>
 #include <Util/include/softfloat.h>
 
+#include <algorithm>
+
 
 /* Global TAO namespace. */
 namespace TAO
@@ -55,6 +58,8 @@ namespace TAO
             if(!vOffsets.empty())
             {
                 /* Loop through offsets pattern. */
+                std::vector<uint1024_t> vCluster;
+
                 uint32_t nSize = vOffsets.size();
                 for(uint32_t n = 0; n < nSize - 4; ++n)
                 {
@@ -67,12 +72,19 @@ namespace TAO
 
                     /* Set the next offset position. */
                     hashNext += nOffset;
+                    vCluster.push_back(hashNext);
+                }
 
-                    /* Check prime at offset. */
-                    if(!fVerify || PrimeCheck(hashNext))
-                        ++nClusterSize;
+                /* Check primes at all offsets in one batch. */
+                if(fVerify)
+                {
+                    std::vector<bool> vPrime;
+                    PrimeCheck(vCluster, vPrime);
 
+                    nClusterSize += std::count(vPrime.begin(), vPrime.end(), true);
                 }
+                else
+                    nClusterSize += vCluster.size();
 
                 /* Get fractional difficulty. */
                 uint32_t nFraction = 0;
@@ -128,12 +140,26 @@ namespace TAO
             vOffsets.clear();
             uint8_t nOffset = 2;
 
+            /* Candidates are checked in batches covering the largest gap of a dense cluster. */
+            std::vector<uint1024_t> vWindow;
+            std::vector<bool> vPrime;
+
             /* Set temporary variables for the checks. */
             uint1024_t hashLast = hashPrime;
             for(uint1024_t hashNext = hashPrime + 2; nOffset <= 12; hashNext += 2, nOffset += 2)
             {
+                /* Check the next window of candidates once we have used up the last. */
+                if(vWindow.empty() || hashNext > vWindow.back())
+                {
+                    vWindow.clear();
+                    for(uint32_t n = 0; n < 6; ++n)
+                        vWindow.push_back(hashNext + (n * 2));
+
+                    PrimeCheck(vWindow, vPrime);
+                }
+
                 /* Check if this interval is prime. */
-                if(PrimeCheck(hashNext))
+                if(vPrime[((hashNext - vWindow.front()) / 2).Get64()])
                 {
                     hashLast = hashNext;
 
@@ -184,19 +210,36 @@ namespace TAO
         }
 
 
-        /* Used after Miller-Rabin and Divisor tests to verify primality. */
-        uint1024_t FermatTest(const uint1024_t& hashTest)
+        /* Determines if each of the given numbers is prime, running the fermat tests as one batch. */
+        void PrimeCheck(const std::vector<uint1024_t>& vTest, std::vector<bool> &vPrime)
         {
-            LLC::CAutoBN_CTX pctx;
+            vPrime.assign(vTest.size(), false);
 
-            LLC::CBigNum bnPrime(hashTest);
-            LLC::CBigNum bnBase(2);
-            LLC::CBigNum bnExp = bnPrime - 1;
+            /* Only candidates passing small divisors go on to fermat. */
+            std::vector<uint1024_t> vFermat;
+            std::vector<uint32_t> vIndex;
+            for(uint32_t n = 0; n < vTest.size(); ++n)
+            {
+                if(!SmallDivisors(vTest[n]))
+                    continue;
+
+                vFermat.push_back(vTest[n]);
+                vIndex.push_back(n);
+            }
 
-            LLC::CBigNum bnResult;
-            BN_mod_exp(bnResult.getBN(), bnBase.getBN(), bnExp.getBN(), bnPrime.getBN(), pctx);
+            /* Fermat Test */
+            std::vector<uint1024_t> vResults;
+            LLC::FermatTest(vFermat, vResults);
 
-            return bnResult.getuint1024();
+            for(uint32_t n = 0; n < vResults.size(); ++n)
+                vPrime[vIndex[n]] = (vResults[n] == 1);
+        }
+
+
+        /* Used after Miller-Rabin and Divisor tests to verify primality. */
+        uint1024_t FermatTest(const uint1024_t& hashTest)
+        {
+            return LLC::FermatTest(hashTest);
         }
 
 
@@ -0,0 +1,449 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+
+#include <LLD/include/global.h>
+#include <LLD/include/version.h>
+
+#include <Legacy/types/transaction.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/types/snapshot.h>
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/args.h>
+#include <Util/include/debug.h>
+#include <Util/include/filesystem.h>
+#include <Util/include/runtime.h>
+#include <Util/templates/datastream.h>
+
+#include <fstream>
+#include <iomanip>
+#include <unordered_map>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* The version of the snapshot format. */
+        const uint32_t SNAPSHOT_VERSION = 1;
+
+
+        /* The size of record data a chunk is cut at. */
+        const uint64_t SNAPSHOT_CHUNK_SIZE = 16 * 1024 * 1024;
+
+
+        /* The keychain buckets read from disk at a time. */
+        const uint32_t SNAPSHOT_SCAN_BUCKETS = 256 * 256;
+
+
+        /* Get the path of a file in a snapshot directory. */
+        static std::string snapshot_path(const std::string& strPath, const uint32_t nChunk)
+        {
+            return debug::safe_printstr(strPath, "/chunk.", std::setfill('0'), std::setw(5), nChunk);
+        }
+
+
+        /* Read a whole snapshot file. */
+        static bool snapshot_read(const std::string& strFile, std::vector<uint8_t> &vBytes)
+        {
+            std::ifstream stream(strFile, std::ios::in | std::ios::binary | std::ios::ate);
+            if(!stream.is_open())
+                return debug::error(FUNCTION, "couldn't open ", strFile);
+
+            /* Read the file in one go. */
+            vBytes.resize(stream.tellg());
+            stream.seekg(0, std::ios::beg);
+            if(!stream.read((char*)vBytes.data(), vBytes.size()))
+                return debug::error(FUNCTION, "only ", stream.gcount(), "/", vBytes.size(), " bytes read from ", strFile);
+
+            return true;
+        }
+
+
+        /* Write a whole snapshot file. */
+        static bool snapshot_write(const std::string& strFile, const std::vector<uint8_t>& vBytes)
+        {
+            std::ofstream stream(strFile, std::ios::out | std::ios::binary | std::ios::trunc);
+            if(!stream.is_open() || !stream.write((char*)vBytes.data(), vBytes.size()))
+                return debug::error(FUNCTION, "couldn't write ", strFile);
+
+            return true;
+        }
+
+
+        /* Determine if a key is one each node writes for itself, which is left out of snapshots. */
+        static bool snapshot_local(const uint16_t nInstance, const LLD::SectorKey& cKey)
+        {
+            /* The types leading the local keys of each database. Markers of completed indexes stay, as the indexes do. */
+            static const std::map<uint16_t, std::vector<std::string>> mapLocal =
+            {
+                { LLD::INSTANCES::LEDGER, { "hashbestchain", "hybrid", "metrics", "volume", "undo" } },
+            };
+
+            /* Local keys are all short enough for the keychain to store them whole. */
+            if(!mapLocal.count(nInstance) || cKey.nLength > cKey.vKey.size())
+                return false;
+
+            for(const auto& strLocal : mapLocal.at(nInstance))
+            {
+                DataStream ssKey(SER_LLD, LLD::DATABASE_VERSION);
+                ssKey << strLocal;
+
+                if(cKey.vKey.size() >= ssKey.size() && std::equal(ssKey.Bytes().begin(), ssKey.Bytes().end(), cKey.vKey.begin()))
+                    return true;
+            }
+
+            return false;
+        }
+
+
+        /* Determine if a record belongs to the best chain, leaving out blocks and transactions of forks. */
+        static bool snapshot_chain(const uint16_t nInstance, const std::vector<uint8_t>& vData)
+        {
+            DataStream ssData(vData, SER_LLD, LLD::DATABASE_VERSION);
+
+            std::string strType;
+            ssData >> strType;
+
+            /* Blocks are on the best chain if connected. */
+            if(strType == "block" && nInstance == LLD::INSTANCES::LEDGER)
+            {
+                BlockState state;
+                ssData >> state;
+
+                return state.IsInMainChain();
+            }
+
+            /* Transactions are on the best chain if indexed to a block. */
+            if(strType == "tx" && nInstance == LLD::INSTANCES::LEDGER)
+            {
+                Transaction tx;
+                ssData >> tx;
+
+                return LLD::Ledger->HasIndex(tx.GetHash());
+            }
+
+            if(strType == "tx" && nInstance == LLD::INSTANCES::LEGACY)
+            {
+                Legacy::Transaction tx;
+                ssData >> tx;
+
+                return LLD::Ledger->HasIndex(tx.GetHash());
+            }
+
+            return true;
+        }
+
+
+        /* Default Constructor. */
+        Snapshot::Snapshot()
+        : nVersion  (SNAPSHOT_VERSION)
+        , nHeight   (0)
+        , hashBlock (0)
+        , vBuckets  ( )
+        , vChunks   ( )
+        {
+        }
+
+
+        /* Get the hash of the manifest, which identifies the snapshot. */
+        uint256_t Snapshot::GetHash() const
+        {
+            DataStream ssManifest(SER_LLD, LLD::DATABASE_VERSION);
+            ssManifest << *this;
+
+            return LLC::SK256(ssManifest.Bytes());
+        }
+
+
+        /* Export the consensus databases at the best block into a directory. */
+        bool Snapshot::Export(const std::string& strPath)
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            /* Take the snapshot at our best block. */
+            const BlockState stateBest = ChainState::tStateBest.load();
+
+            nVersion  = SNAPSHOT_VERSION;
+            nHeight   = stateBest.nHeight;
+            hashBlock = stateBest.GetHash();
+            vBuckets.clear();
+            vChunks.clear();
+
+            /* Create the directory if it doesn't exist yet. */
+            if(!filesystem::exists(strPath) && !filesystem::create_directories(strPath + "/"))
+                return debug::error(FUNCTION, "couldn't create ", strPath);
+
+            try
+            {
+                uint64_t nRecords = 0;
+                for(const auto& pair : LLD::Instances(LLD::INSTANCES::CONSENSUS))
+                {
+                    const uint16_t nInstance = pair.first;
+                    const uint32_t nBuckets  = pair.second->Buckets();
+
+                    vBuckets.emplace_back(nInstance, nBuckets);
+
+                    /* The position of each record by its location, or -1 for records left out. */
+                    std::unordered_map<uint64_t, uint64_t> mapRecords;
+                    uint64_t nPosition = 0;
+
+                    /* Cut the records into chunks as they are read. */
+                    std::vector<LLD::SectorRecord> vChunk;
+                    uint64_t nChunkSize = 0;
+                    for(uint32_t nBegin = 0; nBegin < nBuckets; nBegin += SNAPSHOT_SCAN_BUCKETS)
+                    {
+                        std::vector< std::pair<uint32_t, LLD::SectorKey> > vKeys;
+                        if(!pair.second->Keys(nBegin, std::min(nBegin + SNAPSHOT_SCAN_BUCKETS, nBuckets), vKeys))
+                            return debug::error(FUNCTION, "failed to read keys from instance ", nInstance);
+
+                        for(const auto& tKey : vKeys)
+                        {
+                            const LLD::SectorKey& cKey = tKey.second;
+                            if(snapshot_local(nInstance, cKey))
+                                continue;
+
+                            LLD::SectorRecord tRecord(tKey.first, cKey);
+
+                            /* Keys with a location either hold a record or are indexed to one found before. */
+                            if(cKey.nSectorFile != 0 || cKey.nSectorSize != 0 || cKey.nSectorStart != 0)
+                            {
+                                const uint64_t nLocation = (uint64_t(cKey.nSectorFile) << 32) | cKey.nSectorStart;
+
+                                auto it = mapRecords.find(nLocation);
+                                if(it != mapRecords.end())
+                                {
+                                    if(it->second == uint64_t(-1))
+                                        continue;
+
+                                    tRecord.nState = LLD::SNAPSHOT::INDEX;
+                                    tRecord.nIndex = it->second;
+                                }
+                                else
+                                {
+                                    if(!pair.second->Get(cKey, tRecord.vData))
+                                        return debug::error(FUNCTION, "failed to read record from instance ", nInstance);
+
+                                    /* Leave out records of forks, and every key indexed to them. */
+                                    if(!snapshot_chain(nInstance, tRecord.vData))
+                                    {
+                                        mapRecords[nLocation] = uint64_t(-1);
+                                        continue;
+                                    }
+
+                                    mapRecords[nLocation] = nPosition++;
+                                    tRecord.nState = LLD::SNAPSHOT::DATA;
+                                }
+                            }
+
+                            nChunkSize += tRecord.vKey.size() + tRecord.vData.size();
+                            vChunk.push_back(std::move(tRecord));
+                            ++nRecords;
+
+                            /* Write the chunk out once full. */
+                            if(nChunkSize >= SNAPSHOT_CHUNK_SIZE)
+                            {
+                                DataStream ssChunk(SER_LLD, LLD::DATABASE_VERSION);
+                                ssChunk << vChunk;
+
+                                if(!snapshot_write(snapshot_path(strPath, vChunks.size()), ssChunk.Bytes()))
+                                    return false;
+
+                                vChunks.emplace_back(nInstance, LLC::SK256(ssChunk.Bytes()));
+                                vChunk.clear();
+                                nChunkSize = 0;
+                            }
+                        }
+                    }
+
+                    /* Write out the rest of this instance. */
+                    if(!vChunk.empty())
+                    {
+                        DataStream ssChunk(SER_LLD, LLD::DATABASE_VERSION);
+                        ssChunk << vChunk;
+
+                        if(!snapshot_write(snapshot_path(strPath, vChunks.size()), ssChunk.Bytes()))
+                            return false;
+
+                        vChunks.emplace_back(nInstance, LLC::SK256(ssChunk.Bytes()));
+                    }
+                }
+
+                /* Check nothing was connected while we were reading. */
+                if(ChainState::hashBestChain.load() != hashBlock)
+                    return debug::error(FUNCTION, "best chain changed while exporting");
+
+                /* Write the manifest last, so a partial export is never mistaken for a snapshot. */
+                DataStream ssManifest(SER_LLD, LLD::DATABASE_VERSION);
+                ssManifest << *this;
+
+                if(!snapshot_write(strPath + "/manifest.dat", ssManifest.Bytes()))
+                    return false;
+
+                debug::log(0, FUNCTION, "Exported ", nRecords, " records in ", vChunks.size(), " chunks at height ", nHeight,
+                    " in ", timer.Elapsed(), " seconds; snapshot hash ", GetHash().ToString());
+            }
+            catch(const std::exception& e)
+            {
+                return debug::error(FUNCTION, "failed to export: ", e.what());
+            }
+
+            return true;
+        }
+
+
+        /* Read the manifest from a directory and check it and its chunks. */
+        bool Snapshot::Verify(const std::string& strPath)
+        {
+            /* We only trust a snapshot we were told to expect. */
+            const std::string strHash = config::GetArg("-snapshothash", "");
+            if(strHash.empty())
+                return debug::error(FUNCTION, "no -snapshothash to verify against");
+
+            try
+            {
+                /* Read the manifest. */
+                std::vector<uint8_t> vBytes;
+                if(!snapshot_read(strPath + "/manifest.dat", vBytes))
+                    return false;
+
+                DataStream ssManifest(vBytes, SER_LLD, LLD::DATABASE_VERSION);
+                ssManifest >> *this;
+
+                if(nVersion != SNAPSHOT_VERSION)
+                    return debug::error(FUNCTION, "unsupported snapshot version ", nVersion);
+
+                /* Check the manifest is the snapshot configured. */
+                uint256_t hashExpected;
+                hashExpected.SetHex(strHash);
+                if(GetHash() != hashExpected)
+                    return debug::error(FUNCTION, "snapshot hash ", GetHash().SubString(), " doesn't match -snapshothash");
+
+                /* Check every chunk against the manifest. */
+                for(uint32_t nChunk = 0; nChunk < vChunks.size(); ++nChunk)
+                {
+                    if(!snapshot_read(snapshot_path(strPath, nChunk), vBytes))
+                        return false;
+
+                    if(LLC::SK256(vBytes) != vChunks[nChunk].second)
+                        return debug::error(FUNCTION, "chunk ", nChunk, " doesn't match the manifest");
+                }
+            }
+            catch(const std::exception& e)
+            {
+                return debug::error(FUNCTION, "failed to verify: ", e.what());
+            }
+
+            return true;
+        }
+
+
+        /* Verify a snapshot and write its chunks in bulk into empty consensus databases. */
+        bool Snapshot::Import(const std::string& strPath)
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            /* Check the snapshot before writing anything. */
+            if(!Verify(strPath))
+                return debug::error(FUNCTION, "snapshot failed verification");
+
+            /* Records are written without checking for existing keys, so the databases must be empty. */
+            uint1024_t hashBest = 0;
+            if(LLD::Ledger->ReadBestChain(hashBest))
+                return debug::error(FUNCTION, "ledger already has a best chain");
+
+            /* An import that didn't finish leaves records behind without a best chain. */
+            uint1024_t hashImport = 0;
+            if(LLD::Ledger->ReadImport(hashImport))
+                return debug::error(FUNCTION, "import of ", hashImport.SubString(), " didn't finish, remove the databases to import again");
+
+            /* Records are stored by bucket, so our keychains must have the same buckets. */
+            const auto mapInstances = LLD::Instances(LLD::INSTANCES::CONSENSUS);
+            for(const auto& pair : vBuckets)
+            {
+                if(!mapInstances.count(pair.first))
+                    return debug::error(FUNCTION, "instance ", pair.first, " isn't open");
+
+                if(mapInstances.at(pair.first)->Buckets() != pair.second)
+                    return debug::error(FUNCTION, "instance ", pair.first, " has ", mapInstances.at(pair.first)->Buckets(),
+                        " buckets, snapshot has ", pair.second);
+            }
+
+            /* Mark the import in progress until our best chain is written. */
+            if(!LLD::Ledger->WriteImport(hashBlock))
+                return debug::error(FUNCTION, "failed to mark import in progress");
+
+            try
+            {
+                /* The location of every record written to each instance, for resolving indexes. */
+                std::map<uint16_t, std::vector< std::tuple<uint16_t, uint32_t, uint32_t> >> mapLocations;
+
+                uint64_t nRecords = 0;
+                for(uint32_t nChunk = 0; nChunk < vChunks.size(); ++nChunk)
+                {
+                    const uint16_t nInstance = vChunks[nChunk].first;
+                    if(!mapInstances.count(nInstance))
+                        return debug::error(FUNCTION, "instance ", nInstance, " isn't open");
+
+                    /* Check the chunk again as we read it, since it is read twice. */
+                    std::vector<uint8_t> vBytes;
+                    if(!snapshot_read(snapshot_path(strPath, nChunk), vBytes))
+                        return false;
+
+                    if(LLC::SK256(vBytes) != vChunks[nChunk].second)
+                        return debug::error(FUNCTION, "chunk ", nChunk, " doesn't match the manifest");
+
+                    DataStream ssChunk(vBytes, SER_LLD, LLD::DATABASE_VERSION);
+
+                    std::vector<LLD::SectorRecord> vRecords;
+                    ssChunk >> vRecords;
+
+                    /* Write the whole chunk in bulk. */
+                    if(!mapInstances.at(nInstance)->Import(vRecords, mapLocations[nInstance]))
+                        return debug::error(FUNCTION, "failed to import chunk ", nChunk);
+
+                    nRecords += vRecords.size();
+                }
+
+                /* Check the snapshot's block is there before making it our best. */
+                BlockState state;
+                if(!LLD::Ledger->ReadBlock(hashBlock, state) || state.nHeight != nHeight)
+                    return debug::error(FUNCTION, "snapshot block ", hashBlock.SubString(), " missing after import");
+
+                if(!LLD::Ledger->WriteBestChain(hashBlock))
+                    return debug::error(FUNCTION, "failed to write best chain");
+
+                if(!LLD::Ledger->EraseImport())
+                    return debug::error(FUNCTION, "failed to clear import in progress");
+
+                debug::log(0, FUNCTION, "Imported ", nRecords, " records in ", vChunks.size(), " chunks at height ", nHeight,
+                    " in ", timer.Elapsed(), " seconds");
+            }
+            catch(const std::exception& e)
+            {
+                return debug::error(FUNCTION, "failed to import: ", e.what());
+            }
+
+            return true;
+        }
+    }
+}
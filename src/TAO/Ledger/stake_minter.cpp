@@ -15,6 +15,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/types/tritium_minter.h>
 
 #include <LLC/hash/SK.h>
+#include <LLC/include/argon2.h>
 #include <LLC/include/eckey.h>
 #include <LLC/types/bignum.h>
 
@@ -632,6 +633,9 @@ namespace TAO
                 SecureString strPIN;
                 RECURSIVE(TAO::API::Authentication::Unlock(strPIN, PinUnlock::STAKING));
 
+                /* Our signing keys don't queue behind logins. */
+                const LLC::Argon2Priority tPriority;
+
                 /* Extract our credentials from sessions. */
                 const auto& pCredentials =
                     TAO::API::Authentication::Credentials();
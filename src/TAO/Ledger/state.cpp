@@ -22,6 +22,7 @@ ________________________________________________________________________________
 #include <Legacy/types/legacy.h>
 #include <Legacy/wallet/wallet.h>
 
+#include <TAO/API/types/cache.h>
 #include <TAO/API/types/indexing.h>
 #include <TAO/API/types/transaction.h>
 
@@ -46,7 +47,9 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/retarget.h>
 
 #include <TAO/Ledger/types/genesis.h>
+#include <TAO/Ledger/types/header_index.h>
 #include <TAO/Ledger/types/mempool.h>
+#include <TAO/Ledger/types/metrics.h>
 #include <TAO/Ledger/types/client.h>
 
 
@@ -64,6 +67,18 @@ namespace TAO
             /* Get the genesis block hash. */
             uint1024_t hashGenesis =  ChainState::Genesis();
 
+            /* Hop to the last block of the channel through the header index, so only that block is read. */
+            uint1024_t hashLast = 0;
+            if(state.nHeight > 0 && state.GetChannel() != nChannel && headers.Last(state.hashPrevBlock, nChannel, hashLast))
+            {
+                BlockState stateLast;
+                if(LLD::Ledger->ReadBlock(hashLast, stateLast))
+                {
+                    state = stateLast;
+                    return true;
+                }
+            }
+
             /* Loop back 1440 blocks. */
             while(true)
             {
@@ -753,6 +768,9 @@ namespace TAO
             if(!LLD::Ledger->WriteBlock(GetHash(), *this))
                 return debug::error(FUNCTION, "block state failed to write");
 
+            /* Add to the header index. */
+            headers.Insert(*this);
+
             /* Signal to set the best chain. */
             if(nVersion >= 7 && !IsHybrid())
             {
@@ -842,10 +860,16 @@ namespace TAO
                 if(!LLD::Ledger->WriteBestChain(hash))
                     return debug::error(FUNCTION, "failed to write best chain");
 
+                /* Write our running metrics with the best chain. */
+                aggregator.Commit(hash);
+
                 /* Write the block to disk. */
                 if(!LLD::Ledger->WriteBlock(hash, *this))
                     return debug::error(FUNCTION, "block state already exists");
 
+                /* Add to the header index. */
+                headers.Insert(*this);
+
                 /* Set the genesis block. */
                 ChainState::tStateGenesis = *this;
             }
@@ -858,7 +882,39 @@ namespace TAO
                 /* Get the blocks to connect and disconnect. */
                 std::vector<BlockState> vDisconnect;
                 std::vector<BlockState> vConnect;
-                while(fork != longer)
+
+                /* Find the fork through the header index, so only the blocks to connect and disconnect are read. */
+                std::vector<uint1024_t> vHashDisconnect;
+                std::vector<uint1024_t> vHashConnect;
+                uint1024_t hashFork = 0;
+
+                bool fIndexed = headers.Fork(fork.GetHash(), hash, vHashDisconnect, vHashConnect, hashFork);
+                if(fIndexed)
+                {
+                    /* The first of each is already in memory. */
+                    for(uint32_t n = 0; fIndexed && n < vHashDisconnect.size(); ++n)
+                    {
+                        vDisconnect.push_back(fork);
+                        if(n > 0)
+                            fIndexed = LLD::Ledger->ReadBlock(vHashDisconnect[n], vDisconnect.back());
+                    }
+
+                    for(uint32_t n = 0; fIndexed && n < vHashConnect.size(); ++n)
+                    {
+                        vConnect.push_back(longer);
+                        if(n > 0)
+                            fIndexed = LLD::Ledger->ReadBlock(vHashConnect[n], vConnect.back());
+                    }
+
+                    /* Fall back to walking the ledger if a block couldn't be read. */
+                    if(!fIndexed)
+                    {
+                        vDisconnect.clear();
+                        vConnect.clear();
+                    }
+                }
+
+                while(!fIndexed && fork != longer)
                 {
                     /* Find the root block in common. */
                     while(longer.nHeight > fork.nHeight)
@@ -885,20 +941,67 @@ namespace TAO
                         return debug::error(FUNCTION, "failed to find ancestor fork block");
                 }
 
+                /* Get the fork found by walking the ledger. */
+                if(!fIndexed)
+                    hashFork = fork.GetHash();
+
                 /* Log if there are blocks to disconnect. */
                 if(vDisconnect.size() > 0)
                 {
                     debug::log(0, FUNCTION, ANSI_COLOR_BRIGHT_YELLOW, "REORGANIZE:", ANSI_COLOR_RESET,
-                        " Disconnect ", vDisconnect.size(), " blocks; ", fork.GetHash().SubString(),
+                        " Disconnect ", vDisconnect.size(), " blocks; ", hashFork.SubString(),
                         "..",  ChainState::tStateBest.load().GetHash().SubString());
 
                     /* Keep this in vDisconnect check, or it will print every block, but only print on reorg if have at least 1 */
                     if(vConnect.size() > 0)
                         debug::log(0, FUNCTION, ANSI_COLOR_BRIGHT_YELLOW, "REORGANIZE:", ANSI_COLOR_RESET,
-                            " Connect ", vConnect.size(), " blocks; ", fork.GetHash().SubString(),
+                            " Connect ", vConnect.size(), " blocks; ", hashFork.SubString(),
                             "..", hash.SubString());
                 }
 
+                /* Time the whole reorganization. */
+                runtime::timer timer;
+                timer.Start();
+
+                /* Check once if we are printing states, rather than for every block. */
+                const bool fPrintState = config::GetBoolArg("-printstate");
+
+                /* Keep what we change in memory, as the caller aborts its database transaction if we fail part way. */
+                Metrics tMetrics;
+                const bool fMetrics = aggregator.Get(tMetrics);
+
+                const BlockState tGenesis = ChainState::tStateGenesis;
+
+                /* Track how far we got to undo our changes in memory on failure. */
+                uint32_t nDisconnected = 0;
+                uint32_t nConnected    = 0;
+                uint32_t nErased       = 0;
+
+                /* Relink our header index along the old best chain and restore our running metrics. */
+                const auto rollback = [&]()
+                {
+                    /* Index the headers of blocks we erased again, lowest first so each links to its previous block. */
+                    for(uint32_t n = nErased; n > 0; --n)
+                        headers.Insert(vDisconnect[n - 1]);
+
+                    /* Unlink the blocks we connected, highest first. */
+                    for(uint32_t n = 0; n < nConnected; ++n)
+                        headers.Disconnect(vConnect[vConnect.size() - nConnected + n].GetHash());
+
+                    /* Link the blocks we disconnected, lowest first. */
+                    for(uint32_t n = nDisconnected; n > 0; --n)
+                        headers.Connect(vDisconnect[n - 1].GetHash());
+
+                    /* Restore the metrics our connected transactions were applied to. */
+                    if(fMetrics)
+                        aggregator.Restore(tMetrics);
+
+                    ChainState::tStateGenesis = tGenesis;
+                };
+
+                /* Keep what our blocks change outside the consensus databases, to apply only once the batch is in. */
+                std::vector<std::function<void()>> vEffects;
+
                 /* Keep track of mempool transactions to delete. */
                 std::vector<std::pair<uint8_t, uint512_t>> vResurrect;
 
@@ -906,20 +1009,19 @@ namespace TAO
                 for(auto& state : vDisconnect)
                 {
                     /* Output the block state if flagged. */
-                    if(config::GetBoolArg("-printstate"))
+                    if(fPrintState)
                         debug::log(0, state.ToString(debug::flags::header | debug::flags::tx));
 
                     /* Disconnect the block. */
-                    if(!state.Disconnect())
-                        return debug::error(FUNCTION, "failed to disconnect ", state.GetHash().SubString());
-
-                    /* Erase block if not connecting anything. */
-                    if(vConnect.empty())
+                    if(!state.Disconnect(vEffects))
                     {
-                        LLD::Ledger->EraseBlock(state.GetHash());
-                        //LLD::Ledger->EraseIndex(state.nHeight);
+                        rollback();
+                        return debug::error(FUNCTION, "failed to disconnect ", state.GetHash().SubString(),
+                            " after ", nDisconnected, " blocks; rolled back");
                     }
 
+                    ++nDisconnected;
+
                     /* Resurrect transactions that were disconnected. */
                     vResurrect.insert(vResurrect.end(), state.vtx.rbegin(), state.vtx.rend());
                 }
@@ -931,12 +1033,18 @@ namespace TAO
                 for(auto state = vConnect.rbegin(); state != vConnect.rend(); ++state)
                 {
                     /* Output the block state if flagged. */
-                    if(config::GetBoolArg("-printstate"))
+                    if(fPrintState)
                         debug::log(0, state->ToString(debug::flags::header | debug::flags::tx));
 
                     /* Connect the block. */
-                    if(!state->Connect())
-                        return debug::error(FUNCTION, "failed to connect ", state->GetHash().SubString());
+                    if(!state->Connect(vEffects))
+                    {
+                        rollback();
+                        return debug::error(FUNCTION, "failed to connect ", state->GetHash().SubString(),
+                            " after disconnecting ", nDisconnected, " and connecting ", nConnected, " blocks; rolled back");
+                    }
+
+                    ++nConnected;
 
                     /* Harden a checkpoint if there is any. */
                     #ifndef UNIT_TESTS
@@ -947,6 +1055,28 @@ namespace TAO
                     vDelete.insert(vDelete.end(), state->vtx.begin(), state->vtx.end());
                 }
 
+                /* Erase the blocks if not connecting anything, now that all of them have been disconnected. */
+                if(vConnect.empty())
+                {
+                    for(const auto& state : vDisconnect)
+                    {
+                        LLD::Ledger->EraseBlock(state.GetHash());
+                        headers.Erase(state.GetHash());
+
+                        ++nErased;
+                    }
+                }
+
+                /* Log how long a reorganization took, written with the best chain in the caller's transaction. */
+                if(vDisconnect.size() > 0)
+                    debug::log(0, FUNCTION, ANSI_COLOR_BRIGHT_YELLOW, "REORGANIZE:", ANSI_COLOR_RESET,
+                        " Disconnected ", vDisconnect.size(), " and connected ", vConnect.size(), " blocks in ",
+                        timer.ElapsedMilliseconds(), " ms");
+
+                /* Check the transactions to resurrect before adding any of them back into the memory pool. */
+                std::vector<TAO::Ledger::Transaction> vTritium;
+                std::vector<Legacy::Transaction> vLegacy;
+
                 /* Reverse the transction to connect to connect in ascending height. */
                 for(auto proof = vResurrect.rbegin(); proof != vResurrect.rend(); ++proof)
                 {
@@ -958,24 +1088,26 @@ namespace TAO
                         {
                             /* Make sure the transaction is not on disk. */
                             if(!LLD::Ledger->EraseTx(proof->second))
-                                return debug::error(FUNCTION, "transaction not on disk");
+                            {
+                                rollback();
+                                return debug::error(FUNCTION, "transaction not on disk; rolled back");
+                            }
                         }
                         else
                         {
                             /* Make sure the transaction is on disk. */
                             TAO::Ledger::Transaction tx;
                             if(!LLD::Ledger->ReadTx(proof->second, tx))
-                                return debug::error(FUNCTION, "transaction not on disk");
+                            {
+                                rollback();
+                                return debug::error(FUNCTION, "transaction not on disk; rolled back");
+                            }
 
                             /* Check for producer transaction. */
                             if(tx.IsCoinBase() || tx.IsCoinStake())
                                 continue;
 
-                            /* Add back into memory pool. */
-                            mempool.Accept(tx);
-
-                            if(config::nVerbose >= 3)
-                                tx.print();
+                            vTritium.push_back(std::move(tx));
                         }
                     }
                     else if(proof->first == TRANSACTION::LEGACY)
@@ -985,31 +1117,36 @@ namespace TAO
                         {
                             /* Make sure the transaction is not on disk. */
                             if(!LLD::Legacy->EraseTx(proof->second))
-                                return debug::error(FUNCTION, "transaction not on disk");
+                            {
+                                rollback();
+                                return debug::error(FUNCTION, "transaction not on disk; rolled back");
+                            }
                         }
                         else
                         {
                             /* Make sure the transaction is on disk. */
                             Legacy::Transaction tx;
                             if(!LLD::Legacy->ReadTx(proof->second, tx))
-                                return debug::error(FUNCTION, "transaction not on disk");
+                            {
+                                rollback();
+                                return debug::error(FUNCTION, "transaction not on disk; rolled back");
+                            }
 
                             /* Check for producer transaction. */
                             if(tx.IsCoinBase() || tx.IsCoinStake())
                                 continue;
 
-                            /* Add back into memory pool. */
-                            mempool.Accept(tx);
-
-                            if(config::nVerbose >= 3)
-                                tx.print();
+                            vLegacy.push_back(std::move(tx));
                         }
                     }
                 }
 
-                /* Delete from mempool. */
-                for(const auto& proof : vDelete)
-                    mempool.Remove(proof.second);
+                /* Write the best chain pointer. */
+                if(!LLD::Ledger->WriteBestChain(hash))
+                {
+                    rollback();
+                    return debug::error(FUNCTION, "failed to write best chain; rolled back");
+                }
 
                 /* Debug output about the best chain. */
                 uint64_t nElapsed = (GetBlockTime() - ChainState::tStateBest.load().GetBlockTime());
@@ -1028,15 +1165,42 @@ namespace TAO
                         " | ", (nTotalInputs * 1000000.0) / (nInputsTime + 1), " script/s]",
                         " [", std::setw(3), (::GetSerializeSize(*this, SER_LLD, nVersion) / 1024.0), " kb]");
 
-                /* Set the best chain variables. */
+                /* Set the best chain variables, now that the best chain is written. */
                 ChainState::tStateBest          = *this; //XXX: we are not getting all the data from connect, consider using pointer
                 ChainState::hashBestChain      = hash;
                 ChainState::nBestChainTrust    = nChainTrust;
                 ChainState::nBestHeight        = nHeight;
 
-                /* Write the best chain pointer. */
-                if(!LLD::Ledger->WriteBestChain(hash))
-                    return debug::error(FUNCTION, "failed to write best chain");
+                /* Add resurrected transactions back into memory pool. */
+                for(const auto& tx : vTritium)
+                {
+                    mempool.Accept(tx);
+
+                    if(config::nVerbose >= 3)
+                        tx.print();
+                }
+
+                for(const auto& tx : vLegacy)
+                {
+                    mempool.Accept(tx);
+
+                    if(config::nVerbose >= 3)
+                        tx.print();
+                }
+
+                /* Delete from mempool. */
+                for(const auto& proof : vDelete)
+                    mempool.Remove(proof.second);
+
+                /* Write our running metrics with the best chain. */
+                aggregator.Commit(hash);
+
+                /* Our batch can no longer fail, so apply what it changes in wallets, API indexes and local stake changes. */
+                for(const auto& fnEffect : vEffects)
+                    fnEffect();
+
+                /* Drop cached API results that change with the best chain, such as immature balances. */
+                TAO::API::ResultCache::InvalidateChain();
 
                 /* Reset contract meters. */
                 nTotalContracts = 0;
@@ -1055,6 +1219,21 @@ namespace TAO
 
         /** Connect a block state into chain. **/
         bool BlockState::Connect()
+        {
+            /* Apply our changes outside the consensus databases right away. */
+            std::vector<std::function<void()>> vEffects;
+            if(!Connect(vEffects))
+                return false;
+
+            for(const auto& fnEffect : vEffects)
+                fnEffect();
+
+            return true;
+        }
+
+
+        /** Connect a block state into chain, leaving changes outside the consensus databases to the caller. **/
+        bool BlockState::Connect(std::vector<std::function<void()>> &vEffects)
         {
             /* Get a copy of our block hash. */
             const uint1024_t hashBlock = GetHash();
@@ -1064,7 +1243,37 @@ namespace TAO
 
             debug::log(3, "BLOCK BEGIN-------------------------------------");
 
+            /* Read the legacy transactions up front, so their inputs can be fetched in one pass. */
+            std::vector<Legacy::Transaction> vLegacy;
+            for(const auto& proof : vtx)
+            {
+                if(proof.first != TRANSACTION::LEGACY)
+                    continue;
+
+                /* Make sure the transaction is on disk. */
+                Legacy::Transaction tx;
+                if(!LLD::Legacy->ReadTx(proof.second, tx))
+                    return debug::error(FUNCTION, "transaction not on disk");
+
+                vLegacy.push_back(std::move(tx));
+            }
+
+            /* Fetch the inputs of every legacy transaction, reading each previous transaction once. */
+            std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
+            if(!Legacy::Transaction::FetchInputs(vLegacy, inputs))
+                return debug::error(FUNCTION, "failed to fetch the inputs");
+
+            /* Track the volume of this block's transactions. */
+            Volume tVolume;
+            std::set<uint256_t> setAccounts;
+
+            /* Journal the pre-images of what our transactions modify, so disconnecting can put them back directly. */
+            const int64_t nUndoHeights = (config::fClient.load() ? 0 : config::GetArg("-undoheights", 1000));
+            if(nUndoHeights > 0)
+                LLD::UndoBegin();
+
             /* Check through all the transactions. */
+            uint32_t nLegacy = 0;
             for(const auto& proof : vtx)
             {
                 /* Get the transaction hash. */
@@ -1109,9 +1318,19 @@ namespace TAO
                     if(!tx.Connect(FLAGS::BLOCK, this))
                         return debug::error(FUNCTION, "failed to connect transaction");
 
+                    /* Drop cached API results that depend on what this transaction touched. */
+                    TAO::API::ResultCache::Invalidate(tx);
+
+                    /* Add the transaction to our running metrics and the block's volume. */
+                    aggregator.Connect(tx);
+                    tVolume.Add(tx, setAccounts);
+
                     /* Add legacy transactions to the wallet where appropriate */
                     #ifndef NO_WALLET
-                    Legacy::Wallet::Instance().AddToWalletIfInvolvingMe(tx, *this, true);
+                    vEffects.push_back([this, tx]()
+                    {
+                        Legacy::Wallet::Instance().AddToWalletIfInvolvingMe(tx, *this, true);
+                    });
                     #endif
 
                     /* Accumulate the fees. */
@@ -1136,21 +1355,25 @@ namespace TAO
                          * It also handles marking stake changes in stake pool as processed, because the block is likely
                          * mined by another node on the network, and stake change must be marked when that block is received.
                          */
-                        StakeChange tRequest;
-                        if(LLD::Local->ReadStakeChange(tx.hashGenesis, tRequest))
+                        const uint256_t hashGenesis = tx.hashGenesis;
+                        vEffects.push_back([hashGenesis, hash]()
                         {
-                            /* Update stake change request if not processed. */
-                            if(!tRequest.fProcessed)
+                            StakeChange tRequest;
+                            if(LLD::Local->ReadStakeChange(hashGenesis, tRequest))
                             {
-                                /* Mark as processed. */
-                                tRequest.fProcessed = true;
-                                tRequest.hashTx     = hash;
-
-                                /* Erase if we can't update it. */
-                                if(!LLD::Local->WriteStakeChange(tx.hashGenesis, tRequest))
-                                    LLD::Local->EraseStakeChange(tx.hashGenesis);
+                                /* Update stake change request if not processed. */
+                                if(!tRequest.fProcessed)
+                                {
+                                    /* Mark as processed. */
+                                    tRequest.fProcessed = true;
+                                    tRequest.hashTx     = hash;
+
+                                    /* Erase if we can't update it. */
+                                    if(!LLD::Local->WriteStakeChange(hashGenesis, tRequest))
+                                        LLD::Local->EraseStakeChange(hashGenesis);
+                                }
                             }
-                        }
+                        });
                     }
 
                     /* Keep track of total contracts processed. */
@@ -1166,23 +1389,22 @@ namespace TAO
                     if(LLD::Ledger->HasIndex(hash))
                         return debug::error(FUNCTION, "transaction overwrites not allowed");
 
-                    /* Make sure the transaction isn't on disk. */
-                    Legacy::Transaction tx;
-                    if(!LLD::Legacy->ReadTx(hash, tx))
-                        return debug::error(FUNCTION, "transaction not on disk");
-
-                    /* Fetch the inputs. */
-                    std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
-                    if(!tx.FetchInputs(inputs))
-                        return debug::error(FUNCTION, "failed to fetch the inputs");
+                    /* Get the transaction read with the inputs. */
+                    const Legacy::Transaction& tx = vLegacy[nLegacy++];
 
                     /* Connect the inputs. */
                     if(!tx.Connect(inputs, *this, FLAGS::BLOCK))
                         return debug::error(FUNCTION, "failed to connect inputs");
 
+                    /* Add the transaction to the block's volume. */
+                    tVolume.Add(tx, setAccounts);
+
                     /* Add legacy transactions to the wallet where appropriate */
                     #ifndef NO_WALLET
-                    Legacy::Wallet::Instance().AddToWalletIfInvolvingMe(tx, *this, true);
+                    vEffects.push_back([this, tx]()
+                    {
+                        Legacy::Wallet::Instance().AddToWalletIfInvolvingMe(tx, *this, true);
+                    });
                     #endif
 
                     /* Keep track of total inputs proceessed. */
@@ -1197,7 +1419,22 @@ namespace TAO
 
                 /* Push to our logical indexing in API. */
                 if(nTime > NEXUS_TRITIUM_TIMELOCK)
-                    TAO::API::Indexing::PushTransaction(hash);
+                    vEffects.push_back([hash]() { TAO::API::Indexing::PushTransaction(hash); });
+            }
+
+            /* Write the undo journals of our transactions, pruning those that fell out of the recent heights. */
+            if(nUndoHeights > 0)
+            {
+                /* Journals that can't put back everything are left out, for disconnecting to roll back instead. */
+                std::map<uint16_t, LLD::SectorUndo> mapUndo;
+                if(!LLD::UndoEnd(mapUndo))
+                    debug::log(3, FUNCTION, "no undo journal for block ", hashBlock.SubString());
+                else if(!LLD::Ledger->WriteUndo(nHeight, hashBlock, mapUndo))
+                    return debug::error(FUNCTION, "failed to write undo journal");
+
+                /* Prune the journal at the oldest height we no longer keep. */
+                if(nHeight > nUndoHeights)
+                    LLD::Ledger->EraseUndo(nHeight - nUndoHeights);
             }
 
             if(config::nVerbose >= 3)
@@ -1226,6 +1463,9 @@ namespace TAO
             if(config::GetBoolArg("-indexheight"))
                 LLD::Ledger->IndexBlock(nHeight, hashBlock);
 
+            /* Write the volume totals up to this block. */
+            aggregator.Connect(*this, tVolume);
+
             /* Update chain pointer for previous block. */
             if(!prev.IsNull())
             {
@@ -1238,6 +1478,9 @@ namespace TAO
                     ChainState::tStateGenesis = prev;
             }
 
+            /* Link the header index along the best chain. */
+            headers.Connect(hashBlock);
+
             return true;
         }
 
@@ -1245,6 +1488,27 @@ namespace TAO
         /** Disconnect a block state from the chain. **/
         bool BlockState::Disconnect()
         {
+            /* Apply our changes outside the consensus databases right away. */
+            std::vector<std::function<void()>> vEffects;
+            if(!Disconnect(vEffects))
+                return false;
+
+            for(const auto& fnEffect : vEffects)
+                fnEffect();
+
+            return true;
+        }
+
+
+        /* Remove a block state from the chain, leaving changes outside the consensus databases to the caller. */
+        bool BlockState::Disconnect(std::vector<std::function<void()>> &vEffects)
+        {
+            /* Check for the undo journal of this block, to put back what it modified instead of rolling it back. */
+            uint1024_t hashUndo = 0;
+            std::map<uint16_t, LLD::SectorUndo> mapUndo;
+            const bool fUndo =
+                (!config::fClient.load() && LLD::Ledger->ReadUndo(nHeight, hashUndo, mapUndo) && hashUndo == GetHash());
+
             /* Disconnect the transctions in reverse order to preserve sigchain ordering. */
             for(auto proof = vtx.rbegin(); proof != vtx.rend(); ++proof)
             {
@@ -1259,26 +1523,39 @@ namespace TAO
                     if(!LLD::Ledger->ReadTx(hash, tx))
                         return debug::error(FUNCTION, "transaction is not on disk");
 
+                    /* Our undo journal covers the consensus databases, leaving only what is indexed outside them. */
+                    if(fUndo)
+                        tx.Deindex();
+
                     /* Disconnect the transaction. */
-                    if(!tx.Disconnect())
+                    else if(!tx.Disconnect())
                         return debug::error(FUNCTION, "failed to disconnect transaction");
 
+                    /* Drop cached API results that depend on what this transaction touched. */
+                    TAO::API::ResultCache::Invalidate(tx);
+
+                    /* Reverse the transaction from our running metrics. */
+                    aggregator.Disconnect(tx);
+
                     /* Make sure this sigchain needs to be de-indexed. */
-                    if(LLD::Logical->HasFirst(tx.hashGenesis))
+                    vEffects.push_back([tx, hash]()
                     {
-                        /* Get a reference of our transaction. */
-                        TAO::API::Transaction wtx = TAO::API::Transaction(tx);
-
-                        /* Make sure indexes are deleted. */
-                        if(!wtx.Delete(hash))
+                        if(LLD::Logical->HasFirst(tx.hashGenesis))
                         {
-                            debug::warning(FUNCTION, "failed to erase our API indexes for ", hash.SubString());
-                            continue;
-                        }
+                            /* Get a reference of our transaction. */
+                            TAO::API::Transaction wtx = TAO::API::Transaction(tx);
 
-                        /* TODO: delete this debug info for < verbose=3 */
-                        debug::log(0, FUNCTION, "deleted API session indexes for ", hash.SubString());
-                    }
+                            /* Make sure indexes are deleted. */
+                            if(!wtx.Delete(hash))
+                            {
+                                debug::warning(FUNCTION, "failed to erase our API indexes for ", hash.SubString());
+                                return;
+                            }
+
+                            /* TODO: delete this debug info for < verbose=3 */
+                            debug::log(0, FUNCTION, "deleted API session indexes for ", hash.SubString());
+                        }
+                    });
                 }
                 else if(proof->first == TRANSACTION::LEGACY)
                 {
@@ -1290,25 +1567,44 @@ namespace TAO
                     if(!LLD::Legacy->ReadTx(hash, tx))
                         return debug::error(FUNCTION, "transaction is not on disk");
 
-                    /* Disconnect the inputs. */
-                    if(!tx.Disconnect(*this))
+                    /* Disconnect the inputs, unless our undo journal covers them. */
+                    if(!fUndo && !tx.Disconnect(*this))
                         return debug::error(FUNCTION, "failed to connect inputs");
 
                     /* Wallets need to refund inputs when disonnecting coinstake */
                     #ifndef NO_WALLET
-                    if(tx.IsCoinStake() && Legacy::Wallet::Instance().IsFromMe(tx))
-                       Legacy::Wallet::Instance().DisableTransaction(tx);
+                    if(tx.IsCoinStake())
+                    {
+                        vEffects.push_back([tx]()
+                        {
+                            if(Legacy::Wallet::Instance().IsFromMe(tx))
+                                Legacy::Wallet::Instance().DisableTransaction(tx);
+                        });
+                    }
                     #endif
                 }
 
                 /* Write the indexing entries. */
-                LLD::Ledger->EraseIndex(proof->second);
+                if(!fUndo)
+                    LLD::Ledger->EraseIndex(proof->second);
+            }
+
+            /* Put back what our transactions modified from their pre-images. */
+            if(fUndo)
+            {
+                if(!LLD::UndoApply(mapUndo))
+                    return debug::error(FUNCTION, "failed to apply undo journal");
+
+                LLD::Ledger->EraseUndo(nHeight);
             }
 
             /* Erase the index for block by height. */
             if(config::GetBoolArg("-indexheight"))
                 LLD::Ledger->EraseIndex(nHeight);
 
+            /* Erase the volume totals up to this block. */
+            aggregator.Disconnect(*this);
+
             /* Update the previous state's next pointer. */
             BlockState prev = Prev();
             if(!prev.IsNull())
@@ -1317,6 +1613,14 @@ namespace TAO
                 LLD::Ledger->WriteBlock(prev.GetHash(), prev);
             }
 
+            /* Unlink the header index from the best chain. */
+            headers.Disconnect(GetHash());
+
+            /* Wallet outputs confirmed by this block need their confirmations checked again. */
+            #ifndef NO_WALLET
+            vEffects.push_back([]() { Legacy::Wallet::Instance().MarkUnsettled(); });
+            #endif
+
             return true;
         }
 
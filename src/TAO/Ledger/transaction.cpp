@@ -54,6 +54,9 @@ ________________________________________________________________________________
 #include <Util/include/debug.h>
 #include <Util/include/runtime.h>
 
+#include <algorithm>
+#include <cstring>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -77,6 +80,9 @@ namespace TAO
         , vchPubKey    ( )
         , vchSig       ( )
         , hashCache    (0)
+        , pBytes       ( )
+        , nHashBytes   (0)
+        , fDecoded     (false)
         {
         }
 
@@ -96,6 +102,9 @@ namespace TAO
         , vchPubKey    ( )
         , vchSig       ( )
         , hashCache    (hashCacheIn)
+        , pBytes       ( )
+        , nHashBytes   (0)
+        , fDecoded     (false)
         {
         }
 
@@ -115,6 +124,9 @@ namespace TAO
         , vchPubKey    (tx.vchPubKey)
         , vchSig       (tx.vchSig)
         , hashCache    (tx.hashCache)
+        , pBytes       (tx.pBytes)
+        , nHashBytes   (tx.nHashBytes)
+        , fDecoded     (tx.fDecoded)
         {
         }
 
@@ -134,6 +146,9 @@ namespace TAO
         , vchPubKey    (std::move(tx.vchPubKey))
         , vchSig       (std::move(tx.vchSig))
         , hashCache    (std::move(tx.hashCache))
+        , pBytes       (std::move(tx.pBytes))
+        , nHashBytes   (std::move(tx.nHashBytes))
+        , fDecoded     (std::move(tx.fDecoded))
         {
         }
 
@@ -153,6 +168,9 @@ namespace TAO
         , vchPubKey    (tx.vchPubKey)
         , vchSig       (tx.vchSig)
         , hashCache    (tx.hashCache)
+        , pBytes       (tx.pBytes)
+        , nHashBytes   (tx.nHashBytes)
+        , fDecoded     (tx.fDecoded)
         {
         }
 
@@ -172,6 +190,9 @@ namespace TAO
         , vchPubKey    (std::move(tx.vchPubKey))
         , vchSig       (std::move(tx.vchSig))
         , hashCache    (std::move(tx.hashCache))
+        , pBytes       (std::move(tx.pBytes))
+        , nHashBytes   (std::move(tx.nHashBytes))
+        , fDecoded     (std::move(tx.fDecoded))
         {
         }
 
@@ -192,6 +213,9 @@ namespace TAO
             vchPubKey    = tx.vchPubKey;
             vchSig       = tx.vchSig;
             hashCache    = tx.hashCache;
+            pBytes       = tx.pBytes;
+            nHashBytes   = tx.nHashBytes;
+            fDecoded     = tx.fDecoded;
 
             return *this;
         }
@@ -213,6 +237,9 @@ namespace TAO
             vchPubKey    = std::move(tx.vchPubKey);
             vchSig       = std::move(tx.vchSig);
             hashCache    = std::move(tx.hashCache);
+            pBytes       = std::move(tx.pBytes);
+            nHashBytes   = std::move(tx.nHashBytes);
+            fDecoded     = std::move(tx.fDecoded);
 
             return *this;
         }
@@ -234,6 +261,9 @@ namespace TAO
             vchPubKey    = tx.vchPubKey;
             vchSig       = tx.vchSig;
             hashCache    = tx.hashCache;
+            pBytes       = tx.pBytes;
+            nHashBytes   = tx.nHashBytes;
+            fDecoded     = tx.fDecoded;
 
             return *this;
         }
@@ -255,6 +285,9 @@ namespace TAO
             vchPubKey    = std::move(tx.vchPubKey);
             vchSig       = std::move(tx.vchSig);
             hashCache    = std::move(tx.hashCache);
+            pBytes       = std::move(tx.pBytes);
+            nHashBytes   = std::move(tx.nHashBytes);
+            fDecoded     = std::move(tx.fDecoded);
 
             return *this;
         }
@@ -269,6 +302,10 @@ namespace TAO
         /* Add contracts to the internal vector. */
         Transaction& Transaction::operator<<(const TAO::Operation::Contract& rContract)
         {
+            /* Changing the contracts invalidates the kept bytes. */
+            fDecoded = false;
+            pBytes.reset();
+
             /* We just push to internal vector here. */
             vContracts.push_back(rContract);
 
@@ -307,6 +344,10 @@ namespace TAO
         /* Write access fot the contract operator overload. This handles writes to create new contracts. */
         TAO::Operation::Contract& Transaction::operator[](const uint32_t n)
         {
+            /* Write access to a contract invalidates the kept bytes. */
+            fDecoded = false;
+            pBytes.reset();
+
             /* Check for contract bounds. */
             if(n >= MAX_TRANSACTION_CONTRACTS)
                 throw debug::exception(FUNCTION, "contract create out of bounds");
@@ -785,6 +826,10 @@ namespace TAO
         /* Build the transaction contracts. */
         bool Transaction::Build()
         {
+            /* Building writes the register pre-states, invalidating the kept bytes. */
+            fDecoded = false;
+            pBytes.reset();
+
             /* Create a temporary map for pre-states. */
             std::map<uint256_t, TAO::Register::State> mapStates;
 
@@ -1082,23 +1127,6 @@ namespace TAO
                         /* Revert saved last stake to the prior stake transaction */
                         if(!LLD::Ledger->WriteStake(hashGenesis, hashLast))
                             return debug::error(FUNCTION, "failed to write last stake");
-
-                        /* If local database has a stake change request, update it to not processed. */
-                        StakeChange tRequest;
-                        if(LLD::Local->ReadStakeChange(hashGenesis, tRequest))
-                        {
-                            /* Check for processed change that's also for this transaction. */
-                            if(tRequest.fProcessed && tRequest.hashTx == GetHash()) //XXX: this is ugly, needs improvement
-                            {
-                                /* Set the stake request to not processed now. */
-                                tRequest.fProcessed = false;
-                                tRequest.hashTx = 0;
-
-                                /* Update stake change request on disconnect. */
-                                if(!LLD::Local->WriteStakeChange(hashGenesis, tRequest))
-                                    debug::error(FUNCTION, "unable to reinstate disconnected stake change request"); //don't fail
-                            }
-                        }
                     }
                     else
                     {
@@ -1110,35 +1138,64 @@ namespace TAO
             }
 
             /* Run through all the contracts in reverse order to disconnect. */
-            std::set<uint256_t> setAddresses;
             for(auto contract = vContracts.rbegin(); contract != vContracts.rend(); ++contract)
             {
                 contract->Bind(this);
                 if(!TAO::Register::Rollback(*contract, nFlags))
                     return false;
+            }
 
-                /* Erase our register index here now if not -client mode and setting enabled. */
-                if(!config::fClient.load() && config::fIndexRegister.load())
-                {
-                    /* Unpack the address we will be working on. */
-                    uint256_t hashAddress;
-                    if(!TAO::Register::Unpack(*contract, hashAddress))
-                        continue;
+            /* Reverse our stake change requests and register indexes. */
+            Deindex(nFlags);
 
-                    /* Check for duplicate entries. */
-                    if(setAddresses.count(hashAddress))
-                        continue;
+            return true;
+        }
 
-                    /* Check fo register in database. */
-                    if(!LLD::Logical->EraseRegisterTx(hashAddress))
-                        debug::warning(FUNCTION, "failed to erase register tx ", TAO::Register::Address(hashAddress).ToString());
 
-                    /* Push the address now. */
-                    setAddresses.insert(hashAddress);
+        /* Reverse what connecting a transaction changed outside of the consensus databases. */
+        void Transaction::Deindex(const uint8_t nFlags) const
+        {
+            /* If local database has a stake change request for a trust coinstake, update it to not processed. */
+            StakeChange tRequest;
+            if(nFlags == FLAGS::BLOCK && IsCoinStake() && IsTrust() && LLD::Local->ReadStakeChange(hashGenesis, tRequest))
+            {
+                /* Check for processed change that's also for this transaction. */
+                if(tRequest.fProcessed && tRequest.hashTx == GetHash()) //XXX: this is ugly, needs improvement
+                {
+                    /* Set the stake request to not processed now. */
+                    tRequest.fProcessed = false;
+                    tRequest.hashTx = 0;
+
+                    /* Update stake change request on disconnect. */
+                    if(!LLD::Local->WriteStakeChange(hashGenesis, tRequest))
+                        debug::error(FUNCTION, "unable to reinstate disconnected stake change request"); //don't fail
                 }
             }
 
-            return true;
+            /* Erase our register index here now if not -client mode and setting enabled. */
+            if(config::fClient.load() || !config::fIndexRegister.load())
+                return;
+
+            /* Run through all the contracts in reverse order. */
+            std::set<uint256_t> setAddresses;
+            for(auto contract = vContracts.rbegin(); contract != vContracts.rend(); ++contract)
+            {
+                /* Unpack the address we will be working on. */
+                uint256_t hashAddress;
+                if(!TAO::Register::Unpack(*contract, hashAddress))
+                    continue;
+
+                /* Check for duplicate entries. */
+                if(setAddresses.count(hashAddress))
+                    continue;
+
+                /* Check fo register in database. */
+                if(!LLD::Logical->EraseRegisterTx(hashAddress))
+                    debug::warning(FUNCTION, "failed to erase register tx ", TAO::Register::Address(hashAddress).ToString());
+
+                /* Push the address now. */
+                setAddresses.insert(hashAddress);
+            }
         }
 
 
@@ -1257,12 +1314,190 @@ namespace TAO
         }
 
 
+        /* Gets the serialized bytes of the transaction. */
+        std::shared_ptr<const std::vector<uint8_t>> Transaction::Bytes() const
+        {
+            /* Check for kept bytes. */
+            if(check_bytes(true))
+                return pBytes;
+
+            /* Serialize the transaction. */
+            DataStream ssTx(SER_NETWORK, LLP::PROTOCOL_VERSION);
+            ssTx << *this;
+
+            std::shared_ptr<const std::vector<uint8_t>> pRet =
+                std::make_shared<const std::vector<uint8_t>>(std::move(ssTx.Bytes()));
+
+            /* Keep them if the transaction is unchanged since it was deserialized. The hashed bytes stop short of the keys. */
+            if(fDecoded)
+            {
+                nHashBytes = static_cast<uint32_t>(pRet->size()
+                           - ::GetSerializeSize(vchPubKey, uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION)
+                           - ::GetSerializeSize(vchSig,    uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION));
+                pBytes     = pRet;
+            }
+
+            return pRet;
+        }
+
+
+        /* Keep the bytes a transaction was just read from a data stream. */
+        void Transaction::keep_bytes(const DataStream& s, const uint64_t nStart, const uint32_t nSerType) const
+        {
+            /* Bytes read without the keys don't cover a full serialization. */
+            pBytes.reset();
+            if(nSerType & (SER_SKIPPUB | SER_SKIPSIG))
+                return;
+
+            /* Sizes can be encoded more than one way, but every encoding of a transaction must have the same txid. Only
+             * the shortest encodings give our own serialized size, so keep the bytes only when they are our serialization,
+             * leaving any others to be serialized again when needed. */
+            if(s.GetPos() - nStart != ::GetSerializeSize(*this, SER_NETWORK, LLP::PROTOCOL_VERSION))
+                return;
+
+            /* Copy the bytes once, to be shared by every copy of this transaction. */
+            pBytes = std::make_shared<const std::vector<uint8_t>>(s.begin() + nStart, s.begin() + s.GetPos());
+
+            /* The hashed bytes stop short of the keys. */
+            nHashBytes = static_cast<uint32_t>(pBytes->size()
+                       - ::GetSerializeSize(vchPubKey, uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION)
+                       - ::GetSerializeSize(vchSig,    uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION));
+        }
+
+
+        /* Compares what is serialized into it against bytes already serialized, without copying them. */
+        class compare_stream
+        {
+            /** The bytes left to compare against. **/
+            const uint8_t* pCompare;
+            const uint8_t* pEnd;
+
+        public:
+
+            /** Flag for if everything serialized so far matched. **/
+            bool fMatch;
+
+
+            /** Constructor. **/
+            compare_stream(const uint8_t* pBegin, const uint8_t* pEndIn)
+            : pCompare (pBegin)
+            , pEnd     (pEndIn)
+            , fMatch   (true)
+            {
+            }
+
+
+            /** Compare bytes written to the stream. **/
+            compare_stream& write(const char* pch, const uint64_t nSize)
+            {
+                if(!fMatch || nSize > static_cast<uint64_t>(pEnd - pCompare) || std::memcmp(pCompare, pch, nSize) != 0)
+                    fMatch = false;
+                else
+                    pCompare += nSize;
+
+                return *this;
+            }
+
+
+            /** Serialize an object to compare. **/
+            template<typename Type>
+            compare_stream& operator<<(const Type& obj)
+            {
+                ::Serialize(*this, obj, uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION);
+                return *this;
+            }
+
+
+            /** Check that every byte was compared and matched. **/
+            bool Matched() const
+            {
+                return fMatch && pCompare == pEnd;
+            }
+        };
+
+
+        /* Check that the kept bytes still match our fields, dropping them if our fields were changed directly. */
+        bool Transaction::check_bytes(const bool fKeys) const
+        {
+            /* Check for kept bytes. */
+            if(!pBytes)
+                return false;
+
+            /* Contracts are only changed through methods that drop the bytes, so check the ledger layer that follows. */
+            const uint64_t nLedger = sizeof(nVersion) + sizeof(nSequence) + sizeof(nTimestamp) + sizeof(nKeyType)
+                + sizeof(nNextType) + ::GetSerializeSize(hashNext,    SER_NETWORK, LLP::PROTOCOL_VERSION) * 3
+                + ::GetSerializeSize(hashPrevTx, SER_NETWORK, LLP::PROTOCOL_VERSION);
+
+            /* The keys follow the hashed bytes. */
+            const uint8_t* pBegin = pBytes->data() + nHashBytes - std::min(nLedger, uint64_t(nHashBytes));
+            const uint8_t* pEnd   = pBytes->data() + (fKeys ? pBytes->size() : nHashBytes);
+
+            compare_stream ssCheck(pBegin, pEnd);
+            ssCheck << nVersion << nSequence << nTimestamp << hashNext << hashRecovery << hashGenesis << hashPrevTx;
+            ssCheck << nKeyType << nNextType;
+
+            if(fKeys)
+                ssCheck << vchPubKey << vchSig;
+
+            /* Check the kept bytes end with our fields. */
+            if(ssCheck.Matched())
+                return true;
+
+            /* Our fields were changed since the bytes were kept. */
+            fDecoded  = false;
+            hashCache = 0;
+            pBytes.reset();
+
+            return false;
+        }
+
+
+        /* Gets the number of kept serialized bytes that match a given serialization. */
+        uint64_t Transaction::SharedBytes(const uint32_t nSerType) const
+        {
+            /* Skipping keys has to serialize. */
+            if(!(nSerType & SER_GETHASH) && (nSerType & (SER_SKIPPUB | SER_SKIPSIG)))
+                return 0;
+
+            /* Check for kept bytes that still match our fields. */
+            if(!check_bytes(!(nSerType & SER_GETHASH)))
+                return 0;
+
+            /* Hashing only covers the bytes before the keys. */
+            if(nSerType & SER_GETHASH)
+                return nHashBytes;
+
+            return pBytes->size();
+        }
+
+
         /* Gets the hash of the transaction object. */
         uint512_t Transaction::GetHash(const bool fCacheOverride) const
         {
-            /* Check if we have an active cache. */
-            //if(hashCache != 0 && !fCacheOverride)
-            //    return hashCache;
+            /* Overriding the cache means the transaction may have been changed directly. */
+            if(fCacheOverride)
+            {
+                fDecoded = false;
+                pBytes.reset();
+            }
+
+            /* Drop the kept bytes if our fields were changed since they were kept. */
+            const bool fKept = check_bytes(false);
+
+            /* A transaction unchanged since it was deserialized only hashes its kept bytes once. */
+            if(fDecoded)
+            {
+                /* Check if we have an active cache. */
+                if(fKept && hashCache != 0)
+                    return hashCache;
+
+                /* Type of 0xff designates tritium tx. */
+                const std::shared_ptr<const std::vector<uint8_t>> pData = Bytes();
+                hashCache = LLC::SK512(pData->begin(), pData->begin() + nHashBytes);
+                hashCache.SetType(TAO::Ledger::TRITIUM);
+
+                return hashCache;
+            }
 
             /* Serialize the transaction data for hashing. */
             DataStream ss(SER_GETHASH, nVersion);
@@ -1276,6 +1511,55 @@ namespace TAO
         }
 
 
+        /* Gets the hashes of a batch of transactions. */
+        void Transaction::GetHashes(const std::vector<Transaction>& vtx, std::vector<uint512_t> &vHashes)
+        {
+            /* Serialize the transaction data for hashing, skipping the ones with a kept hash. */
+            std::vector<std::vector<uint8_t>> vData;
+            std::vector<uint32_t> vIndexes;
+            vData.reserve(vtx.size());
+            vHashes.resize(vtx.size());
+            for(uint32_t n = 0; n < vtx.size(); ++n)
+            {
+                const Transaction& tx = vtx[n];
+                const bool fKept = tx.check_bytes(false);
+                if(tx.fDecoded && fKept && tx.hashCache != 0)
+                {
+                    vHashes[n] = tx.hashCache;
+                    continue;
+                }
+
+                /* Use the kept bytes where we can. */
+                if(tx.fDecoded)
+                {
+                    const std::shared_ptr<const std::vector<uint8_t>> pData = tx.Bytes();
+                    vData.push_back(std::vector<uint8_t>(pData->begin(), pData->begin() + tx.nHashBytes));
+                }
+                else
+                {
+                    DataStream ss(SER_GETHASH, tx.nVersion);
+                    ss << tx;
+
+                    vData.push_back(ss.Bytes());
+                }
+
+                vIndexes.push_back(n);
+            }
+
+            /* Hash them in one batch. */
+            std::vector<uint512_t> vBatch;
+            LLC::SK512(vData, vBatch);
+            for(uint32_t n = 0; n < vIndexes.size(); ++n)
+            {
+                /* Type of 0xff designates tritium tx. */
+                vBatch[n].SetType(TAO::Ledger::TRITIUM);
+
+                vHashes[vIndexes[n]]        = vBatch[n];
+                vtx[vIndexes[n]].hashCache = vBatch[n];
+            }
+        }
+
+
         /* Gets a proof hash of the transaction object. */
         uint512_t Transaction::ProofHash() const
         {
@@ -1342,6 +1626,10 @@ namespace TAO
         /* Sets the Next Hash from the key */
         void Transaction::NextHash(const uint512_t& hashSecret)
         {
+            /* The next hash is serialized, so the kept bytes are no longer valid. */
+            fDecoded = false;
+            pBytes.reset();
+
             /* Set the next hash if void function. */
             hashNext = Transaction::NextHash(hashSecret, nNextType);
         }
@@ -1400,6 +1688,10 @@ namespace TAO
         /* Signs the transaction with the private key and sets the public key */
         bool Transaction::Sign(const uint512_t& hashSecret)
         {
+            /* Signing sets the public key and signature, invalidating the kept bytes. */
+            fDecoded = false;
+            pBytes.reset();
+
             /* Get the secret from new key. */
             std::vector<uint8_t> vBytes = hashSecret.GetBytes();
             LLC::CSecret vchSecret(vBytes.begin(), vBytes.end());
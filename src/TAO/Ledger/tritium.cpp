@@ -100,6 +100,7 @@ namespace TAO
             vOffsets       = block.vOffsets;
             vchBlockSig    = block.vchBlockSig;
             vMissing       = block.vMissing;
+            tMerkleTree    = block.tMerkleTree;
             hashMissing    = block.hashMissing;
             fConflicted    = block.fConflicted;
 
@@ -126,6 +127,7 @@ namespace TAO
             vOffsets       = std::move(block.vOffsets);
             vchBlockSig    = std::move(block.vchBlockSig);
             vMissing       = std::move(block.vMissing);
+            tMerkleTree    = std::move(block.tMerkleTree);
             hashMissing    = std::move(block.hashMissing);
             fConflicted    = std::move(block.fConflicted);
 
@@ -182,7 +184,30 @@ namespace TAO
             if(block.nVersion < 7)
                 throw debug::exception(FUNCTION, "invalid sync block version for tritium block");
 
+            /* Deserialize the tritium transactions up front so they can be hashed in one batch. */
+            std::vector<Transaction> vTritium;
+            for(uint32_t n = 0; n + 1 < block.vtx.size(); ++n)
+            {
+                /* Skip over other transaction types. */
+                if(block.vtx[n].first != TRANSACTION::TRITIUM)
+                    continue;
+
+                /* Serialize stream. */
+                DataStream ssData(block.vtx[n].second, SER_DISK, LLD::DATABASE_VERSION);
+
+                /* Build the transaction. */
+                Transaction tx;
+                ssData >> tx;
+
+                vTritium.push_back(tx);
+            }
+
+            /* Get the transaction hashes. */
+            std::vector<uint512_t> vHashes;
+            Transaction::GetHashes(vTritium, vHashes);
+
             /* Loop through transctions. */
+            uint32_t nTritium = 0;
             for(uint32_t n = 0; n < block.vtx.size(); ++n)
             {
                 /* Switch for type. */
@@ -191,26 +216,27 @@ namespace TAO
                     /* Check for tritium. */
                     case TRANSACTION::TRITIUM:
                     {
-                        /* Serialize stream. */
-                        DataStream ssData(block.vtx[n].second, SER_DISK, LLD::DATABASE_VERSION);
-
-                        /* Build the transaction. */
-                        Transaction tx;
-                        ssData >> tx;
-
                         /* Add transaction to binary data. */
                         if(n == block.vtx.size() - 1)
-                            producer = tx; //handle for the producer transaction
+                        {
+                            /* Serialize stream. */
+                            DataStream ssData(block.vtx[n].second, SER_DISK, LLD::DATABASE_VERSION);
+
+                            /* Build the producer transaction. */
+                            ssData >> producer;
+                        }
                         else
                         {
-                            /* Get the transaction hash */
-                            uint512_t hash = tx.GetHash();
+                            /* Get the transaction and its hash. */
+                            const Transaction& tx = vTritium[nTritium];
+                            const uint512_t& hash = vHashes[nTritium];
+                            ++nTritium;
 
                             /* Accept into memory pool. */
-                            if(!LLD::Ledger->HasTx(tx.GetHash()))
+                            if(!LLD::Ledger->HasTx(hash))
                                 mempool.AddUnchecked(tx);
 
-                            vtx.push_back(std::make_pair(block.vtx[n].first, tx.GetHash()));
+                            vtx.push_back(std::make_pair(block.vtx[n].first, hash));
                         }
 
                         break;
@@ -536,46 +562,53 @@ namespace TAO
                 return debug::error(FUNCTION, "hashMerkleRoot mismatch");
 
             /* Verify producer signature(s) (if not synchronizing) */
-            if(!TAO::Ledger::ChainState::Synchronizing())
+            if(!TAO::Ledger::ChainState::Synchronizing() && !VerifyProducer())
+                return false;
+
+            return true;
+        }
+
+
+        /* Verify the block signature against the producer's public key. */
+        bool TritiumBlock::VerifyProducer() const
+        {
+            /* Switch based on signature type. */
+            switch(producer.nKeyType)
             {
-                /* Switch based on signature type. */
-                switch(producer.nKeyType)
+                /* Support for the FALCON signature scheeme. */
+                case SIGNATURE::FALCON:
                 {
-                    /* Support for the FALCON signature scheeme. */
-                    case SIGNATURE::FALCON:
-                    {
-                        /* Create the FL Key object. */
-                        LLC::FLKey key;
+                    /* Create the FL Key object. */
+                    LLC::FLKey key;
 
-                        /* Set the public key and verify. */
-                        key.SetPubKey(producer.vchPubKey);
+                    /* Set the public key and verify. */
+                    key.SetPubKey(producer.vchPubKey);
 
-                        /* Check the Block Signature. */
-                        if(!VerifySignature(key))
-                            return debug::error(FUNCTION, "bad block signature");
+                    /* Check the Block Signature. */
+                    if(!VerifySignature(key))
+                        return debug::error(FUNCTION, "bad block signature");
 
-                        break;
-                    }
-
-                    /* Support for the BRAINPOOL signature scheme. */
-                    case SIGNATURE::BRAINPOOL:
-                    {
-                        /* Create EC Key object. */
-                        LLC::ECKey key = LLC::ECKey(LLC::BRAINPOOL_P512_T1, 64);
+                    break;
+                }
 
-                        /* Set the public key and verify. */
-                        key.SetPubKey(producer.vchPubKey);
+                /* Support for the BRAINPOOL signature scheme. */
+                case SIGNATURE::BRAINPOOL:
+                {
+                    /* Create EC Key object. */
+                    LLC::ECKey key = LLC::ECKey(LLC::BRAINPOOL_P512_T1, 64);
 
-                        /* Check the Block Signature. */
-                        if(!VerifySignature(key))
-                            return debug::error(FUNCTION, "bad block signature");
+                    /* Set the public key and verify. */
+                    key.SetPubKey(producer.vchPubKey);
 
-                        break;
-                    }
+                    /* Check the Block Signature. */
+                    if(!VerifySignature(key))
+                        return debug::error(FUNCTION, "bad block signature");
 
-                    default:
-                        return debug::error(FUNCTION, "unknown signature type");
+                    break;
                 }
+
+                default:
+                    return debug::error(FUNCTION, "unknown signature type");
             }
 
             return true;
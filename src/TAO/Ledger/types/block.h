@@ -17,6 +17,8 @@ ________________________________________________________________________________
 
 #include <LLC/types/uint1024.h>
 
+#include <TAO/Ledger/types/merkle_tree.h>
+
 #include <set>
 
 //forward declerations for BigNum
@@ -85,8 +87,8 @@ namespace TAO
             mutable std::vector<std::pair<uint8_t, uint512_t> > vMissing;
 
 
-            /** MEMORY ONLY: list of hashes used in computing merkle root. **/
-            mutable std::vector<uint512_t> vMerkleTree;
+            /** MEMORY ONLY: levels of hashes used in computing merkle root. **/
+            mutable MerkleTree tMerkleTree;
 
 
             /** MEMORY ONLY: hash of root block that missing tx's failed on. **/
@@ -285,6 +287,20 @@ namespace TAO
             uint512_t BuildMerkleTree(const std::vector<std::pair<uint8_t, uint512_t> >& vtx) const;
 
 
+            /** UpdateMerkleTree
+             *
+             *  Update the merkle tree after one transaction changed, such as a re-signed producer. Only the path of
+             *  that leaf is rehashed when the cached tree matches the rest of the list, otherwise it is rebuilt.
+             *
+             *  @param[in] vtx The list of hashes to build merkle tree with.
+             *  @param[in] nIndex The index of the changed transaction in vtx
+             *
+             *  @return The 512-bit merkle root
+             *
+             **/
+            uint512_t UpdateMerkleTree(const std::vector<uint512_t>& vtx, const uint32_t nIndex) const;
+
+
             /** GetMerkleBranch
              *
              *  Get the merkle branch of a transaction at given index.
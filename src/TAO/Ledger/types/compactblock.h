@@ -0,0 +1,163 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_COMPACTBLOCK_H
+#define NEXUS_TAO_LEDGER_TYPES_COMPACTBLOCK_H
+
+#include <TAO/Register/types/stream.h>
+
+#include <TAO/Ledger/types/block.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/templates/serialize.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        class BlockState;
+        class TritiumBlock;
+
+
+        /** CompactBlock
+         *
+         *  A tritium block for relay, with each transaction reference cut down to a 64 bit short id keyed by the block
+         *  hash. The receiver rebuilds the full block from the transactions it already has in its memory pool, and
+         *  only has to ask for the ones it doesn't.
+         *
+         **/
+        class CompactBlock : public Block
+        {
+        public:
+
+            /** The Block's timestamp. This number is locked into the signature hash. **/
+            uint64_t nTime;
+
+
+            /** Producer Transaction. **/
+            Transaction producer;
+
+
+            /** System Script
+             *
+             *  The critical system level pre-states and post-states.
+             *
+             **/
+            TAO::Register::Stream  ssSystem;
+
+
+            /** The short transaction ids.
+             *  uint8_t = TransactionType (per enum)
+             *  uint64_t = Short id of the tx hash
+             **/
+            std::vector<std::pair<uint8_t, uint64_t> > vShort;
+
+
+            /** Serialization **/
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(nVersion);
+                READWRITE(hashPrevBlock);
+                READWRITE(hashMerkleRoot);
+                READWRITE(nChannel);
+                READWRITE(nHeight);
+                READWRITE(nBits);
+                READWRITE(nNonce);
+                READWRITE(nTime);
+                READWRITE(vchBlockSig);
+                READWRITE(producer);
+                READWRITE(ssSystem);
+                READWRITE(vOffsets);
+                READWRITE(vShort);
+            )
+
+
+            /** The default constructor. **/
+            CompactBlock();
+
+
+            /** Copy constructor. **/
+            CompactBlock(const CompactBlock& block);
+
+
+            /** Move constructor. **/
+            CompactBlock(CompactBlock&& block) noexcept;
+
+
+            /** Copy assignment. **/
+            CompactBlock& operator=(const CompactBlock& block);
+
+
+            /** Move assignment. **/
+            CompactBlock& operator=(CompactBlock&& block) noexcept;
+
+
+            /** Default Destructor **/
+            virtual ~CompactBlock();
+
+
+            /** Copy Constructor. **/
+            CompactBlock(const TritiumBlock& block);
+
+
+            /** Copy Constructor. **/
+            CompactBlock(const BlockState& state);
+
+
+            /** SignatureHash
+             *
+             *  Get the Signature Hash of the block, the same as the tritium block it was built from.
+             *
+             *  @return Returns a 1024-bit signature hash.
+             *
+             **/
+            uint1024_t SignatureHash() const override;
+
+
+            /** ShortID
+             *
+             *  Get the short id of a transaction in a given block.
+             *
+             *  @param[in] hashBlock The hash of the block, keying the short ids so they can't be collided in advance.
+             *  @param[in] hashTx The hash of the transaction.
+             *
+             *  @return The 64 bit short id.
+             *
+             **/
+            static uint64_t ShortID(const uint1024_t& hashBlock, const uint512_t& hashTx);
+
+
+            /** Reconstruct
+             *
+             *  Rebuild the full tritium block from a pool of known transactions.
+             *
+             *  @param[in] vPool The types and hashes of the known transactions.
+             *  @param[out] block The rebuilt block.
+             *  @param[out] vMissing The positions in vShort that no known transaction, or more than one, matches.
+             *
+             *  @return True if every transaction was found and the merkle root matches.
+             *
+             **/
+            bool Reconstruct(const std::vector<std::pair<uint8_t, uint512_t> >& vPool,
+                             TritiumBlock &block, std::vector<uint32_t> &vMissing) const;
+
+        };
+    }
+}
+
+#endif
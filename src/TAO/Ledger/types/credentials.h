@@ -24,6 +24,7 @@ ________________________________________________________________________________
 #include <Util/include/mutex.h>
 #include <Util/include/memory.h>
 
+#include <map>
 #include <string>
 
 /* Global TAO namespace. */
@@ -62,6 +63,10 @@ namespace TAO
             mutable std::pair<uint32_t, SecureString> pairCache;
 
 
+            /** Internal cache of typed keys by (type, sequence), holding a hash of the secret they were derived with and the key. **/
+            mutable std::map<std::pair<std::string, uint32_t>, std::pair<uint256_t, SecureString>> mapKeys;
+
+
             /** Internal genesis hash. **/
             const uint256_t hashGenesis;
 
@@ -182,6 +187,19 @@ namespace TAO
             uint512_t Generate(const std::string& strType, const uint32_t nKeyID, const SecureString& strSecret) const;
 
 
+            /** Prepare
+             *
+             *  Derives the private keys for the given key types concurrently and stores them in the key cache, so that
+             *  following calls to Generate, Key or KeyHash for these types don't have to wait on argon2 one by one.
+             *
+             *  @param[in] vTypes The types of signing keys to derive.
+             *  @param[in] nKeyID The key number in the keychian
+             *  @param[in] strSecret The secret phrase to use
+             *
+             **/
+            void Prepare(const std::vector<std::string>& vTypes, const uint32_t nKeyID, const SecureString& strSecret) const;
+
+
             /** Generate
              *
              *  This function is responsible for generating a private key from a seed phrase.  By comparison to the other Generate
@@ -0,0 +1,292 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_HEADER_INDEX_H
+#define NEXUS_TAO_LEDGER_TYPES_HEADER_INDEX_H
+
+#include <LLC/types/uint1024.h>
+
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        class BlockState;
+
+
+        /** HeaderIndex
+         *
+         *  Compact headers of the most recent blocks held in memory, linked to their previous and next blocks and
+         *  to the last block of every channel at or before them. Walks back the chain by channel, or to the fork
+         *  of two chains, hop through the links instead of reading each full block state from the ledger.
+         *
+         *  A missing link is unknown rather than absent, and callers fall back to walking the ledger.
+         *
+         **/
+        class HeaderIndex
+        {
+        public:
+
+            /** The number of channels linked, up to the private channel. **/
+            static const uint32_t CHANNELS = 4;
+
+
+            /** Header
+             *
+             *  The compact header of a block, and its links.
+             *
+             **/
+            struct Header
+            {
+                /** The block hash. **/
+                uint1024_t hash;
+
+
+                /** The block height. **/
+                uint32_t nHeight;
+
+
+                /** The block channel. **/
+                uint32_t nChannel;
+
+
+                /** The block difficulty bits. **/
+                uint32_t nBits;
+
+
+                /** The block timestamp. **/
+                uint64_t nTime;
+
+
+                /** The chain trust up to the block. **/
+                uint64_t nChainTrust;
+
+
+                /** The previous block. **/
+                Header* pprev;
+
+
+                /** The next block in the best chain. **/
+                Header* pnext;
+
+
+                /** The last block of each channel, at or before this block. **/
+                Header* plast[CHANNELS];
+            };
+
+        private:
+
+            /* Hash the block hashes by their low bits, which proof of work leaves random. */
+            struct hasher
+            {
+                size_t operator()(const uint1024_t& hash) const
+                {
+                    return static_cast<size_t>(hash.Get64(0));
+                }
+            };
+
+
+            /** Mutex for thread concurrency. **/
+            mutable std::mutex MUTEX;
+
+
+            /** The headers by block hash. **/
+            std::unordered_map<uint1024_t, Header, hasher> mapHeaders;
+
+
+            /** The number of most recent heights to keep. **/
+            uint32_t nMaxHeights;
+
+
+            /** The highest block height indexed. **/
+            uint32_t nTop;
+
+
+            /** The lowest block height indexed. **/
+            uint32_t nFloor;
+
+
+            /* Find a header by hash, or nullptr if it isn't indexed. */
+            Header* find(const uint1024_t& hash);
+
+
+            /* Find a header by hash, or nullptr if it isn't indexed. */
+            const Header* find(const uint1024_t& hash) const;
+
+
+            /* Add a header, linked to its previous block if it is indexed. */
+            Header* insert(const Header& header, const uint1024_t& hashPrev);
+
+
+            /* Remove headers, clearing every link to them. */
+            void remove(const std::vector<uint1024_t>& vHashes);
+
+
+            /* Remove the headers that have fallen out of the most recent heights. */
+            void prune();
+
+        public:
+
+            /** Constructor
+             *
+             *  @param[in] nMaxIn The number of most recent heights to keep.
+             *
+             **/
+            HeaderIndex(const uint32_t nMaxIn = 10000);
+
+
+            /** Copy Constructor. **/
+            HeaderIndex(const HeaderIndex& index) = delete;
+
+
+            /** Copy Assignment. **/
+            HeaderIndex& operator=(const HeaderIndex& index) = delete;
+
+
+            /** Load
+             *
+             *  Fill the index from the ledger, walking back from the best block.
+             *
+             *  @param[in] stateBest The best block in the chain.
+             *  @param[in] nMaxIn The number of most recent heights to keep.
+             *
+             *  @return The number of headers loaded.
+             *
+             **/
+            uint32_t Load(const BlockState& stateBest, const uint32_t nMaxIn);
+
+
+            /** Insert
+             *
+             *  Add the header of a block state that was written to the ledger.
+             *
+             *  @param[in] state The block state to add.
+             *
+             **/
+            void Insert(const BlockState& state);
+
+
+            /** Connect
+             *
+             *  Link a block as the next block of its previous block.
+             *
+             *  @param[in] hash The hash of the connected block.
+             *
+             **/
+            void Connect(const uint1024_t& hash);
+
+
+            /** Disconnect
+             *
+             *  Unlink a block from being the next block of its previous block.
+             *
+             *  @param[in] hash The hash of the disconnected block.
+             *
+             **/
+            void Disconnect(const uint1024_t& hash);
+
+
+            /** Erase
+             *
+             *  Remove the header of a block erased from the ledger.
+             *
+             *  @param[in] hash The hash of the erased block.
+             *
+             **/
+            void Erase(const uint1024_t& hash);
+
+
+            /** Has
+             *
+             *  Check if a block is indexed.
+             *
+             *  @param[in] hash The block hash.
+             *
+             **/
+            bool Has(const uint1024_t& hash) const;
+
+
+            /** Next
+             *
+             *  Get the next block in the best chain.
+             *
+             *  @param[in] hash The block hash.
+             *  @param[out] hashNext The hash of the next block.
+             *
+             *  @return True if the next block is indexed.
+             *
+             **/
+            bool Next(const uint1024_t& hash, uint1024_t &hashNext) const;
+
+
+            /** Last
+             *
+             *  Get the last block of a channel at or before a block, not counting the genesis.
+             *
+             *  @param[in] hash The block hash to search back from.
+             *  @param[in] nChannel The channel to search for.
+             *  @param[out] hashLast The hash of the last block of the channel.
+             *
+             *  @return True if the last block is indexed.
+             *
+             **/
+            bool Last(const uint1024_t& hash, const uint32_t nChannel, uint1024_t &hashLast) const;
+
+
+            /** Fork
+             *
+             *  Find the blocks to disconnect and connect to move the best chain to a new block.
+             *
+             *  @param[in] hashBest The hash of the best block.
+             *  @param[in] hashNew The hash of the new best block.
+             *  @param[out] vDisconnect The blocks to disconnect, from the best block back.
+             *  @param[out] vConnect The blocks to connect, from the new block back.
+             *  @param[out] hashFork The hash of the block both chains share.
+             *
+             *  @return True if both chains are indexed back to the fork.
+             *
+             **/
+            bool Fork(const uint1024_t& hashBest, const uint1024_t& hashNew,
+                      std::vector<uint1024_t> &vDisconnect, std::vector<uint1024_t> &vConnect, uint1024_t &hashFork) const;
+
+
+            /** Size
+             *
+             *  Get the number of headers indexed.
+             *
+             **/
+            uint32_t Size() const;
+
+
+            /** Clear
+             *
+             *  Remove all headers.
+             *
+             **/
+            void Clear();
+
+        };
+
+        extern HeaderIndex headers;
+    }
+}
+
+#endif
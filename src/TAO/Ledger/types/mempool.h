@@ -316,6 +316,16 @@ namespace TAO
             bool List(std::vector<uint512_t> &vHashes, uint32_t nCount = std::numeric_limits<uint32_t>::max(), bool fLegacy = false);
 
 
+            /** Hashes
+             *
+             *  Get the type and hash of every transaction in the pool, including conflicted ones.
+             *
+             *  @param[out] vtx The transaction types and hashes, typed as in a block's vtx.
+             *
+             **/
+            void Hashes(std::vector<std::pair<uint8_t, uint512_t>> &vtx) const;
+
+
             /** Size
              *
              *  Gets the size of the memory pool.
@@ -123,9 +123,13 @@ namespace TAO
                     READWRITE(vMerkleBranch);
                     READWRITE(nIndex);
 
-                    /* Reset our cache if deserializing. */
+                    /* Reset our cache if deserializing, the kept bytes only cover the base transaction. */
                     if(fRead)
+                    {
                         hashCache = 0;
+                        pBytes.reset();
+                        fDecoded  = false;
+                    }
                 }
             )
 
@@ -0,0 +1,163 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_MERKLE_TREE_H
+#define NEXUS_TAO_LEDGER_TYPES_MERKLE_TREE_H
+
+#include <LLC/types/uint1024.h>
+
+#include <vector>
+
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /** @class MerkleTree
+         *
+         *  Holds every level of a block's merkle tree, from the transaction hashes up to the root. An odd node out on
+         *  any level is paired with itself. Large levels are hashed in parallel chunks, and leaves can be appended
+         *  or replaced by recomputing only their path to the root.
+         *
+         **/
+        class MerkleTree
+        {
+            /** The levels of the tree, leaves first. **/
+            std::vector<std::vector<uint512_t>> vLevels;
+
+        public:
+
+            /** Default Constructor. **/
+            MerkleTree();
+
+
+            /** Copy Constructor. **/
+            MerkleTree(const MerkleTree& tree);
+
+
+            /** Move Constructor. **/
+            MerkleTree(MerkleTree&& tree) noexcept;
+
+
+            /** Copy Assignment Operator **/
+            MerkleTree& operator=(const MerkleTree& tree);
+
+
+            /** Move Assignment Operator **/
+            MerkleTree& operator=(MerkleTree&& tree) noexcept;
+
+
+            /** Destructor. **/
+            ~MerkleTree();
+
+
+            /** Constructor
+             *
+             *  Build a tree from a list of leaves.
+             *
+             *  @param[in] vLeaves The transaction hashes.
+             *
+             **/
+            explicit MerkleTree(const std::vector<uint512_t>& vLeaves);
+
+
+            /** Build
+             *
+             *  Build the tree from a list of leaves, replacing anything already held.
+             *
+             *  @param[in] vLeaves The transaction hashes.
+             *
+             *  @return The merkle root.
+             *
+             **/
+            uint512_t Build(const std::vector<uint512_t>& vLeaves);
+
+
+            /** Append
+             *
+             *  Add a leaf to the end of the tree, recomputing the right edge only.
+             *
+             *  @param[in] hashLeaf The transaction hash to add.
+             *
+             *  @return The new merkle root.
+             *
+             **/
+            uint512_t Append(const uint512_t& hashLeaf);
+
+
+            /** Update
+             *
+             *  Replace a leaf, recomputing its path to the root only.
+             *
+             *  @param[in] nIndex The index of the leaf.
+             *  @param[in] hashLeaf The new transaction hash.
+             *
+             *  @return The new merkle root.
+             *
+             **/
+            uint512_t Update(const uint32_t nIndex, const uint512_t& hashLeaf);
+
+
+            /** Root
+             *
+             *  Get the merkle root, or zero for an empty tree.
+             *
+             **/
+            uint512_t Root() const;
+
+
+            /** Branch
+             *
+             *  Get the merkle branch proving a leaf, checked with Block::CheckMerkleBranch.
+             *
+             *  @param[in] nIndex The index of the leaf.
+             *
+             *  @return The sibling hashes from the leaf level up.
+             *
+             **/
+            std::vector<uint512_t> Branch(uint32_t nIndex) const;
+
+
+            /** Leaves
+             *
+             *  Get the leaves of the tree.
+             *
+             **/
+            const std::vector<uint512_t>& Leaves() const;
+
+
+            /** Size
+             *
+             *  Get the number of leaves in the tree.
+             *
+             **/
+            uint32_t Size() const;
+
+
+            /** Clear
+             *
+             *  Remove every level of the tree.
+             *
+             **/
+            void Clear();
+
+        };
+    }
+}
+
+#endif
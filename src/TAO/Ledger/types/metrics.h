@@ -0,0 +1,388 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_METRICS_H
+#define NEXUS_TAO_LEDGER_TYPES_METRICS_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/serialize.h>
+
+#include <map>
+#include <mutex>
+#include <set>
+
+/* Forward declarations. */
+namespace Legacy { class Transaction; }
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        class BlockState;
+        class Transaction;
+
+
+        /** Volume
+         *
+         *  Volume totals accumulated over the chain up to and including a block, kept by height so the volume over
+         *  any range of blocks is the difference of two records.
+         *
+         **/
+        class Volume
+        {
+        public:
+
+            /** The height the totals started accumulating from. **/
+            uint32_t nFirst;
+
+
+            /** The timestamp of the block. **/
+            uint64_t nTime;
+
+
+            /** The number of transactions. **/
+            uint64_t nTransactions;
+
+
+            /** The number of contracts. **/
+            uint64_t nContracts;
+
+
+            /** The number of accounts active in each block. **/
+            uint64_t nAccounts;
+
+
+            /** The amount deposited from legacy. **/
+            uint64_t nDeposits;
+
+
+            /** The amount withdrawn to legacy. **/
+            uint64_t nWithdraws;
+
+
+            /** The amount minted by coinbase. **/
+            uint64_t nMining;
+
+
+            /** The amount minted by trust and genesis. **/
+            uint64_t nStaking;
+
+
+            /** The change in stake. **/
+            int64_t nStakeChange;
+
+
+            /** Default Constructor. **/
+            Volume();
+
+
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(nFirst);
+                READWRITE(nTime);
+                READWRITE(nTransactions);
+                READWRITE(nContracts);
+                READWRITE(nAccounts);
+                READWRITE(nDeposits);
+                READWRITE(nWithdraws);
+                READWRITE(nMining);
+                READWRITE(nStaking);
+                READWRITE(nStakeChange);
+            )
+
+
+            /** Subtract
+             *
+             *  Remove the totals of an earlier record, leaving the volume of the blocks between them.
+             *
+             *  @param[in] tVolume The earlier record.
+             *
+             **/
+            Volume& operator-=(const Volume& tVolume);
+
+
+            /** Add
+             *
+             *  Add the contracts of a tritium transaction, counting accounts not yet seen in this block.
+             *
+             *  @param[in] tx The transaction to add.
+             *  @param[out] setAccounts The accounts seen in this block.
+             *
+             **/
+            void Add(const Transaction& tx, std::set<uint256_t> &setAccounts);
+
+
+            /** Add
+             *
+             *  Add the outputs of a legacy transaction, counting accounts not yet seen in this block.
+             *
+             *  @param[in] tx The transaction to add.
+             *  @param[out] setAccounts The accounts seen in this block.
+             *
+             **/
+            void Add(const Legacy::Transaction& tx, std::set<uint256_t> &setAccounts);
+        };
+
+
+        /** Metrics
+         *
+         *  Running totals of the registers, names and stake on the chain as of a given best block.
+         *
+         **/
+        class Metrics
+        {
+        public:
+
+            /** The best block these totals are as of. **/
+            uint1024_t hashBest;
+
+
+            /** The number of registers by address type. **/
+            std::map<uint8_t, uint64_t> mapRegisters;
+
+
+            /** The number of names in the global namespace. **/
+            uint64_t nGlobalNames;
+
+
+            /** The number of names in user namespaces. **/
+            uint64_t nNamespacedNames;
+
+
+            /** The number of assets owned by tokens. **/
+            uint64_t nTokenized;
+
+
+            /** The number of trust accounts with stake. **/
+            uint64_t nStakers;
+
+
+            /** The total stake of all trust accounts. **/
+            uint64_t nStake;
+
+
+            /** The total trust of trust accounts with stake. **/
+            uint64_t nTrust;
+
+
+            /** Default Constructor. **/
+            Metrics();
+
+
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(hashBest);
+                READWRITE(mapRegisters);
+                READWRITE(nGlobalNames);
+                READWRITE(nNamespacedNames);
+                READWRITE(nTokenized);
+                READWRITE(nStakers);
+                READWRITE(nStake);
+                READWRITE(nTrust);
+            )
+
+
+            /** Registers
+             *
+             *  Get the number of registers of a given address type.
+             *
+             *  @param[in] nType The address type to count.
+             *
+             *  @return The number of registers.
+             *
+             **/
+            uint64_t Registers(const uint8_t nType) const;
+
+
+            /** Registers
+             *
+             *  Get the number of registers of every type.
+             *
+             *  @return The number of registers.
+             *
+             **/
+            uint64_t Registers() const;
+
+
+            /** Apply
+             *
+             *  Apply the contracts of a transaction that was connected, or reverse them for one that was disconnected.
+             *
+             *  @param[in] tx The transaction to apply.
+             *  @param[in] fConnect Flag for if the transaction was connected, otherwise disconnected.
+             *
+             **/
+            void Apply(const Transaction& tx, const bool fConnect);
+
+
+            /** Scan
+             *
+             *  Count our totals from the registers in the register database.
+             *
+             **/
+            void Scan();
+        };
+
+
+        /** Aggregator
+         *
+         *  Keeps the running metrics of the chain as blocks are connected and disconnected, persisted with the best
+         *  chain pointer, and the volume records of the most recent heights.
+         *
+         **/
+        class Aggregator
+        {
+            /** Mutex for thread concurrency. **/
+            mutable std::mutex MUTEX;
+
+
+            /** Our running metrics. **/
+            Metrics tMetrics;
+
+
+            /** Flag for if our metrics are consistent with the best chain. **/
+            bool fReady;
+
+
+            /** The number of most recent heights to keep volume records for. **/
+            uint32_t nMaxHeights;
+
+        public:
+
+            /** Default Constructor. **/
+            Aggregator();
+
+
+            /** Copy Constructor. **/
+            Aggregator(const Aggregator& aggregator) = delete;
+
+
+            /** Copy Assignment. **/
+            Aggregator& operator=(const Aggregator& aggregator) = delete;
+
+
+            /** Load
+             *
+             *  Read our metrics from the ledger, counting them from the register database if they aren't as of the
+             *  best block.
+             *
+             *  @param[in] hashBest The hash of the best block.
+             *  @param[in] nMaxIn The number of most recent heights to keep volume records for.
+             *
+             **/
+            void Load(const uint1024_t& hashBest, const uint32_t nMaxIn);
+
+
+            /** Connect
+             *
+             *  Apply a transaction that was connected to the running metrics.
+             *
+             *  @param[in] tx The transaction that was connected.
+             *
+             **/
+            void Connect(const Transaction& tx);
+
+
+            /** Disconnect
+             *
+             *  Reverse a transaction that was disconnected from the running metrics.
+             *
+             *  @param[in] tx The transaction that was disconnected.
+             *
+             **/
+            void Disconnect(const Transaction& tx);
+
+
+            /** Connect
+             *
+             *  Write the volume record of a connected block, pruning the record that fell out of the recent heights.
+             *
+             *  @param[in] state The block that was connected.
+             *  @param[in] tVolume The volume of the block's transactions.
+             *
+             **/
+            void Connect(const BlockState& state, const Volume& tVolume);
+
+
+            /** Disconnect
+             *
+             *  Erase the volume record of a disconnected block.
+             *
+             *  @param[in] state The block that was disconnected.
+             *
+             **/
+            void Disconnect(const BlockState& state);
+
+
+            /** Commit
+             *
+             *  Write our running metrics along with a new best chain pointer.
+             *
+             *  @param[in] hashBest The hash of the new best block.
+             *
+             **/
+            void Commit(const uint1024_t& hashBest);
+
+
+            /** Restore
+             *
+             *  Put back running metrics copied before a reorganization that failed, as its database transaction is
+             *  aborted along with the transactions applied since.
+             *
+             *  @param[in] tMetricsIn The running metrics to restore.
+             *
+             **/
+            void Restore(const Metrics& tMetricsIn);
+
+
+            /** Get
+             *
+             *  Get a copy of our running metrics.
+             *
+             *  @param[out] tMetricsOut The running metrics.
+             *
+             *  @return true if our metrics are consistent with the best chain.
+             *
+             **/
+            bool Get(Metrics &tMetricsOut) const;
+
+
+            /** Window
+             *
+             *  Get the volume of the blocks up to a best block with timestamps within a number of seconds of a given
+             *  time, finding the first block by its record.
+             *
+             *  @param[in] state The best block to end the window at.
+             *  @param[in] nTime The time the window is measured back from.
+             *  @param[in] nSeconds The length of the window.
+             *  @param[out] tVolume The volume of the blocks in the window.
+             *
+             *  @return true if our records cover the whole window.
+             *
+             **/
+            bool Window(const BlockState& state, const uint64_t nTime, const uint64_t nSeconds, Volume &tVolume) const;
+        };
+
+
+        /** The running metrics of the chain. **/
+        extern Aggregator aggregator;
+    }
+}
+
+#endif
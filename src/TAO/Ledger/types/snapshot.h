@@ -0,0 +1,133 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_SNAPSHOT_H
+#define NEXUS_TAO_LEDGER_TYPES_SNAPSHOT_H
+
+#include <LLC/types/uint1024.h>
+
+#include <Util/templates/serialize.h>
+
+#include <string>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /** Snapshot
+         *
+         *  Manifest of a snapshot of the consensus databases at a block, so a node can start validating from that
+         *  block without connecting the chain below it.
+         *
+         *  Records are exported in chunks ordered by database, keychain bucket and key, leaving out what each node
+         *  writes for itself and what isn't on the best chain, so nodes at the same block with the same indexing
+         *  arguments export the same bytes. The manifest holds the hash of every chunk, so chunks can be streamed
+         *  and checked one at a time, and the hash of the manifest identifies the snapshot.
+         *
+         **/
+        class Snapshot
+        {
+        public:
+
+            /** The version of the snapshot format. **/
+            uint32_t nVersion;
+
+
+            /** The height of the block the snapshot was taken at. **/
+            uint32_t nHeight;
+
+
+            /** The hash of the block the snapshot was taken at. **/
+            uint1024_t hashBlock;
+
+
+            /** The keychain buckets of each database, since records are stored by bucket. **/
+            std::vector< std::pair<uint16_t, uint32_t> > vBuckets;
+
+
+            /** The database and hash of each chunk, in order. **/
+            std::vector< std::pair<uint16_t, uint256_t> > vChunks;
+
+
+            /** Default Constructor. **/
+            Snapshot();
+
+
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(nVersion);
+                READWRITE(nHeight);
+                READWRITE(hashBlock);
+                READWRITE(vBuckets);
+                READWRITE(vChunks);
+            )
+
+
+            /** GetHash
+             *
+             *  Get the hash of the manifest, which identifies the snapshot.
+             *
+             *  @return The snapshot hash.
+             *
+             **/
+            uint256_t GetHash() const;
+
+
+            /** Export
+             *
+             *  Export the consensus databases at the best block into a directory. The databases must not be
+             *  written to while exporting.
+             *
+             *  @param[in] strPath The directory to export to.
+             *
+             *  @return True if the snapshot was exported, false otherwise.
+             *
+             **/
+            bool Export(const std::string& strPath);
+
+
+            /** Verify
+             *
+             *  Read the manifest from a directory and check it against -snapshothash, then check every chunk
+             *  against the manifest.
+             *
+             *  @param[in] strPath The directory to verify.
+             *
+             *  @return True if the snapshot is the one configured and all of its chunks are intact.
+             *
+             **/
+            bool Verify(const std::string& strPath);
+
+
+            /** Import
+             *
+             *  Verify a snapshot and write its chunks in bulk into empty consensus databases, setting its block as
+             *  the best chain.
+             *
+             *  @param[in] strPath The directory to import from.
+             *
+             *  @return True if the snapshot was imported, false otherwise.
+             *
+             **/
+            bool Import(const std::string& strPath);
+        };
+    }
+}
+
+#endif
@@ -19,6 +19,8 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/types/block.h>
 
+#include <functional>
+
 namespace Legacy
 {
     class LegacyBlock;
@@ -264,6 +266,19 @@ namespace TAO
             bool Connect();
 
 
+            /** Connect
+             *
+             *  Connect a block state into chain, leaving what it changes outside the consensus databases (wallets,
+             *  API indexes, local stake changes) for the caller to apply once its batch is committed.
+             *
+             *  @param[out] vEffects The changes outside the consensus databases, in the order to apply them.
+             *
+             *  @return true if connected.
+             *
+             **/
+            bool Connect(std::vector<std::function<void()>> &vEffects);
+
+
             /** Disconnect
              *
              *  Remove a block state from the chain.
@@ -274,6 +289,19 @@ namespace TAO
             bool Disconnect();
 
 
+            /** Disconnect
+             *
+             *  Remove a block state from the chain, leaving what it changes outside the consensus databases (wallets,
+             *  API indexes) for the caller to apply once its batch is committed.
+             *
+             *  @param[out] vEffects The changes outside the consensus databases, in the order to apply them.
+             *
+             *  @return true if disconnected.
+             *
+             **/
+            bool Disconnect(std::vector<std::function<void()>> &vEffects);
+
+
             /** Trust
              *
              *  Get the trust of this block.
@@ -16,6 +16,10 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/enum.h>
 
+#include <Util/templates/datastream.h>
+#include <Util/templates/flatdata.h>
+
+#include <memory>
 #include <vector>
 
 namespace TAO::API { class Transaction; }
@@ -41,6 +45,37 @@ namespace TAO::Ledger
         friend class MerkleTx;
         friend class TAO::API::Transaction;
 
+
+        /* Streams that can't give back the bytes they were read from have no position. */
+        template<typename Stream>
+        static uint64_t stream_position(const Stream& s)
+        {
+            return 0;
+        }
+
+
+        /* Get the read position of a data stream. */
+        static uint64_t stream_position(const DataStream& s)
+        {
+            return s.GetPos();
+        }
+
+
+        /* Streams that can't give back the bytes they were read from leave them to be serialized when needed. */
+        template<typename Stream>
+        void keep_bytes(const Stream& s, const uint64_t nStart, const uint32_t nSerType) const
+        {
+            pBytes.reset();
+        }
+
+
+        /* Keep the bytes a transaction was just read from a data stream. */
+        void keep_bytes(const DataStream& s, const uint64_t nStart, const uint32_t nSerType) const;
+
+
+        /* Check that the kept bytes still match our fields, dropping them if our fields were changed directly. */
+        bool check_bytes(const bool fKeys) const;
+
     protected:
 
         /** For disk indexing on contract. **/
@@ -94,34 +129,61 @@ namespace TAO::Ledger
         mutable uint512_t hashCache;
 
 
+        /** MEMORY ONLY: the serialized bytes of a transaction unchanged since it was deserialized, shared by copies. **/
+        mutable std::shared_ptr<const std::vector<uint8_t>> pBytes;
+
+
+        /** MEMORY ONLY: the number of leading serialized bytes that are hashed for the txid. **/
+        mutable uint32_t nHashBytes;
+
+
+        /** MEMORY ONLY: flag that the transaction is unchanged since it was deserialized. **/
+        mutable bool fDecoded;
+
+
         /* serialization macros */
         IMPLEMENT_SERIALIZE
         (
-            /* Operations layers. */
-            READWRITE(vContracts);
-
-            /* Ledger layer */
-            READWRITE(nVersion);
-            READWRITE(nSequence);
-            READWRITE(nTimestamp);
-            READWRITE(hashNext);
-            READWRITE(hashRecovery);
-            READWRITE(hashGenesis);
-            READWRITE(hashPrevTx);
-            READWRITE(nKeyType);
-            READWRITE(nNextType);
-
-            /* Check for skipping public key. */
-            if(!(nSerType & SER_GETHASH) && !(nSerType & SER_SKIPPUB))
-                READWRITE(vchPubKey);
-
-            /* Handle for when not getting hash or skipsig. */
-            if(!(nSerType & SER_GETHASH) && !(nSerType & SER_SKIPSIG))
-                READWRITE(vchSig);
-
-            /* Reset our cache if deserializing. */
-            if(!(nSerType & SER_GETHASH) && fRead)
-                hashCache = 0;
+            /* Write the shared bytes when they cover this serialization, rather than every contract again. */
+            const uint64_t nShared = SharedBytes(nSerType);
+            if(!fRead && nShared > 0)
+                READWRITE(REF(FlatData((char*)pBytes->data(), (char*)pBytes->data() + nShared)));
+            else
+            {
+                /* Track where the transaction starts, to keep the bytes it was read from. */
+                const uint64_t nStart = stream_position(s);
+
+                /* Operations layers. */
+                READWRITE(vContracts);
+
+                /* Ledger layer */
+                READWRITE(nVersion);
+                READWRITE(nSequence);
+                READWRITE(nTimestamp);
+                READWRITE(hashNext);
+                READWRITE(hashRecovery);
+                READWRITE(hashGenesis);
+                READWRITE(hashPrevTx);
+                READWRITE(nKeyType);
+                READWRITE(nNextType);
+
+                /* Check for skipping public key. */
+                if(!(nSerType & SER_GETHASH) && !(nSerType & SER_SKIPPUB))
+                    READWRITE(vchPubKey);
+
+                /* Handle for when not getting hash or skipsig. */
+                if(!(nSerType & SER_GETHASH) && !(nSerType & SER_SKIPSIG))
+                    READWRITE(vchSig);
+
+                /* Reset our cache if deserializing. */
+                if(!(nSerType & SER_GETHASH) && fRead)
+                {
+                    hashCache = 0;
+                    fDecoded  = true;
+
+                    keep_bytes(s, nStart, nSerType);
+                }
+            }
         )
 
 
@@ -303,6 +365,17 @@ namespace TAO::Ledger
         bool Disconnect(const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
 
 
+        /** Deindex
+         *
+         *  Reverse what connecting a transaction changed outside of the consensus databases: our stake change
+         *  requests and register indexes.
+         *
+         *  @param[in] nFlags Flag to tell whether transaction is a mempool check.
+         *
+         **/
+        void Deindex(const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK) const;
+
+
         /** IsCoinBase
          *
          *  Determines if the transaction is a coinbase transaction.
@@ -400,6 +473,40 @@ namespace TAO::Ledger
         uint512_t GetHash(const bool fCacheOverride = false) const;
 
 
+        /** Bytes
+         *
+         *  Gets the serialized bytes of the transaction. A transaction unchanged since it was deserialized keeps them,
+         *  so its hash, relay and disk writes all reuse one buffer, and copies share it.
+         *
+         *  @return The serialized bytes.
+         *
+         **/
+        std::shared_ptr<const std::vector<uint8_t>> Bytes() const;
+
+
+        /** SharedBytes
+         *
+         *  Gets the number of kept serialized bytes that match a given serialization.
+         *
+         *  @param[in] nSerType The serialization type.
+         *
+         *  @return The number of bytes, or zero if the transaction has to be serialized.
+         *
+         **/
+        uint64_t SharedBytes(const uint32_t nSerType) const;
+
+
+        /** GetHashes
+         *
+         *  Gets the hashes of a batch of transactions, hashing their serialized data side by side.
+         *
+         *  @param[in] vtx The transactions to hash.
+         *  @param[out] vHashes The hashes, in the same order as vtx.
+         *
+         **/
+        static void GetHashes(const std::vector<Transaction>& vtx, std::vector<uint512_t> &vHashes);
+
+
         /** ProofHash
          *
          *  Gets a proof hash of the transaction object.
@@ -177,6 +177,15 @@ namespace TAO
             bool Check() const override;
 
 
+            /** VerifyProducer
+             *
+             *  Verify the block signature against the producer's public key. This needs no chain state, so it can be
+             *  checked before the block is connected.
+             *
+             **/
+            bool VerifyProducer() const;
+
+
             /** Accept
              *
              *  Accept a tritium block with chain state parameters.
@@ -23,9 +23,14 @@ ________________________________________________________________________________
 #include <Util/include/runtime.h>
 #include <Util/include/version.h>
 
+#include <Util/templates/ringbuffer.h>
+
+#include <algorithm>
 #include <cstdarg>
 #include <cstdio>
 #include <map>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include <iostream>
@@ -75,6 +80,170 @@ namespace debug
     uint32_t nLogSizeMB;
 
 
+    /* Flag to tell if log output goes through the background writer. */
+    std::atomic<bool> fLogAsync(false);
+
+
+    namespace
+    {
+        /* A log record waiting for the background writer. */
+        struct LogRecord
+        {
+            /* Timestamp in milliseconds the record was logged. */
+            uint64_t nTimestamp;
+
+            /* The formatted log output. */
+            std::string strDebug;
+        };
+
+
+        /* The ring buffers of every thread that has logged. */
+        std::vector<std::shared_ptr<ringbuffer<LogRecord>>> vLogRings;
+
+
+        /* Mutex to protect the list of ring buffers, only taken on a thread's first record. */
+        std::mutex RINGS_MUTEX;
+
+
+        /* The number of records each thread's ring buffer holds. */
+        uint32_t nLogBuffer = 4096;
+
+
+        /* The number of records dropped on full buffers. */
+        std::atomic<uint64_t> nLogDropped(0);
+
+
+        /* Flag to keep the background writer running. */
+        std::atomic<bool> fLogRunning(false);
+
+
+        /* The background writer thread. */
+        std::thread LOG_THREAD;
+
+
+        /* Get this thread's ring buffer, registering it with the writer on first use. */
+        ringbuffer<LogRecord>& log_ring()
+        {
+            thread_local std::shared_ptr<ringbuffer<LogRecord>> pRing;
+            if(!pRing)
+            {
+                pRing = std::make_shared<ringbuffer<LogRecord>>(nLogBuffer);
+
+                LOCK(RINGS_MUTEX);
+                vLogRings.push_back(pRing);
+            }
+
+            return *pRing;
+        }
+
+
+        /* Write the records of every thread to the console and log file in batches until stopped. */
+        void log_writer()
+        {
+            std::vector<LogRecord> vBatch;
+            std::string strBatch;
+
+            /* Track the dropped records already reported. */
+            uint64_t nReported = 0;
+
+            /* Cache the formatted time of the current second. */
+            time_t nSecond = 0;
+            std::string strSecond;
+
+            while(true)
+            {
+                /* Check before draining, so the last records are written on shutdown. */
+                const bool fStop = !fLogRunning.load();
+
+                /* Copy the ring buffers, dropping those of finished threads once empty. */
+                std::vector<std::shared_ptr<ringbuffer<LogRecord>>> vRings;
+                {
+                    LOCK(RINGS_MUTEX);
+
+                    vLogRings.erase(std::remove_if(vLogRings.begin(), vLogRings.end(),
+                        [](const std::shared_ptr<ringbuffer<LogRecord>>& pRing)
+                        {
+                            return pRing.use_count() == 1 && pRing->empty();
+                        }), vLogRings.end());
+
+                    vRings = vLogRings;
+                }
+
+                /* Drain every buffer. */
+                LogRecord record;
+                for(const auto& pRing : vRings)
+                {
+                    while(pRing->pop(record))
+                        vBatch.push_back(std::move(record));
+                }
+
+                /* Report the records dropped since the last batch. */
+                const uint64_t nDropped = nLogDropped.load();
+                if(nDropped != nReported)
+                {
+                    vBatch.push_back({runtime::timestamp(true), safe_printstr(ANSI_COLOR_BRIGHT_YELLOW, "WARNING: ", ANSI_COLOR_RESET,
+                        "dropped ", nDropped - nReported, " log records on full buffers")});
+
+                    nReported = nDropped;
+                }
+
+                /* Wait for more records. */
+                if(vBatch.empty())
+                {
+                    if(fStop)
+                        break;
+
+                    runtime::sleep(10);
+                    continue;
+                }
+
+                /* Interleave the threads by time, keeping each thread's own order. */
+                std::stable_sort(vBatch.begin(), vBatch.end(),
+                    [](const LogRecord& a, const LogRecord& b)
+                    {
+                        return a.nTimestamp < b.nTimestamp;
+                    });
+
+                LOCK(DEBUG_MUTEX);
+
+                /* Build the timestamped lines. */
+                for(const auto& entry : vBatch)
+                {
+                    const time_t nTime = entry.nTimestamp / 1000;
+                    if(nTime != nSecond)
+                    {
+                        nSecond   = nTime;
+                        strSecond = safe_printstr(std::put_time(std::localtime(&nTime), "%H:%M:%S"));
+                    }
+
+                    char chMillis[8];
+                    snprintf(chMillis, sizeof(chMillis), ".%03u] ", static_cast<uint32_t>(entry.nTimestamp % 1000));
+
+                    strBatch += "[";
+                    strBatch += strSecond;
+                    strBatch += chMillis;
+                    strBatch += entry.strDebug;
+                    strBatch += "\n";
+                }
+
+                /* One buffered write and flush per batch. */
+                std::cout << strBatch << std::flush;
+                if(ssFile.is_open())
+                {
+                    ssFile << strBatch;
+                    ssFile.flush();
+
+                    /* Check if the current file should be archived and take action. */
+                    check_log_archive(ssFile);
+                }
+
+                vBatch.clear();
+                strBatch.clear();
+            }
+        }
+    }
+
+
     /* Write startup information into the log file */
     void Initialize()
     {
@@ -99,6 +268,17 @@ namespace debug
         /* Get the debug logging configuration parameters (or default if none specified) */
         nLogFiles  = config::GetArg("-logfiles", 20);
         nLogSizeMB = config::GetArg("-logsizeMB", 5);
+
+        /* Start the background writer for asynchronous logging. */
+        if(config::GetBoolArg("-logasync", false))
+        {
+            nLogBuffer = config::GetArg("-logbuffer", 4096);
+
+            fLogRunning.store(true);
+            LOG_THREAD = std::thread(log_writer);
+
+            fLogAsync.store(true);
+        }
     }
 
 
@@ -107,6 +287,15 @@ namespace debug
     {
         try
         {
+            /* Stop the background writer, which writes what is left first. */
+            if(LOG_THREAD.joinable())
+            {
+                fLogAsync.store(false);
+                fLogRunning.store(false);
+
+                LOG_THREAD.join();
+            }
+
             /* Close our debug file on shutdown. */
             if(ssFile.is_open())
                 ssFile.close();
@@ -283,6 +472,21 @@ namespace debug
         //#endif
     }
 
+    /* Hands log output to the background writer through this thread's ring buffer, without locking. */
+    void _log_async(std::string&& strDebug)
+    {
+        if(!log_ring().push({runtime::timestamp(true), std::move(strDebug)}))
+            ++nLogDropped;
+    }
+
+
+    /* Get the number of log records dropped because a thread's ring buffer was full. */
+    uint64_t LogDropped()
+    {
+        return nLogDropped.load();
+    }
+
+
     /* We need this so we can declare in source file and not need forward declaration of LLD::TxnAbort. */
     void acid_handler(const uint8_t nFlags, const uint8_t nInstances)
     {
@@ -15,6 +15,7 @@ ________________________________________________________________________________
 #ifndef NEXUS_UTIL_INCLUDE_DEBUG_H
 #define NEXUS_UTIL_INCLUDE_DEBUG_H
 
+#include <atomic>
 #include <string>
 #include <cstdint>
 #include <iosfwd>
@@ -94,6 +95,7 @@ namespace debug
 
     extern std::mutex DEBUG_MUTEX;
     extern std::ofstream ssFile;
+    extern std::atomic<bool> fLogAsync;
     extern thread_local std::string strLastError;
     extern thread_local std::string strLastException;
 
@@ -169,6 +171,25 @@ namespace debug
      void _log(const time_t& nTimestamp, const std::string& strDebug);
 
 
+    /** _log_async
+     *
+     *  Hands log output to the background writer through this thread's ring buffer, without locking.
+     *  Records are dropped and counted if the buffer is full.
+     *
+     *  @param[in] strDebug The formatted log output.
+     *
+     **/
+    void _log_async(std::string&& strDebug);
+
+
+    /** LogDropped
+     *
+     *  Get the number of log records dropped because a thread's ring buffer was full.
+     *
+     **/
+    uint64_t LogDropped();
+
+
     /** log
      *
      *  Safe constant format debugging logs.
@@ -188,6 +209,13 @@ namespace debug
         /* We catch execption here to prevent crashes on shutdown for iOS. */
         try
         {
+            /* Format on this thread and leave the writing to the background writer. */
+            if(fLogAsync.load(std::memory_order_relaxed))
+            {
+                _log_async(safe_printstr(args...));
+                return;
+            }
+
             /* Lock the mutex. */
             LOCK(DEBUG_MUTEX);
 
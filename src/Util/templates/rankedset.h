@@ -0,0 +1,299 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_RANKEDSET_H
+#define NEXUS_UTIL_TEMPLATES_RANKEDSET_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+
+/**
+ *
+ *  Ordered set that can also look up elements by their position in the order. Stored as a treap with subtree sizes,
+ *  so insert, erase and lookup by position are all O(log n).
+ *
+ **/
+template <typename Type, typename Compare = std::less<Type>>
+class rankedset
+{
+    /** A node of the tree, with the number of elements below and including it. **/
+    struct Node
+    {
+        Type value;
+        uint32_t nPriority;
+        uint64_t nSize;
+
+        std::unique_ptr<Node> pLeft;
+        std::unique_ptr<Node> pRight;
+
+        Node(const Type& valueIn, const uint32_t nPriorityIn)
+        : value     (valueIn)
+        , nPriority (nPriorityIn)
+        , nSize     (1)
+        , pLeft     ( )
+        , pRight    ( )
+        {
+        }
+    };
+
+
+    /** The root of the tree. **/
+    std::unique_ptr<Node> pRoot;
+
+
+    /** The ordering of the elements. **/
+    Compare compare;
+
+
+    /** State for the node priorities. **/
+    uint32_t nSeed;
+
+
+    /* Get the number of elements in a subtree. */
+    static uint64_t size(const std::unique_ptr<Node>& pNode)
+    {
+        return pNode ? pNode->nSize : 0;
+    }
+
+
+    /* Recalculate a node's size from its children. */
+    static void update(const std::unique_ptr<Node>& pNode)
+    {
+        if(pNode)
+            pNode->nSize = 1 + size(pNode->pLeft) + size(pNode->pRight);
+    }
+
+
+    /* Get the next node priority. */
+    uint32_t priority()
+    {
+        nSeed ^= nSeed << 13;
+        nSeed ^= nSeed >> 17;
+        nSeed ^= nSeed << 5;
+
+        return nSeed;
+    }
+
+
+    /* Split a subtree into the elements ordered before a value and the rest, or up to and including it. */
+    void split(std::unique_ptr<Node> pNode, const Type& value, const bool fInclusive,
+               std::unique_ptr<Node> &pLeft, std::unique_ptr<Node> &pRight)
+    {
+        if(!pNode)
+        {
+            pLeft.reset();
+            pRight.reset();
+
+            return;
+        }
+
+        /* Check which side of the split the node falls on. */
+        const bool fLeft = fInclusive ? !compare(value, pNode->value) : compare(pNode->value, value);
+        if(fLeft)
+        {
+            split(std::move(pNode->pRight), value, fInclusive, pNode->pRight, pRight);
+            update(pNode);
+
+            pLeft = std::move(pNode);
+        }
+        else
+        {
+            split(std::move(pNode->pLeft), value, fInclusive, pLeft, pNode->pLeft);
+            update(pNode);
+
+            pRight = std::move(pNode);
+        }
+    }
+
+
+    /* Join two subtrees, every element of the left ordered before the right. */
+    std::unique_ptr<Node> merge(std::unique_ptr<Node> pLeft, std::unique_ptr<Node> pRight)
+    {
+        if(!pLeft)
+            return pRight;
+
+        if(!pRight)
+            return pLeft;
+
+        if(pLeft->nPriority > pRight->nPriority)
+        {
+            pLeft->pRight = merge(std::move(pLeft->pRight), std::move(pRight));
+            update(pLeft);
+
+            return pLeft;
+        }
+
+        pRight->pLeft = merge(std::move(pLeft), std::move(pRight->pLeft));
+        update(pRight);
+
+        return pRight;
+    }
+
+
+public:
+
+    /** rankedset
+     *
+     *  Default constructor
+     *
+     **/
+    rankedset(const Compare& compareIn = Compare())
+    : pRoot   ( )
+    , compare (compareIn)
+    , nSeed   (2463534242)
+    {
+    }
+
+
+    /** Copy Constructor. **/
+    rankedset(const rankedset& set) = delete;
+
+
+    /** Copy Assignment. **/
+    rankedset& operator=(const rankedset& set) = delete;
+
+
+    /** insert
+     *
+     *  Insert an element into the set.
+     *
+     *  @param[in] value The element to insert.
+     *
+     *  @return False if the element was already in the set.
+     *
+     **/
+    bool insert(const Type& value)
+    {
+        if(count(value))
+            return false;
+
+        std::unique_ptr<Node> pLeft, pRight;
+        split(std::move(pRoot), value, false, pLeft, pRight);
+
+        pRoot = merge(merge(std::move(pLeft), std::unique_ptr<Node>(new Node(value, priority()))), std::move(pRight));
+
+        return true;
+    }
+
+
+    /** erase
+     *
+     *  Remove an element from the set.
+     *
+     *  @param[in] value The element to remove.
+     *
+     *  @return False if the element was not in the set.
+     *
+     **/
+    bool erase(const Type& value)
+    {
+        std::unique_ptr<Node> pLeft, pMiddle, pRight;
+        split(std::move(pRoot), value, false, pLeft, pRight);
+        split(std::move(pRight), value, true, pMiddle, pRight);
+
+        pRoot = merge(std::move(pLeft), std::move(pRight));
+
+        return pMiddle != nullptr;
+    }
+
+
+    /** count
+     *
+     *  Get the count of elements equal to a value.
+     *
+     **/
+    uint64_t count(const Type& value) const
+    {
+        const Node* pNode = pRoot.get();
+        while(pNode)
+        {
+            if(compare(value, pNode->value))
+                pNode = pNode->pLeft.get();
+            else if(compare(pNode->value, value))
+                pNode = pNode->pRight.get();
+            else
+                return 1;
+        }
+
+        return 0;
+    }
+
+
+    /** at
+     *
+     *  Get the element at a position in the order.
+     *
+     *  @param[in] nIndex The position, from zero.
+     *
+     *  @return The element, throws std::out_of_range if past the end.
+     *
+     **/
+    const Type& at(uint64_t nIndex) const
+    {
+        if(nIndex >= size())
+            throw std::out_of_range("rankedset::at");
+
+        const Node* pNode = pRoot.get();
+        while(true)
+        {
+            const uint64_t nLeft = size(pNode->pLeft);
+            if(nIndex < nLeft)
+                pNode = pNode->pLeft.get();
+            else if(nIndex == nLeft)
+                return pNode->value;
+            else
+            {
+                nIndex -= nLeft + 1;
+                pNode = pNode->pRight.get();
+            }
+        }
+    }
+
+
+    /** size
+     *
+     *  Get the number of elements in the set.
+     *
+     **/
+    uint64_t size() const
+    {
+        return size(pRoot);
+    }
+
+
+    /** empty
+     *
+     *  Determine if the set is empty.
+     *
+     **/
+    bool empty() const
+    {
+        return !pRoot;
+    }
+
+
+    /** clear
+     *
+     *  Remove all elements from the set.
+     *
+     **/
+    void clear()
+    {
+        pRoot.reset();
+    }
+};
+
+#endif
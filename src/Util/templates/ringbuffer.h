@@ -0,0 +1,160 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_RINGBUFFER_H
+#define NEXUS_UTIL_TEMPLATES_RINGBUFFER_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+/**
+ *
+ *  Fixed size lock-free queue for one producer thread and one consumer thread. The capacity is rounded up to a
+ *  power of two, and a push to a full buffer fails instead of waiting.
+ *
+ **/
+template <typename Type>
+class ringbuffer
+{
+    /** The slots of the buffer. **/
+    std::vector<Type> vBuffer;
+
+
+    /** Mask to wrap positions into the buffer. **/
+    const uint64_t nMask;
+
+
+    /** The next position to write, only moved by the producer. **/
+    alignas(64) std::atomic<uint64_t> nHead;
+
+
+    /** The next position to read, only moved by the consumer. **/
+    alignas(64) std::atomic<uint64_t> nTail;
+
+
+    /* Round a capacity up to the next power of two. */
+    static uint64_t round_capacity(const uint64_t nCapacity)
+    {
+        uint64_t nSize = 1;
+        while(nSize < nCapacity)
+            nSize <<= 1;
+
+        return nSize;
+    }
+
+public:
+
+    /** ringbuffer
+     *
+     *  Default constructor
+     *
+     *  @param[in] nCapacity The number of slots, rounded up to a power of two.
+     *
+     **/
+    ringbuffer(const uint64_t nCapacity)
+    : vBuffer (round_capacity(nCapacity))
+    , nMask   (vBuffer.size() - 1)
+    , nHead   (0)
+    , nTail   (0)
+    {
+    }
+
+
+    /** Copy Constructor. **/
+    ringbuffer(const ringbuffer& buffer) = delete;
+
+
+    /** Copy Assignment. **/
+    ringbuffer& operator=(const ringbuffer& buffer) = delete;
+
+
+    /** push
+     *
+     *  Add a value to the back of the buffer, from the producer thread only.
+     *
+     *  @param[in] value The value to move into the buffer.
+     *
+     *  @return False if the buffer is full.
+     *
+     **/
+    bool push(Type&& value)
+    {
+        const uint64_t nPosition = nHead.load(std::memory_order_relaxed);
+        if(nPosition - nTail.load(std::memory_order_acquire) > nMask)
+            return false;
+
+        vBuffer[nPosition & nMask] = std::move(value);
+        nHead.store(nPosition + 1, std::memory_order_release);
+
+        return true;
+    }
+
+
+    /** pop
+     *
+     *  Take a value from the front of the buffer, from the consumer thread only.
+     *
+     *  @param[out] value The value moved out of the buffer.
+     *
+     *  @return False if the buffer is empty.
+     *
+     **/
+    bool pop(Type &value)
+    {
+        const uint64_t nPosition = nTail.load(std::memory_order_relaxed);
+        if(nPosition == nHead.load(std::memory_order_acquire))
+            return false;
+
+        value = std::move(vBuffer[nPosition & nMask]);
+        nTail.store(nPosition + 1, std::memory_order_release);
+
+        return true;
+    }
+
+
+    /** empty
+     *
+     *  Check if there are no values waiting.
+     *
+     **/
+    bool empty() const
+    {
+        return nHead.load(std::memory_order_acquire) == nTail.load(std::memory_order_acquire);
+    }
+
+
+    /** size
+     *
+     *  Get the number of values waiting.
+     *
+     **/
+    uint64_t size() const
+    {
+        return nHead.load(std::memory_order_acquire) - nTail.load(std::memory_order_acquire);
+    }
+
+
+    /** capacity
+     *
+     *  Get the number of slots in the buffer.
+     *
+     **/
+    uint64_t capacity() const
+    {
+        return nMask + 1;
+    }
+};
+
+#endif
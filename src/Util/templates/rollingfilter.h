@@ -0,0 +1,203 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_UTIL_TEMPLATES_ROLLINGFILTER_H
+#define NEXUS_UTIL_TEMPLATES_ROLLINGFILTER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ *
+ *  Bloom filter over 64 bit keys that remembers at least the most recent elements it was sized for, in a fixed
+ *  amount of memory. It is split into three generations, and the oldest one is cleared each time the newest fills,
+ *  so old keys roll out instead of the false positive rate growing. There are no false negatives for keys that
+ *  haven't rolled out.
+ *
+ **/
+class rollingfilter
+{
+    /** The number of generations. **/
+    static const uint32_t GENERATIONS = 3;
+
+
+    /** The bits of every generation, one after another. **/
+    std::vector<uint64_t> vBits;
+
+
+    /** The number of keys in each generation. **/
+    uint32_t nPerGeneration;
+
+
+    /** The number of bits in each generation. **/
+    uint64_t nBitsPerGeneration;
+
+
+    /** The number of bits set for each key. **/
+    uint32_t nHashes;
+
+
+    /** The generation new keys go into. **/
+    uint32_t nGeneration;
+
+
+    /** The number of keys in the newest generation. **/
+    uint32_t nCount;
+
+
+    /* Spread the bits of a key, so keys that aren't hashes are still spread across the filter. */
+    static uint64_t mix(uint64_t nKey)
+    {
+        nKey += 0x9e3779b97f4a7c15ull;
+        nKey  = (nKey ^ (nKey >> 30)) * 0xbf58476d1ce4e5b9ull;
+        nKey  = (nKey ^ (nKey >> 27)) * 0x94d049bb133111ebull;
+
+        return nKey ^ (nKey >> 31);
+    }
+
+
+    /* Get the position of one of the bits for a key within a generation. */
+    uint64_t position(const uint64_t nHash1, const uint64_t nHash2, const uint32_t n) const
+    {
+        return (nHash1 + n * nHash2) % nBitsPerGeneration;
+    }
+
+
+    /* Check a generation for all of a key's bits. */
+    bool check(const uint32_t nGen, const uint64_t nHash1, const uint64_t nHash2) const
+    {
+        const uint64_t nOffset = nGen * nBitsPerGeneration;
+        for(uint32_t n = 0; n < nHashes; ++n)
+        {
+            const uint64_t nBit = nOffset + position(nHash1, nHash2, n);
+            if(!(vBits[nBit >> 6] & (uint64_t(1) << (nBit & 63))))
+                return false;
+        }
+
+        return true;
+    }
+
+public:
+
+    /** rollingfilter
+     *
+     *  Default constructor
+     *
+     *  @param[in] nElements The number of most recent keys to always remember.
+     *  @param[in] dRate The chance of a key that was never added being found, in each generation.
+     *
+     **/
+    rollingfilter(const uint32_t nElements, const double dRate = 0.00001)
+    : vBits              ( )
+    , nPerGeneration     (std::max(1u, (nElements + 1) / 2))
+    , nBitsPerGeneration (0)
+    , nHashes            (0)
+    , nGeneration        (0)
+    , nCount             (0)
+    {
+        /* Size each generation for its keys at the given rate, as whole words. */
+        const double dBits = -1.0 * nPerGeneration * std::log(dRate) / (std::log(2.0) * std::log(2.0));
+        nBitsPerGeneration = ((static_cast<uint64_t>(dBits) + 63) / 64) * 64;
+        nHashes = std::max(1u, std::min(32u, static_cast<uint32_t>(std::round(dBits / nPerGeneration * std::log(2.0)))));
+
+        vBits.resize((nBitsPerGeneration / 64) * GENERATIONS, 0);
+    }
+
+
+    /** insert
+     *
+     *  Add a key to the filter, rolling out the oldest generation if the newest is full.
+     *
+     *  @param[in] nKey The key to add.
+     *
+     **/
+    void insert(const uint64_t nKey)
+    {
+        /* Start a new generation over the oldest one. */
+        if(nCount >= nPerGeneration)
+        {
+            nGeneration = (nGeneration + 1) % GENERATIONS;
+            nCount      = 0;
+
+            const uint64_t nWords = nBitsPerGeneration / 64;
+            std::fill(vBits.begin() + nGeneration * nWords, vBits.begin() + (nGeneration + 1) * nWords, 0);
+        }
+
+        /* Set the key's bits. */
+        const uint64_t nHash1 = mix(nKey);
+        const uint64_t nHash2 = mix(nHash1) | 1;
+
+        const uint64_t nOffset = nGeneration * nBitsPerGeneration;
+        for(uint32_t n = 0; n < nHashes; ++n)
+        {
+            const uint64_t nBit = nOffset + position(nHash1, nHash2, n);
+            vBits[nBit >> 6] |= (uint64_t(1) << (nBit & 63));
+        }
+
+        ++nCount;
+    }
+
+
+    /** contains
+     *
+     *  Check if a key is in the filter.
+     *
+     *  @param[in] nKey The key to check.
+     *
+     *  @return True if the key was added and hasn't rolled out, or for a false positive.
+     *
+     **/
+    bool contains(const uint64_t nKey) const
+    {
+        const uint64_t nHash1 = mix(nKey);
+        const uint64_t nHash2 = mix(nHash1) | 1;
+
+        for(uint32_t nGen = 0; nGen < GENERATIONS; ++nGen)
+        {
+            if(check(nGen, nHash1, nHash2))
+                return true;
+        }
+
+        return false;
+    }
+
+
+    /** clear
+     *
+     *  Remove all keys from the filter.
+     *
+     **/
+    void clear()
+    {
+        std::fill(vBits.begin(), vBits.end(), 0);
+
+        nGeneration = 0;
+        nCount      = 0;
+    }
+
+
+    /** bytes
+     *
+     *  Get the memory used by the filter bits.
+     *
+     **/
+    uint64_t bytes() const
+    {
+        return vBits.size() * sizeof(uint64_t);
+    }
+};
+
+#endif
@@ -26,6 +26,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/create.h>
 #include <TAO/Ledger/include/chainstate.h>
 #include <TAO/Ledger/include/dispatch.h>
+#include <TAO/Ledger/types/snapshot.h>
 #include <TAO/Ledger/types/stake_minter.h>
 #include <TAO/Ledger/include/timelocks.h>
 
@@ -204,74 +205,112 @@ int main(int argc, char** argv)
         TAO::Ledger::Dispatch::Initialize();
 
 
-        /* Initialize ChainState. */
-        TAO::Ledger::ChainState::Initialize();
+        /* Import a snapshot into our empty databases, to start validating from its block. */
+        if(config::HasArg("-snapshotimport"))
+        {
+            TAO::Ledger::Snapshot snapshot;
+            if(!snapshot.Import(config::GetArg("-snapshotimport", "")))
+            {
+                config::fShutdown.store(true);
+                fFailed = true;
+            }
+        }
 
 
-        /* Run our LLD indexing operations. */
-        LLD::Indexing();
+        /* Check for an import that didn't finish, since we can't start from its partial databases. */
+        else
+        {
+            uint1024_t hashImport = 0;
+            if(LLD::Ledger->ReadImport(hashImport))
+            {
+                debug::error(FUNCTION, "snapshot import of ", hashImport.SubString(), " didn't finish, remove the databases to start");
 
+                config::fShutdown.store(true);
+                fFailed = true;
+            }
+        }
 
-        /* Initialize Legacy Environment. */
-        if(!Legacy::Initialize())
+
+        /* Start up from our databases, unless a failed import left them partly written. */
+        if(!fFailed)
         {
-            config::fShutdown.store(true);
-            fFailed = true;
-        }
+            /* Initialize ChainState. */
+            TAO::Ledger::ChainState::Initialize();
 
 
-        /* Initialize the Lower Level Protocol. */
-        LLP::Initialize();
+            /* Run our LLD indexing operations. */
+            LLD::Indexing();
 
 
-        /* Startup performance metric. */
-        debug::log(0, FUNCTION, "Started up in ", timer.ElapsedMilliseconds(), "ms");
+            /* Export a snapshot of our best block before anything else writes to the databases. */
+            if(config::HasArg("-snapshotexport"))
+            {
+                TAO::Ledger::Snapshot snapshot;
+                snapshot.Export(config::GetArg("-snapshotexport", ""));
+            }
 
 
-        /* Set the initialized flags. */
-        config::fInitialized.store(true);
+            /* Initialize Legacy Environment. */
+            if(!Legacy::Initialize())
+            {
+                config::fShutdown.store(true);
+                fFailed = true;
+            }
 
 
-        /* Kick off our startup thread for post-startup processing. */
-        std::thread tStartup = std::thread(Startup);
+            /* Initialize the Lower Level Protocol. */
+            LLP::Initialize();
 
 
-        /* Initialize generator thread. */
-        std::thread thread;
-        if(config::fHybrid.load())
-            thread = std::thread(TAO::Ledger::ThreadGenerator);
+            /* Startup performance metric. */
+            debug::log(0, FUNCTION, "Started up in ", timer.ElapsedMilliseconds(), "ms");
 
 
-        /* Wait for shutdown. */
-        if(!config::GetBoolArg(std::string("-gdb")))
-        {
-            std::mutex SHUTDOWN_MUTEX;
-            std::unique_lock<std::mutex> SHUTDOWN_LOCK(SHUTDOWN_MUTEX);
-            SHUTDOWN.wait(SHUTDOWN_LOCK, []{ return config::fShutdown.load(); });
-        }
+            /* Set the initialized flags. */
+            config::fInitialized.store(true);
 
 
-        /* GDB mode waits for keyboard input to initiate clean shutdown. */
-        else
-        {
-            getchar();
-            config::fShutdown = true;
-        }
+            /* Kick off our startup thread for post-startup processing. */
+            std::thread tStartup = std::thread(Startup);
 
 
-        /* Wait for our startup thread to finish. */
-        tStartup.join();
+            /* Initialize generator thread. */
+            std::thread thread;
+            if(config::fHybrid.load())
+                thread = std::thread(TAO::Ledger::ThreadGenerator);
 
 
-        /* Stop stake minter if running. Minter ignores request if not running, so safe to just call both */
-        TAO::Ledger::StakeMinter::GetInstance().Stop();
+            /* Wait for shutdown. */
+            if(!config::GetBoolArg(std::string("-gdb")))
+            {
+                std::mutex SHUTDOWN_MUTEX;
+                std::unique_lock<std::mutex> SHUTDOWN_LOCK(SHUTDOWN_MUTEX);
+                SHUTDOWN.wait(SHUTDOWN_LOCK, []{ return config::fShutdown.load(); });
+            }
 
 
-        /* Wait for the private condition. */
-        if(config::fHybrid.load())
-        {
-            TAO::Ledger::PRIVATE_CONDITION.notify_all();
-            thread.join();
+            /* GDB mode waits for keyboard input to initiate clean shutdown. */
+            else
+            {
+                getchar();
+                config::fShutdown = true;
+            }
+
+
+            /* Wait for our startup thread to finish. */
+            tStartup.join();
+
+
+            /* Stop stake minter if running. Minter ignores request if not running, so safe to just call both */
+            TAO::Ledger::StakeMinter::GetInstance().Stop();
+
+
+            /* Wait for the private condition. */
+            if(config::fHybrid.load())
+            {
+                TAO::Ledger::PRIVATE_CONDITION.notify_all();
+                thread.join();
+            }
         }
 
 
@@ -0,0 +1,116 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/montgomery.h>
+#include <LLC/include/random.h>
+#include <LLC/prime/fermat.h>
+#include <LLC/types/bignum.h>
+
+#include <TAO/Ledger/include/prime.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <openssl/bn.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Fermat Test Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin Fermat Test Benchmarks =====");
+
+    const uint32_t nTotal = 1000;
+
+    //random odd numbers with the highest bit clear for the 32-bit limb kernel
+    std::vector<uint1024_t> vTest;
+    for(uint32_t i = 0; i < nTotal; ++i)
+    {
+        uint1024_t hashTest = LLC::GetRand1024();
+        hashTest |= 1;
+        hashTest &= ~(uint1024_t(1) << 1023);
+
+        vTest.push_back(hashTest);
+    }
+
+    //bignum path
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        LLC::CAutoBN_CTX pctx;
+        for(const auto& hashTest : vTest)
+        {
+            LLC::CBigNum bnPrime(hashTest);
+            LLC::CBigNum bnBase(2);
+            LLC::CBigNum bnExp = bnPrime - 1;
+
+            LLC::CBigNum bnResult;
+            BN_mod_exp(bnResult.getBN(), bnBase.getBN(), bnExp.getBN(), bnPrime.getBN(), pctx);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "BigNum::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tests / second");
+    }
+
+    //32-bit limb kernel
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hashTest : vTest)
+            fermat_prime(hashTest);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Fermat32::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tests / second");
+    }
+
+    //single number path
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hashTest : vTest)
+            LLC::FermatTest(hashTest);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "FermatTest::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tests / second");
+    }
+
+    //batched IFMA kernel
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<uint1024_t> vResults;
+        LLC::FermatTest(vTest, vResults);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Batch::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tests / second");
+    }
+
+    //cluster checks through the ledger
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<bool> vPrime;
+        for(uint32_t i = 0; i + 6 <= nTotal; i += 6)
+            TAO::Ledger::PrimeCheck(std::vector<uint1024_t>(vTest.begin() + i, vTest.begin() + i + 6), vPrime);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "PrimeCheck::", ANSI_COLOR_RESET, (nTotal / 6) * 1000000.0 / nTime, " clusters / second");
+    }
+
+    debug::log(0, "===== End Fermat Test Benchmarks =====\n");
+}
@@ -0,0 +1,108 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
+#include <TAO/Ledger/types/block.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "SK Hashing Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin SK Hashing Benchmarks =====");
+
+    const uint32_t nTotal = 100000;
+
+    //merkle node pairs, back to back
+    std::vector<uint512_t> vNodes;
+    for(uint32_t i = 0; i < nTotal * 2; ++i)
+        vNodes.push_back(LLC::GetRand512());
+
+    //transaction sized messages
+    std::vector<std::vector<uint8_t>> vData;
+    for(uint32_t i = 0; i < nTotal; ++i)
+        vData.push_back(LLC::GetRand256().GetBytes());
+
+    for(uint32_t i = 0; i < nTotal; ++i)
+        vData[i].resize(150 + LLC::GetRandInt(400));
+
+    //single pair hashing
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nTotal; ++i)
+            LLC::SK512(BEGIN(vNodes[i * 2]), END(vNodes[i * 2]), BEGIN(vNodes[i * 2 + 1]), END(vNodes[i * 2 + 1]));
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "SK512::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " pairs / second");
+    }
+
+    //batched pair hashing
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<uint512_t> vHashes(nTotal);
+        LLC::SK512((uint8_t *)&vNodes[0], 128, nTotal, &vHashes[0]);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Batch::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " pairs / second");
+    }
+
+    //single message hashing
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& vch : vData)
+            LLC::SK512(vch.begin(), vch.end(), LLC::pblank, LLC::pblank);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "SK512::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " messages / second");
+    }
+
+    //batched message hashing
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<uint512_t> vHashes;
+        LLC::SK512(vData, vHashes);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Batch::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " messages / second");
+    }
+
+    //merkle tree construction
+    {
+        TAO::Ledger::Block block;
+
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < 100; ++i)
+            block.BuildMerkleTree(std::vector<uint512_t>(vNodes.begin(), vNodes.begin() + 2000));
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Merkle::", ANSI_COLOR_RESET, 100 * 1000000.0 / nTime, " trees of 2000 / second");
+    }
+
+    debug::log(0, "===== End SK Hashing Benchmarks =====\n");
+}
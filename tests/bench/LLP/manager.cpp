@@ -0,0 +1,123 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/manager.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <algorithm>
+
+#include <arpa/inet.h>
+
+
+TEST_CASE( "Address Manager Benchmarks", "[LLP]")
+{
+    debug::log(0, "===== Begin Address Manager Benchmarks =====");
+
+    const uint32_t nTotal = 100000;
+
+    LLP::AddressManager manager(8325);
+
+    //synthetic public addresses
+    std::vector<LLP::BaseAddress> vAddresses;
+    for(uint32_t i = 0; i < nTotal; ++i)
+    {
+        struct in_addr addr;
+        addr.s_addr = htonl(0x0B000000 + i);
+
+        vAddresses.push_back(LLP::BaseAddress(addr, 8325));
+    }
+
+    //add them with mixed states
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nTotal; ++i)
+        {
+            const uint8_t nState = (i % 3 == 0) ? LLP::ConnectState::FAILED : LLP::ConnectState::NEW;
+            manager.AddAddress(vAddresses[i], nState);
+        }
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "AddressManager::", ANSI_COLOR_RESET, "Added ", nTotal, " addresses in ", nTime, " ms");
+    }
+
+    //latency updates move addresses in the selection index
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nTotal; ++i)
+            manager.SetLatency(LLC::GetRandInt(1000), vAddresses[i]);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "AddressManager::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " SetLatency / second");
+    }
+
+    //copy and sort every eligible address, as selection used to
+    {
+        const uint32_t nCalls = 20;
+
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nCalls; ++i)
+        {
+            std::vector<LLP::TrustAddress> vTrust;
+            manager.GetAddresses(vTrust, LLP::ConnectState::NEW | LLP::ConnectState::FAILED | LLP::ConnectState::DROPPED);
+
+            std::sort(vTrust.begin(), vTrust.end());
+            std::reverse(vTrust.begin(), vTrust.end());
+
+            REQUIRE(vTrust.size() == nTotal);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "AddressManager::", ANSI_COLOR_RESET, nCalls * 1000000.0 / nTime, " copy and sort selections / second");
+    }
+
+    //indexed selection
+    {
+        const uint32_t nCalls = 100000;
+
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nCalls; ++i)
+        {
+            LLP::BaseAddress addr;
+            REQUIRE(manager.StochasticSelect(addr));
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "AddressManager::", ANSI_COLOR_RESET, nCalls * 1000000.0 / nTime, " StochasticSelect / second");
+    }
+
+    //connected addresses are not selected
+    for(uint32_t i = 0; i < nTotal; ++i)
+        manager.AddAddress(vAddresses[i], LLP::ConnectState::CONNECTED);
+
+    LLP::BaseAddress addr;
+    REQUIRE_FALSE(manager.StochasticSelect(addr));
+
+    //dropped ones are again
+    manager.AddAddress(vAddresses[0], LLP::ConnectState::DROPPED);
+    REQUIRE(manager.StochasticSelect(addr));
+    REQUIRE(addr == vAddresses[0]);
+}
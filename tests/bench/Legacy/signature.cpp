@@ -0,0 +1,123 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/eckey.h>
+#include <LLC/include/random.h>
+
+#include <Legacy/include/sigcache.h>
+#include <Legacy/include/signature.h>
+#include <Legacy/types/script.h>
+#include <Legacy/types/transaction.h>
+#include <Legacy/wallet/basickeystore.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Legacy Signature Benchmarks", "[Legacy]")
+{
+    debug::log(0, "===== Begin Legacy Signature Benchmarks =====");
+
+    const uint32_t nInputs = 1000;
+    const uint32_t nKeys   = 16;
+
+    //keys to pay the outputs to
+    Legacy::BasicKeyStore keystore;
+
+    std::vector<Legacy::Script> vScriptPubKeys;
+    for(uint32_t i = 0; i < nKeys; ++i)
+    {
+        LLC::ECKey key;
+        key.MakeNewKey(true);
+        REQUIRE(keystore.AddKey(key));
+
+        Legacy::Script script;
+        script.SetNexusAddress(key.GetPubKey());
+        vScriptPubKeys.push_back(script);
+    }
+
+    //transaction with many small outputs
+    Legacy::Transaction txFrom;
+    txFrom.vin.push_back(Legacy::TxIn(LLC::GetRand512(), 0));
+    for(uint32_t i = 0; i < nInputs; ++i)
+        txFrom.vout.push_back(Legacy::TxOut(1000 + i, vScriptPubKeys[i % nKeys]));
+
+    //consolidation transaction spending all of them
+    Legacy::Transaction txTo;
+    for(uint32_t i = 0; i < nInputs; ++i)
+        txTo.vin.push_back(Legacy::TxIn(txFrom.GetHash(), i));
+    txTo.vout.push_back(Legacy::TxOut(nInputs * 1000, vScriptPubKeys[0]));
+
+    for(uint32_t i = 0; i < nInputs; ++i)
+        REQUIRE(Legacy::SignSignature(keystore, txFrom, txTo, i));
+
+    std::vector<std::pair<uint32_t, Legacy::Script>> vScripts;
+    for(uint32_t i = 0; i < nInputs; ++i)
+        vScripts.push_back(std::make_pair(i, txFrom.vout[i].scriptPubKey));
+
+    Legacy::SignatureCache& cache = Legacy::SignatureCache::Instance();
+    cache.Clear();
+
+    //one input at a time, as connecting used to
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nInputs; ++i)
+            REQUIRE(Legacy::VerifySignature(txFrom, txTo, i, 0));
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Legacy::", ANSI_COLOR_RESET, "Serial verify of ", nInputs, " inputs in ", nTime, " ms");
+    }
+
+    //inputs spread over threads, storing into the cache as on mempool acceptance
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        REQUIRE(Legacy::VerifyInputs(txTo, vScripts, true));
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Legacy::", ANSI_COLOR_RESET, "Parallel verify of ", nInputs, " inputs in ", nTime, " ms");
+    }
+    REQUIRE(cache.Size() == nInputs);
+
+    //connecting the same transaction again hits the cache
+    {
+        const uint64_t nHits = cache.Hits();
+
+        runtime::timer timer;
+        timer.Start();
+
+        REQUIRE(Legacy::VerifyInputs(txTo, vScripts));
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Legacy::", ANSI_COLOR_RESET, "Cached verify of ", nInputs, " inputs in ", nTime, " ms");
+
+        REQUIRE(cache.Hits() - nHits == nInputs);
+    }
+
+    //a changed output invalidates every signature, cached or not
+    Legacy::Transaction txBad = txTo;
+    txBad.vout[0].nValue += 1;
+    REQUIRE_FALSE(Legacy::VerifyInputs(txBad, vScripts));
+
+    //a signature moved to another input fails too
+    txBad = txTo;
+    std::swap(txBad.vin[0].scriptSig, txBad.vin[1].scriptSig);
+    REQUIRE_FALSE(Legacy::VerifyInputs(txBad, vScripts));
+
+    cache.Clear();
+}
@@ -0,0 +1,173 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <Legacy/types/reservekey.h>
+#include <Legacy/types/script.h>
+#include <Legacy/wallet/wallet.h>
+#include <Legacy/wallet/walletdb.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Wallet Balance Benchmarks", "[Legacy]")
+{
+    debug::log(0, "===== Begin Wallet Balance Benchmarks =====");
+
+    const uint32_t nTotal = 1000000;
+
+    //load wallet
+    bool fFirstRun;
+    Legacy::Wallet::Initialize(Legacy::WalletDB::DEFAULT_WALLET_DB);
+    REQUIRE(Legacy::Wallet::LoadWallet(fFirstRun) == Legacy::DB_LOAD_OK);
+
+    Legacy::Wallet& wallet = Legacy::Wallet::Instance();
+
+    //pay every output to one of our keys
+    std::vector<uint8_t> vKey;
+    REQUIRE(wallet.GetKeyPool().GetKeyFromPool(vKey, false));
+
+    Legacy::Script script;
+    script.SetNexusAddress(vKey);
+
+    //block at the tip of the chain to confirm the transactions
+    const uint1024_t hashBest = TAO::Ledger::ChainState::hashBestChain.load();
+    const uint32_t nBestHeight = TAO::Ledger::ChainState::nBestHeight.load();
+
+    TAO::Ledger::BlockState state;
+    state.nHeight = nBestHeight + 1;
+    state.nTime   = runtime::unifiedtimestamp() - 60;
+
+    const uint1024_t hashBlock = state.GetHash();
+    REQUIRE(LLD::Ledger->WriteBlock(hashBlock, state));
+
+    TAO::Ledger::ChainState::hashBestChain.store(hashBlock);
+    TAO::Ledger::ChainState::nBestHeight.store(state.nHeight);
+
+    //synthetic wallet transactions
+    {
+        RECURSIVE(wallet.cs_wallet);
+        for(uint32_t i = 0; i < nTotal; ++i)
+        {
+            Legacy::WalletTx wtx(&wallet);
+            wtx.nTime     = state.nTime;
+            wtx.hashBlock = hashBlock;
+            wtx.vin.push_back(Legacy::TxIn(LLC::GetRand512(), 0));
+            wtx.vout.push_back(Legacy::TxOut(1 + LLC::GetRandInt(1000000), script));
+
+            wallet.mapWallet.emplace(wtx.GetHash(), wtx);
+        }
+    }
+
+    //build the coin index
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        wallet.ReindexCoins();
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Wallet::", ANSI_COLOR_RESET, "Indexed ", nTotal, " transactions in ", nTime, " ms");
+    }
+
+    //full scan of the wallet, as balances used to be calculated
+    int64_t nScanBalance = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        RECURSIVE(wallet.cs_wallet);
+        for(const auto& item : wallet.mapWallet)
+        {
+            const Legacy::WalletTx& wtx = item.second;
+            if(!wtx.IsFinal() || !wtx.IsConfirmed() || wtx.nTime > runtime::unifiedtimestamp())
+                continue;
+
+            for(uint32_t n = 0; n < wtx.vout.size(); ++n)
+                if(!wtx.IsSpent(n) && wallet.IsMine(wtx.vout[n]))
+                    nScanBalance += wtx.vout[n].nValue;
+        }
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Wallet::", ANSI_COLOR_RESET, "Full scan balance in ", nTime, " ms");
+    }
+
+    //first balance settles every new transaction
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        REQUIRE(wallet.GetBalance() == nScanBalance);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Wallet::", ANSI_COLOR_RESET, "First GetBalance in ", nTime, " ms");
+    }
+
+    //settled balance
+    {
+        const uint32_t nCalls = 100000;
+
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nCalls; ++i)
+            REQUIRE(wallet.GetBalance() == nScanBalance);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Wallet::", ANSI_COLOR_RESET, nCalls * 1000000.0 / nTime, " GetBalance / second");
+    }
+
+    //coin selection, through creating a signed transaction
+    {
+        const uint32_t nCalls = 1000;
+
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nCalls; ++i)
+        {
+            std::vector<std::pair<Legacy::Script, int64_t>> vecSend;
+            vecSend.push_back(std::make_pair(script, 1 + LLC::GetRandInt(2000000)));
+
+            Legacy::WalletTx wtx;
+            Legacy::ReserveKey changeKey(wallet);
+
+            int64_t nFees;
+            REQUIRE(wallet.CreateTransaction(vecSend, wtx, changeKey, nFees, 1));
+
+            changeKey.ReturnKey();
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Wallet::", ANSI_COLOR_RESET, nCalls * 1000000.0 / nTime, " CreateTransaction / second");
+    }
+
+    //clean up
+    {
+        RECURSIVE(wallet.cs_wallet);
+        wallet.mapWallet.clear();
+        wallet.ReindexCoins();
+    }
+
+    TAO::Ledger::ChainState::hashBestChain.store(hashBest);
+    TAO::Ledger::ChainState::nBestHeight.store(nBestHeight);
+}
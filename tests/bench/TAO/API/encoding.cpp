@@ -0,0 +1,117 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <TAO/API/include/encoding.h>
+#include <TAO/API/include/json.h>
+
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Time encoding and decoding a response both ways, logging the rates and sizes. */
+static void BenchmarkEncoding(const std::string& strName, const encoding::json& jResponse, const uint8_t nEncoding)
+{
+    const uint32_t nRounds = 10;
+
+    /* Encode our response the way the API node does. */
+    std::string strContent;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nRounds; ++n)
+        {
+            strContent.clear();
+            TAO::API::EncodeContent(jResponse, nEncoding, strContent);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Encoding::", ANSI_COLOR_RESET, strName, " ", TAO::API::ContentType(nEncoding),
+            " encode ", strContent.size() * nRounds / double(nTime), " MB/s (", strContent.size(), " bytes)");
+    }
+
+    /* Decode it back the way a client would. */
+    encoding::json jDecoded;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nRounds; ++n)
+            jDecoded = TAO::API::DecodeContent(strContent, nEncoding);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Encoding::", ANSI_COLOR_RESET, strName, " ", TAO::API::ContentType(nEncoding),
+            " decode ", strContent.size() * nRounds / double(nTime), " MB/s");
+    }
+
+    REQUIRE(jDecoded == jResponse);
+}
+
+
+TEST_CASE( "Response Encoding Benchmarks", "[API]")
+{
+    debug::log(0, "===== Begin Response Encoding Benchmarks =====");
+
+    /* Build a page of blocks the way ledger/list/blocks returns them, held in memory to stay off the disk. */
+    encoding::json jBlocks = encoding::json::array();
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        TAO::Ledger::BlockState tBlock;
+        tBlock.nVersion       = 8;
+        tBlock.nChannel       = 2;
+        tBlock.nHeight        = 5000000 + n;
+        tBlock.nBits          = 0x7b00ffff;
+        tBlock.nNonce         = LLC::GetRand();
+        tBlock.nTime          = 1600000000 + n * 50;
+        tBlock.hashPrevBlock  = LLC::GetRand1024();
+        tBlock.hashNextBlock  = LLC::GetRand1024();
+        tBlock.hashMerkleRoot = LLC::GetRand512();
+
+        jBlocks.push_back(TAO::API::BlockToJSON(tBlock, 0));
+    }
+
+    /* Build a page of signed transactions the way ledger/list/transactions returns them. */
+    encoding::json jTransactions = encoding::json::array();
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        TAO::Ledger::Transaction tx;
+        tx.nSequence   = n;
+        tx.nTimestamp  = 1600000000 + n;
+        tx.hashGenesis = LLC::GetRand256();
+        tx.hashNext    = LLC::GetRand256();
+        tx.hashPrevTx  = LLC::GetRand512();
+        tx.vchPubKey   = LLC::GetRand256().GetBytes();
+        tx.vchSig      = LLC::GetRand512().GetBytes();
+
+        jTransactions.push_back(TAO::API::TransactionToJSON(tx, TAO::Ledger::BlockState(), 3));
+    }
+
+    /* Compare every encoding against text JSON. */
+    const std::vector<uint8_t> vEncodings =
+        { TAO::API::ENCODING::JSON, TAO::API::ENCODING::CBOR, TAO::API::ENCODING::MSGPACK };
+
+    for(const auto& nEncoding : vEncodings)
+    {
+        BenchmarkEncoding("blocks",       { { "result", jBlocks } },       nEncoding);
+        BenchmarkEncoding("transactions", { { "result", jTransactions } }, nEncoding);
+    }
+
+    debug::log(0, "===== End Response Encoding Benchmarks =====\n");
+}
@@ -0,0 +1,101 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <TAO/API/include/filter.h>
+#include <TAO/API/include/json.h>
+#include <TAO/API/types/predicate.h>
+
+#include <TAO/Ledger/include/constants.h>
+
+#include <TAO/Register/include/create.h>
+#include <TAO/Register/types/object.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Where Clause Benchmarks", "[API]")
+{
+    debug::log(0, "===== Begin Where Clause Benchmarks =====");
+
+    /* Build a sigchain of NXS accounts with random whole balances and timestamps, encoded without addresses to stay off the disk. */
+    const uint32_t nTotal = 100000;
+
+    std::vector<TAO::Register::Object> vRegisters;
+    vRegisters.reserve(nTotal);
+    for(uint32_t n = 0; n < nTotal; ++n)
+    {
+        TAO::Register::Object tAccount = TAO::Register::CreateAccount(0);
+        tAccount.nCreated  = 1600000000 + n;
+        tAccount.nModified = 1600000000 + n + LLC::GetRand(1000000);
+        tAccount.hashOwner = LLC::GetRand256();
+
+        REQUIRE(tAccount.Parse());
+        REQUIRE(tAccount.Write("balance", uint64_t(LLC::GetRand(100000)) * TAO::Ledger::NXS_COIN));
+
+        vRegisters.push_back(tAccount);
+    }
+
+    /* The same query both ways, on the formatted balance or the object member. */
+    const encoding::json jResults =
+        { { "where", TAO::API::QueryToJSON("results.balance>90000 AND results.modified>1600500000") } };
+
+    const encoding::json jObject =
+        { { "where", TAO::API::QueryToJSON("object.balance>90000 AND results.modified>1600500000") } };
+
+    /* Filter every register through its JSON. */
+    uint32_t nJSON = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& tRegister : vRegisters)
+        {
+            encoding::json jRegister = TAO::API::RegisterToJSON(tRegister);
+            if(TAO::API::FilterResults(jResults, jRegister))
+                ++nJSON;
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Where::", ANSI_COLOR_RESET, "JSON per register ", nTotal * 1000000.0 / nTime, " registers/s");
+    }
+
+    /* Filter the registers on the objects with the compiled predicate, building JSON only for the matches. */
+    uint32_t nCompiled = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        const TAO::API::Predicate tWhere = TAO::API::Predicate(jObject);
+        for(const auto& tRegister : vRegisters)
+        {
+            if(tWhere.Evaluate(tRegister) != TAO::API::Predicate::MATCH)
+                continue;
+
+            encoding::json jRegister = TAO::API::RegisterToJSON(tRegister);
+            ++nCompiled;
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Where::", ANSI_COLOR_RESET, "compiled predicate ", nTotal * 1000000.0 / nTime, " registers/s");
+    }
+
+    REQUIRE(nCompiled == nJSON);
+    debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Where::", ANSI_COLOR_RESET, nCompiled, " of ", nTotal, " registers matched");
+
+    debug::log(0, "===== End Where Clause Benchmarks =====\n");
+}
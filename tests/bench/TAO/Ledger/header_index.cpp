@@ -0,0 +1,177 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Ledger/include/enum.h>
+
+#include <TAO/Ledger/types/header_index.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Write a chain of block states off a block to the ledger, with a stake block every 30 blocks. */
+static std::vector<TAO::Ledger::BlockState> header_bench_chain(const TAO::Ledger::BlockState& stateStart, const uint32_t nBlocks)
+{
+    std::vector<TAO::Ledger::BlockState> vChain;
+    for(uint32_t n = 0; n < nBlocks; ++n)
+    {
+        const TAO::Ledger::BlockState& statePrev = (vChain.empty() ? stateStart : vChain.back());
+
+        TAO::Ledger::BlockState state;
+        state.nVersion      = 7;
+        state.hashPrevBlock = statePrev.GetHash();
+        state.nHeight       = statePrev.nHeight + 1;
+        state.nChannel      = (n % 30 == 0 ? 0 : 1 + (n % 2));
+        state.nBits         = 0x7b000000;
+        state.nNonce        = LLC::GetRand();
+        state.nChainTrust   = statePrev.nChainTrust + 1;
+
+        /* Blocks carry transactions, which every full read has to deserialize. */
+        for(uint32_t i = 0; i < 100; ++i)
+            state.vtx.push_back(std::make_pair(TAO::Ledger::TRANSACTION::TRITIUM, LLC::GetRand512()));
+
+        LLD::Ledger->WriteBlock(state.GetHash(), state);
+        vChain.push_back(state);
+    }
+
+    return vChain;
+}
+
+
+/* Find the fork of two chains by reading back through the ledger, as the best chain did without an index. */
+static uint32_t header_bench_walk(TAO::Ledger::BlockState fork, TAO::Ledger::BlockState longer)
+{
+    uint32_t nBlocks = 0;
+    while(fork != longer)
+    {
+        while(longer.nHeight > fork.nHeight)
+        {
+            ++nBlocks;
+            longer = longer.Prev();
+        }
+
+        if(fork == longer)
+            break;
+
+        ++nBlocks;
+        fork = fork.Prev();
+    }
+
+    return nBlocks;
+}
+
+
+TEST_CASE( "Header Index Benchmarks", "[ledger]")
+{
+    debug::log(0, "===== Begin Header Index Benchmarks =====");
+
+    TAO::Ledger::BlockState stateStart;
+    stateStart.nVersion = 7;
+    stateStart.nHeight  = 1;
+    stateStart.nChannel = 1;
+    stateStart.nBits    = 0x7b000000;
+    stateStart.nNonce   = LLC::GetRand();
+    LLD::Ledger->WriteBlock(stateStart.GetHash(), stateStart);
+
+    const std::vector<TAO::Ledger::BlockState> vChain  = header_bench_chain(stateStart, 5000);
+    const std::vector<TAO::Ledger::BlockState> vBranch = header_bench_chain(vChain[4900], 120);
+
+    /* Wait for the writes to reach the disk. */
+    while(!LLD::Ledger->HasBlock(vBranch.back().GetHash()))
+        runtime::sleep(10);
+
+    const uint32_t nTotal = 2000;
+
+    /* Search for the last stake block from the most recent blocks, walking back through the ledger. */
+    TAO::Ledger::headers.Clear();
+
+    std::vector<uint1024_t> vWalk;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+        {
+            TAO::Ledger::BlockState state = vChain[vChain.size() - 1 - n];
+            REQUIRE(TAO::Ledger::GetLastState(state, 0));
+
+            vWalk.push_back(state.GetHash());
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "GetLastState::", ANSI_COLOR_RESET, "ledger walk ", nTotal * 1000000.0 / nTime, " per/s");
+    }
+
+    /* The same search hopping through the header index. */
+    REQUIRE(TAO::Ledger::headers.Load(vChain.back(), 10000) == vChain.size() + 1);
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+        {
+            TAO::Ledger::BlockState state = vChain[vChain.size() - 1 - n];
+            REQUIRE(TAO::Ledger::GetLastState(state, 0));
+
+            REQUIRE(state.GetHash() == vWalk[n]);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "GetLastState::", ANSI_COLOR_RESET, "header index ", nTotal * 1000000.0 / nTime, " per/s");
+    }
+
+    /* Search for the fork of a 100 block reorganization, walking back through the ledger. */
+    for(const auto& state : vBranch)
+        TAO::Ledger::headers.Insert(state);
+
+    const uint32_t nForks = 100;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nForks; ++n)
+            REQUIRE(header_bench_walk(vChain.back(), vBranch.back()) == 99 + 120);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Fork::", ANSI_COLOR_RESET, "ledger walk ", nForks * 1000000.0 / nTime, " per/s");
+    }
+
+    /* The same search hopping through the header index. */
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<uint1024_t> vDisconnect;
+        std::vector<uint1024_t> vConnect;
+        uint1024_t hashFork = 0;
+        for(uint32_t n = 0; n < nForks; ++n)
+        {
+            REQUIRE(TAO::Ledger::headers.Fork(vChain.back().GetHash(), vBranch.back().GetHash(), vDisconnect, vConnect, hashFork));
+            REQUIRE(vDisconnect.size() + vConnect.size() == 99 + 120);
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Fork::", ANSI_COLOR_RESET, "header index ", nForks * 1000000.0 / nTime, " per/s");
+    }
+
+    TAO::Ledger::headers.Clear();
+
+    debug::log(0, "===== End Header Index Benchmarks =====\n");
+}
@@ -0,0 +1,115 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
+#include <TAO/Ledger/types/merkle_tree.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Merkle Tree Benchmarks", "[ledger]")
+{
+    debug::log(0, "===== Begin Merkle Tree Benchmarks =====");
+
+    const uint32_t nTotal = 50000;
+
+    std::vector<uint512_t> vHashes;
+    for(uint32_t i = 0; i < nTotal; ++i)
+        vHashes.push_back(LLC::GetRand512());
+
+    //serial pair by pair build, as blocks used to do it
+    uint512_t hashSerial = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<uint512_t> vMerkleTree(vHashes);
+
+        uint32_t j = 0;
+        for(uint32_t nSize = nTotal; nSize > 1; nSize = (nSize + 1) / 2)
+        {
+            for(uint32_t i = 0; i < nSize; i += 2)
+            {
+                const uint512_t hashLeft  = vMerkleTree[j + i];
+                const uint512_t hashRight = vMerkleTree[j + std::min(i + 1, nSize - 1)];
+
+                vMerkleTree.push_back(LLC::SK512(BEGIN(hashLeft), END(hashLeft), BEGIN(hashRight), END(hashRight)));
+            }
+
+            j += nSize;
+        }
+
+        hashSerial = vMerkleTree.back();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Serial::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " leaves / second");
+    }
+
+    //batched and chunked build
+    TAO::Ledger::MerkleTree tree;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        tree.Build(vHashes);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Build::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " leaves / second");
+
+        REQUIRE(tree.Root() == hashSerial);
+    }
+
+    //single leaf updates, such as a re-signed producer
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < 1000; ++i)
+            tree.Update(nTotal - 1, LLC::GetRand512());
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Update::", ANSI_COLOR_RESET, 1000 * 1000000.0 / nTime, " updates / second");
+    }
+
+    //appending leaves
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < 1000; ++i)
+            tree.Append(LLC::GetRand512());
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Append::", ANSI_COLOR_RESET, 1000 * 1000000.0 / nTime, " appends / second");
+    }
+
+    //branch proofs
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t i = 0; i < nTotal; ++i)
+            tree.Branch(i);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Branch::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " branches / second");
+    }
+
+    debug::log(0, "===== End Merkle Tree Benchmarks =====\n");
+}
@@ -4,6 +4,8 @@
 
 #include <Util/include/debug.h>
 
+#include <thread>
+
 TEST_CASE( "Signature Chain Benchmarks", "[ledger]")
 {
 
@@ -26,5 +28,47 @@ TEST_CASE( "Signature Chain Benchmarks", "[ledger]")
     nTime = bench.ElapsedMilliseconds();
     debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Generate::", ANSI_COLOR_RESET, "Created in ", nTime, " ms");
 
+    bench.Reset();
+    user.Generate("auth", 0, "pin");
+
+    //time output
+    nTime = bench.ElapsedMilliseconds();
+    debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Generate::", ANSI_COLOR_RESET, "Typed key created in ", nTime, " ms");
+
+    bench.Reset();
+    user.Generate("auth", 0, "pin");
+
+    //time output
+    nTime = bench.ElapsedMilliseconds();
+    debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Generate::", ANSI_COLOR_RESET, "Typed key cached in ", nTime, " ms");
+
+    bench.Reset();
+    user.Prepare({ "network", "sign", "lisp" }, 0, "pin");
+
+    //time output
+    nTime = bench.ElapsedMilliseconds();
+    debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Prepare::", ANSI_COLOR_RESET, "3 typed keys created in ", nTime, " ms");
+
+    //simulate concurrent logins
+    bench.Reset();
+    {
+        std::vector<std::thread> vLogins;
+        for(uint32_t n = 0; n < 8; ++n)
+            vLogins.emplace_back(std::thread([n]
+            {
+                const TAO::Ledger::Credentials login =
+                    TAO::Ledger::Credentials(SecureString(debug::safe_printstr("user", n).c_str()), "password");
+
+                login.Generate("auth", 0, "pin");
+            }));
+
+        for(auto& tLogin : vLogins)
+            tLogin.join();
+    }
+
+    //time output
+    nTime = bench.ElapsedMilliseconds();
+    debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Login::", ANSI_COLOR_RESET, "8 concurrent logins in ", nTime, " ms");
+
     debug::log(0, "===== End Signature Chain Benchmarks =====\n");
 }
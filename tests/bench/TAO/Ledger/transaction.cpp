@@ -0,0 +1,124 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/version.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/runtime.h>
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* The work a transaction sees from being received to relayed: hashed when accepted, checked, and indexed, then
+ * measured, relayed and written. Returns the number of bytes serialized along the way. */
+static uint64_t transaction_work(const TAO::Ledger::Transaction& tx)
+{
+    uint64_t nBytes = 0;
+    for(uint32_t n = 0; n < 3; ++n)
+        nBytes += tx.GetHash().Get64(0) & 1;
+
+    nBytes += ::GetSerializeSize(tx, SER_NETWORK, LLP::PROTOCOL_VERSION);
+
+    DataStream ssRelay(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssRelay << tx;
+
+    DataStream ssDisk(SER_LLD, LLD::DATABASE_VERSION);
+    ssDisk << tx;
+
+    return nBytes + ssRelay.size() + ssDisk.size();
+}
+
+
+TEST_CASE( "Transaction Bytes Benchmarks", "[ledger]")
+{
+    debug::log(0, "===== Begin Transaction Bytes Benchmarks =====");
+
+    const uint32_t nTotal = 10000;
+
+    /* Build transactions of a few contracts, as they come in from the network. */
+    std::vector<TAO::Ledger::Transaction> vBuilt;
+    std::vector<TAO::Ledger::Transaction> vRecv;
+    for(uint32_t i = 0; i < nTotal; ++i)
+    {
+        TAO::Ledger::Transaction tx;
+        tx.nSequence   = i;
+        tx.hashGenesis = LLC::GetRand256();
+        tx.hashPrevTx  = LLC::GetRand512();
+        for(uint32_t n = 0; n < 4; ++n)
+            tx[n] << uint8_t(TAO::Operation::OP::DEBIT) << LLC::GetRand256() << LLC::GetRand256() << uint64_t(n) << uint64_t(0);
+
+        tx.vchPubKey = std::vector<uint8_t>(897, 0x0a);
+        tx.vchSig    = std::vector<uint8_t>(690, 0x0b);
+
+        DataStream ssTx(SER_NETWORK, LLP::PROTOCOL_VERSION);
+        ssTx << tx;
+
+        TAO::Ledger::Transaction txRecv;
+        ssTx >> txRecv;
+
+        vBuilt.push_back(tx);
+        vRecv.push_back(txRecv);
+    }
+
+    //serializing every time, as built transactions do
+    uint64_t nBuilt = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& tx : vBuilt)
+            nBuilt += transaction_work(tx);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Serialize::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tx / second");
+    }
+
+    //reusing the kept bytes of received transactions
+    uint64_t nRecv = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& tx : vRecv)
+            nRecv += transaction_work(tx);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Kept::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tx / second");
+    }
+
+    REQUIRE(nBuilt == nRecv);
+
+    //copying received transactions, as the memory pool and ledger reads do
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        std::vector<TAO::Ledger::Transaction> vCopies(vRecv);
+        for(uint32_t i = 0; i < nTotal; ++i)
+            REQUIRE(vCopies[i].Bytes().get() == vRecv[i].Bytes().get());
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Copy::", ANSI_COLOR_RESET, nTotal * 1000000.0 / nTime, " tx / second");
+    }
+
+    debug::log(0, "===== End Transaction Bytes Benchmarks =====\n");
+}
@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 #include <LLC/types/uint1024.h>
 #include <LLC/types/bignum.h>
+#include <LLC/include/montgomery.h>
 #include <LLC/include/random.h>
 #include <LLC/prime/fermat.h>
 #include <openssl/bn.h>
@@ -82,3 +83,42 @@ TEST_CASE("Fermat Tests", "[LLC]")
 
 
 }
+
+
+TEST_CASE("Montgomery Fermat Tests", "[LLC]")
+{
+    uint1024_t hashNumber = uint1024_t("0x010009f035e34e85a13fe2c51d56d96781ace0b2df31fecff9ff09094e7772db452d335fe59dfaab61a6bafcf399a5705e98a9b2e1b368e37d267f76693388ffe8255177a734eb77ceac385f0a994288f24bc2526d4c53499aaf270232eb9d31f6ee6c78627bbd490ac899c5a814d861acafd17f51882e68dc01f7330db013cc");
+    uint64_t nonce = uint64_t(5190024797402611181);
+
+    uint1024_t bn1 = hashNumber + nonce;
+    REQUIRE(LLC::FermatTest(bn1) == 1);
+    REQUIRE(LLC::FermatTest(bn1).GetHex() == FermatTest2(LLC::CBigNum(bn1)).getuint1024().GetHex());
+
+    //small and even moduli
+    REQUIRE(LLC::FermatTest(uint1024_t(1)) == 0);
+    REQUIRE(LLC::FermatTest(uint1024_t(7)) == 1);
+    REQUIRE(LLC::FermatTest(uint1024_t(9)) == 4);
+    REQUIRE(LLC::FermatTest(uint1024_t(10)).GetHex() == FermatTest2(LLC::CBigNum(10)).getuint1024().GetHex());
+
+    //random odd numbers, including those with the highest bit set
+    std::vector<uint1024_t> vTest;
+    for(uint32_t i = 0; i < 200; ++i)
+    {
+        bn1 = LLC::GetRand1024();
+        bn1 |= 1; //make odd
+
+        if(i % 2 == 0)
+            bn1 |= (uint1024_t(1) << 1023);
+
+        vTest.push_back(bn1);
+        REQUIRE(LLC::FermatTest(bn1).GetHex() == FermatTest2(LLC::CBigNum(bn1)).getuint1024().GetHex());
+    }
+
+    //batched results match single results
+    std::vector<uint1024_t> vResults;
+    LLC::FermatTest(vTest, vResults);
+
+    REQUIRE(vResults.size() == vTest.size());
+    for(uint32_t i = 0; i < vTest.size(); ++i)
+        REQUIRE(vResults[i] == LLC::FermatTest(vTest[i]));
+}
@@ -0,0 +1,54 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "SK512 Batch Tests", "[LLC]")
+{
+    //lengths around every skein block boundary
+    std::vector<std::vector<uint8_t>> vData;
+    for(uint32_t nLength : { 0, 1, 63, 64, 65, 127, 128, 129, 192, 500 })
+    {
+        for(uint32_t i = 0; i < 9; ++i)
+        {
+            std::vector<uint8_t> vch(nLength);
+            for(auto& n : vch)
+                n = static_cast<uint8_t>(LLC::GetRandInt(255));
+
+            vData.push_back(vch);
+        }
+    }
+
+    std::vector<uint512_t> vHashes;
+    LLC::SK512(vData, vHashes);
+
+    REQUIRE(vHashes.size() == vData.size());
+    for(uint32_t i = 0; i < vData.size(); ++i)
+        REQUIRE(vHashes[i] == LLC::SK512(vData[i].begin(), vData[i].end(), LLC::pblank, LLC::pblank));
+
+    //merkle pairs stored back to back
+    std::vector<uint512_t> vNodes;
+    for(uint32_t i = 0; i < 42; ++i)
+        vNodes.push_back(LLC::GetRand512());
+
+    std::vector<uint512_t> vPairs(21);
+    LLC::SK512((uint8_t *)&vNodes[0], 128, 21, &vPairs[0]);
+
+    for(uint32_t i = 0; i < 21; ++i)
+        REQUIRE(vPairs[i] == LLC::SK512(BEGIN(vNodes[i * 2]), END(vNodes[i * 2]), BEGIN(vNodes[i * 2 + 1]), END(vNodes[i * 2 + 1])));
+}
@@ -0,0 +1,81 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/block_cache.h>
+
+
+TEST_CASE( "Block Cache Tests", "[LLP]")
+{
+    LLP::BlockCache cache(4096);
+
+    const uint1024_t hashBlock = LLC::GetRand1024();
+    const uint1024_t hashNext  = LLC::GetRand1024();
+
+    //two packets of 100 bytes
+    std::shared_ptr<LLP::BlockCache::Packets> pPackets = std::make_shared<LLP::BlockCache::Packets>();
+    pPackets->push_back(std::vector<uint8_t>(100, 0x01));
+    pPackets->push_back(std::vector<uint8_t>(100, 0x02));
+
+    //miss before it is added
+    REQUIRE(cache.Get(hashBlock, 0x41, hashNext) == nullptr);
+    REQUIRE(cache.Misses() == 1);
+
+    cache.Put(hashBlock, 0x41, hashNext, pPackets);
+    REQUIRE(cache.Size() == 1);
+    REQUIRE(cache.Bytes() == 200);
+
+    //hit with the same specifier
+    std::shared_ptr<const LLP::BlockCache::Packets> pCached = cache.Get(hashBlock, 0x41, hashNext);
+    REQUIRE(pCached != nullptr);
+    REQUIRE(pCached->size() == 2);
+    REQUIRE(pCached->at(1)[0] == 0x02);
+    REQUIRE(cache.Hits() == 1);
+    REQUIRE(cache.BytesServed() == 200);
+
+    //other specifiers are separate entries
+    REQUIRE(cache.Get(hashBlock, 0x42, hashNext) == nullptr);
+
+    //a new next block drops the entry
+    REQUIRE(cache.Get(hashBlock, 0x41, LLC::GetRand1024()) == nullptr);
+    REQUIRE(cache.Size() == 0);
+    REQUIRE(cache.Bytes() == 0);
+
+    //least recently used entries are evicted once over size
+    std::vector<uint1024_t> vBlocks;
+    for(uint32_t i = 0; i < 30; ++i)
+    {
+        vBlocks.push_back(LLC::GetRand1024());
+        cache.Put(vBlocks.back(), 0x41, hashNext, pPackets);
+
+        //keep the first block in use
+        REQUIRE(cache.Get(vBlocks[0], 0x41, hashNext) != nullptr);
+    }
+
+    REQUIRE(cache.Bytes() <= 4096);
+    REQUIRE(cache.Size() == 20);
+    REQUIRE(cache.Get(vBlocks[1], 0x41, hashNext) == nullptr);
+    REQUIRE(cache.Get(vBlocks[29], 0x41, hashNext) != nullptr);
+
+    //entries over a quarter of the cache are not kept
+    pPackets->push_back(std::vector<uint8_t>(1024, 0x03));
+    cache.Put(hashBlock, 0x41, hashNext, pPackets);
+    REQUIRE(cache.Get(hashBlock, 0x41, hashNext) == nullptr);
+
+    cache.Clear();
+    REQUIRE(cache.Size() == 0);
+    REQUIRE(cache.Bytes() == 0);
+}
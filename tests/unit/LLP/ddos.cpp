@@ -0,0 +1,107 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLP/templates/ddos.h>
+
+#include <thread>
+
+
+TEST_CASE( "DDOS scores and request limits", "[llp]")
+{
+    SECTION("Scores from many threads are all counted")
+    {
+        LLP::DDOS_Score score(60);
+
+        std::vector<std::thread> vThreads;
+        for(uint32_t nThread = 0; nThread < 4; ++nThread)
+        {
+            vThreads.push_back(std::thread([&score]()
+            {
+                for(uint32_t n = 0; n < 15000; ++n)
+                    score += 1;
+            }));
+        }
+
+        for(auto& tThread : vThreads)
+            tThread.join();
+
+        /* The moving average is per second over the whole timespan. */
+        REQUIRE(score.Score() == 60000 / 60);
+
+        score.Flush();
+        REQUIRE(score.Score() == 0);
+    }
+
+
+    SECTION("Token bucket holds a burst then refills")
+    {
+        LLP::DDOS_Limit limit;
+
+        /* Ten tokens, one every millisecond. */
+        for(uint32_t n = 0; n < 10; ++n)
+            REQUIRE(limit.Take(1000000, 1000, 10));
+
+        REQUIRE_FALSE(limit.Take(1000000, 1000, 10));
+
+        /* One token comes back each interval. */
+        REQUIRE(limit.Take(1001000, 1000, 10));
+        REQUIRE_FALSE(limit.Take(1001000, 1000, 10));
+
+        /* A given back token can be taken again. */
+        limit.Give(1000);
+        REQUIRE(limit.Take(1001000, 1000, 10));
+
+        /* Idle time fills the bucket, but never past the burst. */
+        for(uint32_t n = 0; n < 10; ++n)
+            REQUIRE(limit.Take(9000000, 1000, 10));
+
+        REQUIRE_FALSE(limit.Take(9000000, 1000, 10));
+
+        /* Giving back a token after a reset leaves the bucket full, rather than wrapping it far into the future. */
+        limit.Reset();
+        limit.Give(1000);
+        for(uint32_t n = 0; n < 10; ++n)
+            REQUIRE(limit.Take(9000000, 1000, 10));
+
+        REQUIRE_FALSE(limit.Take(9000000, 1000, 10));
+    }
+
+
+    SECTION("Commands are limited on their own and as an address")
+    {
+        LLP::DDOS_Filter filter(60, 100, 20);
+
+        /* One command runs out first, without holding back others. */
+        uint32_t nAllowed = 0;
+        for(uint32_t n = 0; n < 50; ++n)
+            nAllowed += filter.Allow(0x10) ? 1 : 0;
+
+        REQUIRE(nAllowed == 20);
+        REQUIRE(filter.Allow(0x11));
+
+        /* The address runs out across all commands. */
+        nAllowed = 0;
+        for(uint16_t nCommand = 0; nCommand < 256; ++nCommand)
+            nAllowed += filter.Allow(nCommand) ? 1 : 0;
+
+        REQUIRE(nAllowed <= 100 - 21 + 1);
+        REQUIRE(nAllowed >= 100 - 21 - 1);
+
+        /* No limits lets everything through. */
+        LLP::DDOS_Filter open(60);
+        for(uint32_t n = 0; n < 10000; ++n)
+            REQUIRE(open.Allow(0x10));
+    }
+}
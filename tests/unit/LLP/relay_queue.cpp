@@ -0,0 +1,102 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/relay_queue.h>
+
+#include <Util/include/runtime.h>
+
+
+TEST_CASE( "Relay queue batching and known inventory", "[llp]")
+{
+    SECTION("Announcements are held for the interval")
+    {
+        LLP::RelayQueue queue(1000, 50);
+        REQUIRE_FALSE(queue.Ready(100));
+
+        REQUIRE(queue.Queue(LLC::GetRand512(), false));
+        REQUIRE(queue.Queue(LLC::GetRand512(), true));
+        REQUIRE_FALSE(queue.Ready(100));
+
+        runtime::sleep(60);
+        REQUIRE(queue.Ready(100));
+
+        const std::vector<std::pair<bool, uint512_t>> vTake = queue.Take(100);
+        REQUIRE(vTake.size() == 2);
+        REQUIRE_FALSE(vTake[0].first);
+        REQUIRE(vTake[1].first);
+
+        REQUIRE(queue.Pending() == 0);
+        REQUIRE_FALSE(queue.Ready(100));
+    }
+
+
+    SECTION("A full packet goes out without waiting")
+    {
+        LLP::RelayQueue queue(1000, 60000);
+
+        std::vector<uint512_t> vHashes;
+        for(uint32_t n = 0; n < 250; ++n)
+        {
+            vHashes.push_back(LLC::GetRand512());
+            REQUIRE(queue.Queue(vHashes.back(), false));
+        }
+
+        /* Batches come out oldest first, at most one packet each. */
+        uint32_t nIndex = 0, nPackets = 0;
+        while(queue.Ready(100))
+        {
+            for(const auto& tx : queue.Take(100))
+                REQUIRE(tx.second == vHashes[nIndex++]);
+
+            ++nPackets;
+        }
+
+        /* The rest are behind a packet that already went, so they are due immediately. */
+        REQUIRE(nPackets == 3);
+        REQUIRE(nIndex == 250);
+    }
+
+
+    SECTION("Known transactions are never announced")
+    {
+        LLP::RelayQueue queue(1000, 0);
+
+        /* Transactions the node told us about. */
+        std::vector<uint512_t> vKnown;
+        for(uint32_t n = 0; n < 100; ++n)
+        {
+            vKnown.push_back(LLC::GetRand512());
+            queue.Known(vKnown.back());
+        }
+
+        /* Relaying them, twice, sends nothing. */
+        for(uint32_t nPass = 0; nPass < 2; ++nPass)
+            for(const uint512_t& hashTx : vKnown)
+                REQUIRE_FALSE(queue.Queue(hashTx, false));
+
+        REQUIRE(queue.Suppressed() == 200);
+        REQUIRE(queue.Pending() == 0);
+
+        /* A new transaction is announced once. */
+        const uint512_t hashTx = LLC::GetRand512();
+        REQUIRE_FALSE(queue.Has(hashTx));
+        REQUIRE(queue.Queue(hashTx, false));
+        REQUIRE(queue.Has(hashTx));
+        REQUIRE_FALSE(queue.Queue(hashTx, false));
+        REQUIRE(queue.Pending() == 1);
+    }
+}
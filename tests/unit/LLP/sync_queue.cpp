@@ -0,0 +1,201 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/sync_queue.h>
+
+#include <algorithm>
+
+
+/* Build a linked chain of base blocks on top of a genesis hash. */
+static std::vector<TAO::Ledger::Block> sync_chain(const uint1024_t& hashGenesis, const uint32_t nBlocks)
+{
+    std::vector<TAO::Ledger::Block> vChain;
+
+    uint1024_t hashPrev = hashGenesis;
+    for(uint32_t n = 1; n <= nBlocks; ++n)
+    {
+        TAO::Ledger::Block block(1, hashPrev, 2, n);
+        block.hashMerkleRoot = LLC::GetRand512();
+        block.nNonce         = n;
+
+        hashPrev = block.GetHash();
+        vChain.push_back(block);
+    }
+
+    return vChain;
+}
+
+
+/* Simulated node delivering the blocks of a listed range, the way ACTION::LIST serves them. */
+static uint32_t sync_deliver(LLP::SyncQueue& queue, const std::vector<TAO::Ledger::Block>& vChain,
+                             const uint64_t nSession, const uint1024_t& hashStart, const uint1024_t& hashStop)
+{
+    /* Find the block after the start hash. */
+    uint32_t nIndex = 0;
+    while(nIndex < vChain.size() && vChain[nIndex].hashPrevBlock != hashStart)
+        ++nIndex;
+
+    uint32_t nDelivered = 0;
+    for( ; nIndex < vChain.size(); ++nIndex)
+    {
+        REQUIRE(queue.Add(nSession, std::unique_ptr<TAO::Ledger::Block>(vChain[nIndex].Clone()), 256));
+        ++nDelivered;
+
+        if(vChain[nIndex].GetHash() == hashStop)
+            break;
+    }
+
+    return nDelivered;
+}
+
+
+TEST_CASE( "Sync Queue Tests", "[LLP]")
+{
+    const uint1024_t hashGenesis = LLC::GetRand1024();
+    const std::vector<TAO::Ledger::Block> vChain = sync_chain(hashGenesis, 100);
+
+    //10 block windows, at most 40 blocks past the connected tip
+    LLP::SyncQueue queue(10, 40);
+    REQUIRE_FALSE(queue.Active());
+
+    queue.Reset(0, hashGenesis);
+    REQUIRE(queue.Active());
+    REQUIRE(queue.Height() == 1);
+
+    //no windows without headers
+    uint1024_t hashStart, hashStop;
+    REQUIRE_FALSE(queue.Assign(1, 100, hashStart, hashStop));
+
+    //headers have to extend the chain
+    uint1024_t hashFrom;
+    REQUIRE(queue.RequestHeaders(hashFrom));
+    REQUIRE(hashFrom == hashGenesis);
+    REQUIRE_FALSE(queue.RequestHeaders(hashFrom));
+
+    REQUIRE(queue.AddHeader(0, hashGenesis, 0));
+    REQUIRE_FALSE(queue.AddHeader(2, vChain[1].GetHash(), vChain[0].GetHash()));
+    REQUIRE_FALSE(queue.AddHeader(1, vChain[0].GetHash(), LLC::GetRand1024()));
+    for(const auto& block : vChain)
+        REQUIRE(queue.AddHeader(block.nHeight, block.GetHash(), block.hashPrevBlock));
+
+    //headers we have are taken again, conflicting ones are not
+    REQUIRE(queue.AddHeader(vChain[49].nHeight, vChain[49].GetHash(), vChain[49].hashPrevBlock));
+    REQUIRE_FALSE(queue.AddHeader(vChain[49].nHeight, LLC::GetRand1024(), vChain[49].hashPrevBlock));
+    REQUIRE_FALSE(queue.AddHeader(101, LLC::GetRand1024(), vChain[98].GetHash()));
+    REQUIRE(queue.HeaderHeight() == 100);
+
+    //lists that don't end at the last header don't answer the request
+    queue.HeadersReceived(vChain[49].GetHash(), 100);
+    REQUIRE_FALSE(queue.RequestHeaders(hashFrom));
+
+    queue.HeadersReceived(vChain.back().GetHash(), 200);
+    REQUIRE(queue.HeaderHeight() == 100);
+    REQUIRE_FALSE(queue.Done());
+
+    //three nodes get two windows each, up to the download horizon
+    std::vector<std::pair<uint1024_t, uint1024_t>> vRequests[3];
+    for(uint64_t nSession = 1; nSession <= 3; ++nSession)
+    {
+        while(queue.Assign(nSession, 100, hashStart, hashStop))
+            vRequests[nSession - 1].push_back(std::make_pair(hashStart, hashStop));
+    }
+    REQUIRE(vRequests[0].size() == 2);
+    REQUIRE(vRequests[1].size() == 2);
+    REQUIRE(vRequests[2].size() == 0);
+    REQUIRE(vRequests[0][0].first  == hashGenesis);
+    REQUIRE(vRequests[0][0].second == vChain[9].GetHash());
+    REQUIRE(vRequests[1][1].second == vChain[39].GetHash());
+
+    //blocks that don't match their header are rejected
+    TAO::Ledger::Block bad(1, vChain[4].GetHash(), 2, 6);
+    REQUIRE_FALSE(queue.Add(2, std::unique_ptr<TAO::Ledger::Block>(bad.Clone()), 256));
+
+    //later windows arrive first and wait in the buffer
+    REQUIRE(sync_deliver(queue, vChain, 2, vRequests[1][1].first, vRequests[1][1].second) == 10);
+    REQUIRE(sync_deliver(queue, vChain, 2, vRequests[1][0].first, vRequests[1][0].second) == 10);
+    REQUIRE(queue.Buffered() == 20);
+    REQUIRE_FALSE(queue.Ready());
+    REQUIRE(queue.Next() == nullptr);
+
+    //node 1 stalls, its windows go to node 3
+    REQUIRE(queue.Stalled(0) == std::vector<uint64_t>{ 1 });
+    REQUIRE(queue.Assign(3, 100, hashStart, hashStop));
+    REQUIRE(hashStart == hashGenesis);
+    REQUIRE(sync_deliver(queue, vChain, 3, hashStart, hashStop) == 10);
+
+    //blocks connect in height order
+    for(uint32_t n = 1; n <= 10; ++n)
+    {
+        std::unique_ptr<TAO::Ledger::Block> pBlock = queue.Next();
+        REQUIRE(pBlock != nullptr);
+        REQUIRE(pBlock->nHeight == n);
+    }
+    REQUIRE(queue.Next() == nullptr);
+
+    //the freed second window is picked up, and the rest of the chain is cut into new windows
+    REQUIRE(queue.Assign(3, 100, hashStart, hashStop));
+    REQUIRE(hashStart == vChain[9].GetHash());
+    REQUIRE(sync_deliver(queue, vChain, 3, hashStart, hashStop) == 10);
+
+    //the buffered windows connect behind it
+    while(queue.Ready())
+        queue.Next();
+    REQUIRE(queue.Height() == 41);
+
+    //a disconnected node frees its windows
+    REQUIRE(queue.Assign(2, 100, hashStart, hashStop));
+    REQUIRE(queue.Assign(2, 100, hashStart, hashStop));
+    queue.Remove(2);
+
+    //nodes stop getting windows after too many stalls
+    for(uint32_t n = 0; n < LLP::SyncQueue::MAX_STALLS; ++n)
+    {
+        REQUIRE(queue.Assign(5, 100, hashStart, hashStop));
+        REQUIRE(queue.Stalled(0) == std::vector<uint64_t>{ 5 });
+    }
+    REQUIRE_FALSE(queue.Assign(5, 100, hashStart, hashStop));
+    REQUIRE(queue.Stalled(0).size() == 0);
+
+    //the rest of the chain downloads from the remaining nodes
+    while(queue.Height() <= 100)
+    {
+        for(uint64_t nSession = 3; nSession <= 4; ++nSession)
+        {
+            while(queue.Assign(nSession, 100, hashStart, hashStop))
+                sync_deliver(queue, vChain, nSession, hashStart, hashStop);
+        }
+
+        while(queue.Ready())
+        {
+            const uint32_t nHeight = queue.Height();
+            REQUIRE(queue.Next()->nHeight == nHeight);
+        }
+    }
+    REQUIRE(queue.Throughput(3) > 0);
+    REQUIRE(queue.Windows() == 0);
+    REQUIRE(queue.Buffered() == 0);
+
+    //headers are complete once they reach the sync node's height
+    REQUIRE(queue.RequestHeaders(hashFrom));
+    REQUIRE(hashFrom == vChain.back().GetHash());
+    queue.HeadersReceived(hashFrom, 100);
+    REQUIRE(queue.Done());
+    REQUIRE_FALSE(queue.RequestHeaders(hashFrom));
+
+    queue.Stop();
+    REQUIRE_FALSE(queue.Active());
+}
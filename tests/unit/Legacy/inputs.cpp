@@ -0,0 +1,207 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <Legacy/include/signature.h>
+#include <Legacy/types/address.h>
+#include <Legacy/types/coin.h>
+#include <Legacy/types/script.h>
+#include <Legacy/types/transaction.h>
+#include <Legacy/wallet/basickeystore.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/enum.h>
+#include <TAO/Ledger/types/mempool.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Create a transaction paying three outputs to a script. */
+static Legacy::Transaction inputs_prev(const Legacy::Script& scriptTo, const uint32_t nTime)
+{
+    Legacy::Transaction tx;
+    tx.nTime = nTime;
+    tx.vin.push_back(Legacy::TxIn(LLC::GetRand512(), 0));
+    for(uint32_t n = 1; n <= 3; ++n)
+        tx.vout.push_back(Legacy::TxOut(n * 1000, scriptTo));
+
+    return tx;
+}
+
+
+/* Create a signed transaction spending outputs of a previous transaction. */
+static Legacy::Transaction inputs_spend(const Legacy::KeyStore& keystore, const Legacy::Transaction& txPrev,
+    const std::vector<uint32_t>& vOutputs, const uint32_t nTime)
+{
+    Legacy::Script scriptTo;
+    scriptTo.SetNexusAddress(Legacy::NexusAddress(LLC::GetRand256()));
+
+    Legacy::Transaction tx;
+    tx.nTime = nTime;
+    for(const auto& n : vOutputs)
+        tx.vin.push_back(Legacy::TxIn(txPrev.GetHash(), n));
+
+    tx.vout.push_back(Legacy::TxOut(500, scriptTo));
+
+    for(uint32_t i = 0; i < tx.vin.size(); ++i)
+        REQUIRE(Legacy::SignSignature(keystore, txPrev, tx, i));
+
+    return tx;
+}
+
+
+TEST_CASE( "Legacy input fetch", "[legacy]")
+{
+    /* Key for the outputs being spent. */
+    LLC::ECKey key;
+    key.MakeNewKey(true);
+
+    Legacy::BasicKeyStore keystore;
+    REQUIRE(keystore.AddKey(key));
+
+    Legacy::Script scriptMine;
+    scriptMine.SetNexusAddress(Legacy::NexusAddress(key.GetPubKey()));
+
+    const uint32_t nNow = runtime::unifiedtimestamp();
+    TAO::Ledger::BlockState state = TAO::Ledger::ChainState::tStateBest.load();
+
+    /* Outputs are indexed with their transaction, and spent without reading it. */
+    {
+        const Legacy::Transaction txPrev = inputs_prev(scriptMine, nNow - 60);
+        const uint512_t hashPrev = txPrev.GetHash();
+        REQUIRE(LLD::Legacy->WriteTx(hashPrev, txPrev));
+
+        for(uint32_t n = 0; n < 3; ++n)
+        {
+            Legacy::Coin coin;
+            REQUIRE(LLD::Legacy->ReadOutput(hashPrev, n, coin));
+            REQUIRE(coin.out == txPrev.vout[n]);
+            REQUIRE(coin.nTime == txPrev.nTime);
+            REQUIRE_FALSE(coin.fCoinBase);
+            REQUIRE_FALSE(coin.fCoinStake);
+        }
+
+        Legacy::Coin coin;
+        REQUIRE_FALSE(LLD::Legacy->ReadOutput(hashPrev, 3, coin));
+
+        const Legacy::Transaction tx = inputs_spend(keystore, txPrev, { 0, 2 }, nNow);
+
+        std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
+        REQUIRE(tx.FetchInputs(inputs));
+        REQUIRE(inputs.size() == 1);
+        REQUIRE(tx.GetValueIn(inputs) == 4000);
+
+        REQUIRE(tx.Connect(inputs, state, TAO::Ledger::FLAGS::MEMPOOL));
+
+        /* A second spend from the same map fetches only the output it adds. */
+        const Legacy::Transaction txOther = inputs_spend(keystore, txPrev, { 1 }, nNow);
+        REQUIRE(txOther.FetchInputs(inputs));
+        REQUIRE(inputs.size() == 1);
+        REQUIRE(txOther.GetValueIn(inputs) == 2000);
+        REQUIRE(tx.GetValueIn(inputs) == 4000);
+    }
+
+
+    /* Transactions written before the index are read whole. */
+    {
+        const Legacy::Transaction txPrev = inputs_prev(scriptMine, nNow - 60);
+        const uint512_t hashPrev = txPrev.GetHash();
+        REQUIRE(LLD::Legacy->Write(std::make_pair(std::string("tx"), hashPrev), txPrev, "tx"));
+
+        Legacy::Coin coin;
+        REQUIRE_FALSE(LLD::Legacy->ReadOutput(hashPrev, 0, coin));
+
+        const Legacy::Transaction tx = inputs_spend(keystore, txPrev, { 1, 2 }, nNow);
+
+        std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
+        REQUIRE(tx.FetchInputs(inputs));
+        REQUIRE(tx.GetValueIn(inputs) == 5000);
+
+        /* Both ways give the same inputs. */
+        REQUIRE(LLD::Legacy->WriteTx(hashPrev, txPrev));
+
+        std::map<uint512_t, std::pair<uint8_t, DataStream> > indexed;
+        REQUIRE(tx.FetchInputs(indexed));
+        REQUIRE(indexed.at(hashPrev).second.Bytes() == inputs.at(hashPrev).second.Bytes());
+
+        REQUIRE(tx.Connect(inputs, state, TAO::Ledger::FLAGS::MEMPOOL));
+    }
+
+
+    /* Missing inputs and outputs out of range aren't found. */
+    {
+        const Legacy::Transaction txPrev = inputs_prev(scriptMine, nNow - 60);
+        REQUIRE(LLD::Legacy->WriteTx(txPrev.GetHash(), txPrev));
+
+        Legacy::Transaction tx = inputs_spend(keystore, txPrev, { 0 }, nNow);
+        tx.vin.push_back(Legacy::TxIn(LLC::GetRand512(), 0));
+
+        std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
+        REQUIRE_FALSE(tx.FetchInputs(inputs));
+
+        tx.vin.back() = Legacy::TxIn(txPrev.GetHash(), 3);
+
+        inputs.clear();
+        REQUIRE_FALSE(tx.FetchInputs(inputs));
+    }
+
+
+    /* Spent inputs are still fetched, and refused on connect. */
+    {
+        const Legacy::Transaction txPrev = inputs_prev(scriptMine, nNow - 60);
+        const uint512_t hashPrev = txPrev.GetHash();
+        REQUIRE(LLD::Legacy->WriteTx(hashPrev, txPrev));
+        REQUIRE(LLD::Legacy->WriteSpend(hashPrev, 1));
+
+        const Legacy::Transaction tx = inputs_spend(keystore, txPrev, { 0, 1 }, nNow);
+
+        std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
+        REQUIRE(tx.FetchInputs(inputs));
+        REQUIRE_FALSE(tx.Connect(inputs, state, TAO::Ledger::FLAGS::MEMPOOL));
+
+        /* The output left unspent still connects. */
+        const Legacy::Transaction txUnspent = inputs_spend(keystore, txPrev, { 0 }, nNow);
+
+        inputs.clear();
+        REQUIRE(txUnspent.FetchInputs(inputs));
+        REQUIRE(txUnspent.Connect(inputs, state, TAO::Ledger::FLAGS::MEMPOOL));
+    }
+
+
+    /* Inputs only in the mempool are left for the mempool to hold as orphans. */
+    {
+        const Legacy::Transaction txPrev = inputs_prev(scriptMine, nNow - 60);
+        const uint512_t hashPrev = txPrev.GetHash();
+        REQUIRE(TAO::Ledger::mempool.AddUnchecked(txPrev));
+
+        Legacy::Transaction txMemory;
+        REQUIRE(LLD::Legacy->ReadTx(hashPrev, txMemory, TAO::Ledger::FLAGS::MEMPOOL));
+
+        Legacy::Coin coin;
+        REQUIRE_FALSE(LLD::Legacy->ReadOutput(hashPrev, 0, coin));
+
+        const Legacy::Transaction tx = inputs_spend(keystore, txPrev, { 0 }, nNow);
+
+        std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
+        REQUIRE_FALSE(tx.FetchInputs(inputs));
+
+        TAO::Ledger::mempool.Remove(hashPrev);
+        REQUIRE_FALSE(TAO::Ledger::mempool.Has(hashPrev));
+    }
+}
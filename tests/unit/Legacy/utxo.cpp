@@ -395,6 +395,13 @@ TEST_CASE("UTXO Unit Tests", "[UTXO]")
             std::map<uint512_t, std::pair<uint8_t, DataStream> > inputs;
             REQUIRE(wtx.FetchInputs(inputs));
 
+            //batched fetch reads the same previous transactions once
+            std::map<uint512_t, std::pair<uint8_t, DataStream> > batched;
+            REQUIRE(Legacy::Transaction::FetchInputs(std::vector<Legacy::Transaction>{ wtx, wtx }, batched));
+            REQUIRE(batched.size() == inputs.size());
+            for(const auto& input : inputs)
+                REQUIRE(batched.at(input.first).second.Bytes() == input.second.second.Bytes());
+
             //write to disk
             REQUIRE(LLD::Legacy->WriteTx(wtx.GetHash(), wtx));
 
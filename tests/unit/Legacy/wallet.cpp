@@ -0,0 +1,181 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <Legacy/include/money.h>
+#include <Legacy/types/output.h>
+#include <Legacy/types/reservekey.h>
+#include <Legacy/types/script.h>
+#include <Legacy/wallet/wallet.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/constants.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <algorithm>
+
+
+/* Count the outputs of a transaction available to spend. */
+static uint32_t wallet_available(const uint512_t& hash, const bool fOnlyConfirmed = true)
+{
+    std::vector<Legacy::Output> vCoins;
+    Legacy::Wallet::Instance().AvailableCoins(runtime::unifiedtimestamp(), vCoins, fOnlyConfirmed);
+
+    return std::count_if(vCoins.begin(), vCoins.end(),
+        [&hash](const Legacy::Output& out){ return out.walletTx.GetHash() == hash; });
+}
+
+
+/* Create a transaction sending from an address, giving the inputs selected for it. */
+static bool wallet_send(const Legacy::NexusAddress& addressFrom, const int64_t nAmount, const uint64_t nTime,
+    std::vector<Legacy::TxIn> &vinRet, const uint32_t nMinDepth = 1)
+{
+    Legacy::Script scriptTo;
+    scriptTo.SetNexusAddress(Legacy::NexusAddress(LLC::GetRand256()));
+
+    std::vector<std::pair<Legacy::Script, int64_t>> vecSend;
+    vecSend.push_back(std::make_pair(scriptTo, nAmount));
+
+    Legacy::WalletTx wtx;
+    wtx.fromAddress = addressFrom;
+    wtx.nTime       = nTime;
+
+    Legacy::ReserveKey changeKey(Legacy::Wallet::Instance());
+
+    int64_t nFees = 0;
+    if(!Legacy::Wallet::Instance().CreateTransaction(vecSend, wtx, changeKey, nFees, nMinDepth))
+        return false;
+
+    vinRet = wtx.vin;
+
+    return true;
+}
+
+
+TEST_CASE( "Legacy wallet coin index", "[legacy]")
+{
+    Legacy::Wallet& wallet = Legacy::Wallet::Instance();
+
+    /* Keep the balance of the other tests. */
+    const int64_t nBase = wallet.GetBalance();
+    const uint64_t nNow = runtime::unifiedtimestamp();
+
+    /* Confirm our transactions in a block at the best height. */
+    TAO::Ledger::BlockState stateBlock = TAO::Ledger::ChainState::tStateBest.load();
+    stateBlock.nNonce        = LLC::GetRand();
+    stateBlock.hashNextBlock = LLC::GetRand1024();
+    REQUIRE(LLD::Ledger->WriteBlock(stateBlock.GetHash(), stateBlock));
+
+    /* Receive two outputs to a fresh address of ours, with one more to someone else. */
+    std::vector<uint8_t> vKey;
+    REQUIRE(wallet.GetKeyPool().GetKeyFromPool(vKey, false));
+    const Legacy::NexusAddress address(vKey);
+
+    Legacy::Script scriptMine;
+    scriptMine.SetNexusAddress(address);
+
+    Legacy::Script scriptTheirs;
+    scriptTheirs.SetNexusAddress(Legacy::NexusAddress(LLC::GetRand256()));
+
+    Legacy::WalletTx wtxReceive;
+    wtxReceive.nTime = nNow - 60;
+    wtxReceive.vin.push_back(Legacy::TxIn(LLC::GetRand512(), 0));
+    wtxReceive.vout.push_back(Legacy::TxOut(3 * TAO::Ledger::NXS_COIN, scriptMine));
+    wtxReceive.vout.push_back(Legacy::TxOut(5 * TAO::Ledger::NXS_COIN, scriptMine));
+    wtxReceive.vout.push_back(Legacy::TxOut(7 * TAO::Ledger::NXS_COIN, scriptTheirs));
+    wtxReceive.hashBlock = stateBlock.GetHash();
+
+    const uint512_t hashReceive = wtxReceive.GetHash();
+
+    /* Adding indexes only the outputs that are ours. */
+    REQUIRE(wallet.AddToWallet(wtxReceive));
+    REQUIRE(wallet_available(hashReceive) == 2);
+    REQUIRE(wallet.GetBalance() == nBase + int64_t(8 * TAO::Ledger::NXS_COIN));
+
+    /* Selection only takes confirmed outputs from the requested address, before the spend time, as deep as asked. */
+    {
+        std::vector<Legacy::TxIn> vin;
+
+        /* Either output covers a small send on its own. */
+        REQUIRE(wallet_send(address, 1 * TAO::Ledger::NXS_COIN, nNow, vin));
+        REQUIRE(vin.size() == 1);
+        REQUIRE(vin[0].prevout.hash == hashReceive);
+        REQUIRE(vin[0].prevout.n < 2);
+
+        /* A larger send needs both. */
+        REQUIRE(wallet_send(address, 6 * TAO::Ledger::NXS_COIN, nNow, vin));
+        REQUIRE(vin.size() == 2);
+        for(const auto& txin : vin)
+            REQUIRE(txin.prevout.hash == hashReceive);
+
+        /* More than we have, spending before we received, or needing more confirmations all fail. */
+        REQUIRE_FALSE(wallet_send(address, 9 * TAO::Ledger::NXS_COIN, nNow, vin));
+        REQUIRE_FALSE(wallet_send(address, 1 * TAO::Ledger::NXS_COIN, nNow - 120, vin));
+        REQUIRE_FALSE(wallet_send(address, 1 * TAO::Ledger::NXS_COIN, nNow, vin, 2));
+    }
+
+    /* Spending an output takes it out of the index. */
+    Legacy::WalletTx wtxSpend;
+    wtxSpend.nTime = nNow;
+    wtxSpend.vin.push_back(Legacy::TxIn(hashReceive, 1));
+    wtxSpend.vout.push_back(Legacy::TxOut(5 * TAO::Ledger::NXS_COIN, scriptTheirs));
+    wtxSpend.hashBlock = stateBlock.GetHash();
+
+    REQUIRE(wallet.AddToWallet(wtxSpend));
+    REQUIRE(wallet_available(hashReceive) == 1);
+    REQUIRE(wallet_available(wtxSpend.GetHash()) == 0);
+    REQUIRE(wallet.GetBalance() == nBase + int64_t(3 * TAO::Ledger::NXS_COIN));
+
+    /* Only the output left can be selected. */
+    {
+        std::vector<Legacy::TxIn> vin;
+        REQUIRE(wallet_send(address, 2 * TAO::Ledger::NXS_COIN, nNow, vin));
+        REQUIRE(vin.size() == 1);
+        REQUIRE(vin[0].prevout.hash == hashReceive);
+        REQUIRE(vin[0].prevout.n == 0);
+
+        REQUIRE_FALSE(wallet_send(address, 4 * TAO::Ledger::NXS_COIN, nNow, vin));
+    }
+
+    /* Our block leaving the main chain is only seen once our outputs are marked to be checked again. */
+    stateBlock.hashNextBlock = 0;
+    REQUIRE(LLD::Ledger->WriteBlock(stateBlock.GetHash(), stateBlock));
+
+    REQUIRE(wallet.GetBalance() == nBase + int64_t(3 * TAO::Ledger::NXS_COIN));
+
+    wallet.MarkUnsettled();
+    REQUIRE(wallet.GetBalance() == nBase);
+    REQUIRE(wallet_available(hashReceive) == 0);
+    REQUIRE(wallet_available(hashReceive, false) == 1);
+
+    /* Unconfirmed outputs can't be selected. */
+    {
+        std::vector<Legacy::TxIn> vin;
+        REQUIRE_FALSE(wallet_send(address, 1 * TAO::Ledger::NXS_COIN, nNow, vin));
+    }
+
+    /* Our block coming back into the main chain counts our outputs again. */
+    stateBlock.hashNextBlock = LLC::GetRand1024();
+    REQUIRE(LLD::Ledger->WriteBlock(stateBlock.GetHash(), stateBlock));
+
+    wallet.MarkUnsettled();
+    REQUIRE(wallet.GetBalance() == nBase + int64_t(3 * TAO::Ledger::NXS_COIN));
+    REQUIRE(wallet_available(hashReceive) == 1);
+}
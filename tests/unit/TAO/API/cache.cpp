@@ -0,0 +1,142 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/API/types/cache.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <TAO/Ledger/types/transaction.h>
+
+#include <Util/include/args.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Result cache tests", "[API]")
+{
+    TAO::API::ResultCache::Clear();
+
+    /* Two entries sharing a caller, each reading their own account. */
+    const uint256_t hashCaller  = LLC::GetRand256();
+    const uint256_t hashAccount = LLC::GetRand256();
+    const uint256_t hashToken   = LLC::GetRand256();
+
+    const uint256_t hashFirst   = LLC::GetRand256();
+    const uint256_t hashSecond  = LLC::GetRand256();
+
+    const encoding::json jFirst  = { { "balance", 1 } };
+    const encoding::json jSecond = { { "balance", 2 } };
+
+    uint64_t nGeneration = TAO::API::ResultCache::Generation();
+    REQUIRE(TAO::API::ResultCache::Insert(hashFirst,  jFirst,  { hashCaller, hashAccount }, nGeneration));
+    REQUIRE(TAO::API::ResultCache::Insert(hashSecond, jSecond, { hashCaller, hashToken },   nGeneration));
+
+
+    SECTION("Entries are returned until a dependency is invalidated")
+    {
+        encoding::json jResults;
+        REQUIRE(TAO::API::ResultCache::Get(hashFirst, jResults));
+        REQUIRE(jResults == jFirst);
+
+        /* Invalidating the account only drops the first entry. */
+        TAO::API::ResultCache::Invalidate(hashAccount);
+        REQUIRE_FALSE(TAO::API::ResultCache::Get(hashFirst, jResults));
+        REQUIRE(TAO::API::ResultCache::Get(hashSecond, jResults));
+        REQUIRE(jResults == jSecond);
+
+        /* Invalidating the caller drops the rest. */
+        TAO::API::ResultCache::Invalidate(hashCaller);
+        REQUIRE_FALSE(TAO::API::ResultCache::Get(hashSecond, jResults));
+
+        const encoding::json jMetrics = TAO::API::ResultCache::Metrics();
+        REQUIRE(jMetrics["entries"].get<uint64_t>() == 0);
+        REQUIRE(jMetrics["invalidated"].get<uint64_t>() >= 2);
+    }
+
+
+    SECTION("Results computed across an invalidation are not cached")
+    {
+        const uint256_t hashStale = LLC::GetRand256();
+
+        nGeneration = TAO::API::ResultCache::Generation();
+        TAO::API::ResultCache::Invalidate(LLC::GetRand256());
+
+        encoding::json jResults;
+        REQUIRE_FALSE(TAO::API::ResultCache::Insert(hashStale, jFirst, { hashAccount }, nGeneration));
+        REQUIRE_FALSE(TAO::API::ResultCache::Get(hashStale, jResults));
+    }
+
+
+    SECTION("Transactions invalidate their sigchain and the recipients of their contracts")
+    {
+        TAO::Ledger::Transaction tx;
+        tx.hashGenesis = LLC::GetRand256();
+        tx[0] << uint8_t(TAO::Operation::OP::DEBIT) << LLC::GetRand256() << hashToken << uint64_t(100) << uint64_t(0);
+
+        TAO::API::ResultCache::Invalidate(tx);
+
+        encoding::json jResults;
+        REQUIRE(TAO::API::ResultCache::Get(hashFirst, jResults));
+        REQUIRE_FALSE(TAO::API::ResultCache::Get(hashSecond, jResults));
+    }
+
+
+    SECTION("Reads are tracked as dependencies, including the best chain")
+    {
+        std::set<uint256_t> setReads;
+        LLD::RegisterDB::pReads = &setReads;
+
+        TAO::API::ResultCache::DependChain();
+        LLD::RegisterDB::pReads = nullptr;
+
+        /* Depending on the chain makes new blocks drop the entry. */
+        const uint256_t hashImmature = LLC::GetRand256();
+        REQUIRE(setReads.size() == 1);
+        REQUIRE(TAO::API::ResultCache::Insert(hashImmature, jFirst, setReads, TAO::API::ResultCache::Generation()));
+
+        TAO::API::ResultCache::InvalidateChain();
+
+        encoding::json jResults;
+        REQUIRE_FALSE(TAO::API::ResultCache::Get(hashImmature, jResults));
+        REQUIRE(TAO::API::ResultCache::Get(hashFirst, jResults));
+    }
+
+
+    SECTION("The least recently used entries are evicted first")
+    {
+        config::mapArgs["-apicache"] = "2";
+
+        /* Touch the first entry so the second is the least recently used. */
+        encoding::json jResults;
+        REQUIRE(TAO::API::ResultCache::Get(hashFirst, jResults));
+
+        const uint256_t hashThird = LLC::GetRand256();
+        REQUIRE(TAO::API::ResultCache::Insert(hashThird, jSecond, { hashCaller }, TAO::API::ResultCache::Generation()));
+
+        REQUIRE(TAO::API::ResultCache::Get(hashFirst, jResults));
+        REQUIRE(TAO::API::ResultCache::Get(hashThird, jResults));
+        REQUIRE_FALSE(TAO::API::ResultCache::Get(hashSecond, jResults));
+
+        /* A size of zero disables the cache. */
+        config::mapArgs["-apicache"] = "0";
+        REQUIRE_FALSE(TAO::API::ResultCache::Insert(LLC::GetRand256(), jFirst, { hashCaller }, TAO::API::ResultCache::Generation()));
+
+        config::mapArgs.erase("-apicache");
+    }
+
+    TAO::API::ResultCache::Clear();
+}
@@ -0,0 +1,91 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/include/encoding.h>
+#include <TAO/API/types/exception.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Content encoding tests", "[API]")
+{
+    SECTION("Content types are matched without their parameters")
+    {
+        uint8_t nEncoding = 0xff;
+        REQUIRE(TAO::API::ContentEncoding("application/json", nEncoding));
+        REQUIRE(nEncoding == TAO::API::ENCODING::JSON);
+
+        REQUIRE(TAO::API::ContentEncoding("Application/CBOR", nEncoding));
+        REQUIRE(nEncoding == TAO::API::ENCODING::CBOR);
+
+        REQUIRE(TAO::API::ContentEncoding("application/x-msgpack; charset=binary", nEncoding));
+        REQUIRE(nEncoding == TAO::API::ENCODING::MSGPACK);
+
+        REQUIRE_FALSE(TAO::API::ContentEncoding("text/html", nEncoding));
+        REQUIRE_FALSE(TAO::API::ContentEncoding("", nEncoding));
+    }
+
+
+    SECTION("Accept headers pick the first supported encoding")
+    {
+        REQUIRE(TAO::API::AcceptEncoding("application/msgpack, application/json", TAO::API::ENCODING::JSON)
+            == TAO::API::ENCODING::MSGPACK);
+
+        REQUIRE(TAO::API::AcceptEncoding("text/html, application/cbor;q=0.9", TAO::API::ENCODING::JSON)
+            == TAO::API::ENCODING::CBOR);
+
+        /* Browsers and wildcards keep the encoding of the request. */
+        REQUIRE(TAO::API::AcceptEncoding("text/html,*/*", TAO::API::ENCODING::CBOR)
+            == TAO::API::ENCODING::CBOR);
+    }
+
+
+    SECTION("Every encoding round trips its content")
+    {
+        const encoding::json jContent =
+        {
+            { "result",
+                {
+                    { "address", "8Bsx5DUrnnDpbpzWtvhAfGdkJaTd9RZqzyCjEjCNCNVqMNYmZbb" },
+                    { "balance", 1234.567891 },
+                    { "height",  5000000 },
+                    { "stake",   false },
+                    { "tokens",  encoding::json::array({ 1, -2, "three" }) }
+                }
+            }
+        };
+
+        for(const auto& nEncoding : { TAO::API::ENCODING::JSON, TAO::API::ENCODING::CBOR, TAO::API::ENCODING::MSGPACK })
+        {
+            std::string strContent;
+            TAO::API::EncodeContent(jContent, nEncoding, strContent);
+
+            REQUIRE(TAO::API::DecodeContent(strContent, nEncoding) == jContent);
+        }
+
+        /* Binary encodings are more compact than text. */
+        std::string strJSON, strCBOR;
+        TAO::API::EncodeContent(jContent, TAO::API::ENCODING::JSON, strJSON);
+        TAO::API::EncodeContent(jContent, TAO::API::ENCODING::CBOR, strCBOR);
+        REQUIRE(strCBOR.size() < strJSON.size());
+        REQUIRE(TAO::API::ContentType(TAO::API::ENCODING::CBOR) == "application/cbor");
+    }
+
+
+    SECTION("Malformed binary content throws an API exception")
+    {
+        const std::string strContent = std::string("\xbf\x61", 2);
+        REQUIRE_THROWS_AS(TAO::API::DecodeContent(strContent, TAO::API::ENCODING::CBOR),    TAO::API::Exception);
+        REQUIRE_THROWS_AS(TAO::API::DecodeContent(strContent, TAO::API::ENCODING::MSGPACK), TAO::API::Exception);
+    }
+}
@@ -0,0 +1,120 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/API/types/history.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "History index tests", "[API]")
+{
+    LLD::LogicalDB* pLogical = new LLD::LogicalDB(LLD::FLAGS::CREATE | LLD::FLAGS::FORCE);
+
+    /* Push a history of transactions with a few contracts each, tracking every contract in order. */
+    const uint256_t hashRegister = LLC::GetRand256();
+    std::vector<std::pair<uint512_t, uint32_t>> vRows;
+
+    const uint32_t nTotal = 200;
+    for(uint32_t nSequence = 0; nSequence < nTotal; ++nSequence)
+    {
+        TAO::API::HistoryEntry tEntry;
+        tEntry.hashTx     = LLC::GetRand512();
+        tEntry.nTimestamp = 1600000000 + nSequence;
+
+        const uint32_t nContracts = LLC::GetRand(3) + 1;
+        for(uint32_t nContract = 0; nContract < nContracts; ++nContract)
+        {
+            tEntry.vContracts.push_back(std::make_pair(nContract * 2, uint8_t(TAO::Operation::OP::DEBIT)));
+            vRows.push_back(std::make_pair(tEntry.hashTx, nContract * 2));
+        }
+
+        REQUIRE(pLogical->PushTransaction(hashRegister, tEntry));
+    }
+
+
+    SECTION("Entries are kept by sequence with their running count of contracts")
+    {
+        REQUIRE(pLogical->HasHistory(hashRegister));
+        REQUIRE_FALSE(pLogical->HasHistory(LLC::GetRand256()));
+
+        uint32_t nCount = 0;
+        REQUIRE(pLogical->CountTransactions(hashRegister, nCount));
+        REQUIRE(nCount == nTotal);
+
+        TAO::API::HistoryEntry tLast;
+        REQUIRE(pLogical->ReadHistory(hashRegister, nTotal - 1, tLast));
+        REQUIRE(tLast.nRows == vRows.size());
+        REQUIRE(tLast.nTimestamp == 1600000000 + nTotal - 1);
+        REQUIRE_FALSE(pLogical->ReadHistory(hashRegister, nTotal, tLast));
+
+        /* The transaction index still lists the same txids. */
+        std::vector<uint512_t> vTransactions;
+        REQUIRE(pLogical->ListTransactions(hashRegister, vTransactions));
+        REQUIRE(vTransactions.size() == nTotal);
+        REQUIRE(vTransactions.back() == tLast.hashTx);
+    }
+
+
+    SECTION("Seeking finds the entry holding every contract")
+    {
+        for(uint32_t nRow = 0; nRow < vRows.size(); ++nRow)
+        {
+            uint32_t nSequence = 0;
+            TAO::API::HistoryEntry tEntry;
+            REQUIRE(pLogical->SeekHistory(hashRegister, nRow, nSequence, tEntry));
+
+            /* Check the position inside the entry lands on the same contract. */
+            const uint32_t nFirst = nRow + tEntry.vContracts.size() - tEntry.nRows;
+            REQUIRE(nFirst < tEntry.vContracts.size());
+            REQUIRE(tEntry.hashTx == vRows[nRow].first);
+            REQUIRE(tEntry.vContracts[nFirst].first == vRows[nRow].second);
+        }
+
+        uint32_t nSequence = 0;
+        TAO::API::HistoryEntry tEntry;
+        REQUIRE_FALSE(pLogical->SeekHistory(hashRegister, vRows.size(), nSequence, tEntry));
+    }
+
+
+    SECTION("Erasing pops the last entry")
+    {
+        TAO::API::HistoryEntry tLast;
+        REQUIRE(pLogical->ReadHistory(hashRegister, nTotal - 1, tLast));
+
+        REQUIRE(pLogical->EraseTransaction(hashRegister));
+        REQUIRE_FALSE(pLogical->ReadHistory(hashRegister, nTotal - 1, tLast));
+
+        uint32_t nCount = 0;
+        REQUIRE(pLogical->CountTransactions(hashRegister, nCount));
+        REQUIRE(nCount == nTotal - 1);
+
+        /* Pushing again continues the running count from the new last entry. */
+        TAO::API::HistoryEntry tPrev, tEntry;
+        REQUIRE(pLogical->ReadHistory(hashRegister, nTotal - 2, tPrev));
+
+        tEntry.hashTx = LLC::GetRand512();
+        tEntry.vContracts.push_back(std::make_pair(0, uint8_t(TAO::Operation::OP::CREDIT)));
+        REQUIRE(pLogical->PushTransaction(hashRegister, tEntry));
+
+        REQUIRE(pLogical->ReadHistory(hashRegister, nTotal - 1, tEntry));
+        REQUIRE(tEntry.nRows == tPrev.nRows + 1);
+    }
+
+    delete pLogical;
+}
@@ -0,0 +1,162 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <TAO/API/types/exception.h>
+#include <TAO/API/types/page.h>
+
+#include <Util/include/json.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Page a list of results the way the list commands did, sorting them all first. */
+static std::vector<uint32_t> page_full(const std::vector<encoding::json>& vResults, const std::string& strOrder,
+                                       const std::string& strColumn, const uint32_t nOffset, const uint32_t nLimit)
+{
+    const bool fDesc = (strOrder == "desc");
+
+    std::vector<uint32_t> vIndex;
+    for(uint32_t n = 0; n < vResults.size(); ++n)
+        vIndex.push_back(n);
+
+    std::stable_sort(vIndex.begin(), vIndex.end(), [&](const uint32_t a, const uint32_t b)
+    {
+        return TAO::API::SortKeyFromJSON(vResults[a], strColumn).Before(TAO::API::SortKeyFromJSON(vResults[b], strColumn), fDesc);
+    });
+
+    std::vector<uint32_t> vPage;
+    for(uint32_t n = nOffset; n < vIndex.size() && vPage.size() < nLimit; ++n)
+        vPage.push_back(vIndex[n]);
+
+    return vPage;
+}
+
+
+/* Page a list of results through the top-k page. */
+static std::vector<uint32_t> page_topk(const std::vector<encoding::json>& vResults, const std::string& strOrder,
+                                       const std::string& strColumn, const uint32_t nOffset, const uint32_t nLimit)
+{
+    TAO::API::ListPage<uint32_t> tPage(strOrder, nOffset, nLimit);
+    for(uint32_t n = 0; n < vResults.size(); ++n)
+    {
+        const TAO::API::SortKey tKey = TAO::API::SortKeyFromJSON(vResults[n], strColumn);
+        if(!tPage.Accept(tKey))
+            continue;
+
+        tPage.Insert(tKey, uint32_t(n));
+    }
+
+    return tPage.Page();
+}
+
+
+TEST_CASE( "List page tests", "[API]")
+{
+    /* Build some results with plenty of ties, and a few missing the columns. */
+    std::vector<encoding::json> vResults;
+    for(uint32_t n = 0; n < 500; ++n)
+    {
+        encoding::json jResult =
+        {
+            { "modified", uint64_t(LLC::GetRand(50)) },
+            { "name",     "name" + std::to_string(LLC::GetRand(40)) },
+            { "nested",   { { "balance", double(LLC::GetRand(30)) / 4 } } }
+        };
+
+        if(n % 17 == 0)
+            jResult.erase("modified");
+
+        if(n % 23 == 0)
+            jResult.erase("nested");
+
+        vResults.push_back(jResult);
+    }
+
+
+    SECTION("Top-k pages match a full sort")
+    {
+        for(const std::string strOrder : { "desc", "asc" })
+        {
+            for(const std::string strColumn : { "modified", "name", "nested.balance", "missing" })
+            {
+                REQUIRE(page_topk(vResults, strOrder, strColumn, 0, 100) == page_full(vResults, strOrder, strColumn, 0, 100));
+                REQUIRE(page_topk(vResults, strOrder, strColumn, 40, 25) == page_full(vResults, strOrder, strColumn, 40, 25));
+                REQUIRE(page_topk(vResults, strOrder, strColumn, 480, 100) == page_full(vResults, strOrder, strColumn, 480, 100));
+                REQUIRE(page_topk(vResults, strOrder, strColumn, 0, 1000).size() == vResults.size());
+                REQUIRE(page_topk(vResults, strOrder, strColumn, 600, 10).empty());
+            }
+        }
+    }
+
+
+    SECTION("Ordering of keys")
+    {
+        TAO::API::ListPage<uint32_t> tPage("desc", 0, 100);
+        for(uint32_t n = 0; n < vResults.size(); ++n)
+            tPage.Insert(TAO::API::SortKeyFromJSON(vResults[n], "modified"), uint32_t(n));
+
+        REQUIRE(tPage.Total() == vResults.size());
+
+        /* Descending order, with equal values kept in the order they were added. */
+        const std::vector<uint32_t> vPage = tPage.Page();
+        REQUIRE(vPage.size() == 100);
+
+        for(uint32_t n = 1; n < vPage.size(); ++n)
+        {
+            const uint64_t nPrev = vResults[vPage[n - 1]]["modified"].get<uint64_t>();
+            const uint64_t nNext = vResults[vPage[n]]["modified"].get<uint64_t>();
+
+            REQUIRE(nPrev >= nNext);
+            if(nPrev == nNext)
+                REQUIRE(vPage[n - 1] < vPage[n]);
+        }
+
+        /* Missing columns go last either way. */
+        const TAO::API::SortKey tMissing;
+        const TAO::API::SortKey tValue = TAO::API::SortKey(uint64_t(5));
+        REQUIRE(tValue.Before(tMissing, true));
+        REQUIRE(tValue.Before(tMissing, false));
+        REQUIRE_FALSE(tMissing.Before(tValue, false));
+        REQUIRE(tMissing.Equals(TAO::API::SortKey()));
+
+        /* Numbers of different types compare by value. */
+        REQUIRE(TAO::API::SortKeyFromJSON({{ "a", -1 }}, "a").Before(tValue, false));
+        REQUIRE(TAO::API::SortKeyFromJSON({{ "a", 5.5 }}, "a").Before(tValue, true));
+        REQUIRE(TAO::API::SortKeyFromJSON({{ "a", 5.0 }}, "a").Equals(tValue));
+
+        /* Columns that can't be sorted by are rejected. */
+        REQUIRE_THROWS_AS(TAO::API::SortKeyFromJSON({{ "a", { 1, 2 } }}, "a"), TAO::API::Exception);
+    }
+
+
+    SECTION("Rows are only accepted while they can land on the page")
+    {
+        TAO::API::ListPage<uint32_t> tPage("asc", 1, 2);
+        for(uint32_t n = 0; n < 3; ++n)
+        {
+            REQUIRE(tPage.Accept(TAO::API::SortKey(uint64_t(10 + n))));
+            tPage.Insert(TAO::API::SortKey(uint64_t(10 + n)), uint32_t(n));
+        }
+
+        REQUIRE_FALSE(tPage.Accept(TAO::API::SortKey(uint64_t(12))));
+        REQUIRE_FALSE(tPage.Accept(TAO::API::SortKey()));
+        REQUIRE(tPage.Accept(TAO::API::SortKey(uint64_t(11))));
+        REQUIRE(tPage.Accept(TAO::API::SortKey(uint64_t(3))));
+
+        tPage.Insert(TAO::API::SortKey(uint64_t(3)), uint32_t(3));
+        REQUIRE(tPage.Total() == 4);
+        REQUIRE(tPage.Page() == std::vector<uint32_t>({ 0, 1 }));
+    }
+}
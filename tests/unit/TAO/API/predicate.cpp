@@ -0,0 +1,214 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/include/filter.h>
+#include <TAO/API/include/json.h>
+#include <TAO/API/types/exception.h>
+#include <TAO/API/types/predicate.h>
+
+#include <TAO/Register/include/create.h>
+#include <TAO/Register/include/enum.h>
+#include <TAO/Register/types/object.h>
+
+#include <Util/include/json.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Build the parameters of a request with a where query. */
+static encoding::json predicate_params(const std::string& strWhere)
+{
+    return encoding::json({ { "where", TAO::API::QueryToJSON(strWhere) } });
+}
+
+
+TEST_CASE( "Predicate tests", "[API]")
+{
+    using namespace TAO::Register;
+
+    /* An account holding 12.5 NXS. */
+    Object tAccount = CreateAccount(0);
+    tAccount.nVersion  = 1;
+    tAccount.nCreated  = 1000;
+    tAccount.nModified = 2000;
+    tAccount.hashOwner = uint256_t("0xa1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1");
+    REQUIRE(tAccount.Parse());
+    REQUIRE(tAccount.Write("balance", uint64_t(12500000)));
+
+    /* An object with a name and a count. */
+    Object tAsset;
+    tAsset << std::string("name")  << uint8_t(TYPES::STRING)   << std::string("widget-blue")
+           << std::string("count") << uint8_t(TYPES::UINT32_T) << uint32_t(42);
+    tAsset.nModified = 3000;
+    REQUIRE(tAsset.Parse());
+
+
+    SECTION("Empty where clause")
+    {
+        const TAO::API::Predicate tWhere = TAO::API::Predicate(encoding::json::object());
+        REQUIRE(tWhere.Empty());
+        REQUIRE_FALSE(tWhere.Results());
+        REQUIRE(tWhere.Evaluate(tAccount) == TAO::API::Predicate::MATCH);
+    }
+
+
+    SECTION("Object clauses are checked on the object")
+    {
+        const std::vector<std::pair<std::string, bool>> vChecks =
+        {
+            { "object.balance>12",                          true  },
+            { "object.balance>12.5",                        false },
+            { "object.balance>=12.5",                       true  },
+            { "object.balance<13",                          true  },
+            { "object.balance=12.5",                        true  },
+            { "object.balance!=12.5",                       false },
+            { "object.count=42",                            false },
+            { "object.modified>1999",                       true  },
+            { "object.modified!=2000",                      false },
+            { "object.created<1000",                        false },
+            { "object.version=1",                           true  },
+            { "object.owner=a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1", true },
+            { "object.owner!=a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1a1", false },
+            { "object.balance>20 OR object.modified=2000",  true  },
+            { "object.balance>20 AND object.modified=2000", false },
+            { "(object.balance>20 OR object.version=1) AND object.created=1000", true },
+        };
+
+        for(const auto& tCheck : vChecks)
+        {
+            const TAO::API::Predicate tWhere = TAO::API::Predicate(predicate_params(tCheck.first));
+            REQUIRE_FALSE(tWhere.Results());
+
+            INFO(tCheck.first);
+            REQUIRE(tWhere.EvaluateObject(tAccount) == tCheck.second);
+            REQUIRE(tWhere.Evaluate(tAccount) == (tCheck.second ? TAO::API::Predicate::MATCH : TAO::API::Predicate::FAIL));
+        }
+
+        /* Strings and wildcards. */
+        REQUIRE(TAO::API::Predicate(predicate_params("object.name=widget-blue")).EvaluateObject(tAsset));
+        REQUIRE(TAO::API::Predicate(predicate_params("object.name=widget*")).EvaluateObject(tAsset));
+        REQUIRE(TAO::API::Predicate(predicate_params("object.name=*blue")).EvaluateObject(tAsset));
+        REQUIRE_FALSE(TAO::API::Predicate(predicate_params("object.name=*red")).EvaluateObject(tAsset));
+        REQUIRE_FALSE(TAO::API::Predicate(predicate_params("object.name!=widget*")).EvaluateObject(tAsset));
+        REQUIRE(TAO::API::Predicate(predicate_params("object.name!=gadget*")).EvaluateObject(tAsset));
+        REQUIRE(TAO::API::Predicate(predicate_params("object.count<=42")).EvaluateObject(tAsset));
+        REQUIRE_FALSE(TAO::API::Predicate(predicate_params("object.count!=42")).EvaluateObject(tAsset));
+
+        REQUIRE_THROWS_AS(TAO::API::Predicate(predicate_params("object.name>widget")).EvaluateObject(tAsset), TAO::API::Exception);
+        REQUIRE_THROWS_AS(TAO::API::Predicate(predicate_params("object.count=many")).EvaluateObject(tAsset), TAO::API::Exception);
+    }
+
+
+    SECTION("Results clauses on the header don't need the JSON")
+    {
+        const TAO::API::Predicate tWhere = TAO::API::Predicate(predicate_params("results.modified>2500"));
+        REQUIRE_FALSE(tWhere.Results());
+
+        REQUIRE(tWhere.Evaluate(tAccount) == TAO::API::Predicate::FAIL);
+        REQUIRE(tWhere.Evaluate(tAsset)   == TAO::API::Predicate::MATCH);
+
+        /* The same clause on the JSON agrees. */
+        encoding::json jAccount = TAO::API::RegisterToJSON(tAccount);
+        encoding::json jAsset   = TAO::API::RegisterToJSON(tAsset);
+        REQUIRE_FALSE(tWhere.Evaluate(jAccount));
+        REQUIRE(tWhere.Evaluate(jAsset));
+    }
+
+
+    SECTION("Results clauses are only checked when they decide the outcome")
+    {
+        /* A failing object clause decides an AND. */
+        const TAO::API::Predicate tAnd = TAO::API::Predicate(predicate_params("results.count=42 AND object.modified=1"));
+        REQUIRE(tAnd.Results());
+        REQUIRE(tAnd.Evaluate(tAsset) == TAO::API::Predicate::FAIL);
+
+        /* A passing object clause decides an OR, unless a results clause came first. */
+        REQUIRE(TAO::API::Predicate(predicate_params("object.modified=3000 OR results.count=1")).Evaluate(tAsset)
+            == TAO::API::Predicate::MATCH);
+        REQUIRE(TAO::API::Predicate(predicate_params("results.count=1 OR object.modified=3000")).Evaluate(tAsset)
+            == TAO::API::Predicate::UNKNOWN);
+
+        /* Otherwise the JSON is checked. */
+        const TAO::API::Predicate tOr = TAO::API::Predicate(predicate_params("results.count=41 OR results.name=widget*"));
+        REQUIRE(tOr.Evaluate(tAsset) == TAO::API::Predicate::UNKNOWN);
+
+        encoding::json jAsset = TAO::API::RegisterToJSON(tAsset);
+        REQUIRE(tOr.Evaluate(tAsset, jAsset));
+
+        /* Object clauses can't be checked without an object. */
+        REQUIRE_THROWS_AS(tAnd.Evaluate(jAsset), TAO::API::Exception);
+    }
+
+
+    SECTION("Results clauses on JSON")
+    {
+        encoding::json jResult =
+        {
+            { "amount",   12.5 },
+            { "delta",    -3 },
+            { "count",    7 },
+            { "active",   true },
+            { "name",     "alpha" },
+            { "nested",   { { "value", 10 } } },
+            { "contracts",
+                {
+                    { { "OP", "DEBIT" },  { "amount", 5 } },
+                    { { "OP", "CREDIT" }, { "amount", 8 } },
+                    { { "OP", "DEBIT" },  { "amount", 9 } },
+                }
+            }
+        };
+
+        const std::vector<std::pair<std::string, bool>> vChecks =
+        {
+            { "results.amount>12.4",      true  },
+            { "results.amount=12.5",      true  },
+            { "results.amount!=12.5",     false },
+            { "results.delta<0",          true  },
+            { "results.delta>=-3",        true  },
+            { "results.count!=7",         false },
+            { "results.count!=8",         true  },
+            { "results.active=true",      true  },
+            { "results.active!=TRUE",     false },
+            { "results.name=al*",         true  },
+            { "results.name!=al*",        false },
+            { "results.nested.value>=10", true  },
+            { "results.nested.value<10",  false },
+            { "results.missing=1",        false },
+        };
+
+        for(const auto& tCheck : vChecks)
+        {
+            encoding::json jCheck = jResult;
+
+            INFO(tCheck.first);
+            REQUIRE(TAO::API::Predicate(predicate_params(tCheck.first)).Evaluate(jCheck) == tCheck.second);
+
+            /* FilterResults runs the same program. */
+            jCheck = jResult;
+            REQUIRE(TAO::API::FilterResults(predicate_params(tCheck.first), jCheck) == tCheck.second);
+        }
+
+        /* Arrays are filtered down to their passing entries. */
+        encoding::json jCheck = jResult;
+        REQUIRE(TAO::API::Predicate(predicate_params("results.contracts.OP=DEBIT AND results.contracts.amount>5")).Evaluate(jCheck));
+        REQUIRE(jCheck["contracts"].size() == 1);
+        REQUIRE(jCheck["contracts"][0]["amount"].get<uint64_t>() == 9);
+
+        jCheck = jResult;
+        REQUIRE_FALSE(TAO::API::Predicate(predicate_params("results.contracts.OP=VOID")).Evaluate(jCheck));
+
+        REQUIRE_THROWS_AS(TAO::API::Predicate(predicate_params("results.name<alpha")).Evaluate(jCheck), TAO::API::Exception);
+        REQUIRE_THROWS_AS(TAO::API::Predicate(predicate_params("other.name=alpha")), TAO::API::Exception);
+    }
+}
@@ -14,6 +14,9 @@ ________________________________________________________________________________
 #include <TAO/Ledger/types/block.h>
 #include <TAO/Ledger/types/tritium.h>
 #include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/merkle_tree.h>
+
+#include <LLC/include/random.h>
 
 #include <unit/catch2/catch.hpp>
 
@@ -117,3 +120,32 @@ TEST_CASE( "Block primitive values", "[ledger]")
 
 
 }
+
+
+TEST_CASE( "Merkle tree values", "[ledger]")
+{
+    TAO::Ledger::Block block;
+    TAO::Ledger::MerkleTree tree;
+
+    std::vector<uint512_t> vHashes;
+    for(uint32_t n = 0; n < 33; ++n)
+    {
+        //appending leaves should match a full rebuild
+        const uint512_t hashLeaf = LLC::GetRand512();
+        vHashes.push_back(hashLeaf);
+
+        REQUIRE(tree.Append(hashLeaf) == block.BuildMerkleTree(vHashes));
+        REQUIRE(tree.Size() == vHashes.size());
+
+        //every branch should prove its leaf
+        for(uint32_t i = 0; i < vHashes.size(); ++i)
+            REQUIRE(TAO::Ledger::Block::CheckMerkleBranch(vHashes[i], block.GetMerkleBranch(vHashes, i), i) == tree.Root());
+    }
+
+    //updating a single leaf should match a full rebuild
+    vHashes[7] = LLC::GetRand512();
+    REQUIRE(tree.Update(7, vHashes[7]) == TAO::Ledger::MerkleTree(vHashes).Root());
+
+    vHashes.back() = LLC::GetRand512();
+    REQUIRE(block.UpdateMerkleTree(vHashes, static_cast<uint32_t>(vHashes.size() - 1)) == TAO::Ledger::MerkleTree(vHashes).Root());
+}
@@ -0,0 +1,158 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Ledger/include/enum.h>
+#include <TAO/Ledger/types/compactblock.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Build a tritium block referencing random transactions, with a matching merkle root. */
+static TAO::Ledger::TritiumBlock compact_block(const uint32_t nTransactions)
+{
+    TAO::Ledger::TritiumBlock block;
+    block.nVersion      = 9;
+    block.hashPrevBlock = LLC::GetRand1024();
+    block.nChannel      = 2;
+    block.nHeight       = 100;
+    block.nNonce        = LLC::GetRand();
+
+    std::vector<uint512_t> vHashes;
+    for(uint32_t n = 0; n < nTransactions; ++n)
+    {
+        const uint8_t nType = (n % 5 == 0 ? TAO::Ledger::TRANSACTION::LEGACY : TAO::Ledger::TRANSACTION::TRITIUM);
+
+        block.vtx.push_back(std::make_pair(nType, LLC::GetRand512()));
+        vHashes.push_back(block.vtx.back().second);
+    }
+
+    vHashes.push_back(block.producer.GetHash());
+    block.hashMerkleRoot = block.BuildMerkleTree(vHashes);
+
+    return block;
+}
+
+
+/* Get the size of a block on the wire. */
+template<typename TypeBlock>
+static uint64_t compact_size(const TypeBlock& block)
+{
+    DataStream ssBlock(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssBlock << block;
+
+    return ssBlock.size();
+}
+
+
+TEST_CASE( "Compact block relay", "[ledger]")
+{
+    SECTION("Blocks rebuild from the pool at every size")
+    {
+        for(const uint32_t nTransactions : { 1u, 10u, 100u, 1000u })
+        {
+            const TAO::Ledger::TritiumBlock block = compact_block(nTransactions);
+
+            /* Round trip the compact block. */
+            DataStream ssCompact(SER_NETWORK, LLP::PROTOCOL_VERSION);
+            ssCompact << TAO::Ledger::CompactBlock(block);
+
+            TAO::Ledger::CompactBlock compact;
+            ssCompact >> compact;
+
+            REQUIRE(compact.GetHash() == block.GetHash());
+            REQUIRE(compact.vShort.size() == nTransactions);
+
+            /* Each transaction costs 9 bytes instead of 65. */
+            REQUIRE(compact_size(block) - compact_size(compact) == nTransactions * (64 - 8));
+
+            /* The pool holds the block's transactions among unrelated ones. */
+            std::vector<std::pair<uint8_t, uint512_t>> vPool;
+            for(uint32_t n = 0; n < nTransactions * 2; ++n)
+                vPool.push_back(std::make_pair(TAO::Ledger::TRANSACTION::TRITIUM, LLC::GetRand512()));
+
+            vPool.insert(vPool.end(), block.vtx.rbegin(), block.vtx.rend());
+
+            TAO::Ledger::TritiumBlock rebuilt;
+            std::vector<uint32_t> vMissing;
+            REQUIRE(compact.Reconstruct(vPool, rebuilt, vMissing));
+            REQUIRE(vMissing.empty());
+
+            REQUIRE(rebuilt.GetHash() == block.GetHash());
+            REQUIRE(rebuilt.vtx == block.vtx);
+            REQUIRE(rebuilt.nTime == block.nTime);
+            REQUIRE(rebuilt.hashMerkleRoot == block.hashMerkleRoot);
+        }
+    }
+
+
+    SECTION("Missing transactions are reported by position")
+    {
+        const TAO::Ledger::TritiumBlock block = compact_block(50);
+        const TAO::Ledger::CompactBlock compact(block);
+
+        /* Leave three transactions out of the pool, and give another the wrong type. */
+        std::vector<std::pair<uint8_t, uint512_t>> vPool;
+        for(uint32_t n = 0; n < block.vtx.size(); ++n)
+        {
+            if(n == 3 || n == 17 || n == 49)
+                continue;
+
+            if(n == 20)
+                vPool.push_back(std::make_pair(TAO::Ledger::TRANSACTION::TRITIUM, block.vtx[n].second));
+            else
+                vPool.push_back(block.vtx[n]);
+        }
+
+        TAO::Ledger::TritiumBlock rebuilt;
+        std::vector<uint32_t> vMissing;
+        REQUIRE_FALSE(compact.Reconstruct(vPool, rebuilt, vMissing));
+        REQUIRE(vMissing == std::vector<uint32_t>({ 3, 17, 20, 49 }));
+
+        /* Adding them completes the block. */
+        for(const uint32_t n : vMissing)
+            vPool.push_back(block.vtx[n]);
+
+        REQUIRE(compact.Reconstruct(vPool, rebuilt, vMissing));
+        REQUIRE(rebuilt.vtx == block.vtx);
+    }
+
+
+    SECTION("Merkle mismatch fails without missing transactions")
+    {
+        TAO::Ledger::TritiumBlock block = compact_block(10);
+        block.hashMerkleRoot = LLC::GetRand512();
+
+        const TAO::Ledger::CompactBlock compact(block);
+
+        TAO::Ledger::TritiumBlock rebuilt;
+        std::vector<uint32_t> vMissing;
+        REQUIRE_FALSE(compact.Reconstruct(block.vtx, rebuilt, vMissing));
+        REQUIRE(vMissing.empty());
+    }
+
+
+    SECTION("Short ids are keyed by the block")
+    {
+        const uint512_t hashTx = LLC::GetRand512();
+
+        REQUIRE(TAO::Ledger::CompactBlock::ShortID(1, hashTx) == TAO::Ledger::CompactBlock::ShortID(1, hashTx));
+        REQUIRE(TAO::Ledger::CompactBlock::ShortID(1, hashTx) != TAO::Ledger::CompactBlock::ShortID(2, hashTx));
+    }
+}
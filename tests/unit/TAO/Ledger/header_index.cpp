@@ -0,0 +1,205 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <TAO/Ledger/types/header_index.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include "util.h"
+
+
+/* Build a chain off a block state, with stake blocks rarer than the proof of work channels. */
+static std::vector<TAO::Ledger::BlockState> header_chain(const TAO::Ledger::BlockState& stateStart, const uint32_t nBlocks)
+{
+    std::vector<TAO::Ledger::BlockState> vChain;
+    for(uint32_t n = 0; n < nBlocks; ++n)
+    {
+        const uint32_t nChannel = (n % 7 == 0 ? 0 : (n % 2 == 0 ? 1 : 2));
+        vChain.push_back(NextState(vChain.empty() ? stateStart : vChain.back(), nChannel));
+    }
+
+    return vChain;
+}
+
+
+/* Find the last block of a channel by walking back, not counting the genesis. */
+static bool header_walk(const std::vector<TAO::Ledger::BlockState>& vChain, uint32_t nIndex, const uint32_t nChannel, uint1024_t &hashLast)
+{
+    while(vChain[nIndex].nHeight > 0)
+    {
+        if(vChain[nIndex].nChannel == nChannel)
+        {
+            hashLast = vChain[nIndex].GetHash();
+            return true;
+        }
+
+        --nIndex;
+    }
+
+    return false;
+}
+
+
+TEST_CASE( "Header index", "[ledger]")
+{
+    /* The genesis starts every chain. */
+    TAO::Ledger::BlockState stateGenesis;
+    stateGenesis.nVersion = 7;
+    stateGenesis.nChannel = 2;
+    stateGenesis.nNonce   = LLC::GetRand();
+
+    std::vector<TAO::Ledger::BlockState> vChain = header_chain(stateGenesis, 200);
+    vChain.insert(vChain.begin(), stateGenesis);
+
+
+    SECTION("Last block of each channel")
+    {
+        TAO::Ledger::HeaderIndex index(1000);
+        for(const auto& state : vChain)
+        {
+            index.Insert(state);
+            index.Connect(state.GetHash());
+        }
+
+        REQUIRE(index.Size() == vChain.size());
+
+        for(uint32_t n = 0; n < vChain.size(); ++n)
+        {
+            for(uint32_t nChannel = 0; nChannel < TAO::Ledger::HeaderIndex::CHANNELS; ++nChannel)
+            {
+                uint1024_t hashWalk = 0;
+                uint1024_t hashLast = 0;
+
+                REQUIRE(index.Last(vChain[n].GetHash(), nChannel, hashLast) == header_walk(vChain, n, nChannel, hashWalk));
+                REQUIRE(hashLast == hashWalk);
+            }
+
+            /* The best chain links forward. */
+            uint1024_t hashNext = 0;
+            REQUIRE(index.Next(vChain[n].GetHash(), hashNext) == (n + 1 < vChain.size()));
+            if(n + 1 < vChain.size())
+                REQUIRE(hashNext == vChain[n + 1].GetHash());
+        }
+
+        /* Unknown blocks and channels aren't answered. */
+        uint1024_t hashLast = 0;
+        REQUIRE_FALSE(index.Last(LLC::GetRand1024(), 0, hashLast));
+        REQUIRE_FALSE(index.Last(vChain.back().GetHash(), 7, hashLast));
+    }
+
+
+    SECTION("Fork between two chains")
+    {
+        TAO::Ledger::HeaderIndex index(1000);
+        for(const auto& state : vChain)
+            index.Insert(state);
+
+        const std::vector<TAO::Ledger::BlockState> vBranch = header_chain(vChain[150], 60);
+        for(const auto& state : vBranch)
+            index.Insert(state);
+
+        std::vector<uint1024_t> vDisconnect;
+        std::vector<uint1024_t> vConnect;
+        uint1024_t hashFork = 0;
+        REQUIRE(index.Fork(vChain.back().GetHash(), vBranch.back().GetHash(), vDisconnect, vConnect, hashFork));
+
+        REQUIRE(hashFork == vChain[150].GetHash());
+        REQUIRE(vDisconnect.size() == 50);
+        REQUIRE(vConnect.size() == 60);
+
+        for(uint32_t n = 0; n < vDisconnect.size(); ++n)
+            REQUIRE(vDisconnect[n] == vChain[200 - n].GetHash());
+
+        for(uint32_t n = 0; n < vConnect.size(); ++n)
+            REQUIRE(vConnect[n] == vBranch[59 - n].GetHash());
+
+        /* Extending the best chain disconnects nothing. */
+        REQUIRE(index.Fork(vChain[150].GetHash(), vChain.back().GetHash(), vDisconnect, vConnect, hashFork));
+        REQUIRE(vDisconnect.empty());
+        REQUIRE(vConnect.size() == 50);
+        REQUIRE(hashFork == vChain[150].GetHash());
+
+        /* The same block is its own fork. */
+        REQUIRE(index.Fork(vBranch.back().GetHash(), vBranch.back().GetHash(), vDisconnect, vConnect, hashFork));
+        REQUIRE(vDisconnect.empty());
+        REQUIRE(vConnect.empty());
+        REQUIRE(hashFork == vBranch.back().GetHash());
+    }
+
+
+    SECTION("Only the most recent heights are kept")
+    {
+        TAO::Ledger::HeaderIndex index(64);
+        for(const auto& state : vChain)
+            index.Insert(state);
+
+        REQUIRE(index.Size() <= 64 + 8);
+        REQUIRE(index.Has(vChain.back().GetHash()));
+        REQUIRE_FALSE(index.Has(vChain[100].GetHash()));
+
+        /* Links into pruned blocks are left for the ledger walk. */
+        const uint32_t nOldest = vChain.size() - index.Size();
+        REQUIRE(index.Has(vChain[nOldest].GetHash()));
+
+        uint1024_t hashLast = 0;
+        for(uint32_t nChannel = 0; nChannel < 3; ++nChannel)
+        {
+            uint1024_t hashWalk = 0;
+            REQUIRE(header_walk(vChain, vChain.size() - 1, nChannel, hashWalk));
+
+            if(index.Last(vChain.back().GetHash(), nChannel, hashLast))
+                REQUIRE(hashLast == hashWalk);
+        }
+
+        std::vector<uint1024_t> vDisconnect;
+        std::vector<uint1024_t> vConnect;
+        uint1024_t hashFork = 0;
+        REQUIRE(index.Fork(vChain.back().GetHash(), vChain[nOldest].GetHash(), vDisconnect, vConnect, hashFork));
+        REQUIRE_FALSE(index.Fork(vChain.back().GetHash(), vChain[100].GetHash(), vDisconnect, vConnect, hashFork));
+    }
+
+
+    SECTION("Erased and disconnected blocks are unlinked")
+    {
+        TAO::Ledger::HeaderIndex index(1000);
+        for(const auto& state : vChain)
+        {
+            index.Insert(state);
+            index.Connect(state.GetHash());
+        }
+
+        /* Disconnect the best block. */
+        uint1024_t hashNext = 0;
+        index.Disconnect(vChain[200].GetHash());
+        REQUIRE_FALSE(index.Next(vChain[199].GetHash(), hashNext));
+
+        /* Erase the last stake block, which every later block links to. */
+        uint1024_t hashStake = 0;
+        REQUIRE(index.Last(vChain[200].GetHash(), 0, hashStake));
+        REQUIRE(hashStake == vChain[197].GetHash());
+
+        index.Erase(hashStake);
+        REQUIRE_FALSE(index.Has(hashStake));
+
+        uint1024_t hashLast = 0;
+        REQUIRE_FALSE(index.Last(vChain[200].GetHash(), 0, hashLast));
+        REQUIRE_FALSE(index.Next(vChain[196].GetHash(), hashNext));
+
+        /* Other channels still hop. */
+        REQUIRE(index.Last(vChain[200].GetHash(), 1, hashLast));
+        REQUIRE(hashLast == vChain[199].GetHash());
+    }
+}
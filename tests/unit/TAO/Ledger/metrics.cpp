@@ -0,0 +1,110 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <TAO/Register/include/create.h>
+#include <TAO/Register/include/enum.h>
+#include <TAO/Register/types/address.h>
+
+#include <TAO/Ledger/types/metrics.h>
+#include <TAO/Ledger/types/state.h>
+#include <TAO/Ledger/types/transaction.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Metrics apply", "[ledger]")
+{
+    /* Build a transaction creating an account and a global name. */
+    TAO::Ledger::Transaction tx;
+    tx.hashGenesis = LLC::GetRand256();
+
+    const TAO::Register::Address hashAccount = TAO::Register::Address(TAO::Register::Address::ACCOUNT);
+    {
+        TAO::Register::Object tAccount = TAO::Register::CreateAccount(0);
+        tx[0] << uint8_t(TAO::Operation::OP::CREATE) << hashAccount << uint8_t(TAO::Register::REGISTER::OBJECT) << tAccount.GetState();
+    }
+
+    const TAO::Register::Address hashName = TAO::Register::Address("metrics", tx.hashGenesis, TAO::Register::Address::NAME);
+    {
+        TAO::Register::Object tName = TAO::Register::CreateName(TAO::Register::NAMESPACE::GLOBAL, "metrics", hashAccount);
+        tx[1] << uint8_t(TAO::Operation::OP::CREATE) << hashName << uint8_t(TAO::Register::REGISTER::OBJECT) << tName.GetState();
+    }
+
+    /* Connecting counts both registers and the name. */
+    TAO::Ledger::Metrics tMetrics;
+    tMetrics.Apply(tx, true);
+
+    REQUIRE(tMetrics.Registers() == 2);
+    REQUIRE(tMetrics.Registers(TAO::Register::Address::ACCOUNT) == 1);
+    REQUIRE(tMetrics.Registers(TAO::Register::Address::NAME) == 1);
+    REQUIRE(tMetrics.Registers(TAO::Register::Address::TOKEN) == 0);
+    REQUIRE(tMetrics.nGlobalNames == 1);
+    REQUIRE(tMetrics.nNamespacedNames == 0);
+
+    /* Disconnecting reverses them. */
+    tMetrics.Apply(tx, false);
+
+    REQUIRE(tMetrics.Registers() == 0);
+    REQUIRE(tMetrics.nGlobalNames == 0);
+}
+
+
+TEST_CASE( "Metrics volume windows", "[ledger]")
+{
+    /* Use heights well above any chain the other tests build. */
+    const uint32_t nStart = 9000000;
+
+    /* Connect a run of blocks fifty seconds apart, with two contracts each. */
+    TAO::Ledger::Aggregator tAggregator;
+    TAO::Ledger::BlockState state;
+    for(uint32_t n = 0; n < 10; ++n)
+    {
+        state = TAO::Ledger::BlockState();
+        state.nHeight = nStart + n;
+        state.nTime   = 1000 + n * 50;
+        state.vtx.push_back(std::make_pair(TAO::Ledger::TRANSACTION::TRITIUM, LLC::GetRand512()));
+
+        TAO::Ledger::Volume tVolume;
+        tVolume.nContracts = 2;
+        tVolume.nMining    = 10;
+
+        tAggregator.Connect(state, tVolume);
+    }
+
+    /* Our records accumulate from the first height. */
+    TAO::Ledger::Volume tRecord;
+    REQUIRE(LLD::Ledger->ReadVolume(nStart + 9, tRecord));
+    REQUIRE(tRecord.nFirst == nStart);
+    REQUIRE(tRecord.nTransactions == 10);
+    REQUIRE(tRecord.nContracts == 20);
+
+    /* Blocks within 200 seconds of the last one are the last four. */
+    TAO::Ledger::Volume tWindow;
+    REQUIRE(tAggregator.Window(state, state.nTime, 200, tWindow));
+    REQUIRE(tWindow.nTransactions == 4);
+    REQUIRE(tWindow.nContracts == 8);
+    REQUIRE(tWindow.nMining == 40);
+
+    /* A window reaching past our first record isn't covered. */
+    REQUIRE_FALSE(tAggregator.Window(state, state.nTime, 1000, tWindow));
+
+    /* Disconnecting the best block erases its record. */
+    tAggregator.Disconnect(state);
+    REQUIRE_FALSE(LLD::Ledger->ReadVolume(nStart + 9, tRecord));
+}
@@ -0,0 +1,145 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/enum.h>
+
+#include <TAO/Ledger/types/header_index.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include "util.h"
+
+
+/* Set the best chain inside one database transaction, the way accepting a block does. */
+static bool reorg_best(const TAO::Ledger::BlockState& state)
+{
+    LLD::TxnBegin();
+    if(!TAO::Ledger::BlockState(state).SetBest())
+    {
+        LLD::TxnAbort();
+        return false;
+    }
+    LLD::TxnCommit();
+
+    return true;
+}
+
+
+/* Check that a chain is linked forward on disk and in the header index. */
+static void reorg_linked(const TAO::Ledger::BlockState& stateFork, const std::vector<TAO::Ledger::BlockState>& vChain)
+{
+    uint1024_t hashPrev = stateFork.GetHash();
+    for(const auto& state : vChain)
+    {
+        TAO::Ledger::BlockState statePrev;
+        REQUIRE(LLD::Ledger->ReadBlock(hashPrev, statePrev));
+        REQUIRE(statePrev.hashNextBlock == state.GetHash());
+
+        uint1024_t hashNext = 0;
+        REQUIRE(TAO::Ledger::headers.Next(hashPrev, hashNext));
+        REQUIRE(hashNext == state.GetHash());
+
+        hashPrev = state.GetHash();
+    }
+}
+
+
+TEST_CASE( "Reorganize synthetic forks", "[ledger]")
+{
+    REQUIRE_FALSE(TAO::Ledger::ChainState::tStateGenesis.IsNull());
+
+    /* Keep the best chain the other tests run on. */
+    const TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+
+    /* Start each fork off a base block well above the best chain. */
+    const TAO::Ledger::BlockState stateBase = BaseState(5000);
+
+    /* Connect a chain of blocks in one batch. */
+    const std::vector<TAO::Ledger::BlockState> vChain = WriteChain(stateBase, 40);
+    REQUIRE(reorg_best(vChain.back()));
+    REQUIRE(TAO::Ledger::ChainState::hashBestChain.load() == vChain.back().GetHash());
+    reorg_linked(stateBase, vChain);
+
+    /* Reorganize onto forks of increasing depth, each one block longer than the chain it replaces. */
+    TAO::Ledger::BlockState stateTip = vChain.back();
+    for(const uint32_t nDepth : { 1, 8, 32 })
+    {
+        /* Find the fork by walking back from our tip. */
+        TAO::Ledger::BlockState stateFork = stateTip;
+        for(uint32_t n = 0; n < nDepth; ++n)
+            stateFork = stateFork.Prev();
+
+        REQUIRE(!stateFork.IsNull());
+
+        /* A fork that fails part way leaves the best chain as it was. */
+        {
+            const std::vector<TAO::Ledger::BlockState> vFailed = WriteChain(stateFork, nDepth);
+
+            /* Replace the last block with one that has a transaction that was never written. */
+            TAO::Ledger::BlockState stateBad = vFailed.back();
+            stateBad.nNonce = LLC::GetRand();
+            stateBad.vtx.push_back(std::make_pair(TAO::Ledger::TRANSACTION::TRITIUM, LLC::GetRand512()));
+
+            REQUIRE(LLD::Ledger->WriteBlock(stateBad.GetHash(), stateBad));
+            TAO::Ledger::headers.Insert(stateBad);
+
+            REQUIRE_FALSE(reorg_best(stateBad));
+
+            REQUIRE(TAO::Ledger::ChainState::hashBestChain.load() == stateTip.GetHash());
+
+            /* Our old best chain is still linked on disk and in the header index. */
+            std::vector<TAO::Ledger::BlockState> vBest;
+            for(TAO::Ledger::BlockState state = stateTip; state != stateFork; state = state.Prev())
+                vBest.insert(vBest.begin(), state);
+
+            reorg_linked(stateFork, vBest);
+        }
+
+        /* A longer fork becomes the best chain. */
+        const std::vector<TAO::Ledger::BlockState> vFork = WriteChain(stateFork, nDepth + 1);
+        REQUIRE(reorg_best(vFork.back()));
+
+        REQUIRE(TAO::Ledger::ChainState::hashBestChain.load() == vFork.back().GetHash());
+        REQUIRE(TAO::Ledger::ChainState::nBestHeight.load() == stateTip.nHeight + 1);
+        reorg_linked(stateFork, vFork);
+
+        stateTip = vFork.back();
+    }
+
+    /* Rewinding to an earlier block disconnects and erases the blocks above it. */
+    {
+        TAO::Ledger::BlockState stateRewind = stateTip.Prev().Prev();
+        const uint1024_t hashTip = stateTip.GetHash();
+
+        REQUIRE(reorg_best(stateRewind));
+        REQUIRE(TAO::Ledger::ChainState::hashBestChain.load() == stateRewind.GetHash());
+        REQUIRE_FALSE(LLD::Ledger->HasBlock(hashTip));
+        REQUIRE_FALSE(TAO::Ledger::headers.Has(hashTip));
+
+        TAO::Ledger::BlockState stateCheck;
+        REQUIRE(LLD::Ledger->ReadBlock(stateRewind.GetHash(), stateCheck));
+        REQUIRE(stateCheck.hashNextBlock == 0);
+    }
+
+    /* Put back the best chain the other tests run on. */
+    TAO::Ledger::ChainState::tStateBest.store(stateBest);
+    TAO::Ledger::ChainState::hashBestChain.store(stateBest.GetHash());
+    TAO::Ledger::ChainState::nBestHeight.store(stateBest.nHeight);
+    REQUIRE(LLD::Ledger->WriteBestChain(stateBest.GetHash()));
+}
@@ -41,6 +41,26 @@ TEST_CASE( "Signature Chain Generation", "[ledger]")
 }
 
 
+TEST_CASE( "Signature Chain Key Cache", "[ledger]")
+{
+    TAO::Ledger::Credentials user = TAO::Ledger::Credentials("user", "password");
+    TAO::Ledger::Credentials check = TAO::Ledger::Credentials("user", "password");
+
+    /* Prepared keys are the keys derived one at a time. */
+    user.Prepare({ "auth", "sign" }, 0, "1234");
+    REQUIRE(user.Generate("auth", 0, "1234") == check.Generate("auth", 0, "1234"));
+    REQUIRE(user.Generate("sign", 0, "1234") == check.Generate("sign", 0, "1234"));
+
+    /* A cached key is only returned for the secret it was derived with. */
+    REQUIRE(user.Generate("auth", 0, "4321") == check.Generate("auth", 0, "4321"));
+    REQUIRE(user.Generate("auth", 0, "4321") != user.Generate("auth", 0, "1234"));
+
+    /* Changing our password drops our cached keys. */
+    user.Update("password2");
+    REQUIRE(user.Generate("auth", 0, "1234") != check.Generate("auth", 0, "1234"));
+}
+
+
 TEST_CASE( "Signature Chain Genesis Transaction checks", "[sigchain]")
 {
     using namespace TAO::Register;
@@ -0,0 +1,224 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Register/include/enum.h>
+
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/state.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+
+#include <TAO/Ledger/types/snapshot.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <Util/include/args.h>
+#include <Util/include/filesystem.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <fstream>
+#include <iomanip>
+
+#include "util.h"
+
+
+/* A database to import snapshot chunks into, with the same buckets as the register database. */
+class SnapshotDB : public LLD::SectorDatabase<LLD::BinaryHashMap, LLD::BinaryLRU>
+{
+public:
+
+    SnapshotDB()
+    : SectorDatabase(std::string("_SNAPSHOT")
+    , LLD::FLAGS::CREATE | LLD::FLAGS::FORCE
+    , LLD::Register->Buckets()
+    , 1024 * 1024)
+    {
+    }
+};
+
+
+/* Read the records of a snapshot chunk. */
+static std::vector<LLD::SectorRecord> snapshot_chunk(const std::string& strPath, const uint32_t nChunk)
+{
+    const std::string strFile = debug::safe_printstr(strPath, "/chunk.", std::setfill('0'), std::setw(5), nChunk);
+
+    std::ifstream stream(strFile, std::ios::in | std::ios::binary);
+    std::vector<uint8_t> vBytes((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+    DataStream ssChunk(vBytes, SER_LLD, LLD::DATABASE_VERSION);
+
+    std::vector<LLD::SectorRecord> vRecords;
+    ssChunk >> vRecords;
+
+    return vRecords;
+}
+
+
+TEST_CASE( "Snapshot export and import", "[ledger]")
+{
+    /* Keep the best chain the other tests run on. */
+    const TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+
+    /* A best block and a fork block that never connected. */
+    const TAO::Ledger::BlockState stateTip = BaseState(9000);
+
+    TAO::Ledger::BlockState stateFork = stateTip;
+    stateFork.nNonce = LLC::GetRand();
+    REQUIRE(LLD::Ledger->WriteBlock(stateFork.GetHash(), stateFork));
+
+    /* A register with a record, an index to it, and a keychain only entry. */
+    const TAO::Register::Address hashRegister = TAO::Register::Address(TAO::Register::Address::RAW);
+    const uint256_t hashGenesis = LLC::GetRand256();
+    {
+        TAO::Register::State state;
+        state.nType  = TAO::Register::REGISTER::RAW;
+        state.hashOwner = hashGenesis;
+        state.SetState(std::vector<uint8_t>(10, 0x03));
+
+        REQUIRE(LLD::Register->WriteState(hashRegister, state));
+        REQUIRE(LLD::Register->IndexTrust(hashGenesis, hashRegister));
+        REQUIRE(LLD::Register->Write(std::make_pair(std::string("snapshot"), hashGenesis)));
+    }
+
+    /* Records each node writes for itself are left out. */
+    REQUIRE(LLD::Ledger->Write(std::make_pair(std::string("undo"), uint32_t(9000)), uint64_t(1)));
+
+    /* Exports of the same state are the same snapshot. */
+    const std::string strPath = config::GetDataDir() + "/snapshot";
+
+    TAO::Ledger::Snapshot snapshot;
+    REQUIRE(snapshot.Export(strPath));
+    REQUIRE(snapshot.nHeight == 9000);
+    REQUIRE(snapshot.hashBlock == stateTip.GetHash());
+    REQUIRE(snapshot.vChunks.size() > 0);
+
+    const uint256_t hashSnapshot = snapshot.GetHash();
+    {
+        TAO::Ledger::Snapshot check;
+        REQUIRE(check.Export(strPath));
+        REQUIRE(check.GetHash() == hashSnapshot);
+    }
+
+    /* The ledger chunks have our best block, but not the fork or local records. */
+    bool fTip = false;
+    for(uint32_t nChunk = 0; nChunk < snapshot.vChunks.size(); ++nChunk)
+    {
+        if(snapshot.vChunks[nChunk].first != LLD::INSTANCES::LEDGER)
+            continue;
+
+        for(const auto& tRecord : snapshot_chunk(strPath, nChunk))
+        {
+            /* No local keys. */
+            DataStream ssLocal(SER_LLD, LLD::DATABASE_VERSION);
+            ssLocal << std::make_pair(std::string("undo"), uint32_t(9000));
+            REQUIRE(tRecord.vKey != ssLocal.Bytes());
+
+            if(tRecord.nState != LLD::SNAPSHOT::DATA)
+                continue;
+
+            DataStream ssData(tRecord.vData, SER_LLD, LLD::DATABASE_VERSION);
+
+            std::string strType;
+            ssData >> strType;
+            if(strType != "block")
+                continue;
+
+            TAO::Ledger::BlockState state;
+            ssData >> state;
+
+            REQUIRE(state.GetHash() != stateFork.GetHash());
+            if(state.GetHash() == stateTip.GetHash())
+                fTip = true;
+        }
+    }
+    REQUIRE(fTip);
+
+    /* Verifying needs the configured hash, and every chunk intact. */
+    {
+        TAO::Ledger::Snapshot check;
+        REQUIRE_FALSE(check.Verify(strPath));
+
+        config::mapArgs["-snapshothash"] = hashSnapshot.GetHex();
+        REQUIRE(check.Verify(strPath));
+
+        /* Corrupt the last byte of the first chunk. */
+        const std::string strChunk = strPath + "/chunk.00000";
+        char nByte = 0;
+        {
+            std::fstream stream(strChunk, std::ios::in | std::ios::out | std::ios::binary);
+            stream.seekg(-1, std::ios::end);
+            stream.read(&nByte, 1);
+            stream.seekp(-1, std::ios::end);
+            stream.put(char(nByte ^ 0xff));
+        }
+        REQUIRE_FALSE(check.Verify(strPath));
+
+        {
+            std::fstream stream(strChunk, std::ios::in | std::ios::out | std::ios::binary);
+            stream.seekp(-1, std::ios::end);
+            stream.put(nByte);
+        }
+        REQUIRE(check.Verify(strPath));
+
+        /* A snapshot can't be imported over a ledger that has a best chain. */
+        REQUIRE(LLD::Ledger->WriteBestChain(stateTip.GetHash()));
+        REQUIRE_FALSE(check.Import(strPath));
+
+        /* Nor over the records of an import that didn't finish. */
+        REQUIRE(LLD::Ledger->Erase(std::string("hashbestchain")));
+        REQUIRE(LLD::Ledger->WriteImport(stateTip.GetHash()));
+        REQUIRE_FALSE(check.Import(strPath));
+
+        uint1024_t hashImport = 0;
+        REQUIRE(LLD::Ledger->ReadImport(hashImport));
+        REQUIRE(hashImport == stateTip.GetHash());
+        REQUIRE(LLD::Ledger->EraseImport());
+
+        config::mapArgs.erase("-snapshothash");
+    }
+
+    /* The register chunks import in bulk into an empty database, readable by their full keys. */
+    {
+        SnapshotDB db;
+
+        std::vector< std::tuple<uint16_t, uint32_t, uint32_t> > vLocations;
+        for(uint32_t nChunk = 0; nChunk < snapshot.vChunks.size(); ++nChunk)
+        {
+            if(snapshot.vChunks[nChunk].first == LLD::INSTANCES::REGISTER)
+                REQUIRE(db.Import(snapshot_chunk(strPath, nChunk), vLocations));
+        }
+
+        TAO::Register::State state;
+        REQUIRE(db.Read(std::make_pair(std::string("state"), uint256_t(hashRegister)), state));
+        REQUIRE(state.hashOwner == hashGenesis);
+        REQUIRE(state.GetState() == std::vector<uint8_t>(10, 0x03));
+
+        TAO::Register::State stateIndex;
+        REQUIRE(db.Read(std::make_pair(std::string("genesis"), hashGenesis), stateIndex));
+        REQUIRE(stateIndex.GetHash() == state.GetHash());
+
+        REQUIRE(db.Exists(std::make_pair(std::string("snapshot"), hashGenesis)));
+    }
+
+    filesystem::remove_directories(strPath);
+
+    /* Put back the best chain the other tests run on. */
+    TAO::Ledger::ChainState::tStateBest.store(stateBest);
+    TAO::Ledger::ChainState::hashBestChain.store(stateBest.GetHash());
+    TAO::Ledger::ChainState::nBestHeight.store(stateBest.nHeight);
+    REQUIRE(LLD::Ledger->WriteBestChain(stateBest.GetHash()));
+}
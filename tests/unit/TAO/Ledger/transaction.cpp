@@ -11,8 +11,16 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLC/include/random.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Operation/include/enum.h>
+
 #include <TAO/Ledger/types/transaction.h>
 
+#include <Util/templates/datastream.h>
+
 #include <unit/catch2/catch.hpp>
 
 //test greater than operator
@@ -39,3 +47,134 @@ TEST_CASE( "Transaction::operator<", "[ledger]" )
     REQUIRE(tx1 < tx2);
     REQUIRE_FALSE(tx2 < tx1);
 }
+
+
+//test the serialized bytes kept by received transactions
+TEST_CASE( "Transaction::Bytes", "[ledger]" )
+{
+    /* Build a transaction with a few contracts and keys. */
+    TAO::Ledger::Transaction tx;
+    tx.nSequence   = 7;
+    tx.hashGenesis = LLC::GetRand256();
+    tx.hashPrevTx  = LLC::GetRand512();
+    tx.hashNext    = LLC::GetRand256();
+    for(uint32_t n = 0; n < 5; ++n)
+        tx[n] << uint8_t(TAO::Operation::OP::DEBIT) << LLC::GetRand256() << LLC::GetRand256() << uint64_t(n) << uint64_t(0);
+
+    tx.vchPubKey = LLC::GetRand512().GetBytes();
+    tx.vchSig    = LLC::GetRand1024().GetBytes();
+
+    const uint512_t hashTx = tx.GetHash();
+
+    DataStream ssTx(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssTx << tx;
+
+    /* Built transactions don't keep their bytes. */
+    REQUIRE(tx.SharedBytes(SER_NETWORK) == 0);
+
+    /* Received transactions keep the bytes they were read from, and hash the same. */
+    TAO::Ledger::Transaction txRecv;
+    ssTx >> txRecv;
+
+    REQUIRE(txRecv.SharedBytes(SER_NETWORK) == ssTx.size());
+    REQUIRE(txRecv.GetHash() == hashTx);
+    REQUIRE(txRecv.SharedBytes(SER_GETHASH) == ::GetSerializeSize(tx, SER_GETHASH, tx.nVersion));
+    REQUIRE(txRecv.SharedBytes(SER_NETWORK | SER_SKIPSIG) == 0);
+    REQUIRE(txRecv.GetHash() == hashTx);
+    REQUIRE(txRecv.ProofHash() == tx.ProofHash());
+
+    /* Serializing writes the kept bytes, matching a full serialization. */
+    DataStream ssRecv(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssRecv << txRecv;
+    REQUIRE(ssRecv.Bytes() == ssTx.Bytes());
+
+    DataStream ssSkip(SER_NETWORK | SER_SKIPSIG, LLP::PROTOCOL_VERSION), ssSkipRecv(SER_NETWORK | SER_SKIPSIG, LLP::PROTOCOL_VERSION);
+    ssSkip << tx;
+    ssSkipRecv << txRecv;
+    REQUIRE(ssSkipRecv.Bytes() == ssSkip.Bytes());
+
+    /* Copies share the bytes. */
+    const TAO::Ledger::Transaction txCopy = txRecv;
+    REQUIRE(txCopy.Bytes().get() == txRecv.Bytes().get());
+    REQUIRE(txCopy.GetHash() == hashTx);
+
+    /* Batch hashing agrees with the kept hash. */
+    std::vector<uint512_t> vHashes;
+    TAO::Ledger::Transaction::GetHashes({ tx, txRecv, txCopy }, vHashes);
+    REQUIRE(vHashes == std::vector<uint512_t>({ hashTx, hashTx, hashTx }));
+
+    /* Changing a contract drops the bytes and hashes the change. */
+    TAO::Ledger::Transaction txChanged = txRecv;
+    txChanged[5] << uint8_t(TAO::Operation::OP::DEBIT) << uint256_t(1) << uint256_t(2) << uint64_t(3) << uint64_t(0);
+    REQUIRE(txChanged.SharedBytes(SER_NETWORK) == 0);
+    REQUIRE(txChanged.GetHash() != hashTx);
+    REQUIRE(txRecv.GetHash() == hashTx);
+
+    /* Reading without the keys keeps nothing. */
+    DataStream ssSkipRead(ssSkip.Bytes(), SER_NETWORK | SER_SKIPSIG, LLP::PROTOCOL_VERSION);
+    TAO::Ledger::Transaction txSkip;
+    ssSkipRead >> txSkip;
+    REQUIRE(txSkip.SharedBytes(SER_NETWORK) == 0);
+    REQUIRE(txSkip.GetHash() == hashTx);
+    REQUIRE(txSkip.SharedBytes(SER_NETWORK) != ssTx.size());
+
+    /* As does changing a field and overriding the cache. */
+    TAO::Ledger::Transaction txField = txRecv;
+    txField.nSequence = 8;
+    REQUIRE(txField.GetHash(true) != hashTx);
+    REQUIRE(txField.SharedBytes(SER_NETWORK) == 0);
+
+    tx.nSequence = 8;
+    REQUIRE(txField.GetHash() == tx.GetHash());
+
+    /* Changing a field without overriding the cache drops the bytes too. */
+    TAO::Ledger::Transaction txDirect = txRecv;
+    REQUIRE(txDirect.GetHash() == hashTx);
+    txDirect.nSequence = 8;
+    REQUIRE(txDirect.GetHash() == tx.GetHash());
+    REQUIRE(txDirect.SharedBytes(SER_NETWORK) == 0);
+
+    /* As does changing a key, which isn't hashed but is relayed. */
+    TAO::Ledger::Transaction txKey = txRecv;
+    REQUIRE(txKey.Bytes()->size() == ssTx.size());
+    txKey.vchSig[0] ^= 0xff;
+
+    DataStream ssKey(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssKey << txKey;
+    REQUIRE(ssKey.Bytes() != ssTx.Bytes());
+    REQUIRE(ssKey.size() == ssTx.size());
+    REQUIRE(txKey.GetHash() == hashTx);
+}
+
+
+//test that a transaction can't be given another txid by encoding its sizes differently
+TEST_CASE( "Transaction malleability", "[ledger]" )
+{
+    TAO::Ledger::Transaction tx;
+    tx.hashGenesis = LLC::GetRand256();
+    tx[0] << uint8_t(TAO::Operation::OP::DEBIT) << LLC::GetRand256() << LLC::GetRand256() << uint64_t(1) << uint64_t(0);
+    tx.vchPubKey = LLC::GetRand512().GetBytes();
+    tx.vchSig    = LLC::GetRand1024().GetBytes();
+
+    DataStream ssTx(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssTx << tx;
+
+    /* Encode the contract count of one as a three byte size. */
+    REQUIRE(ssTx.Bytes()[0] == 0x01);
+    std::vector<uint8_t> vMalleated = { 0xfd, 0x01, 0x00 };
+    vMalleated.insert(vMalleated.end(), ssTx.Bytes().begin() + 1, ssTx.Bytes().end());
+
+    DataStream ssMalleated(vMalleated, SER_NETWORK, LLP::PROTOCOL_VERSION);
+
+    TAO::Ledger::Transaction txMalleated;
+    ssMalleated >> txMalleated;
+
+    /* It doesn't keep the bytes it was read from, and hashes and relays as the canonical encoding. */
+    REQUIRE(txMalleated.SharedBytes(SER_NETWORK) == 0);
+    REQUIRE(txMalleated.GetHash() == tx.GetHash());
+    REQUIRE(*txMalleated.Bytes() == ssTx.Bytes());
+
+    DataStream ssRelay(SER_NETWORK, LLP::PROTOCOL_VERSION);
+    ssRelay << txMalleated;
+    REQUIRE(ssRelay.Bytes() == ssTx.Bytes());
+}
@@ -0,0 +1,201 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Register/include/enum.h>
+
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/state.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/enum.h>
+
+#include <TAO/Ledger/types/header_index.h>
+#include <TAO/Ledger/types/state.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <thread>
+
+#include "util.h"
+
+
+TEST_CASE( "Undo journal pre-images", "[ledger]")
+{
+    /* Use keys no other test writes. */
+    const uint256_t hashKeys = LLC::GetRand256();
+    const auto key = [&hashKeys](const uint32_t n) { return std::make_pair(hashKeys, n); };
+
+    /* Keys with a record, in the keychain only, and one to be erased. */
+    REQUIRE(LLD::Ledger->Write(key(1), uint64_t(1)));
+    REQUIRE(LLD::Ledger->Write(key(2)));
+    REQUIRE(LLD::Ledger->Write(key(3), uint64_t(3)));
+
+    /* Modify them in a transaction while capturing. */
+    std::map<uint16_t, LLD::SectorUndo> mapUndo;
+    {
+        LLD::TxnBegin(0, LLD::INSTANCES::LEDGER);
+        LLD::UndoBegin(LLD::INSTANCES::LEDGER);
+
+        REQUIRE(LLD::Ledger->Write(key(1), uint64_t(10)));
+        REQUIRE(LLD::Ledger->Write(key(1), uint64_t(11)));
+        REQUIRE(LLD::Ledger->Erase(key(2)));
+        REQUIRE(LLD::Ledger->Erase(key(3)));
+        REQUIRE(LLD::Ledger->Write(key(4), uint64_t(4)));
+        REQUIRE(LLD::Ledger->Write(key(5)));
+        REQUIRE(LLD::Ledger->Index(key(6), key(4)));
+
+        /* Another thread writing into the same transaction isn't captured. */
+        std::thread([&key]() { LLD::Ledger->Write(key(7), uint64_t(7)); }).join();
+
+        REQUIRE(LLD::UndoEnd(mapUndo, LLD::INSTANCES::LEDGER));
+        LLD::TxnCommit(0, LLD::INSTANCES::LEDGER);
+    }
+
+    /* Each key is captured once, in the order first touched. */
+    REQUIRE(mapUndo.size() == 1);
+    const LLD::SectorUndo& undo = mapUndo[LLD::INSTANCES::LEDGER];
+    REQUIRE(undo.vPreimages.size() == 6);
+    REQUIRE(undo.vPreimages[0].nState == LLD::PREIMAGE::DATA);
+    REQUIRE(undo.vPreimages[1].nState == LLD::PREIMAGE::KEY);
+    REQUIRE(undo.vPreimages[2].nState == LLD::PREIMAGE::DATA);
+    REQUIRE(undo.vPreimages[3].nState == LLD::PREIMAGE::MISSING);
+    REQUIRE(undo.vPreimages[4].nState == LLD::PREIMAGE::MISSING);
+    REQUIRE(undo.vPreimages[5].nState == LLD::PREIMAGE::MISSING);
+
+    uint64_t nValue = 0;
+    REQUIRE(LLD::Ledger->Read(key(1), nValue));
+    REQUIRE(nValue == 11);
+    REQUIRE(LLD::Ledger->Read(key(6), nValue));
+    REQUIRE(nValue == 4);
+
+    /* The journal round trips through the ledger. */
+    const uint1024_t hashBlock = LLC::GetRand1024();
+    REQUIRE(LLD::Ledger->WriteUndo(8000000, hashBlock, mapUndo));
+
+    uint1024_t hashCheck = 0;
+    std::map<uint16_t, LLD::SectorUndo> mapCheck;
+    REQUIRE(LLD::Ledger->ReadUndo(8000000, hashCheck, mapCheck));
+    REQUIRE(hashCheck == hashBlock);
+    REQUIRE(mapCheck[LLD::INSTANCES::LEDGER].vPreimages.size() == 6);
+    REQUIRE(LLD::Ledger->EraseUndo(8000000));
+
+    /* Applying the journal puts every key back. */
+    LLD::TxnBegin(0, LLD::INSTANCES::LEDGER);
+    REQUIRE(LLD::UndoApply(mapCheck));
+    LLD::TxnCommit(0, LLD::INSTANCES::LEDGER);
+
+    REQUIRE(LLD::Ledger->Read(key(1), nValue));
+    REQUIRE(nValue == 1);
+    REQUIRE(LLD::Ledger->Exists(key(2)));
+    REQUIRE(LLD::Ledger->Read(key(3), nValue));
+    REQUIRE(nValue == 3);
+    REQUIRE_FALSE(LLD::Ledger->Exists(key(4)));
+    REQUIRE_FALSE(LLD::Ledger->Exists(key(5)));
+    REQUIRE_FALSE(LLD::Ledger->Exists(key(6)));
+    REQUIRE(LLD::Ledger->Read(key(7), nValue));
+
+    /* Indexing a key that existed can't be put back, so the journal is incomplete. */
+    {
+        LLD::TxnBegin(0, LLD::INSTANCES::LEDGER);
+        LLD::UndoBegin(LLD::INSTANCES::LEDGER);
+
+        REQUIRE(LLD::Ledger->Index(key(1), key(3)));
+
+        std::map<uint16_t, LLD::SectorUndo> mapIncomplete;
+        REQUIRE_FALSE(LLD::UndoEnd(mapIncomplete, LLD::INSTANCES::LEDGER));
+        LLD::TxnAbort(0, LLD::INSTANCES::LEDGER);
+    }
+}
+
+
+TEST_CASE( "Undo journal disconnects blocks", "[ledger]")
+{
+    /* Keep the best chain the other tests run on. */
+    const TAO::Ledger::BlockState stateBest = TAO::Ledger::ChainState::tStateBest.load();
+
+    /* A register the block will modify. */
+    const TAO::Register::Address hashRegister = TAO::Register::Address(TAO::Register::Address::RAW);
+    {
+        TAO::Register::State state;
+        state.nType  = TAO::Register::REGISTER::RAW;
+        state.hashOwner = LLC::GetRand256();
+        state.SetState(std::vector<uint8_t>(10, 0x01));
+
+        REQUIRE(LLD::Register->WriteState(hashRegister, state));
+    }
+
+    /* Start off a base block well above the best chain. */
+    const TAO::Ledger::BlockState stateBase = BaseState(7000);
+
+    /* Connecting a block keeps its journal by height, pruning beyond our depth. */
+    config::mapArgs["-undoheights"] = "2";
+
+    const std::vector<TAO::Ledger::BlockState> vChain = WriteChain(stateBase, 4);
+
+    LLD::TxnBegin();
+    REQUIRE(TAO::Ledger::BlockState(vChain.back()).SetBest());
+    LLD::TxnCommit();
+
+    uint1024_t hashUndo = 0;
+    std::map<uint16_t, LLD::SectorUndo> mapUndo;
+    REQUIRE(LLD::Ledger->ReadUndo(7004, hashUndo, mapUndo));
+    REQUIRE(hashUndo == vChain[3].GetHash());
+    REQUIRE(LLD::Ledger->ReadUndo(7003, hashUndo, mapUndo));
+    REQUIRE_FALSE(LLD::Ledger->ReadUndo(7002, hashUndo, mapUndo));
+
+    config::mapArgs.erase("-undoheights");
+
+    /* Modify our register as the tip's transactions would, keeping the journal for the tip. */
+    TAO::Ledger::BlockState stateTip = vChain.back();
+    {
+        LLD::TxnBegin();
+        LLD::UndoBegin();
+
+        TAO::Register::State state;
+        REQUIRE(LLD::Register->ReadState(hashRegister, state));
+        state.SetState(std::vector<uint8_t>(10, 0x02));
+        REQUIRE(LLD::Register->WriteState(hashRegister, state));
+
+        mapUndo.clear();
+        REQUIRE(LLD::UndoEnd(mapUndo));
+        REQUIRE(LLD::Ledger->WriteUndo(stateTip.nHeight, stateTip.GetHash(), mapUndo));
+
+        LLD::TxnCommit();
+
+        /* A memory state over the tip, as the mempool would write. */
+        state.SetState(std::vector<uint8_t>(10, 0x03));
+        REQUIRE(LLD::Register->WriteState(hashRegister, state, TAO::Ledger::FLAGS::MEMPOOL));
+    }
+
+    /* Disconnecting the tip puts the register back, erases its memory state, and erases the journal. */
+    LLD::TxnBegin();
+    REQUIRE(stateTip.Disconnect());
+    LLD::TxnCommit();
+
+    TAO::Register::State state;
+    REQUIRE(LLD::Register->ReadState(hashRegister, state));
+    REQUIRE(state.GetState() == std::vector<uint8_t>(10, 0x01));
+    REQUIRE(LLD::Register->ReadState(hashRegister, state, TAO::Ledger::FLAGS::MEMPOOL));
+    REQUIRE(state.GetState() == std::vector<uint8_t>(10, 0x01));
+    REQUIRE_FALSE(LLD::Ledger->ReadUndo(stateTip.nHeight, hashUndo, mapUndo));
+
+    /* Put back the best chain the other tests run on. */
+    TAO::Ledger::ChainState::tStateBest.store(stateBest);
+    TAO::Ledger::ChainState::hashBestChain.store(stateBest.GetHash());
+    TAO::Ledger::ChainState::nBestHeight.store(stateBest.nHeight);
+    REQUIRE(LLD::Ledger->WriteBestChain(stateBest.GetHash()));
+}
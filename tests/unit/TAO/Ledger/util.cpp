@@ -0,0 +1,79 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+
+#include <TAO/Ledger/types/header_index.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include "util.h"
+
+
+/* Build an empty block state following another on a given channel. */
+TAO::Ledger::BlockState NextState(const TAO::Ledger::BlockState& statePrev, const uint32_t nChannel)
+{
+    TAO::Ledger::BlockState state;
+    state.nVersion      = 7;
+    state.hashPrevBlock = statePrev.GetHash();
+    state.nHeight       = statePrev.nHeight + 1;
+    state.nChannel      = nChannel;
+    state.nBits         = 0x7b000000;
+    state.nNonce        = LLC::GetRand();
+    state.nTime         = statePrev.nTime + 50;
+    state.nChainTrust   = statePrev.nChainTrust + 1;
+
+    return state;
+}
+
+
+/* Write an empty block state with no previous block at a height above the best chain, and make it our best. */
+TAO::Ledger::BlockState BaseState(const uint32_t nHeight)
+{
+    TAO::Ledger::BlockState state;
+    state.nVersion = 7;
+    state.nHeight  = nHeight;
+    state.nChannel = 1;
+    state.nBits    = 0x7b000000;
+    state.nNonce   = LLC::GetRand();
+    state.nTime    = 1600000000;
+
+    REQUIRE(LLD::Ledger->WriteBlock(state.GetHash(), state));
+    TAO::Ledger::headers.Insert(state);
+
+    TAO::Ledger::ChainState::tStateBest.store(state);
+    TAO::Ledger::ChainState::hashBestChain.store(state.GetHash());
+    TAO::Ledger::ChainState::nBestHeight.store(state.nHeight);
+
+    return state;
+}
+
+
+/* Write a chain of empty block states off another to the ledger, indexing their headers. */
+std::vector<TAO::Ledger::BlockState> WriteChain(const TAO::Ledger::BlockState& stateStart, const uint32_t nBlocks)
+{
+    std::vector<TAO::Ledger::BlockState> vChain;
+    for(uint32_t n = 0; n < nBlocks; ++n)
+    {
+        vChain.push_back(NextState(vChain.empty() ? stateStart : vChain.back(), 1 + (n % 2)));
+
+        REQUIRE(LLD::Ledger->WriteBlock(vChain.back().GetHash(), vChain.back()));
+        TAO::Ledger::headers.Insert(vChain.back());
+    }
+
+    return vChain;
+}
@@ -0,0 +1,44 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+
+#include <TAO/Ledger/types/state.h>
+
+#include <vector>
+
+
+/** NextState
+ *
+ *  Build an empty block state following another on a given channel, for use in unit tests.
+ *
+ **/
+TAO::Ledger::BlockState NextState(const TAO::Ledger::BlockState& statePrev, const uint32_t nChannel);
+
+
+/** BaseState
+ *
+ *  Write an empty block state with no previous block at a height above the best chain, and make it our best, for
+ *  building chains off in unit tests.
+ *
+ **/
+TAO::Ledger::BlockState BaseState(const uint32_t nHeight);
+
+
+/** WriteChain
+ *
+ *  Write a chain of empty block states off another to the ledger, alternating the proof of work channels and indexing
+ *  their headers as accepting them would.
+ *
+ **/
+std::vector<TAO::Ledger::BlockState> WriteChain(const TAO::Ledger::BlockState& stateStart, const uint32_t nBlocks);
@@ -0,0 +1,68 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/templates/rankedset.h>
+#include <unit/catch2/catch.hpp>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+TEST_CASE("Util rankedset tests", "[rankedset]")
+{
+    rankedset<uint32_t, std::greater<uint32_t>> set;
+    REQUIRE(set.empty());
+    REQUIRE_THROWS(set.at(0));
+
+    //duplicates are rejected
+    REQUIRE(set.insert(5));
+    REQUIRE_FALSE(set.insert(5));
+    REQUIRE(set.size() == 1);
+    REQUIRE(set.at(0) == 5);
+
+    //random inserts and erases stay in order against a sorted vector
+    std::mt19937 rng(42);
+    std::vector<uint32_t> vSorted = { 5 };
+    for(uint32_t n = 0; n < 20000; ++n)
+    {
+        const uint32_t nValue = rng() % 5000;
+        auto it = std::lower_bound(vSorted.begin(), vSorted.end(), nValue, std::greater<uint32_t>());
+        const bool fHas = (it != vSorted.end() && *it == nValue);
+
+        if(rng() % 3 == 0)
+        {
+            REQUIRE(set.erase(nValue) == fHas);
+            if(fHas)
+                vSorted.erase(it);
+        }
+        else
+        {
+            REQUIRE(set.insert(nValue) == !fHas);
+            if(!fHas)
+                vSorted.insert(it, nValue);
+        }
+    }
+
+    //positions match the sorted order
+    REQUIRE(set.size() == vSorted.size());
+    for(uint32_t n = 0; n < vSorted.size(); ++n)
+        REQUIRE(set.at(n) == vSorted[n]);
+    REQUIRE_THROWS(set.at(vSorted.size()));
+
+    REQUIRE(set.count(vSorted.front()) == 1);
+    REQUIRE_FALSE(set.erase(5001));
+
+    set.clear();
+    REQUIRE(set.empty());
+    REQUIRE(set.size() == 0);
+}
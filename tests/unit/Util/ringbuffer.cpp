@@ -0,0 +1,69 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/templates/ringbuffer.h>
+#include <unit/catch2/catch.hpp>
+
+#include <string>
+#include <thread>
+
+TEST_CASE("Util ringbuffer tests", "[ringbuffer]")
+{
+    //capacity rounds up to a power of two
+    ringbuffer<std::string> buffer(5);
+    REQUIRE(buffer.capacity() == 8);
+    REQUIRE(buffer.empty());
+
+    //pushes fail once full
+    for(uint32_t n = 0; n < 8; ++n)
+        REQUIRE(buffer.push(std::to_string(n)));
+    REQUIRE_FALSE(buffer.push("full"));
+    REQUIRE(buffer.size() == 8);
+
+    //values come out in order
+    std::string strValue;
+    for(uint32_t n = 0; n < 8; ++n)
+    {
+        REQUIRE(buffer.pop(strValue));
+        REQUIRE(strValue == std::to_string(n));
+    }
+    REQUIRE_FALSE(buffer.pop(strValue));
+    REQUIRE(buffer.empty());
+
+    //one producer and one consumer keep the order across wraps
+    ringbuffer<uint64_t> queue(64);
+    const uint64_t nTotal = 100000;
+
+    std::thread producer([&queue, nTotal]()
+    {
+        for(uint64_t n = 0; n < nTotal; )
+        {
+            uint64_t nValue = n;
+            if(queue.push(std::move(nValue)))
+                ++n;
+        }
+    });
+
+    uint64_t nNext = 0, nValue = 0;
+    while(nNext < nTotal)
+    {
+        if(queue.pop(nValue))
+        {
+            REQUIRE(nValue == nNext);
+            ++nNext;
+        }
+    }
+
+    producer.join();
+    REQUIRE(queue.empty());
+}
@@ -0,0 +1,54 @@
+/*__________________________________________________________________________________________
+
+            Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014]++
+
+            (c) Copyright The Nexus Developers 2014 - 2023
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/templates/rollingfilter.h>
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE("Util rollingfilter tests", "[rollingfilter]")
+{
+    rollingfilter filter(1000);
+
+    //added keys are always found
+    for(uint64_t n = 0; n < 1000; ++n)
+        filter.insert(n);
+    for(uint64_t n = 0; n < 1000; ++n)
+        REQUIRE(filter.contains(n));
+
+    //keys never added are rarely found
+    uint32_t nFalse = 0;
+    for(uint64_t n = 1000000; n < 1100000; ++n)
+        nFalse += filter.contains(n) ? 1 : 0;
+    REQUIRE(nFalse < 100);
+
+    //the most recent keys are still found after many more are added
+    for(uint64_t n = 1000; n < 10000; ++n)
+        filter.insert(n);
+    for(uint64_t n = 9000; n < 10000; ++n)
+        REQUIRE(filter.contains(n));
+
+    //old keys have rolled out
+    uint32_t nOld = 0;
+    for(uint64_t n = 0; n < 1000; ++n)
+        nOld += filter.contains(n) ? 1 : 0;
+    REQUIRE(nOld < 10);
+
+    //memory stays fixed
+    const uint64_t nBytes = filter.bytes();
+    for(uint64_t n = 10000; n < 20000; ++n)
+        filter.insert(n);
+    REQUIRE(filter.bytes() == nBytes);
+
+    //clear removes everything
+    filter.clear();
+    REQUIRE_FALSE(filter.contains(19999));
+}